@@ -0,0 +1,209 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	template<class T>
+	static std::vector<T> make_byteswap_bench(size_t bytes) {
+		std::vector<T> res(bytes / sizeof(T));
+			for (size_t i = 0; i != res.size(); ++i) { res[i] = static_cast<T>(i * 0x9E37'79B9'7F4A'7C15ull); }
+		return res;
+	}
+
+	// byteswap(value) once per element, the loop the compiler sees without the bulk kernel
+	template<class T>
+	static void BM_ByteswapScalar(benchmark::State& state) {
+		const std::vector<T> src = make_byteswap_bench<T>(static_cast<size_t>(state.range(0)));
+		std::vector<T> dst(src.size());
+			for (auto _ : state) {
+					for (size_t i = 0; i != src.size(); ++i) { dst[i] = byteswap(src[i]); }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+
+	template<class T>
+	static void BM_Byteswap(benchmark::State& state) {
+		const std::vector<T> src = make_byteswap_bench<T>(static_cast<size_t>(state.range(0)));
+		std::vector<T> dst(src.size());
+			for (auto _ : state) {
+				byteswap(src.data(), dst.data(), src.size());
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+
+	template<class T>
+	static void BM_ByteswapInPlace(benchmark::State& state) {
+		std::vector<T> data = make_byteswap_bench<T>(static_cast<size_t>(state.range(0)));
+			for (auto _ : state) {
+				byteswap(data.data(), data.size());
+				benchmark::DoNotOptimize(data.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetBytesProcessed(state.iterations() * state.range(0));
+	}
+
+		// L1, L2 and main memory sized buffers
+		#define _MSTD_BYTESWAP_BENCHMARKS(name, type) BENCHMARK_TEMPLATE(name, type)->RangeMultiplier(64)->Range(4 << 10, 16 << 20);
+
+	_MSTD_BYTESWAP_BENCHMARKS(BM_ByteswapScalar, uint16_t)
+	_MSTD_BYTESWAP_BENCHMARKS(BM_Byteswap, uint16_t)
+	_MSTD_BYTESWAP_BENCHMARKS(BM_ByteswapScalar, uint32_t)
+	_MSTD_BYTESWAP_BENCHMARKS(BM_Byteswap, uint32_t)
+	_MSTD_BYTESWAP_BENCHMARKS(BM_ByteswapInPlace, uint32_t)
+	_MSTD_BYTESWAP_BENCHMARKS(BM_ByteswapScalar, uint64_t)
+	_MSTD_BYTESWAP_BENCHMARKS(BM_Byteswap, uint64_t)
+	_MSTD_BYTESWAP_BENCHMARKS(BM_ByteswapScalar, double)
+	_MSTD_BYTESWAP_BENCHMARKS(BM_Byteswap, double)
+
+		#undef _MSTD_BYTESWAP_BENCHMARKS
+
+	static constexpr size_t bit_bench_count = 4096;
+
+	static std::vector<uint64_t> make_bit_bench_values() {
+		std::vector<uint64_t> res(bit_bench_count);
+		uint64_t x = 0x9E37'79B9'7F4A'7C15ull;
+			for (uint64_t& value : res) {
+				x ^= x << 13;
+				x ^= x >> 7;
+				x ^= x << 17;
+				value = x;
+			}
+		return res;
+	}
+
+	// Func maps every value to a 64 bit result, items/s of the whole buffer
+	template<class Func>
+	static void run_bit_values(benchmark::State& state, const Func& func) {
+		const std::vector<uint64_t> src = make_bit_bench_values();
+		std::vector<uint64_t> dst(bit_bench_count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != bit_bench_count; ++i) { dst[i] = func(src[i]); }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(bit_bench_count));
+	}
+
+	// the popcount instruction when the target has it, the SWAR count otherwise
+	static void BM_Popcount(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return static_cast<uint64_t>(popcount(value)); });
+	}
+
+	static void BM_PopcountFallback(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return static_cast<uint64_t>(utils::popcount_fallback(value)); });
+	}
+
+	static void BM_PopcountSpan(benchmark::State& state) {
+		const std::vector<uint64_t> src = make_bit_bench_values();
+		size_t total					= 0;
+			for (auto _ : state) {
+				total = popcount(src.data(), src.size());
+				benchmark::DoNotOptimize(total);
+			}
+		state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bit_bench_count * sizeof(uint64_t)));
+	}
+
+	static void BM_PopcountSpanScalar(benchmark::State& state) {
+		const std::vector<uint64_t> src = make_bit_bench_values();
+		size_t total					= 0;
+			for (auto _ : state) {
+				total = 0;
+					for (const uint64_t value : src) { total += static_cast<size_t>(popcount(value)); }
+				benchmark::DoNotOptimize(total);
+			}
+		state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bit_bench_count * sizeof(uint64_t)));
+	}
+
+	static void BM_CountlZero(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return static_cast<uint64_t>(countl_zero(value)); });
+	}
+
+	static void BM_CountlZeroFallback(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return static_cast<uint64_t>(utils::countl_zero_fallback(value)); });
+	}
+
+	static void BM_BitReverse(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return bit_reverse(value); });
+	}
+
+	// pdep/pext through BMI2 when compiled in, the bit by bit loop otherwise
+	static void BM_Pdep(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return pdep(value, 0x5555'5555'5555'5555ull); });
+	}
+
+	static void BM_PdepFallback(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return utils::pdep_fallback(value, 0x5555'5555'5555'5555ull); });
+	}
+
+	static void BM_Pext(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return pext(value, 0x5555'5555'5555'5555ull); });
+	}
+
+	static void BM_PextFallback(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) { return utils::pext_fallback(value, 0x5555'5555'5555'5555ull); });
+	}
+
+	// morton_encode picks pdep under BMI2, the magic bits spread is the portable path
+	static void BM_MortonEncode2(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) {
+			return morton_encode(vec<2, uint32_t>(static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32)));
+		});
+	}
+
+	static void BM_MortonEncode2MagicBits(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) {
+			return utils::morton_spread2(static_cast<uint32_t>(value))
+				   | (utils::morton_spread2(static_cast<uint32_t>(value >> 32)) << 1);
+		});
+	}
+
+	static void BM_MortonEncode3(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) {
+			return morton_encode(vec<3, uint32_t>(static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 21),
+			  static_cast<uint32_t>(value >> 42)));
+		});
+	}
+
+	static void BM_MortonEncode3MagicBits(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) {
+			return utils::morton_spread3(static_cast<uint32_t>(value))
+				   | (utils::morton_spread3(static_cast<uint32_t>(value >> 21)) << 1)
+				   | (utils::morton_spread3(static_cast<uint32_t>(value >> 42)) << 2);
+		});
+	}
+
+	static void BM_MortonDecode3(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) {
+			const vec<3, uint32_t> pos = morton_decode<3>(value);
+			return static_cast<uint64_t>(pos[0] ^ pos[1] ^ pos[2]);
+		});
+	}
+
+	static void BM_MortonDecode3MagicBits(benchmark::State& state) {
+		run_bit_values(state, [](uint64_t value) {
+			return static_cast<uint64_t>(utils::morton_compact3(value) ^ utils::morton_compact3(value >> 1)
+										 ^ utils::morton_compact3(value >> 2));
+		});
+	}
+
+	BENCHMARK(BM_Popcount);
+	BENCHMARK(BM_PopcountFallback);
+	BENCHMARK(BM_PopcountSpan);
+	BENCHMARK(BM_PopcountSpanScalar);
+	BENCHMARK(BM_CountlZero);
+	BENCHMARK(BM_CountlZeroFallback);
+	BENCHMARK(BM_BitReverse);
+	BENCHMARK(BM_Pdep);
+	BENCHMARK(BM_PdepFallback);
+	BENCHMARK(BM_Pext);
+	BENCHMARK(BM_PextFallback);
+	BENCHMARK(BM_MortonEncode2);
+	BENCHMARK(BM_MortonEncode2MagicBits);
+	BENCHMARK(BM_MortonEncode3);
+	BENCHMARK(BM_MortonEncode3MagicBits);
+	BENCHMARK(BM_MortonDecode3);
+	BENCHMARK(BM_MortonDecode3MagicBits);
+} // namespace mstd::benchmarks
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	static dmat<float> make_dmat_bench(size_t size, size_t seed) {
+		dmat<float> res(size, size);
+			for (size_t x = 0; x != size; ++x) {
+					for (size_t y = 0; y != size; ++y) {
+						res[x][y] = static_cast<float>((x * 7 + y * 3 + seed) % 11) * 0.25f - 1.f;
+					}
+			}
+		return res;
+	}
+
+	static void set_gemm_counters(benchmark::State& state, size_t size) {
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size * size));
+	}
+
+	// textbook i-j-k loop over the column major storage
+	static void BM_DMatMulNaive(benchmark::State& state) {
+		const size_t size	= static_cast<size_t>(state.range(0));
+		const dmat<float> a = make_dmat_bench(size, 1);
+		const dmat<float> b = make_dmat_bench(size, 2);
+		dmat<float> res(size, size);
+			for (auto _ : state) {
+					for (size_t x = 0; x != size; ++x) {
+							for (size_t y = 0; y != size; ++y) {
+								float sum = 0.f;
+									for (size_t k = 0; k != size; ++k) { sum += a[k][y] * b[x][k]; }
+								res[x][y] = sum;
+							}
+					}
+				benchmark::DoNotOptimize(res.data());
+				benchmark::ClobberMemory();
+			}
+		set_gemm_counters(state, size);
+	}
+
+	static void BM_DMatMul(benchmark::State& state) {
+		const size_t size	= static_cast<size_t>(state.range(0));
+		const dmat<float> a = make_dmat_bench(size, 1);
+		const dmat<float> b = make_dmat_bench(size, 2);
+		dmat<float> res(size, size);
+			for (auto _ : state) {
+				gemm<float>(a, b, res);
+				benchmark::DoNotOptimize(res.data());
+				benchmark::ClobberMemory();
+			}
+		set_gemm_counters(state, size);
+	}
+
+	static void BM_DMatMulThreaded(benchmark::State& state) {
+		const size_t size	= static_cast<size_t>(state.range(0));
+		const dmat<float> a = make_dmat_bench(size, 1);
+		const dmat<float> b = make_dmat_bench(size, 2);
+		dmat<float> res(size, size);
+			for (auto _ : state) {
+				gemm<float>(a, b, res, 0);
+				benchmark::DoNotOptimize(res.data());
+				benchmark::ClobberMemory();
+			}
+		set_gemm_counters(state, size);
+	}
+
+	static void BM_DMatInverse(benchmark::State& state) {
+		const size_t size	= static_cast<size_t>(state.range(0));
+		const dmat<float> a = make_dmat_bench(size, 1) + dmat<float>::fill_identity(size, static_cast<float>(size));
+			for (auto _ : state) {
+				dmat<float> res = a.inverted();
+				benchmark::DoNotOptimize(res.data());
+				benchmark::ClobberMemory();
+			}
+		set_gemm_counters(state, size);
+	}
+
+		#define _MSTD_DMAT_BENCHMARKS(name) BENCHMARK(name)->RangeMultiplier(2)->Range(64, 512);
+
+	_MSTD_DMAT_BENCHMARKS(BM_DMatMulNaive)
+	_MSTD_DMAT_BENCHMARKS(BM_DMatMul)
+	_MSTD_DMAT_BENCHMARKS(BM_DMatMulThreaded)
+	_MSTD_DMAT_BENCHMARKS(BM_DMatInverse)
+
+		#undef _MSTD_DMAT_BENCHMARKS
+} // namespace mstd::benchmarks
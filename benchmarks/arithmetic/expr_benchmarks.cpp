@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	template<size_t N>
+	static vec<N, float> make_expr_vec(float seed) {
+		vec<N, float> res;
+			for (size_t i = 0; i != N; ++i) { res[i] = seed + static_cast<float>(i) * 0.25f; }
+		return res;
+	}
+
+	template<size_t N>
+	static mat<N, N, float> make_expr_mat(float seed) {
+		mat<N, N, float> res;
+			for (size_t x = 0; x != N; ++x) {
+					for (size_t y = 0; y != N; ++y) { res[x][y] = seed + static_cast<float>(x * N + y) * 0.25f; }
+			}
+		return res;
+	}
+
+	// a * s + b - c * t with a temporary per operator
+	template<size_t N>
+	static void BM_VecExprEager(benchmark::State& state) {
+		auto a		  = make_expr_vec<N>(1.f);
+		const auto b  = make_expr_vec<N>(2.f);
+		const auto c  = make_expr_vec<N>(3.f);
+		const float s = 1.5f;
+		const float t = 0.5f;
+		vec<N, float> res;
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(a);
+				res = a * s + b - c * t;
+				benchmark::DoNotOptimize(res);
+			}
+	}
+
+	template<size_t N>
+	static void BM_VecExprLazy(benchmark::State& state) {
+		auto a		  = make_expr_vec<N>(1.f);
+		const auto b  = make_expr_vec<N>(2.f);
+		const auto c  = make_expr_vec<N>(3.f);
+		const float s = 1.5f;
+		const float t = 0.5f;
+		vec<N, float> res;
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(a);
+				res = lazy(a) * s + b - lazy(c) * t;
+				benchmark::DoNotOptimize(res);
+			}
+	}
+
+	template<size_t N>
+	static void BM_MatExprEager(benchmark::State& state) {
+		auto a		  = make_expr_mat<N>(1.f);
+		const auto b  = make_expr_mat<N>(2.f);
+		const auto c  = make_expr_mat<N>(3.f);
+		const float s = 1.5f;
+		const float t = 0.5f;
+		mat<N, N, float> res;
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(a);
+				res = a * s + b - c * t;
+				benchmark::DoNotOptimize(res);
+			}
+	}
+
+	template<size_t N>
+	static void BM_MatExprLazy(benchmark::State& state) {
+		auto a		  = make_expr_mat<N>(1.f);
+		const auto b  = make_expr_mat<N>(2.f);
+		const auto c  = make_expr_mat<N>(3.f);
+		const float s = 1.5f;
+		const float t = 0.5f;
+		mat<N, N, float> res;
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(a);
+				res = lazy(a) * s + b - lazy(c) * t;
+				benchmark::DoNotOptimize(res);
+			}
+	}
+
+	BENCHMARK_TEMPLATE(BM_VecExprEager, 4);
+	BENCHMARK_TEMPLATE(BM_VecExprLazy, 4);
+	BENCHMARK_TEMPLATE(BM_VecExprEager, 64);
+	BENCHMARK_TEMPLATE(BM_VecExprLazy, 64);
+	BENCHMARK_TEMPLATE(BM_VecExprEager, 1024);
+	BENCHMARK_TEMPLATE(BM_VecExprLazy, 1024);
+	BENCHMARK_TEMPLATE(BM_MatExprEager, 4);
+	BENCHMARK_TEMPLATE(BM_MatExprLazy, 4);
+	BENCHMARK_TEMPLATE(BM_MatExprEager, 32);
+	BENCHMARK_TEMPLATE(BM_MatExprLazy, 32);
+} // namespace mstd::benchmarks
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	static constexpr size_t fixed_bench_count = 4096;
+
+	using sfixed16_16 = fixed<16, 16, int32_t, fixed_overflow::saturate>;
+
+	// the same pseudo random values in [-10, 10) for every type
+	template<class T>
+	static std::vector<T> make_fixed_bench_values(uint32_t seed) {
+		std::mt19937 gen(seed);
+		std::uniform_real_distribution<double> dist(-10.0, 10.0);
+
+		std::vector<T> res(fixed_bench_count);
+			for (T& value : res) { value = static_cast<T>(dist(gen)); }
+		return res;
+	}
+
+	template<size_t N, class T>
+	static std::vector<vec<N, T> > make_fixed_bench_vecs(uint32_t seed) {
+		const std::vector<T> values = make_fixed_bench_values<T>(seed);
+		std::vector<vec<N, T> > res(fixed_bench_count / N);
+			for (size_t i = 0; i != res.size(); ++i) { res[i] = vec<N, T>(&values[i * N], N); }
+		return res;
+	}
+
+	template<class T>
+	static void BM_FixedMulAdd(benchmark::State& state) {
+		const std::vector<T> a = make_fixed_bench_values<T>(1);
+		const std::vector<T> b = make_fixed_bench_values<T>(2);
+		std::vector<T> dst	   = make_fixed_bench_values<T>(3);
+			for (auto _ : state) {
+					for (size_t i = 0; i != fixed_bench_count; ++i) { dst[i] = a[i] * b[i] + dst[i]; }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(fixed_bench_count));
+	}
+
+	template<class T>
+	static void BM_FixedDiv(benchmark::State& state) {
+		const std::vector<T> a = make_fixed_bench_values<T>(1);
+		std::vector<T> b	   = make_fixed_bench_values<T>(2);
+			for (T& value : b) { value = value + static_cast<T>(11); }
+		std::vector<T> dst(fixed_bench_count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != fixed_bench_count; ++i) { dst[i] = a[i] / b[i]; }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(fixed_bench_count));
+	}
+
+	template<class T>
+	static void BM_FixedVec3Dot(benchmark::State& state) {
+		const std::vector<vec<3, T> > a = make_fixed_bench_vecs<3, T>(1);
+		const std::vector<vec<3, T> > b = make_fixed_bench_vecs<3, T>(2);
+			for (auto _ : state) {
+				T sum = static_cast<T>(0);
+					for (size_t i = 0; i != a.size(); ++i) { sum += a[i].dot(b[i]); }
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(a.size()));
+	}
+
+	template<class T>
+	static void BM_FixedVec3Normalize(benchmark::State& state) {
+		const std::vector<vec<3, T> > src = make_fixed_bench_vecs<3, T>(1);
+		std::vector<vec<3, T> > dst(src.size());
+			for (auto _ : state) {
+					for (size_t i = 0; i != src.size(); ++i) { dst[i] = src[i].normalized(); }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(src.size()));
+	}
+
+	template<class T>
+	static void BM_FixedMat4MulVec4(benchmark::State& state) {
+		const std::vector<T> values			  = make_fixed_bench_values<T>(1);
+		const mat<4, 4, T> transform		  = mat<4, 4, T>(&values[0], 16) * static_cast<T>(0.1);
+		const std::vector<vec<4, T> > src	  = make_fixed_bench_vecs<4, T>(2);
+		std::vector<vec<4, T> > dst(src.size());
+			for (auto _ : state) {
+					for (size_t i = 0; i != src.size(); ++i) { dst[i] = transform * src[i]; }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(src.size()));
+	}
+
+		#define _MSTD_FIXED_BENCHMARKS(name)                                                                               \
+			BENCHMARK_TEMPLATE(name, float);                                                                               \
+			BENCHMARK_TEMPLATE(name, double);                                                                              \
+			BENCHMARK_TEMPLATE(name, fixed16_16);                                                                          \
+			BENCHMARK_TEMPLATE(name, sfixed16_16);
+
+	_MSTD_FIXED_BENCHMARKS(BM_FixedMulAdd)
+	_MSTD_FIXED_BENCHMARKS(BM_FixedDiv)
+	_MSTD_FIXED_BENCHMARKS(BM_FixedVec3Dot)
+	_MSTD_FIXED_BENCHMARKS(BM_FixedVec3Normalize)
+	_MSTD_FIXED_BENCHMARKS(BM_FixedMat4MulVec4)
+
+		#undef _MSTD_FIXED_BENCHMARKS
+
+		#ifdef __SIZEOF_INT128__
+	BENCHMARK_TEMPLATE(BM_FixedMulAdd, fixed32_32);
+	BENCHMARK_TEMPLATE(BM_FixedDiv, fixed32_32);
+	BENCHMARK_TEMPLATE(BM_FixedVec3Dot, fixed32_32);
+		#endif
+} // namespace mstd::benchmarks
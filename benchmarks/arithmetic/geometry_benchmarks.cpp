@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	// boxes spread around a camera looking down -z, roughly a quarter of them is visible
+	static aabb_soa<3, float> make_geometry_bench_boxes(size_t count) {
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<float> pos(-200.f, 200.f);
+		std::uniform_real_distribution<float> size(0.5f, 5.f);
+
+		aabb_soa<3, float> res;
+		res.reserve(count);
+			for (size_t i = 0; i != count; ++i) {
+				const vec3 center(pos(gen), pos(gen), pos(gen));
+				res.push_back(aabb3::from_center(center, vec3(size(gen), size(gen), size(gen))));
+			}
+		return res;
+	}
+
+	static frustum<> make_geometry_bench_frustum() {
+		return frustum<>(mat4::perspective(1.2f, 16.f / 9.f, 0.1f, 300.f) * mat4::rot_y(0.4f));
+	}
+
+	// one intersects() call per box read from the SoA lanes, what culling looks like without the batched kernels
+	static void BM_FrustumCullLoop(benchmark::State& state) {
+		const size_t count			   = static_cast<size_t>(state.range(0));
+		const aabb_soa<3, float> boxes = make_geometry_bench_boxes(count);
+		const frustum<> f			   = make_geometry_bench_frustum();
+		std::vector<uint64_t> mask((count + 63) / 64);
+			for (auto _ : state) {
+				std::fill(mask.begin(), mask.end(), uint64_t(0));
+					for (size_t i = 0; i != count; ++i) {
+						mask[i / 64] |= static_cast<uint64_t>(f.intersects(boxes.get(i))) << (i % 64);
+					}
+				benchmark::DoNotOptimize(mask.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_FrustumCull(benchmark::State& state) {
+		const size_t count			   = static_cast<size_t>(state.range(0));
+		const aabb_soa<3, float> boxes = make_geometry_bench_boxes(count);
+		const frustum<> f			   = make_geometry_bench_frustum();
+		std::vector<uint64_t> mask((count + 63) / 64);
+			for (auto _ : state) {
+				f.cull(boxes, mask.data());
+				benchmark::DoNotOptimize(mask.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_RayAabb(benchmark::State& state) {
+		const size_t count			   = static_cast<size_t>(state.range(0));
+		const aabb_soa<3, float> boxes = make_geometry_bench_boxes(count);
+		std::vector<aabb3> aos(count);
+			for (size_t i = 0; i != count; ++i) { aos[i] = boxes.get(i); }
+		const ray<> r(vec3(-250.f, -3.f, 7.f), vec3(1.f, 0.01f, -0.02f));
+			for (auto _ : state) {
+				size_t hits = 0;
+					for (const aabb3& box : aos) { hits += r.intersects(box); }
+				benchmark::DoNotOptimize(hits);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	BENCHMARK(BM_FrustumCullLoop)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+	BENCHMARK(BM_FrustumCull)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+	BENCHMARK(BM_RayAabb)->Arg(1 << 16);
+} // namespace mstd::benchmarks
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	static std::vector<float> make_float16_bench_values(size_t count) {
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<float> dist(-100.f, 100.f);
+
+		std::vector<float> res(count);
+			for (float& value : res) { value = dist(gen); }
+		return res;
+	}
+
+	// element by element conversion, what a loop over the values compiles to without the bulk routines
+	template<class T>
+	static void BM_Float16ConvertLoop(benchmark::State& state) {
+		const size_t count			   = static_cast<size_t>(state.range(0));
+		const std::vector<float> src = make_float16_bench_values(count);
+		std::vector<T> dst(count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { dst[i] = T(src[i]); }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	template<class T>
+	static void BM_Float16Convert(benchmark::State& state) {
+		const size_t count			   = static_cast<size_t>(state.range(0));
+		const std::vector<float> src = make_float16_bench_values(count);
+		std::vector<T> dst(count);
+			for (auto _ : state) {
+				convert(src.data(), dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	template<class T>
+	static void BM_Float16ConvertBack(benchmark::State& state) {
+		const size_t count		 = static_cast<size_t>(state.range(0));
+		const std::vector<float> values = make_float16_bench_values(count);
+		std::vector<T> src(count);
+		std::vector<float> dst(count);
+		convert(values.data(), src.data(), count);
+			for (auto _ : state) {
+				convert(src.data(), dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	// batched point transforms with the same values stored as float, half and bfloat16. The small batch fits in the
+	// cache and shows the conversion cost, the large one is bound by memory bandwidth and shows what the smaller
+	// storage saves. Bytes are the ones read and written
+	template<class T>
+	static void BM_Float16TransformPoints(benchmark::State& state) {
+		const size_t count				= static_cast<size_t>(state.range(0));
+		const mat4 m = mat4::translation({ 1.f, -2.f, 3.f }) * mat4::rot_y(0.7f) * mat4::scale({ 2.f, 3.f, 0.5f });
+		const std::vector<float> values = make_float16_bench_values(count * 3);
+		std::vector<vec<3, T> > src(count);
+			for (size_t i = 0; i != count; ++i) { src[i] = vec<3, T>(&values[i * 3], 3); }
+		std::vector<vec<3, T> > dst(count);
+			for (auto _ : state) {
+				transform_points(m, src.data(), dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+		state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * 2
+								* static_cast<int64_t>(sizeof(vec<3, T>)));
+	}
+
+	BENCHMARK_TEMPLATE(BM_Float16ConvertLoop, half)->Arg(1 << 16);
+	BENCHMARK_TEMPLATE(BM_Float16ConvertLoop, bfloat16)->Arg(1 << 16);
+	BENCHMARK_TEMPLATE(BM_Float16Convert, half)->Arg(1 << 16);
+	BENCHMARK_TEMPLATE(BM_Float16Convert, bfloat16)->Arg(1 << 16);
+	BENCHMARK_TEMPLATE(BM_Float16ConvertBack, half)->Arg(1 << 16);
+	BENCHMARK_TEMPLATE(BM_Float16ConvertBack, bfloat16)->Arg(1 << 16);
+
+	BENCHMARK_TEMPLATE(BM_Float16TransformPoints, float)->Arg(1 << 12)->Arg(1 << 22);
+	BENCHMARK_TEMPLATE(BM_Float16TransformPoints, half)->Arg(1 << 12)->Arg(1 << 22);
+	BENCHMARK_TEMPLATE(BM_Float16TransformPoints, bfloat16)->Arg(1 << 12)->Arg(1 << 22);
+} // namespace mstd::benchmarks
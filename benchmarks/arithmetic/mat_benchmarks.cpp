@@ -0,0 +1,196 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	template<size_t C, size_t R, class T>
+	static mat<C, R, T> make_mat() {
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<T> dist(static_cast<T>(-10), static_cast<T>(10));
+
+		mat<C, R, T> res;
+			for (size_t x = 0; x != C; ++x) {
+					for (size_t y = 0; y != R; ++y) { res[x][y] = dist(gen); }
+			}
+		return res;
+	}
+
+	template<size_t N, class T>
+	static vec<N, T> make_vec() {
+		std::mt19937 gen(7);
+		std::uniform_real_distribution<T> dist(static_cast<T>(-10), static_cast<T>(10));
+
+		vec<N, T> res;
+			for (size_t i = 0; i != N; ++i) { res[i] = dist(gen); }
+		return res;
+	}
+
+	// the proxy based triple loop mat::operator* used before the kernels
+	template<size_t C, size_t R, size_t OC, class T>
+	static mat<OC, R, T> naive_mul(const mat<C, R, T>& a, const mat<OC, C, T>& b) {
+		mat<OC, R, T> res;
+			for (size_t x = 0; x != OC; ++x) {
+					for (size_t y = 0; y != R; ++y) {
+							for (size_t i = 0; i != C; ++i) { res[x][y] += a[i][y] * b[x][i]; }
+					}
+			}
+		return res;
+	}
+
+	template<size_t C, size_t R, class T>
+	static vec<R, T> naive_mul(const mat<C, R, T>& a, const vec<C, T>& v) {
+		vec<R, T> res;
+			for (size_t y = 0; y != R; ++y) {
+					for (size_t x = 0; x != C; ++x) { res[y] += a[x][y] * v[x]; }
+			}
+		return res;
+	}
+
+	template<size_t N, class T>
+	static void BM_MatMulNaive(benchmark::State& state) {
+		const auto a = make_mat<N, N, T>();
+		auto b		 = make_mat<N, N, T>();
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(b);
+				auto res = naive_mul(a, b);
+				benchmark::DoNotOptimize(res);
+			}
+	}
+
+	template<size_t N, class T>
+	static void BM_MatMul(benchmark::State& state) {
+		const auto a = make_mat<N, N, T>();
+		auto b		 = make_mat<N, N, T>();
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(b);
+				auto res = a * b;
+				benchmark::DoNotOptimize(res);
+			}
+	}
+
+	template<size_t N, class T>
+	static void BM_MatVecMulNaive(benchmark::State& state) {
+		const auto a = make_mat<N, N, T>();
+		auto v		 = make_vec<N, T>();
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(v);
+				auto res = naive_mul(a, v);
+				benchmark::DoNotOptimize(res);
+			}
+	}
+
+	template<size_t N, class T>
+	static void BM_MatVecMul(benchmark::State& state) {
+		const auto a = make_mat<N, N, T>();
+		auto v		 = make_vec<N, T>();
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(v);
+				auto res = a * v;
+				benchmark::DoNotOptimize(res);
+			}
+	}
+
+	#define _MSTD_MAT_MUL_BENCHMARKS(name)   \
+		BENCHMARK_TEMPLATE(name, 3, float);  \
+		BENCHMARK_TEMPLATE(name, 4, float);  \
+		BENCHMARK_TEMPLATE(name, 4, double); \
+		BENCHMARK_TEMPLATE(name, 8, float);  \
+		BENCHMARK_TEMPLATE(name, 16, float);
+
+	_MSTD_MAT_MUL_BENCHMARKS(BM_MatMulNaive)
+	_MSTD_MAT_MUL_BENCHMARKS(BM_MatMul)
+	_MSTD_MAT_MUL_BENCHMARKS(BM_MatVecMulNaive)
+	_MSTD_MAT_MUL_BENCHMARKS(BM_MatVecMul)
+
+	#undef _MSTD_MAT_MUL_BENCHMARKS
+
+	template<size_t N, class T>
+	static void BM_MatDeterminant(benchmark::State& state) {
+		const auto m = make_mat<N, N, T>();
+			for (auto _ : state) {
+				T det = m.determinant();
+				benchmark::DoNotOptimize(det);
+			}
+	}
+
+	template<size_t N, class T>
+	static void BM_MatInverted(benchmark::State& state) {
+		const auto m = make_mat<N, N, T>();
+			for (auto _ : state) {
+				auto inv = m.inverted();
+				benchmark::DoNotOptimize(inv);
+			}
+	}
+
+	template<size_t N, class T>
+	static void BM_MatSolve(benchmark::State& state) {
+		const auto m = make_mat<N, N, T>();
+		const auto b = make_vec<N, T>();
+			for (auto _ : state) {
+				auto x = m.solve(b);
+				benchmark::DoNotOptimize(x);
+			}
+	}
+
+	template<class T>
+	static mat<4, 4, T> make_rigid_mat() {
+		return mat<4, 4, T>::translation({ 1, -2, 3 }) * mat<4, 4, T>::rot({ 1, 1, 0 }, static_cast<T>(0.7));
+	}
+
+	// inverted() finds the affine bottom row on its own, BM_MatInverted<4, T> covers the cofactor path
+	template<class T>
+	static void BM_Mat4InvertedAuto(benchmark::State& state) {
+		const auto m = make_rigid_mat<T>();
+			for (auto _ : state) {
+				auto inv = m.inverted();
+				benchmark::DoNotOptimize(inv);
+			}
+	}
+
+	template<class T>
+	static void BM_Mat4InvertedAffine(benchmark::State& state) {
+		const auto m = make_rigid_mat<T>();
+			for (auto _ : state) {
+				auto inv = m.inverted_affine();
+				benchmark::DoNotOptimize(inv);
+			}
+	}
+
+	template<class T>
+	static void BM_Mat4InvertedRigid(benchmark::State& state) {
+		const auto m = make_rigid_mat<T>();
+			for (auto _ : state) {
+				auto inv = m.inverted_rigid();
+				benchmark::DoNotOptimize(inv);
+			}
+	}
+
+	template<class T>
+	static void BM_TaggedMat4Inverted(benchmark::State& state) {
+		const auto m = tagged_mat<4, T>::translation({ 1, -2, 3 }) * tagged_mat<4, T>::rot({ 1, 1, 0 }, static_cast<T>(0.7));
+			for (auto _ : state) {
+				auto inv = m.inverted();
+				benchmark::DoNotOptimize(inv);
+			}
+	}
+
+	BENCHMARK_TEMPLATE(BM_Mat4InvertedAuto, float);
+	BENCHMARK_TEMPLATE(BM_Mat4InvertedAffine, float);
+	BENCHMARK_TEMPLATE(BM_Mat4InvertedRigid, float);
+	BENCHMARK_TEMPLATE(BM_TaggedMat4Inverted, float);
+	BENCHMARK_TEMPLATE(BM_Mat4InvertedAuto, double);
+	BENCHMARK_TEMPLATE(BM_Mat4InvertedAffine, double);
+	BENCHMARK_TEMPLATE(BM_Mat4InvertedRigid, double);
+	BENCHMARK_TEMPLATE(BM_TaggedMat4Inverted, double);
+
+	#define _MSTD_MAT_SQR_BENCHMARKS(name)   \
+		BENCHMARK_TEMPLATE(name, 4, float);  \
+		BENCHMARK_TEMPLATE(name, 5, float);  \
+		BENCHMARK_TEMPLATE(name, 6, double); \
+		BENCHMARK_TEMPLATE(name, 8, double);
+
+	_MSTD_MAT_SQR_BENCHMARKS(BM_MatDeterminant)
+	_MSTD_MAT_SQR_BENCHMARKS(BM_MatInverted)
+	_MSTD_MAT_SQR_BENCHMARKS(BM_MatSolve)
+
+	#undef _MSTD_MAT_SQR_BENCHMARKS
+} // namespace mstd::benchmarks
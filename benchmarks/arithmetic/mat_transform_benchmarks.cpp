@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	static std::vector<vec3> make_points(size_t count) {
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<float> dist(-100.f, 100.f);
+
+		std::vector<vec3> res(count);
+			for (vec3& point : res) { point = vec3(dist(gen), dist(gen), dist(gen)); }
+		return res;
+	}
+
+	static mat4 make_transform() {
+		return mat4::translation({ 1.f, -2.f, 3.f }) * mat4::rot_y(0.7f) * mat4::scale({ 2.f, 3.f, 0.5f });
+	}
+
+	// element by element mat::operator*(vec) used before the batch API
+	static void BM_TransformPointsLoop(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const mat4 m	   = make_transform();
+		const auto src	   = make_points(count);
+		std::vector<vec3> dst(count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { dst[i] = vec3(m * vec4(src[i], 1.f)); }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_TransformPoints(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const mat4 m	   = make_transform();
+		const auto src	   = make_points(count);
+		std::vector<vec3> dst(count);
+			for (auto _ : state) {
+				transform_points(m, src.data(), dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_TransformPointsThreaded(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const mat4 m	   = make_transform();
+		const auto src	   = make_points(count);
+		std::vector<vec3> dst(count);
+			for (auto _ : state) {
+				transform_points(m, src.data(), dst.data(), count, 0);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_TransformNormals(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const mat4 m	   = make_transform();
+		const auto src	   = make_points(count);
+		std::vector<vec3> dst(count);
+			for (auto _ : state) {
+				transform_normals(m, src.data(), dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	// position, uv and normal interleaved in one buffer
+	static void BM_TransformPointsStrided(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const mat4 m	   = make_transform();
+		std::vector<float> vertices(count * 8, 1.f);
+			for (auto _ : state) {
+				transform_points(m, vertices.data(), 8 * sizeof(float), vertices.data(), 8 * sizeof(float), count);
+				benchmark::DoNotOptimize(vertices.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	#define _MSTD_MAT_TRANSFORM_BENCHMARKS(name) BENCHMARK(name)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+	_MSTD_MAT_TRANSFORM_BENCHMARKS(BM_TransformPointsLoop)
+	_MSTD_MAT_TRANSFORM_BENCHMARKS(BM_TransformPoints)
+	_MSTD_MAT_TRANSFORM_BENCHMARKS(BM_TransformPointsThreaded)
+	_MSTD_MAT_TRANSFORM_BENCHMARKS(BM_TransformNormals)
+	_MSTD_MAT_TRANSFORM_BENCHMARKS(BM_TransformPointsStrided)
+
+	#undef _MSTD_MAT_TRANSFORM_BENCHMARKS
+} // namespace mstd::benchmarks
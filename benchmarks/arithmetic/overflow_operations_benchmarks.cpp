@@ -0,0 +1,210 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	static constexpr size_t overflow_bench_count = 4096;
+
+	template<class T>
+	static std::vector<T> make_overflow_bench_values(uint64_t seed) {
+		std::vector<T> res(overflow_bench_count);
+		uint64_t x = seed;
+			for (T& value : res) {
+				x ^= x << 13;
+				x ^= x >> 7;
+				x ^= x << 17;
+				value = static_cast<T>(x);
+			}
+		return res;
+	}
+
+	// decimal numbers of every length that fits T, a few of them negative
+	template<class T>
+	static std::vector<std::string> make_strtonum_bench_values() {
+		const std::vector<T> values = make_overflow_bench_values<T>(0x9E37'79B9'7F4A'7C15ull);
+		std::vector<std::string> res;
+		res.reserve(values.size());
+			for (size_t i = 0; i != values.size(); ++i) {
+				const T value = static_cast<T>(values[i] >> (i % (sizeof(T) * 8)));
+				res.push_back(std::to_string(i % 3 == 0 ? static_cast<T>(-(value / 2)) : value));
+			}
+		return res;
+	}
+
+	// the decimal path of strtonum with the division based checks it used before the builtins
+	template<class T>
+	static bool strtonum_fallback(const std::string_view str, T& num) {
+		size_t i = 0;
+		T sign	 = 1;
+			while (str[i] == '-' || str[i] == '+') {
+					if (str[i] == '-') { sign *= static_cast<T>(-1); }
+
+				++i;
+					if (i == str.size()) { return false; }
+			}
+
+		num = 0;
+			while (str[i] >= '0' && str[i] <= '9') {
+					if (utils::mul_overflow_fallback(num, 10, num)) { return false; }
+					if (utils::add_overflow_fallback(num, sign * (str[i] - '0'), num)) { return false; }
+
+				++i;
+					if (i == str.size()) { return true; }
+			}
+
+		return false;
+	}
+
+	template<class T, bool Fallback>
+	static void BM_Strtonum(benchmark::State& state) {
+		const std::vector<std::string> strings = make_strtonum_bench_values<T>();
+		int64_t bytes						   = 0;
+			for (const std::string& str : strings) { bytes += static_cast<int64_t>(str.size()); }
+
+			for (auto _ : state) {
+					for (const std::string& str : strings) {
+						T value = 0;
+						bool ok = false;
+							if _MSTD_CONSTEXPR17 (Fallback) { ok = strtonum_fallback(str, value); }
+							else { ok = strtonum(str, value); }
+						benchmark::DoNotOptimize(ok);
+						benchmark::DoNotOptimize(value);
+					}
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(strings.size()));
+		state.SetBytesProcessed(state.iterations() * bytes);
+	}
+
+	// one checked operation per element, the result and the overflow flag both consumed
+	template<class T, bool Fallback>
+	static void BM_MulOverflow(benchmark::State& state) {
+		const std::vector<T> a = make_overflow_bench_values<T>(1);
+		const std::vector<T> b = make_overflow_bench_values<T>(2);
+		std::vector<T> dst(overflow_bench_count);
+		size_t overflows	   = 0;
+			for (auto _ : state) {
+					for (size_t i = 0; i != overflow_bench_count; ++i) {
+						// small factors so only some of the products overflow
+						const T factor = static_cast<T>(b[i] >> (sizeof(T) * 8 - 12));
+							if _MSTD_CONSTEXPR17 (Fallback) {
+								overflows += utils::mul_overflow_fallback(a[i], factor, dst[i]) ? 1 : 0;
+							}
+							else { overflows += mul_overflow(a[i], factor, dst[i]) ? 1 : 0; }
+					}
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::DoNotOptimize(overflows);
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(overflow_bench_count));
+	}
+
+	template<class T>
+	static void BM_SaturatingAddScalar(benchmark::State& state) {
+		const std::vector<T> a = make_overflow_bench_values<T>(1);
+		const std::vector<T> b = make_overflow_bench_values<T>(2);
+		std::vector<T> dst(overflow_bench_count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != overflow_bench_count; ++i) {
+						T res = 0;
+						// the branchy version written with the checked add
+						dst[i] = add_overflow(a[i], b[i], res) ? (b[i] < 0 ? std::numeric_limits<T>::min()
+																		   : std::numeric_limits<T>::max())
+															   : res;
+					}
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(overflow_bench_count));
+	}
+
+	template<class T>
+	static void BM_SaturatingAdd(benchmark::State& state) {
+		const std::vector<T> a = make_overflow_bench_values<T>(1);
+		const std::vector<T> b = make_overflow_bench_values<T>(2);
+		std::vector<T> dst(overflow_bench_count);
+			for (auto _ : state) {
+				saturating_add(a.data(), b.data(), dst.data(), overflow_bench_count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(overflow_bench_count));
+	}
+
+	// the plain wrapping sum as the baseline for the checked one
+	template<class T>
+	static void BM_Sum(benchmark::State& state) {
+		const std::vector<T> values = make_overflow_bench_values<T>(3);
+			for (auto _ : state) {
+				int64_t sum = 0;
+					for (const T value : values) { sum += value; }
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(overflow_bench_count));
+	}
+
+	template<class T>
+	static void BM_SumOverflow(benchmark::State& state) {
+		const std::vector<T> values = make_overflow_bench_values<T>(3);
+			for (auto _ : state) {
+				int64_t sum		  = 0;
+				const bool failed = sum_overflow(values.data(), values.size(), sum);
+				benchmark::DoNotOptimize(failed);
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(overflow_bench_count));
+	}
+
+	// checked add per element, the loop sum_overflow replaces
+	template<class T>
+	static void BM_SumOverflowScalar(benchmark::State& state) {
+		const std::vector<T> values = make_overflow_bench_values<T>(3);
+			for (auto _ : state) {
+				int64_t sum = 0;
+				bool failed = false;
+					for (const T value : values) { failed |= add_overflow(sum, value, sum); }
+				benchmark::DoNotOptimize(failed);
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(overflow_bench_count));
+	}
+
+	// half width values so none of the products overflows on its own
+	template<class T>
+	static void BM_DotOverflow(benchmark::State& state) {
+		std::vector<T> a = make_overflow_bench_values<T>(4);
+		std::vector<T> b = make_overflow_bench_values<T>(5);
+			for (size_t i = 0; i != overflow_bench_count; ++i) {
+				a[i] = static_cast<T>(a[i] >> (sizeof(T) * 4));
+				b[i] = static_cast<T>(b[i] >> (sizeof(T) * 4));
+			}
+			for (auto _ : state) {
+				int64_t dot		  = 0;
+				const bool failed = dot_overflow(a.data(), b.data(), a.size(), dot);
+				benchmark::DoNotOptimize(failed);
+				benchmark::DoNotOptimize(dot);
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(overflow_bench_count));
+	}
+
+	BENCHMARK_TEMPLATE(BM_Strtonum, int32_t, false);
+	BENCHMARK_TEMPLATE(BM_Strtonum, int32_t, true);
+	BENCHMARK_TEMPLATE(BM_Strtonum, int64_t, false);
+	BENCHMARK_TEMPLATE(BM_Strtonum, int64_t, true);
+	BENCHMARK_TEMPLATE(BM_MulOverflow, int32_t, false);
+	BENCHMARK_TEMPLATE(BM_MulOverflow, int32_t, true);
+	BENCHMARK_TEMPLATE(BM_MulOverflow, int64_t, false);
+	BENCHMARK_TEMPLATE(BM_MulOverflow, int64_t, true);
+	BENCHMARK_TEMPLATE(BM_SaturatingAddScalar, int16_t);
+	BENCHMARK_TEMPLATE(BM_SaturatingAdd, int16_t);
+	BENCHMARK_TEMPLATE(BM_SaturatingAddScalar, int32_t);
+	BENCHMARK_TEMPLATE(BM_SaturatingAdd, int32_t);
+	BENCHMARK_TEMPLATE(BM_SaturatingAddScalar, int64_t);
+	BENCHMARK_TEMPLATE(BM_SaturatingAdd, int64_t);
+	BENCHMARK_TEMPLATE(BM_Sum, int32_t);
+	BENCHMARK_TEMPLATE(BM_SumOverflowScalar, int32_t);
+	BENCHMARK_TEMPLATE(BM_SumOverflow, int32_t);
+	BENCHMARK_TEMPLATE(BM_SumOverflowScalar, int64_t);
+	BENCHMARK_TEMPLATE(BM_SumOverflow, int64_t);
+	BENCHMARK_TEMPLATE(BM_DotOverflow, int16_t);
+	BENCHMARK_TEMPLATE(BM_DotOverflow, int32_t);
+	BENCHMARK_TEMPLATE(BM_DotOverflow, int64_t);
+} // namespace mstd::benchmarks
@@ -0,0 +1,140 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	static std::vector<vec3> make_quat_points(size_t count) {
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<float> dist(-100.f, 100.f);
+
+		std::vector<vec3> res(count);
+			for (vec3& point : res) { point = vec3(dist(gen), dist(gen), dist(gen)); }
+		return res;
+	}
+
+	static std::vector<fquat> make_quats(size_t count, unsigned seed) {
+		std::mt19937 gen(seed);
+		std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+		std::vector<fquat> res(count);
+			for (fquat& q : res) { q = fquat::rotation(vec3(dist(gen), dist(gen), dist(gen) + 2.f), dist(gen) * 3.f); }
+		return res;
+	}
+
+	// q * quat(0, v) * q^-1 used before quat::rotate
+	static void BM_QuatRotateSandwich(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const fquat q	   = make_quats(1, 7)[0];
+		const auto src	   = make_quat_points(count);
+		std::vector<vec3> dst(count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { dst[i] = (q * fquat(0.f, src[i]) * q.inverted()).v; }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_QuatRotate(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const fquat q	   = make_quats(1, 7)[0];
+		const auto src	   = make_quat_points(count);
+		std::vector<vec3> dst(count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { dst[i] = q.rotate(src[i]); }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_QuatRotateVectors(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const fquat q	   = make_quats(1, 7)[0];
+		const auto src	   = make_quat_points(count);
+		std::vector<vec3> dst(count);
+			for (auto _ : state) {
+				rotate_vectors(q, src.data(), dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_QuatRotateVectorsThreaded(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const fquat q	   = make_quats(1, 7)[0];
+		const auto src	   = make_quat_points(count);
+		std::vector<vec3> dst(count);
+			for (auto _ : state) {
+				rotate_vectors(q, src.data(), dst.data(), count, 0);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_QuatMulLoop(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const auto a	   = make_quats(count, 1);
+		const auto b	   = make_quats(count, 2);
+		std::vector<fquat> dst(count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { dst[i] = a[i] * b[i]; }
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_QuatMulQuats(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const auto a	   = make_quats(count, 1);
+		const auto b	   = make_quats(count, 2);
+		std::vector<fquat> dst(count);
+			for (auto _ : state) {
+				mul_quats(a.data(), b.data(), dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_QuatSlerp(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const auto a	   = make_quats(count, 1);
+		const auto b	   = make_quats(count, 2);
+		std::vector<fquat> dst(count);
+			for (auto _ : state) {
+				slerp(a.data(), b.data(), 0.3f, dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_QuatNlerp(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		const auto a	   = make_quats(count, 1);
+		const auto b	   = make_quats(count, 2);
+		std::vector<fquat> dst(count);
+			for (auto _ : state) {
+				nlerp(a.data(), b.data(), 0.3f, dst.data(), count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	#define _MSTD_QUAT_BENCHMARKS(name) BENCHMARK(name)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+	_MSTD_QUAT_BENCHMARKS(BM_QuatRotateSandwich)
+	_MSTD_QUAT_BENCHMARKS(BM_QuatRotate)
+	_MSTD_QUAT_BENCHMARKS(BM_QuatRotateVectors)
+	_MSTD_QUAT_BENCHMARKS(BM_QuatRotateVectorsThreaded)
+	_MSTD_QUAT_BENCHMARKS(BM_QuatMulLoop)
+	_MSTD_QUAT_BENCHMARKS(BM_QuatMulQuats)
+	_MSTD_QUAT_BENCHMARKS(BM_QuatSlerp)
+	_MSTD_QUAT_BENCHMARKS(BM_QuatNlerp)
+
+	#undef _MSTD_QUAT_BENCHMARKS
+} // namespace mstd::benchmarks
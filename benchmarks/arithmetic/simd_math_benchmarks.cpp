@@ -0,0 +1,213 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	static constexpr size_t math_bench_count = 4096;
+
+	// evenly spread values in [from, to)
+	template<class T>
+	static std::vector<T> make_math_bench_values(double from, double to, double seed) {
+		std::vector<T> res(math_bench_count);
+		double t = seed;
+			for (T& value : res) {
+				t	  = t + 0.6180339887498949 - std::floor(t + 0.6180339887498949);
+				value = static_cast<T>(from + (to - from) * t);
+			}
+		return res;
+	}
+
+	template<class T>
+	static double math_bench_ulp(T value, long double exact) {
+		const T rounded = static_cast<T>(exact);
+		const T ulp		= std::nextafter(std::abs(rounded), std::numeric_limits<T>::infinity()) - std::abs(rounded);
+		return static_cast<double>(std::abs(static_cast<long double>(value) - exact) / ulp);
+	}
+
+	// items/s for the throughput, max_ulp against the long double result for the accuracy
+	template<class T, class Func, class Reference>
+	static void run_unary_math(benchmark::State& state, double from, double to, const Func& func,
+	  const Reference& reference) {
+		const std::vector<T> src = make_math_bench_values<T>(from, to, 0.1);
+		std::vector<T> dst(math_bench_count);
+			for (auto _ : state) {
+				func(src.data(), dst.data(), math_bench_count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(math_bench_count));
+
+		double maxUlp = 0.0;
+			for (size_t i = 0; i != math_bench_count; ++i) {
+				maxUlp = std::max(maxUlp, math_bench_ulp(dst[i], reference(static_cast<long double>(src[i]))));
+			}
+		state.counters["max_ulp"] = maxUlp;
+	}
+
+	template<class T, class Func, class Reference>
+	static void run_binary_math(benchmark::State& state, double from, double to, const Func& func,
+	  const Reference& reference) {
+		const std::vector<T> a = make_math_bench_values<T>(from, to, 0.1);
+		const std::vector<T> b = make_math_bench_values<T>(from, to, 0.7);
+		std::vector<T> dst(math_bench_count);
+			for (auto _ : state) {
+				func(a.data(), b.data(), dst.data(), math_bench_count);
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(math_bench_count));
+
+		double maxUlp = 0.0;
+			for (size_t i = 0; i != math_bench_count; ++i) {
+				maxUlp = std::max(maxUlp, math_bench_ulp(dst[i],
+											reference(static_cast<long double>(a[i]), static_cast<long double>(b[i]))));
+			}
+		state.counters["max_ulp"] = maxUlp;
+	}
+
+		#define _MSTD_UNARY_MATH_BENCHMARK(name, func, from, to)                                                           \
+			template<class T>                                                                                              \
+			static void BM_##name##Libm(benchmark::State& state) {                                                         \
+				run_unary_math<T>(                                                                                         \
+				  state, from, to,                                                                                         \
+				  [](const T* src, T* dst, size_t count) {                                                                 \
+						  for (size_t i = 0; i != count; ++i) { dst[i] = std::func(src[i]); }                             \
+				  },                                                                                                       \
+				  [](long double x) { return std::func(x); });                                                             \
+			}                                                                                                              \
+                                                                                                                           \
+			template<class T, math_precision Precision>                                                                    \
+			static void BM_##name(benchmark::State& state) {                                                               \
+				run_unary_math<T>(                                                                                         \
+				  state, from, to, [](const T* src, T* dst, size_t count) { func<Precision>(src, dst, count); },           \
+				  [](long double x) { return std::func(x); });                                                             \
+			}
+
+		#define _MSTD_BINARY_MATH_BENCHMARK(name, func, from, to)                                                          \
+			template<class T>                                                                                              \
+			static void BM_##name##Libm(benchmark::State& state) {                                                         \
+				run_binary_math<T>(                                                                                        \
+				  state, from, to,                                                                                         \
+				  [](const T* a, const T* b, T* dst, size_t count) {                                                       \
+						  for (size_t i = 0; i != count; ++i) { dst[i] = std::func(a[i], b[i]); }                         \
+				  },                                                                                                       \
+				  [](long double a, long double b) { return std::func(a, b); });                                           \
+			}                                                                                                              \
+                                                                                                                           \
+			template<class T, math_precision Precision>                                                                    \
+			static void BM_##name(benchmark::State& state) {                                                               \
+				run_binary_math<T>(                                                                                        \
+				  state, from, to,                                                                                         \
+				  [](const T* a, const T* b, T* dst, size_t count) { func<Precision>(a, b, dst, count); },                 \
+				  [](long double a, long double b) { return std::func(a, b); });                                           \
+			}
+
+	_MSTD_UNARY_MATH_BENCHMARK(Sin, sin, -100.0, 100.0)
+	_MSTD_UNARY_MATH_BENCHMARK(Cos, cos, -100.0, 100.0)
+	_MSTD_UNARY_MATH_BENCHMARK(Tan, tan, -100.0, 100.0)
+	_MSTD_UNARY_MATH_BENCHMARK(Exp, exp, -80.0, 80.0)
+	_MSTD_UNARY_MATH_BENCHMARK(Log, log, 1e-3, 1e3)
+	_MSTD_BINARY_MATH_BENCHMARK(Atan2, atan2, -100.0, 100.0)
+	_MSTD_BINARY_MATH_BENCHMARK(Pow, pow, 0.5, 8.0)
+
+		#undef _MSTD_UNARY_MATH_BENCHMARK
+		#undef _MSTD_BINARY_MATH_BENCHMARK
+
+		#define _MSTD_MATH_BENCHMARKS(name)                                                                                \
+			BENCHMARK_TEMPLATE(BM_##name##Libm, float);                                                                    \
+			BENCHMARK_TEMPLATE(BM_##name, float, math_precision::fast);                                                    \
+			BENCHMARK_TEMPLATE(BM_##name, float, math_precision::precise);                                                 \
+			BENCHMARK_TEMPLATE(BM_##name##Libm, double);                                                                   \
+			BENCHMARK_TEMPLATE(BM_##name, double, math_precision::fast);                                                   \
+			BENCHMARK_TEMPLATE(BM_##name, double, math_precision::precise);
+
+	_MSTD_MATH_BENCHMARKS(Sin)
+	_MSTD_MATH_BENCHMARKS(Cos)
+	_MSTD_MATH_BENCHMARKS(Tan)
+	_MSTD_MATH_BENCHMARKS(Exp)
+	_MSTD_MATH_BENCHMARKS(Log)
+	_MSTD_MATH_BENCHMARKS(Atan2)
+	_MSTD_MATH_BENCHMARKS(Pow)
+
+		#undef _MSTD_MATH_BENCHMARKS
+
+	static long double rsqrt_reference(long double x) { return 1.0L / std::sqrt(x); }
+
+	template<class T>
+	static void BM_RsqrtLibm(benchmark::State& state) {
+		run_unary_math<T>(state, 1e-3, 1e3, [](const T* src, T* dst, size_t count) {
+				for (size_t i = 0; i != count; ++i) { dst[i] = static_cast<T>(1) / std::sqrt(src[i]); }
+		}, rsqrt_reference);
+	}
+
+	static void BM_QRsqrt(benchmark::State& state) {
+		run_unary_math<float>(state, 1e-3, 1e3, [](const float* src, float* dst, size_t count) {
+				for (size_t i = 0; i != count; ++i) { dst[i] = q_rsqrt(src[i]); }
+		}, rsqrt_reference);
+	}
+
+	template<class T, math_precision Precision>
+	static void BM_Rsqrt(benchmark::State& state) {
+		run_unary_math<T>(state, 1e-3, 1e3, [](const T* src, T* dst, size_t count) { rsqrt<Precision>(src, dst, count); },
+		  rsqrt_reference);
+	}
+
+	// the single value version called per element
+	template<class T, math_precision Precision>
+	static void BM_RsqrtScalar(benchmark::State& state) {
+		run_unary_math<T>(state, 1e-3, 1e3, [](const T* src, T* dst, size_t count) {
+				for (size_t i = 0; i != count; ++i) { dst[i] = rsqrt<Precision>(src[i]); }
+		}, rsqrt_reference);
+	}
+
+	template<class T>
+	static void BM_RcpLibm(benchmark::State& state) {
+		run_unary_math<T>(state, -1e3, 1e3, [](const T* src, T* dst, size_t count) {
+				for (size_t i = 0; i != count; ++i) { dst[i] = static_cast<T>(1) / src[i]; }
+		}, [](long double x) { return 1.0L / x; });
+	}
+
+	template<class T, math_precision Precision>
+	static void BM_Rcp(benchmark::State& state) {
+		run_unary_math<T>(state, -1e3, 1e3, [](const T* src, T* dst, size_t count) { rcp<Precision>(src, dst, count); },
+		  [](long double x) { return 1.0L / x; });
+	}
+
+	template<class T, bool Fast>
+	static void BM_Normalize(benchmark::State& state) {
+		const std::vector<T> components = make_math_bench_values<T>(-10.0, 10.0, 0.3);
+		std::vector<vec<3, T> > src(math_bench_count / 3);
+			for (size_t i = 0; i != src.size(); ++i) {
+				src[i] = vec<3, T>(components[3 * i], components[3 * i + 1], components[3 * i + 2]);
+			}
+		std::vector<vec<3, T> > dst(src.size());
+			for (auto _ : state) {
+					for (size_t i = 0; i != src.size(); ++i) {
+						dst[i] = Fast ? src[i].normalized_fast() : src[i].normalized();
+					}
+				benchmark::DoNotOptimize(dst.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(src.size()));
+	}
+
+	BENCHMARK(BM_QRsqrt);
+	BENCHMARK_TEMPLATE(BM_RsqrtLibm, float);
+	BENCHMARK_TEMPLATE(BM_Rsqrt, float, math_precision::fast);
+	BENCHMARK_TEMPLATE(BM_Rsqrt, float, math_precision::precise);
+	BENCHMARK_TEMPLATE(BM_RsqrtScalar, float, math_precision::fast);
+	BENCHMARK_TEMPLATE(BM_RsqrtScalar, float, math_precision::precise);
+	BENCHMARK_TEMPLATE(BM_RsqrtLibm, double);
+	BENCHMARK_TEMPLATE(BM_Rsqrt, double, math_precision::fast);
+	BENCHMARK_TEMPLATE(BM_Rsqrt, double, math_precision::precise);
+	BENCHMARK_TEMPLATE(BM_RsqrtScalar, double, math_precision::fast);
+	BENCHMARK_TEMPLATE(BM_RcpLibm, float);
+	BENCHMARK_TEMPLATE(BM_Rcp, float, math_precision::fast);
+	BENCHMARK_TEMPLATE(BM_Rcp, float, math_precision::precise);
+	BENCHMARK_TEMPLATE(BM_RcpLibm, double);
+	BENCHMARK_TEMPLATE(BM_Rcp, double, math_precision::fast);
+	BENCHMARK_TEMPLATE(BM_Rcp, double, math_precision::precise);
+	BENCHMARK_TEMPLATE(BM_Normalize, float, false);
+	BENCHMARK_TEMPLATE(BM_Normalize, float, true);
+	BENCHMARK_TEMPLATE(BM_Normalize, double, false);
+	BENCHMARK_TEMPLATE(BM_Normalize, double, true);
+} // namespace mstd::benchmarks
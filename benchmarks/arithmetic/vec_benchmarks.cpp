@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	template<size_t N, class T>
+	static std::vector<vec<N, T>> make_vecs(size_t count) {
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<T> dist(static_cast<T>(-10), static_cast<T>(10));
+
+		std::vector<vec<N, T>> res(count);
+			for (auto& v : res) {
+					for (size_t i = 0; i != N; ++i) { v[i] = dist(gen); }
+			}
+		return res;
+	}
+
+	static constexpr size_t vec_count = 4096;
+
+	template<size_t N, class T>
+	static void BM_VecMulAddScalar(benchmark::State& state) {
+		using scalar = utils::scalar_vec_kernels<N, T>;
+
+		auto a		 = make_vecs<N, T>(vec_count);
+		auto b		 = make_vecs<N, T>(vec_count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != vec_count; ++i) {
+						scalar::mul(&a[i][0], static_cast<const T*>(b[i]));
+						scalar::add(&a[i][0], static_cast<T>(0.5));
+					}
+				benchmark::DoNotOptimize(a.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vec_count));
+	}
+
+	template<size_t N, class T>
+	static void BM_VecMulAdd(benchmark::State& state) {
+		auto a = make_vecs<N, T>(vec_count);
+		auto b = make_vecs<N, T>(vec_count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != vec_count; ++i) {
+						a[i] *= b[i];
+						a[i] += static_cast<T>(0.5);
+					}
+				benchmark::DoNotOptimize(a.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vec_count));
+	}
+
+	template<size_t N, class T>
+	static void BM_VecDotScalar(benchmark::State& state) {
+		using scalar = utils::scalar_vec_kernels<N, T>;
+
+		auto a		 = make_vecs<N, T>(vec_count);
+		auto b		 = make_vecs<N, T>(vec_count);
+			for (auto _ : state) {
+				T sum = static_cast<T>(0);
+					for (size_t i = 0; i != vec_count; ++i) {
+						sum += scalar::dot(static_cast<const T*>(a[i]), static_cast<const T*>(b[i]));
+					}
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vec_count));
+	}
+
+	template<size_t N, class T>
+	static void BM_VecDot(benchmark::State& state) {
+		auto a = make_vecs<N, T>(vec_count);
+		auto b = make_vecs<N, T>(vec_count);
+			for (auto _ : state) {
+				T sum = static_cast<T>(0);
+					for (size_t i = 0; i != vec_count; ++i) { sum += a[i].dot(b[i]); }
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vec_count));
+	}
+
+	template<size_t N, class T>
+	static void BM_VecNormalizeScalar(benchmark::State& state) {
+		using scalar	= utils::scalar_vec_kernels<N, T>;
+
+		const auto src	= make_vecs<N, T>(vec_count);
+		auto a			= src;
+			for (auto _ : state) {
+					for (size_t i = 0; i != vec_count; ++i) {
+						T len = std::sqrt(scalar::dot(static_cast<const T*>(src[i]), static_cast<const T*>(src[i])));
+						a[i]  = src[i];
+						scalar::div(&a[i][0], len);
+					}
+				benchmark::DoNotOptimize(a.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vec_count));
+	}
+
+	template<size_t N, class T>
+	static void BM_VecNormalize(benchmark::State& state) {
+		const auto src = make_vecs<N, T>(vec_count);
+		auto a		   = src;
+			for (auto _ : state) {
+					for (size_t i = 0; i != vec_count; ++i) { a[i] = src[i].normalized(); }
+				benchmark::DoNotOptimize(a.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vec_count));
+	}
+
+	template<size_t N, class T>
+	static void BM_VecClampScalar(benchmark::State& state) {
+		using scalar	= utils::scalar_vec_kernels<N, T>;
+
+		const auto src	= make_vecs<N, T>(vec_count);
+		const auto minV = vec<N, T>::fill(static_cast<T>(-1));
+		const auto maxV = vec<N, T>::fill(static_cast<T>(1));
+		auto a			= src;
+			for (auto _ : state) {
+					for (size_t i = 0; i != vec_count; ++i) {
+						a[i] = src[i];
+						scalar::clamp(&a[i][0], static_cast<const T*>(minV), static_cast<const T*>(maxV));
+					}
+				benchmark::DoNotOptimize(a.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vec_count));
+	}
+
+	template<size_t N, class T>
+	static void BM_VecClamp(benchmark::State& state) {
+		const auto src	= make_vecs<N, T>(vec_count);
+		const auto minV = vec<N, T>::fill(static_cast<T>(-1));
+		const auto maxV = vec<N, T>::fill(static_cast<T>(1));
+		auto a			= src;
+			for (auto _ : state) {
+					for (size_t i = 0; i != vec_count; ++i) { a[i] = src[i].clampped(minV, maxV); }
+				benchmark::DoNotOptimize(a.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * vec_count));
+	}
+
+	#define _MSTD_VEC_BENCHMARKS(name)      \
+		BENCHMARK_TEMPLATE(name, 4, float); \
+		BENCHMARK_TEMPLATE(name, 3, float); \
+		BENCHMARK_TEMPLATE(name, 4, double);
+
+	_MSTD_VEC_BENCHMARKS(BM_VecMulAddScalar)
+	_MSTD_VEC_BENCHMARKS(BM_VecMulAdd)
+	_MSTD_VEC_BENCHMARKS(BM_VecDotScalar)
+	_MSTD_VEC_BENCHMARKS(BM_VecDot)
+	_MSTD_VEC_BENCHMARKS(BM_VecNormalizeScalar)
+	_MSTD_VEC_BENCHMARKS(BM_VecNormalize)
+	_MSTD_VEC_BENCHMARKS(BM_VecClampScalar)
+	_MSTD_VEC_BENCHMARKS(BM_VecClamp)
+
+	#undef _MSTD_VEC_BENCHMARKS
+} // namespace mstd::benchmarks
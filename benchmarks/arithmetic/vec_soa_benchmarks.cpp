@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	template<size_t N, class T>
+	static std::vector<vec<N, T>> make_aos(size_t count) {
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<T> dist(static_cast<T>(-10), static_cast<T>(10));
+
+		std::vector<vec<N, T>> res(count);
+			for (auto& v : res) {
+					for (size_t i = 0; i != N; ++i) { v[i] = dist(gen); }
+			}
+		return res;
+	}
+
+	template<size_t N, class T>
+	static vec_soa<N, T> make_soa(size_t count) {
+		vec_soa<N, T> res;
+		res.reserve(count);
+			for (const auto& v : make_aos<N, T>(count)) { res.push_back(v); }
+		return res;
+	}
+
+	template<size_t N, class T>
+	static void BM_AosFma(benchmark::State& state) {
+		const auto count = static_cast<size_t>(state.range(0));
+		auto a			 = make_aos<N, T>(count);
+		const auto b	 = make_aos<N, T>(count);
+		const auto c	 = make_aos<N, T>(count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { a[i] = a[i] * b[i] + c[i]; }
+				benchmark::DoNotOptimize(a.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	}
+
+	template<size_t N, class T>
+	static void BM_SoaFma(benchmark::State& state) {
+		const auto count = static_cast<size_t>(state.range(0));
+		auto a			 = make_soa<N, T>(count);
+		const auto b	 = make_soa<N, T>(count);
+		const auto c	 = make_soa<N, T>(count);
+			for (auto _ : state) {
+				a.fma(b, c);
+				benchmark::DoNotOptimize(a.lane(0));
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	}
+
+	template<size_t N, class T>
+	static void BM_AosDot(benchmark::State& state) {
+		const auto count = static_cast<size_t>(state.range(0));
+		const auto a	 = make_aos<N, T>(count);
+		const auto b	 = make_aos<N, T>(count);
+		std::vector<T> out(count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { out[i] = a[i].dot(b[i]); }
+				benchmark::DoNotOptimize(out.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	}
+
+	template<size_t N, class T>
+	static void BM_SoaDot(benchmark::State& state) {
+		const auto count = static_cast<size_t>(state.range(0));
+		const auto a	 = make_soa<N, T>(count);
+		const auto b	 = make_soa<N, T>(count);
+		std::vector<T> out(count);
+			for (auto _ : state) {
+				a.dot(b, out.data());
+				benchmark::DoNotOptimize(out.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	}
+
+	template<size_t N, class T>
+	static void BM_AosNormalize(benchmark::State& state) {
+		const auto count = static_cast<size_t>(state.range(0));
+		auto a			 = make_aos<N, T>(count);
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { a[i].normalize(); }
+				benchmark::DoNotOptimize(a.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	}
+
+	template<size_t N, class T>
+	static void BM_SoaNormalize(benchmark::State& state) {
+		const auto count = static_cast<size_t>(state.range(0));
+		auto a			 = make_soa<N, T>(count);
+			for (auto _ : state) {
+				a.normalize();
+				benchmark::DoNotOptimize(a.lane(0));
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	}
+
+	template<size_t N, class T>
+	static void BM_AosCross(benchmark::State& state) {
+		const auto count = static_cast<size_t>(state.range(0));
+		const auto a	 = make_aos<N, T>(count);
+		const auto b	 = make_aos<N, T>(count);
+		auto out		 = a;
+			for (auto _ : state) {
+					for (size_t i = 0; i != count; ++i) { out[i] = a[i].cross(b[i]); }
+				benchmark::DoNotOptimize(out.data());
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	}
+
+	template<size_t N, class T>
+	static void BM_SoaCross(benchmark::State& state) {
+		const auto count = static_cast<size_t>(state.range(0));
+		const auto a	 = make_soa<N, T>(count);
+		const auto b	 = make_soa<N, T>(count);
+			for (auto _ : state) {
+				auto out = a.cross(b);
+				benchmark::DoNotOptimize(out.lane(0));
+				benchmark::ClobberMemory();
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+	}
+
+	#define _MSTD_SOA_BENCHMARKS(name)                                                    \
+		BENCHMARK_TEMPLATE(name, 3, float)->RangeMultiplier(32)->Range(1 << 10, 1 << 20); \
+		BENCHMARK_TEMPLATE(name, 4, float)->RangeMultiplier(32)->Range(1 << 10, 1 << 20); \
+		BENCHMARK_TEMPLATE(name, 3, double)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+	_MSTD_SOA_BENCHMARKS(BM_AosFma)
+	_MSTD_SOA_BENCHMARKS(BM_SoaFma)
+	_MSTD_SOA_BENCHMARKS(BM_AosDot)
+	_MSTD_SOA_BENCHMARKS(BM_SoaDot)
+	_MSTD_SOA_BENCHMARKS(BM_AosNormalize)
+	_MSTD_SOA_BENCHMARKS(BM_SoaNormalize)
+
+	#undef _MSTD_SOA_BENCHMARKS
+
+	BENCHMARK_TEMPLATE(BM_AosCross, 3, float)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK_TEMPLATE(BM_SoaCross, 3, float)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+} // namespace mstd::benchmarks
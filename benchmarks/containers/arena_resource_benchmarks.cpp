@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	// new/delete counting the calls, what the global heap sees from a container
+	class arena_bench_heap : public std::pmr::memory_resource {
+	public:
+		size_t allocations = 0;
+
+	protected:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			++allocations;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+			std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+		}
+
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+	};
+
+	template<class Container>
+	static void arena_bench_fill(Container& container, int count) {
+			for (int i = 0; i != count; ++i) {
+				if _MSTD_CONSTEXPR17 (std::is_same_v<typename Container::value_type, int>) { container.push_back(i); }
+				else { container.insert_back({ i, i }); }
+			}
+	}
+
+	template<class Container>
+	static void arena_bench_fill_bimap(Container& container, int count) {
+			for (int i = 0; i != count; ++i) { container.insert({ i, -i }); }
+	}
+
+	// build then discard, every container straight on the heap
+	static void BM_OrderedMapBuildHeap(benchmark::State& state) {
+		arena_bench_heap heap;
+			for (auto _ : state) {
+				mstd::pmr::ordered_map<int, int> container(&heap);
+				arena_bench_fill(container, static_cast<int>(state.range(0)));
+				benchmark::DoNotOptimize(container.size());
+			}
+		state.counters["allocations"] = static_cast<double>(heap.allocations) / static_cast<double>(state.iterations());
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	// build then discard, a frame arena reset after every container
+	static void BM_OrderedMapBuildArena(benchmark::State& state) {
+		arena_bench_heap heap;
+		mstd::arena_resource arena(4096, &heap);
+			for (auto _ : state) {
+				{
+					mstd::pmr::ordered_map<int, int> container(&arena);
+					arena_bench_fill(container, static_cast<int>(state.range(0)));
+					benchmark::DoNotOptimize(container.size());
+				}
+				arena.reset();
+			}
+		state.counters["allocations"] = static_cast<double>(heap.allocations) / static_cast<double>(state.iterations());
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_StableVectorBuildHeap(benchmark::State& state) {
+		arena_bench_heap heap;
+			for (auto _ : state) {
+				mstd::pmr::stable_vector<int> container(&heap);
+				arena_bench_fill(container, static_cast<int>(state.range(0)));
+				benchmark::DoNotOptimize(container.data());
+			}
+		state.counters["allocations"] = static_cast<double>(heap.allocations) / static_cast<double>(state.iterations());
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_StableVectorBuildArena(benchmark::State& state) {
+		arena_bench_heap heap;
+		mstd::arena_resource arena(4096, &heap);
+			for (auto _ : state) {
+				{
+					mstd::pmr::stable_vector<int> container(&arena);
+					arena_bench_fill(container, static_cast<int>(state.range(0)));
+					benchmark::DoNotOptimize(container.data());
+				}
+				arena.reset();
+			}
+		state.counters["allocations"] = static_cast<double>(heap.allocations) / static_cast<double>(state.iterations());
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_BimapBuildHeap(benchmark::State& state) {
+		arena_bench_heap heap;
+			for (auto _ : state) {
+				mstd::pmr::unordered_bimap<int, int> container(&heap);
+				arena_bench_fill_bimap(container, static_cast<int>(state.range(0)));
+				benchmark::DoNotOptimize(container.size());
+			}
+		state.counters["allocations"] = static_cast<double>(heap.allocations) / static_cast<double>(state.iterations());
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_BimapBuildArena(benchmark::State& state) {
+		arena_bench_heap heap;
+		mstd::arena_resource arena(4096, &heap);
+			for (auto _ : state) {
+				{
+					mstd::pmr::unordered_bimap<int, int> container(&arena);
+					arena_bench_fill_bimap(container, static_cast<int>(state.range(0)));
+					benchmark::DoNotOptimize(container.size());
+				}
+				arena.reset();
+			}
+		state.counters["allocations"] = static_cast<double>(heap.allocations) / static_cast<double>(state.iterations());
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	BENCHMARK(BM_OrderedMapBuildHeap)->Arg(64)->Arg(1 << 12);
+	BENCHMARK(BM_OrderedMapBuildArena)->Arg(64)->Arg(1 << 12);
+	BENCHMARK(BM_StableVectorBuildHeap)->Arg(64)->Arg(1 << 12);
+	BENCHMARK(BM_StableVectorBuildArena)->Arg(64)->Arg(1 << 12);
+	BENCHMARK(BM_BimapBuildHeap)->Arg(64)->Arg(1 << 12);
+	BENCHMARK(BM_BimapBuildArena)->Arg(64)->Arg(1 << 12);
+} // namespace mstd::benchmarks
@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+#include <unordered_map>
+
+namespace mstd::benchmarks {
+	// new/delete keeping the bytes a container holds
+	class flat_bench_bytes : public std::pmr::memory_resource {
+	public:
+		size_t bytes = 0;
+
+	protected:
+		void* do_allocate(size_t size, size_t alignment) override {
+			bytes += size;
+			return std::pmr::new_delete_resource()->allocate(size, alignment);
+		}
+
+		void do_deallocate(void* ptr, size_t size, size_t alignment) override {
+			bytes -= size;
+			std::pmr::new_delete_resource()->deallocate(ptr, size, alignment);
+		}
+
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+	};
+
+	// count distinct keys in random order, misses are the keys past count. Lookups use another seed than inserts,
+	// node based maps would otherwise walk their nodes in allocation order
+	static std::vector<size_t> flat_bench_keys(size_t count, size_t offset, uint32_t seed = 42) {
+		std::vector<size_t> keys(count);
+			for (size_t i = 0; i != count; ++i) { keys[i] = (i + offset) * 0x9E3779B1u; }
+		std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+		return keys;
+	}
+
+	template<class Map>
+	static void flat_bench_fill(Map& map, const std::vector<size_t>& keys) {
+			for (size_t key : keys) { map.insert({ key, key }); }
+	}
+
+	template<class Allocator>
+	static void flat_bench_fill(ordered_map<size_t, size_t, Allocator>& map, const std::vector<size_t>& keys) {
+			for (size_t key : keys) { map.insert_back({ key, key }); }
+	}
+
+	// Arg(0) keys inserted into an empty map
+	template<class Map>
+	static void flat_bench_insert(benchmark::State& state) {
+		const std::vector<size_t> keys = flat_bench_keys(static_cast<size_t>(state.range(0)), 0);
+			for (auto _ : state) {
+				Map map;
+				flat_bench_fill(map, keys);
+				benchmark::DoNotOptimize(map.size());
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	// Arg(0) keys in the map, every step looks up a present key or one that is not there
+	template<class Map, bool Hit>
+	static void flat_bench_lookup(benchmark::State& state) {
+		const size_t count				  = static_cast<size_t>(state.range(0));
+		const std::vector<size_t> lookups = flat_bench_keys(count, Hit ? 0 : count, 7);
+		Map map;
+		flat_bench_fill(map, flat_bench_keys(count, 0));
+
+		size_t i = 0;
+			for (auto _ : state) {
+				benchmark::DoNotOptimize(map.find(lookups[i]));
+					if (++i == count) { i = 0; }
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+	}
+
+	// bytes held per element after inserting Arg(0) keys
+	template<class Map>
+	static void flat_bench_memory(benchmark::State& state) {
+		const std::vector<size_t> keys = flat_bench_keys(static_cast<size_t>(state.range(0)), 0);
+		size_t bytes				   = 0;
+			for (auto _ : state) {
+				flat_bench_bytes resource;
+				{
+					Map map(&resource);
+					flat_bench_fill(map, keys);
+					bytes = resource.bytes;
+					benchmark::DoNotOptimize(map.size());
+				}
+			}
+		state.counters["bytes_per_element"] = static_cast<double>(bytes) / static_cast<double>(state.range(0));
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_FlatHashMapInsert(benchmark::State& state) { flat_bench_insert<flat_hash_map<size_t, size_t> >(state); }
+
+	static void BM_UnorderedMapInsert(benchmark::State& state) {
+		flat_bench_insert<std::unordered_map<size_t, size_t> >(state);
+	}
+
+	static void BM_FlatHashMapLookupHit(benchmark::State& state) {
+		flat_bench_lookup<flat_hash_map<size_t, size_t>, true>(state);
+	}
+
+	static void BM_UnorderedMapLookupHit(benchmark::State& state) {
+		flat_bench_lookup<std::unordered_map<size_t, size_t>, true>(state);
+	}
+
+	static void BM_OrderedMapLookupHit(benchmark::State& state) { flat_bench_lookup<ordered_map<size_t, size_t>, true>(state); }
+
+	static void BM_FlatHashMapLookupMiss(benchmark::State& state) {
+		flat_bench_lookup<flat_hash_map<size_t, size_t>, false>(state);
+	}
+
+	static void BM_UnorderedMapLookupMiss(benchmark::State& state) {
+		flat_bench_lookup<std::unordered_map<size_t, size_t>, false>(state);
+	}
+
+	static void BM_FlatHashMapMemory(benchmark::State& state) {
+		flat_bench_memory<mstd::pmr::flat_hash_map<size_t, size_t> >(state);
+	}
+
+	static void BM_UnorderedMapMemory(benchmark::State& state) {
+		flat_bench_memory<std::pmr::unordered_map<size_t, size_t> >(state);
+	}
+
+	static void BM_OrderedMapMemory(benchmark::State& state) {
+		flat_bench_memory<mstd::pmr::ordered_map<size_t, size_t> >(state);
+	}
+
+	BENCHMARK(BM_FlatHashMapInsert)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_UnorderedMapInsert)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_FlatHashMapLookupHit)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_UnorderedMapLookupHit)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_OrderedMapLookupHit)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_FlatHashMapLookupMiss)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_UnorderedMapLookupMiss)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_FlatHashMapMemory)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_UnorderedMapMemory)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_OrderedMapMemory)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+} // namespace mstd::benchmarks
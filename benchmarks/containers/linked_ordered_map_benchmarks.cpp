@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	template<class Map>
+	static Map linked_bench_make_map(size_t count) {
+		Map map;
+			for (size_t i = 0; i != count; ++i) { map.insert_back({ i, i }); }
+		return map;
+	}
+
+	// Arg(0) live keys. Every step erases a random key and inserts it again at the back, what an LRU touch does
+	template<class Map>
+	static void linked_bench_touch(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		std::mt19937 gen(42);
+		Map map = linked_bench_make_map<Map>(count);
+
+			for (auto _ : state) {
+				const size_t key = gen() % count;
+				map.erase(key);
+				map.insert_back({ key, key });
+			}
+		benchmark::DoNotOptimize(map.size());
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+	}
+
+	// evicting the oldest key and inserting a new one, the worst case for ordered_map
+	template<class Map>
+	static void linked_bench_evict(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		Map map			   = linked_bench_make_map<Map>(count);
+
+		size_t next = count;
+			for (auto _ : state) {
+				map.erase(map.begin()->first);
+				map.insert_back({ next, next });
+				++next;
+			}
+		benchmark::DoNotOptimize(map.size());
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+	}
+
+	// ordered iteration after churn, the cost of following the links instead of a contiguous array.
+	// ordered_map stays contiguous whatever was erased, so it skips the (quadratic for it) churn
+	template<class Map, bool Churn>
+	static void linked_bench_iterate(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		std::mt19937 gen(7);
+		Map map = linked_bench_make_map<Map>(count);
+			if _MSTD_CONSTEXPR17 (Churn) {
+					for (size_t i = 0; i != count; ++i) {
+						const size_t key = gen() % count;
+						map.erase(key);
+						map.insert_back({ key, key });
+					}
+			}
+
+			for (auto _ : state) {
+				size_t sum = 0;
+					for (const auto& pair : map) { sum += pair.second; }
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_OrderedMapTouch(benchmark::State& state) { linked_bench_touch<ordered_map<size_t, size_t> >(state); }
+
+	static void BM_LinkedOrderedMapTouch(benchmark::State& state) {
+		linked_bench_touch<linked_ordered_map<size_t, size_t> >(state);
+	}
+
+	static void BM_OrderedMapEvict(benchmark::State& state) { linked_bench_evict<ordered_map<size_t, size_t> >(state); }
+
+	static void BM_LinkedOrderedMapEvict(benchmark::State& state) {
+		linked_bench_evict<linked_ordered_map<size_t, size_t> >(state);
+	}
+
+	static void BM_OrderedMapIterate(benchmark::State& state) { linked_bench_iterate<ordered_map<size_t, size_t>, false>(state); }
+
+	static void BM_LinkedOrderedMapIterate(benchmark::State& state) {
+		linked_bench_iterate<linked_ordered_map<size_t, size_t>, true>(state);
+	}
+
+	BENCHMARK(BM_OrderedMapTouch)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_LinkedOrderedMapTouch)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_OrderedMapEvict)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_LinkedOrderedMapEvict)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_OrderedMapIterate)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+	BENCHMARK(BM_LinkedOrderedMapIterate)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+} // namespace mstd::benchmarks
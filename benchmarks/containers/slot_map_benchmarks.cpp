@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	// a component sized payload
+	struct slot_bench_value {
+		uint64_t values[4] = {};
+	};
+
+	// Arg(0) live elements. Every step erases a random element, inserts a new one and looks up another
+	static void BM_SlotMapChurn(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		std::mt19937 gen(42);
+		slot_map<slot_bench_value> container;
+		std::vector<slot_map<slot_bench_value>::handle> handles;
+			for (size_t i = 0; i != count; ++i) { handles.push_back(container.insert(slot_bench_value())); }
+
+		uint64_t sum = 0;
+			for (auto _ : state) {
+				const size_t victim = gen() % count;
+				container.erase(handles[victim]);
+				handles[victim] = container.insert(slot_bench_value{ { victim, 0, 0, 0 } });
+				sum			   += container.at(handles[gen() % count]).values[0];
+			}
+		benchmark::DoNotOptimize(sum);
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+	}
+
+	static void BM_StableVectorChurn(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		std::mt19937 gen(42);
+		stable_vector<slot_bench_value> container;
+		std::vector<size_t> ids;
+			for (size_t i = 0; i != count; ++i) { ids.push_back(container.get_id(container.insert(slot_bench_value()))); }
+
+		uint64_t sum = 0;
+			for (auto _ : state) {
+				const size_t victim = gen() % count;
+				container.erase(ids[victim]);
+				ids[victim] = container.get_id(container.insert(slot_bench_value{ { victim, 0, 0, 0 } }));
+				sum		   += container.at(ids[gen() % count]).values[0];
+			}
+		benchmark::DoNotOptimize(sum);
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+	}
+
+	// random lookups of the payload through handles, a quarter of them stale
+	static void BM_SlotMapLookup(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		std::mt19937 gen(7);
+		slot_map<slot_bench_value> container;
+		std::vector<slot_map<slot_bench_value>::handle> handles;
+			for (size_t i = 0; i != count; ++i) { handles.push_back(container.insert(slot_bench_value())); }
+			for (size_t i = 0; i < count; i += 4) { container.erase(handles[i]); }
+
+		std::vector<uint32_t> order(1024);
+			for (uint32_t& index : order) { index = static_cast<uint32_t>(gen() % count); }
+			for (auto _ : state) {
+				uint64_t sum = 0;
+					for (const uint32_t index : order) {
+						const slot_bench_value* value = container.try_get(handles[index]);
+						sum							 += value != nullptr ? value->values[0] : 1;
+					}
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(order.size()));
+	}
+
+	static void BM_StableVectorLookup(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		std::mt19937 gen(7);
+		stable_vector<slot_bench_value> container;
+		std::vector<size_t> ids;
+			for (size_t i = 0; i != count; ++i) { ids.push_back(container.get_id(container.insert(slot_bench_value()))); }
+			for (size_t i = 0; i < count; i += 4) { container.erase(ids[i]); }
+
+		std::vector<uint32_t> order(1024);
+			for (uint32_t& index : order) { index = static_cast<uint32_t>(gen() % count); }
+			for (auto _ : state) {
+				uint64_t sum = 0;
+					for (const uint32_t index : order) {
+						const slot_bench_value* value = container.try_at(ids[index]);
+						sum							 += value != nullptr ? value->values[0] : 1;
+					}
+				benchmark::DoNotOptimize(sum);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(order.size()));
+	}
+
+	// every insert_at past the end grows the id tables
+	static void BM_StableVectorInsertAtEnd(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+			for (auto _ : state) {
+				stable_vector<slot_bench_value> container;
+					for (size_t i = 0; i != count; ++i) { container.insert_at(i * 2, slot_bench_value()); }
+				benchmark::DoNotOptimize(container.data());
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	BENCHMARK(BM_SlotMapChurn)->Arg(1 << 16);
+	BENCHMARK(BM_StableVectorChurn)->Arg(1 << 16);
+	BENCHMARK(BM_SlotMapLookup)->Arg(1 << 16);
+	BENCHMARK(BM_StableVectorLookup)->Arg(1 << 16);
+	BENCHMARK(BM_StableVectorInsertAtEnd)->Arg(1 << 14);
+} // namespace mstd::benchmarks
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	static size_t stable_vector_bench_allocations = 0;
+
+	template<class T>
+	struct stable_vector_bench_allocator {
+		using value_type = T;
+
+		stable_vector_bench_allocator() = default;
+
+		template<class U>
+		stable_vector_bench_allocator(const stable_vector_bench_allocator<U>&) noexcept {}
+
+		T* allocate(size_t count) {
+			++stable_vector_bench_allocations;
+			return std::allocator<T>().allocate(count);
+		}
+
+		void deallocate(T* ptr, size_t count) noexcept { std::allocator<T>().deallocate(ptr, count); }
+
+		bool operator==(const stable_vector_bench_allocator&) const noexcept { return true; }
+
+		bool operator!=(const stable_vector_bench_allocator&) const noexcept { return false; }
+	};
+
+	// a component owning a buffer, every copy allocates
+	struct stable_vector_bench_component {
+		std::vector<float, stable_vector_bench_allocator<float> > buffer;
+
+		explicit stable_vector_bench_component(size_t size) : buffer(size, 1.f) {}
+	};
+
+	// Arg(0) elements, reports the buffer allocations per element (1 when nothing is copied)
+	static void BM_StableVectorEmplaceHeavy(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		stable_vector_bench_allocations = 0;
+			for (auto _ : state) {
+				stable_vector<stable_vector_bench_component> container;
+					for (size_t i = 0; i != count; ++i) { container.emplace_back(size_t(64)); }
+				benchmark::DoNotOptimize(container.data());
+			}
+		state.counters["allocations"] = static_cast<double>(stable_vector_bench_allocations)
+									  / static_cast<double>(state.iterations() * count);
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_StableVectorPushBackMoveHeavy(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		stable_vector_bench_allocations = 0;
+			for (auto _ : state) {
+				stable_vector<stable_vector_bench_component> container;
+					for (size_t i = 0; i != count; ++i) {
+						stable_vector_bench_component component(64);
+						container.push_back(std::move(component));
+					}
+				benchmark::DoNotOptimize(container.data());
+			}
+		state.counters["allocations"] = static_cast<double>(stable_vector_bench_allocations)
+									  / static_cast<double>(state.iterations() * count);
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	// the same elements in a std::vector, the lower bound
+	static void BM_VectorEmplaceBackHeavy(benchmark::State& state) {
+		const size_t count = static_cast<size_t>(state.range(0));
+		stable_vector_bench_allocations = 0;
+			for (auto _ : state) {
+				std::vector<stable_vector_bench_component> container;
+					for (size_t i = 0; i != count; ++i) { container.emplace_back(size_t(64)); }
+				benchmark::DoNotOptimize(container.data());
+			}
+		state.counters["allocations"] = static_cast<double>(stable_vector_bench_allocations)
+									  / static_cast<double>(state.iterations() * count);
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	BENCHMARK(BM_StableVectorEmplaceHeavy)->Arg(1 << 12);
+	BENCHMARK(BM_StableVectorPushBackMoveHeavy)->Arg(1 << 12);
+	BENCHMARK(BM_VectorEmplaceBackHeavy)->Arg(1 << 12);
+} // namespace mstd::benchmarks
@@ -0,0 +1,10 @@
+#pragma once
+#ifndef _MSTD_BENCHMARKS_PCH_HPP_
+	#define _MSTD_BENCHMARKS_PCH_HPP_
+
+	#include <benchmark/benchmark.h>
+	#include <mstd/mstd.hpp>
+	#include <random>
+	#include <vector>
+
+#endif // _MSTD_BENCHMARKS_PCH_HPP_
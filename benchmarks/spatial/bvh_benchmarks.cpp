@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+
+namespace mstd::benchmarks {
+	// small boxes in a cube, like the triangles of a scene
+	static std::vector<aabb3> make_bvh_bench_boxes(size_t count) {
+		std::mt19937 gen(42);
+		std::uniform_real_distribution<float> pos(-100.f, 100.f);
+		std::uniform_real_distribution<float> size(0.05f, 0.5f);
+
+		std::vector<aabb3> res(count);
+			for (aabb3& box : res) {
+				box = aabb3::from_center(vec3(pos(gen), pos(gen), pos(gen)), vec3(size(gen), size(gen), size(gen)));
+			}
+		return res;
+	}
+
+	static std::vector<ray<> > make_bvh_bench_rays(size_t count) {
+		std::mt19937 gen(7);
+		std::uniform_real_distribution<float> pos(-100.f, 100.f);
+		std::uniform_real_distribution<float> dir(-1.f, 1.f);
+
+		std::vector<ray<> > res;
+		res.reserve(count);
+			for (size_t i = 0; i != count; ++i) {
+				res.emplace_back(vec3(pos(gen), pos(gen), pos(gen)), vec3(dir(gen), dir(gen), dir(gen)));
+			}
+		return res;
+	}
+
+	// Arg(0) primitives, Arg(1) threads (0 uses every hardware thread)
+	static void BM_BvhBuild(benchmark::State& state) {
+		const std::vector<aabb3> boxes = make_bvh_bench_boxes(static_cast<size_t>(state.range(0)));
+		bvh<> tree;
+			for (auto _ : state) {
+				tree.build(boxes, static_cast<size_t>(state.range(1)));
+				benchmark::DoNotOptimize(tree.nodes().data());
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	static void BM_BvhRefit(benchmark::State& state) {
+		const std::vector<aabb3> boxes = make_bvh_bench_boxes(static_cast<size_t>(state.range(0)));
+		bvh<> tree(boxes);
+			for (auto _ : state) {
+				tree.refit(boxes);
+				benchmark::DoNotOptimize(tree.nodes().data());
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	// closest hit against the primitive boxes, queries per second
+	static void BM_BvhRaycast(benchmark::State& state) {
+		const std::vector<aabb3> boxes	= make_bvh_bench_boxes(static_cast<size_t>(state.range(0)));
+		const std::vector<ray<> > rays = make_bvh_bench_rays(1024);
+		const bvh<> tree(boxes);
+			for (auto _ : state) {
+					for (const ray<>& r : rays) {
+						float t = std::numeric_limits<float>::infinity();
+						benchmark::DoNotOptimize(tree.raycast(r, t, [&boxes, &r](size_t primitive, float& closest) {
+							float tNear = 0.f;
+							float tFar	= 0.f;
+								if (r.intersects(boxes[primitive], tNear, tFar) && tNear < closest) {
+									closest = tNear;
+									return true;
+								}
+							return false;
+						}));
+					}
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(rays.size()));
+	}
+
+	// the same rays tested against every box
+	static void BM_BvhRaycastBruteForce(benchmark::State& state) {
+		const std::vector<aabb3> boxes	= make_bvh_bench_boxes(static_cast<size_t>(state.range(0)));
+		const std::vector<ray<> > rays = make_bvh_bench_rays(16);
+			for (auto _ : state) {
+					for (const ray<>& r : rays) {
+						float t = std::numeric_limits<float>::infinity();
+							for (const aabb3& box : boxes) {
+								float tNear = 0.f;
+								float tFar	= 0.f;
+									if (r.intersects(box, tNear, tFar) && tNear < t) { t = tNear; }
+							}
+						benchmark::DoNotOptimize(t);
+					}
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(rays.size()));
+	}
+
+	static void BM_BvhQuery(benchmark::State& state) {
+		const std::vector<aabb3> boxes	 = make_bvh_bench_boxes(static_cast<size_t>(state.range(0)));
+		const std::vector<aabb3> areas = make_bvh_bench_boxes(1024);
+		const bvh<> tree(boxes);
+			for (auto _ : state) {
+				size_t found = 0;
+					for (const aabb3& area : areas) {
+						const aabb3 grown(area.min - vec3(2.f, 2.f, 2.f), area.max + vec3(2.f, 2.f, 2.f));
+						tree.query(grown, [&boxes, &grown, &found](size_t primitive) { found += boxes[primitive].intersects(grown); });
+					}
+				benchmark::DoNotOptimize(found);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(areas.size()));
+	}
+
+	static void BM_BvhNearest(benchmark::State& state) {
+		const std::vector<aabb3> boxes = make_bvh_bench_boxes(static_cast<size_t>(state.range(0)));
+		const std::vector<ray<> > rays = make_bvh_bench_rays(1024);
+		const bvh<> tree(boxes);
+			for (auto _ : state) {
+					for (const ray<>& r : rays) {
+						const vec3& point = r.origin();
+						float distance	  = std::numeric_limits<float>::infinity();
+						benchmark::DoNotOptimize(tree.nearest(point, distance,
+						  [&boxes, &point](size_t primitive) { return boxes[primitive].distance_squared(point); }));
+					}
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(rays.size()));
+	}
+
+	BENCHMARK(BM_BvhBuild)->Args({ 1 << 16, 1 })->Args({ 1 << 20, 1 })->Args({ 1 << 20, 0 })->Unit(benchmark::kMillisecond);
+	BENCHMARK(BM_BvhRefit)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+	BENCHMARK(BM_BvhRaycast)->Arg(1 << 16)->Arg(1 << 20);
+	BENCHMARK(BM_BvhRaycastBruteForce)->Arg(1 << 16);
+	BENCHMARK(BM_BvhQuery)->Arg(1 << 20);
+	BENCHMARK(BM_BvhNearest)->Arg(1 << 20);
+} // namespace mstd::benchmarks
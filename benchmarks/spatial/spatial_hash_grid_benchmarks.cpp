@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <pch.hpp>
+#include <unordered_map>
+
+namespace mstd::benchmarks {
+	// about 8 points per 4 wide cell
+	static std::vector<vec3> make_grid_bench_points(size_t count) {
+		std::mt19937 gen(42);
+		const float range = 50.f * std::cbrt(static_cast<float>(count) / static_cast<float>(1 << 17));
+		std::uniform_real_distribution<float> pos(-range, range);
+
+		std::vector<vec3> res(count);
+			for (vec3& point : res) { point = vec3(pos(gen), pos(gen), pos(gen)); }
+		return res;
+	}
+
+	static const float grid_bench_cell = 4.f;
+
+	// Arg(0) points, Arg(1) threads (0 uses every hardware thread)
+	static void BM_SpatialHashGridRebuild(benchmark::State& state) {
+		const std::vector<vec3> points = make_grid_bench_points(static_cast<size_t>(state.range(0)));
+		spatial_hash_grid3 grid(grid_bench_cell);
+			for (auto _ : state) {
+				grid.rebuild(points, static_cast<size_t>(state.range(1)));
+				benchmark::DoNotOptimize(grid.indices().data());
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	// the same cells kept in a node based map of vectors, allocating per cell
+	static void BM_UnorderedMapGridRebuild(benchmark::State& state) {
+		const std::vector<vec3> points = make_grid_bench_points(static_cast<size_t>(state.range(0)));
+		std::unordered_map<size_t, std::vector<uint32_t> > cells;
+			for (auto _ : state) {
+				cells.clear();
+					for (size_t i = 0; i != points.size(); ++i) {
+						const vec3& point = points[i];
+						const size_t key  = hash_combine(static_cast<int32_t>(std::floor(point.x() / grid_bench_cell)),
+						   static_cast<int32_t>(std::floor(point.y() / grid_bench_cell)),
+						   static_cast<int32_t>(std::floor(point.z() / grid_bench_cell)));
+						cells[key].push_back(static_cast<uint32_t>(i));
+					}
+				benchmark::DoNotOptimize(cells.size());
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	// radius queries around existing points, queries per second
+	static void BM_SpatialHashGridQuery(benchmark::State& state) {
+		const std::vector<vec3> points = make_grid_bench_points(static_cast<size_t>(state.range(0)));
+		spatial_hash_grid3 grid(grid_bench_cell);
+		grid.rebuild(points);
+			for (auto _ : state) {
+				size_t found = 0;
+					for (size_t i = 0; i != 1024; ++i) {
+						grid.query_radius(points[i], grid_bench_cell, [&found](size_t, float) { ++found; });
+					}
+				benchmark::DoNotOptimize(found);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 1024);
+	}
+
+	// one simulation step: rebuild, then the neighbors of every point, points per second
+	static void BM_SpatialHashGridTick(benchmark::State& state) {
+		const std::vector<vec3> points = make_grid_bench_points(static_cast<size_t>(state.range(0)));
+		spatial_hash_grid3 grid(grid_bench_cell);
+			for (auto _ : state) {
+				grid.rebuild(points);
+				size_t found = 0;
+					for (const vec3& point : points) {
+						grid.query_radius(point, grid_bench_cell, [&found](size_t, float) { ++found; });
+					}
+				benchmark::DoNotOptimize(found);
+			}
+		state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+	}
+
+	BENCHMARK(BM_SpatialHashGridRebuild)
+	  ->Args({ 1 << 16, 1 })
+	  ->Args({ 1 << 20, 1 })
+	  ->Args({ 1 << 20, 0 })
+	  ->Unit(benchmark::kMillisecond);
+	BENCHMARK(BM_UnorderedMapGridRebuild)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+	BENCHMARK(BM_SpatialHashGridQuery)->Arg(1 << 20);
+	BENCHMARK(BM_SpatialHashGridTick)->Arg(1 << 16)->Unit(benchmark::kMillisecond);
+} // namespace mstd::benchmarks
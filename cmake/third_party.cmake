@@ -10,7 +10,13 @@ else()
     set(DOWNLOAD_GTEST OFF)
 endif()
 
-if(DOWNLOAD_FMT OR DOWNLOAD_GTEST)
+if (MSTD_BUILD_BENCHMARKS AND NOT TARGET benchmark::benchmark_main)
+    set(DOWNLOAD_BENCHMARK ON)
+else()
+    set(DOWNLOAD_BENCHMARK OFF)
+endif()
+
+if(DOWNLOAD_FMT OR DOWNLOAD_GTEST OR DOWNLOAD_BENCHMARK)
     include(${CMAKE_CURRENT_LIST_DIR}/get_cpm.cmake)
 endif()
 
@@ -22,4 +28,14 @@ endif()
 # GOOGLE TESTS
 if(DOWNLOAD_GTEST)
     CPMAddPackage("gh:google/googletest#v1.17.0")
+endif()
+
+# GOOGLE BENCHMARK
+if(DOWNLOAD_BENCHMARK)
+    CPMAddPackage(
+        NAME benchmark
+        GITHUB_REPOSITORY google/benchmark
+        VERSION 1.9.4
+        OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_GTEST_TESTS OFF" "BENCHMARK_ENABLE_INSTALL OFF"
+    )
 endif()
\ No newline at end of file
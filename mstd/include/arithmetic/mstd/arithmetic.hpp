@@ -18,11 +18,25 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 	#else
 
 		#include <mstd/bit_operations.hpp>
+		#include <mstd/dmat.hpp>
+		#include <mstd/dmat_lu.hpp>
+		#include <mstd/dvec.hpp>
+		#include <mstd/expr.hpp>
+		#include <mstd/fixed.hpp>
+		#include <mstd/geometry.hpp>
+		#include <mstd/half.hpp>
 		#include <mstd/mat.hpp>
+		#include <mstd/mat_lu.hpp>
+		#include <mstd/mat_transform.hpp>
 		#include <mstd/math_functions.hpp>
 		#include <mstd/overflow_operations.hpp>
 		#include <mstd/quat.hpp>
+		#include <mstd/quat_transform.hpp>
+		#include <mstd/simd.hpp>
+		#include <mstd/simd_math.hpp>
+		#include <mstd/tagged_mat.hpp>
 		#include <mstd/vec.hpp>
+		#include <mstd/vec_soa.hpp>
 
 	#endif
 #endif
\ No newline at end of file
@@ -26,10 +26,18 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <cstring>
 		#include <iomanip>
 		#include <iostream>
+		#include <new>
 		#include <sstream>
 		#include <string>
+		#include <thread>
+		#include <vector>
 		#if _MSTD_HAS_CXX20
 			#include <bit>
 		#endif
+		#if _MSTD_HAS_SSE2
+			#include <immintrin.h>
+		#elif _MSTD_HAS_NEON
+			#include <arm_neon.h>
+		#endif
 	#endif
 #endif
\ No newline at end of file
@@ -21,28 +21,146 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/management_types.hpp>
 
 namespace mstd {
+	// what is known about a square transform matrix, ordered from the weakest guarantee: general < affine (last row is
+	// (0, ..., 0, 1)) < rigid (affine with an orthonormal linear block)
+	enum class transform_type : uint8_t { general = 0, affine = 1, rigid = 2 };
+
+	// number types vec and mat accept besides the built in arithmetic ones (quat and mat_lu too, since mat names them in
+	// its declarations). A specialization promises +, -, *, / with their compound versions, unary -, comparisons,
+	// construction from integers and a std::numeric_limits specialization, fixed from fixed.hpp is one
+	template<class T>
+	struct is_arithmetic_like : std::is_arithmetic<T> {};
+
+	template<class T>
+	static _MSTD_CONSTEXPR17 const bool is_arithmetic_like_v = is_arithmetic_like<T>::value;
+
 		#if _MSTD_HAS_CXX20
-	template<size_t N, arithmetic T>
+	template<class T> concept arithmetic_like = is_arithmetic_like_v<T>;
+
+	template<size_t N, arithmetic_like T>
 	requires (N > 0)
 	class vec;
 
-	template<arithmetic T = float>
+	template<arithmetic_like T = float>
 	class quat;
 
-	template<size_t C, size_t R, arithmetic T>
+	template<size_t C, size_t R, arithmetic_like T>
 	requires (C > 0 && R > 0)
 	class mat;
+
+	template<size_t N, arithmetic_like T>
+	requires (N > 0)
+	class mat_lu;
+
+	template<size_t N, arithmetic T>
+	requires (N > 0)
+	class vec_soa;
+
+	template<size_t N, arithmetic T>
+	requires (N > 2)
+	class tagged_mat;
+
+	template<arithmetic T, class Allocator = utils::aligned_allocator<T> >
+	class dvec;
+
+	template<arithmetic T, class Allocator = utils::aligned_allocator<T> >
+	class dmat;
+
+	template<arithmetic T, class Allocator = utils::aligned_allocator<T> >
+	class dmat_lu;
+
+	template<size_t N, arithmetic T>
+	requires (N > 0)
+	class aabb;
+
+	template<size_t N, arithmetic T>
+	requires (N > 0)
+	class aabb_soa;
+
+	template<floating_point T = float>
+	class sphere;
+
+	template<floating_point T = float>
+	class plane;
+
+	template<floating_point T = float>
+	class ray;
+
+	template<floating_point T = float>
+	class frustum;
 		#else
-	template<size_t N, class T, std::enable_if_t<(N > 0 && std::is_arithmetic_v<T>), bool> = true>
+	template<size_t N, class T, std::enable_if_t<(N > 0 && is_arithmetic_like_v<T>), bool> = true>
 	class vec;
 
-	template<class T = float, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+	template<class T = float, std::enable_if_t<is_arithmetic_like_v<T>, bool> = true>
 	class quat;
 
-	template<size_t C, size_t R, class T, std::enable_if_t<(C > 0 && R > 0 && std::is_arithmetic_v<T>), bool> = true>
+	template<size_t C, size_t R, class T, std::enable_if_t<(C > 0 && R > 0 && is_arithmetic_like_v<T>), bool> = true>
 	class mat;
+
+	template<size_t N, class T, std::enable_if_t<(N > 0 && is_arithmetic_like_v<T>), bool> = true>
+	class mat_lu;
+
+	template<size_t N, class T, std::enable_if_t<(N > 0 && std::is_arithmetic_v<T>), bool> = true>
+	class vec_soa;
+
+	template<size_t N, class T, std::enable_if_t<(N > 2 && std::is_arithmetic_v<T>), bool> = true>
+	class tagged_mat;
+
+	template<class T, class Allocator = utils::aligned_allocator<T>, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+	class dvec;
+
+	template<class T, class Allocator = utils::aligned_allocator<T>, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+	class dmat;
+
+	template<class T, class Allocator = utils::aligned_allocator<T>, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+	class dmat_lu;
+
+	template<size_t N, class T, std::enable_if_t<(N > 0 && std::is_arithmetic_v<T>), bool> = true>
+	class aabb;
+
+	template<size_t N, class T, std::enable_if_t<(N > 0 && std::is_arithmetic_v<T>), bool> = true>
+	class aabb_soa;
+
+	template<class T = float, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	class sphere;
+
+	template<class T = float, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	class plane;
+
+	template<class T = float, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	class ray;
+
+	template<class T = float, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	class frustum;
 		#endif
 
+	// non owning views used to pass fixed and dynamic size values to the same algorithms, T may be const
+	template<class T>
+	class dvec_view;
+
+	template<class T>
+	class dmat_view;
+
+	namespace utils {
+		// base of the lazy vec/mat expression nodes from expr.hpp
+		struct expr_base {};
+
+		template<class Expr>
+		static _MSTD_CONSTEXPR17 const bool is_expr_v = std::is_base_of_v<expr_base, Expr>;
+
+		template<class Expr, class Result, class = void>
+		struct is_expr_of : std::false_type {};
+
+		template<class Expr, class Result>
+		struct is_expr_of<Expr, Result, std::enable_if_t<is_expr_v<Expr>>>
+			: std::is_same<typename Expr::result_type, Result> {};
+
+		// Expr is an expression node evaluating to Result
+		template<class Expr, class Result>
+		static _MSTD_CONSTEXPR17 const bool is_expr_of_v = is_expr_of<Expr, Result>::value;
+	} // namespace utils
+
 		#pragma region PREDEFINED_QUATS
 	using fquat	  = quat<float>;
 	using dquat	  = quat<double>;
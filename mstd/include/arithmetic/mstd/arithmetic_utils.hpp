@@ -20,5 +20,182 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 
 		#include <mstd/arithmetic_libs.hpp>
 
+namespace mstd::utils {
+	// splits [0, count) into at most threads contiguous chunks of at least minChunk elements and calls func(first, last) for
+	// every chunk, the calling thread takes the first one. threads == 0 uses every hardware thread. When a thread can not
+	// be started its chunks run on the calling thread
+	template<class Func>
+	void parallel_for(size_t count, size_t threads, size_t minChunk, const Func& func) {
+		const size_t maxThreads = std::max<size_t>(count / std::max<size_t>(minChunk, 1), 1);
+			if (threads == 0 && maxThreads > 1) {
+				// querying the hardware is a system call on some platforms
+				static const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+				threads								= hardwareThreads;
+			}
+		threads = std::min(threads, maxThreads);
+
+			if (threads <= 1) {
+				func(size_t(0), count);
+				return;
+			}
+
+		const size_t chunk = (count + threads - 1) / threads;
+		std::vector<std::thread> workers;
+		workers.reserve(threads - 1);
+
+		size_t inlineFirst = count;
+			for (size_t first = chunk; first < count; first += chunk) {
+					try {
+						workers.emplace_back(func, first, std::min(first + chunk, count));
+					} catch (...) {
+						inlineFirst = first;
+						break;
+					}
+			}
+
+		func(size_t(0), chunk);
+			if (inlineFirst != count) { func(inlineFirst, count); }
+			for (std::thread& worker : workers) { worker.join(); }
+	}
+
+	// std::allocator with over-aligned storage, the default alignment fits a cache line and every SIMD register width
+	template<class T, size_t Alignment = 64>
+	struct aligned_allocator {
+		static_assert((Alignment & (Alignment - 1)) == 0 && Alignment >= alignof(T), "invalid alignment");
+
+		using value_type = T;
+
+		template<class U>
+		struct rebind {
+			using other = aligned_allocator<U, Alignment>;
+		};
+
+		static _MSTD_CONSTEXPR17 const size_t alignment = Alignment;
+
+		_MSTD_CONSTEXPR20 aligned_allocator() noexcept = default;
+
+		template<class U>
+		_MSTD_CONSTEXPR20 aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept {}
+
+		// the size is rounded up to whole Alignment blocks, so the storage always ends on a block boundary
+		[[nodiscard]] T* allocate(size_t count) {
+			const size_t bytes = (count * sizeof(T) + Alignment - 1) & ~(Alignment - 1);
+			return static_cast<T*>(::operator new(bytes, std::align_val_t(Alignment)));
+		}
+
+		void deallocate(T* ptr, size_t) noexcept { ::operator delete(ptr, std::align_val_t(Alignment)); }
+
+		template<class U>
+		_MSTD_CONSTEXPR20 bool operator==(const aligned_allocator<U, Alignment>&) const noexcept {
+			return true;
+		}
+
+		template<class U>
+		_MSTD_CONSTEXPR20 bool operator!=(const aligned_allocator<U, Alignment>&) const noexcept {
+			return false;
+		}
+	};
+
+		#pragma region DECOMPOSITIONS
+
+	// algorithms shared by the fixed and dynamic size matrices. Both store n x n values column major, column(x) returns a
+	// pointer to the n values of column x
+
+	// PA = LU with partial (row) pivoting in place, L has an implicit unit diagonal and is stored below U. Row y of PA is
+	// row pivots[y] of the input. Returns false when the matrix is singular
+	template<class T, class Columns>
+	_MSTD_CONSTEXPR20 bool lu_decompose(size_t n, const Columns& column, size_t* pivots, bool& oddPermutation) {
+		bool regular = true;
+			for (size_t y = 0; y != n; ++y) { pivots[y] = y; }
+
+			for (size_t k = 0; k != n; ++k) {
+				const T* columnK = column(k);
+				size_t pivotRow	 = k;
+				T pivotAbs		 = columnK[k] < static_cast<T>(0) ? -columnK[k] : columnK[k];
+					for (size_t y = k + 1; y != n; ++y) {
+						const T valueAbs = columnK[y] < static_cast<T>(0) ? -columnK[y] : columnK[y];
+							if (valueAbs > pivotAbs) {
+								pivotRow = y;
+								pivotAbs = valueAbs;
+							}
+					}
+
+					if (pivotAbs == static_cast<T>(0)) {
+						regular = false;
+						continue;
+					}
+
+					if (pivotRow != k) {
+							for (size_t x = 0; x != n; ++x) { std::swap(column(x)[k], column(x)[pivotRow]); }
+						std::swap(pivots[k], pivots[pivotRow]);
+						oddPermutation = !oddPermutation;
+					}
+
+				T* lower	  = column(k);
+				const T pivot = lower[k];
+					for (size_t y = k + 1; y != n; ++y) { lower[y] /= pivot; }
+
+					// rank-1 update of the trailing block, walking down the columns keeps the access contiguous
+					for (size_t x = k + 1; x != n; ++x) {
+						T* values	   = column(x);
+						const T factor = values[k];
+							if (factor == static_cast<T>(0)) { continue; }
+							for (size_t y = k + 1; y != n; ++y) { values[y] -= lower[y] * factor; }
+					}
+			}
+		return regular;
+	}
+
+	// solves LU x = b in place for a right hand side already permuted by the pivots
+	template<class T, class Columns>
+	_MSTD_CONSTEXPR20 void lu_solve_in_place(size_t n, const Columns& column, T* values) {
+			// L y = P b
+			for (size_t x = 0; x != n; ++x) {
+				const T value = values[x];
+					if (value == static_cast<T>(0)) { continue; }
+				const T* lower = column(x);
+					for (size_t y = x + 1; y != n; ++y) { values[y] -= lower[y] * value; }
+			}
+
+			// U x = y
+			for (size_t x = n; x-- != 0;) {
+				const T* upper	= column(x);
+				values[x]	   /= upper[x];
+				const T value	= values[x];
+					for (size_t y = 0; y != x; ++y) { values[y] -= upper[y] * value; }
+			}
+	}
+
+	// fraction-free elimination, every division is exact so integer determinants stay exact. Overwrites the values
+	template<class T, class Columns>
+	_MSTD_CONSTEXPR20 T bareiss_determinant(size_t n, const Columns& column) {
+		T prevPivot = static_cast<T>(1);
+		bool odd	= false;
+			for (size_t k = 0; k + 1 < n; ++k) {
+					if (column(k)[k] == static_cast<T>(0)) {
+						size_t pivotRow = k + 1;
+							while (pivotRow != n && column(k)[pivotRow] == static_cast<T>(0)) { ++pivotRow; }
+							if (pivotRow == n) { return static_cast<T>(0); }
+
+							for (size_t x = 0; x != n; ++x) { std::swap(column(x)[k], column(x)[pivotRow]); }
+						odd = !odd;
+					}
+
+				const T* columnK = column(k);
+					for (size_t x = k + 1; x != n; ++x) {
+						T* values = column(x);
+							for (size_t y = k + 1; y != n; ++y) {
+								values[y] = (values[y] * columnK[k] - columnK[y] * values[k]) / prevPivot;
+							}
+					}
+				prevPivot = columnK[k];
+			}
+			if (n == 0) { return static_cast<T>(1); }
+		return odd ? -column(n - 1)[n - 1] : column(n - 1)[n - 1];
+	}
+
+		#pragma endregion // DECOMPOSITIONS
+} // namespace mstd::utils
+
 	#endif
 #endif
\ No newline at end of file
@@ -18,20 +18,795 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 	#else
 
 		#include <mstd/arithmetic_types.hpp>
+		#include <mstd/vec.hpp>
 
 namespace mstd {
-	_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint32_t swap_endians(uint32_t value) noexcept {
-		_MSTD_CONSTEXPR17 const uint32_t first_elem_mask	   = 0x0000'00FF;
-		_MSTD_CONSTEXPR17 const uint32_t second_elem_mask	   = 0x0000'FF00;
-		_MSTD_CONSTEXPR17 const uint32_t third_elem_mask	   = 0x00FF'0000;
-		_MSTD_CONSTEXPR17 const uint32_t forth_elem_mask	   = 0xFF00'0000;
+	enum class endian : uint8_t {
+		little,
+		big,
+		#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		native = big
+		#else
+		native = little
+		#endif
+	};
 
-		_MSTD_CONSTEXPR17 const uint32_t corner_elements_shift = 24;
-		_MSTD_CONSTEXPR17 const uint32_t middle_elements_shift = 8;
+	namespace utils {
+		#pragma region BYTESWAP_TRAITS
 
-		return ((value >> corner_elements_shift) & first_elem_mask) | ((value >> middle_elements_shift) & second_elem_mask) |
-			   ((value << middle_elements_shift) & third_elem_mask) | ((value << corner_elements_shift) & forth_elem_mask);
+		template<class T>
+		struct is_int128 : std::false_type {};
+
+		#ifdef __SIZEOF_INT128__
+		template<>
+		struct is_int128<__int128> : std::true_type {};
+
+		template<>
+		struct is_int128<unsigned __int128> : std::true_type {};
+		#endif
+
+		// integers (without bool), 128 bit integers where the compiler has them, float and double
+		template<class T>
+		static _MSTD_CONSTEXPR17 const bool is_byteswappable_v
+		  = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || is_int128<T>::value
+			|| (std::is_floating_point_v<T> && sizeof(T) <= sizeof(uint64_t));
+
+		template<size_t Size>
+		struct unsigned_of_size;
+
+		template<>
+		struct unsigned_of_size<1> {
+			using type = uint8_t;
+		};
+
+		template<>
+		struct unsigned_of_size<2> {
+			using type = uint16_t;
+		};
+
+		template<>
+		struct unsigned_of_size<4> {
+			using type = uint32_t;
+		};
+
+		template<>
+		struct unsigned_of_size<8> {
+			using type = uint64_t;
+		};
+
+		#ifdef __SIZEOF_INT128__
+		template<>
+		struct unsigned_of_size<16> {
+			using type = unsigned __int128;
+		};
+		#endif
+
+		#pragma endregion // BYTESWAP_TRAITS
+
+		template<class To, class From>
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 To bit_cast(const From& value) noexcept {
+			static_assert(sizeof(To) == sizeof(From), "bit_cast needs types of the same size");
+		#if _MSTD_HAS_CXX20
+			return std::bit_cast<To>(value);
+		#else
+			To res;
+			std::memcpy(&res, &value, sizeof(To));
+			return res;
+		#endif
+		}
+
+		template<class U>
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 U byteswap_unsigned(U value) noexcept {
+				if _MSTD_CONSTEXPR17 (sizeof(U) == 1) { return value; }
+				else if _MSTD_CONSTEXPR17 (sizeof(U) > 8) {
+					// two 64 bit halves swapped and exchanged
+					const uint64_t lo = static_cast<uint64_t>(value);
+					const uint64_t hi = static_cast<uint64_t>(value >> 64);
+					return (static_cast<U>(byteswap_unsigned(lo)) << 64) | static_cast<U>(byteswap_unsigned(hi));
+				}
+				else {
+		#if defined(__GNUC__) || defined(__clang__)
+						if _MSTD_CONSTEXPR17 (sizeof(U) == 2) { return __builtin_bswap16(value); }
+						else if _MSTD_CONSTEXPR17 (sizeof(U) == 4) { return __builtin_bswap32(value); }
+						else { return __builtin_bswap64(value); }
+		#else
+						if (!_MSTD_IS_CONSTANT_EVALUATED()) {
+								if _MSTD_CONSTEXPR17 (sizeof(U) == 2) { return _byteswap_ushort(value); }
+								else if _MSTD_CONSTEXPR17 (sizeof(U) == 4) { return _byteswap_ulong(value); }
+								else { return _byteswap_uint64(value); }
+						}
+
+					U res = 0;
+						for (size_t i = 0; i != sizeof(U); ++i) {
+							res	  = static_cast<U>((res << 8) | (value & 0xFF));
+							value = static_cast<U>(value >> 8);
+						}
+					return res;
+		#endif
+				}
+		}
+	} // namespace utils
+
+		#pragma region BYTESWAP
+
+	// reverses the order of the bytes of value, floating point values are swapped through their bit pattern
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T byteswap(T value) noexcept {
+		using bits_type = typename utils::unsigned_of_size<sizeof(T)>::type;
+		return utils::bit_cast<T>(utils::byteswap_unsigned(utils::bit_cast<bits_type>(value)));
+	}
+
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint32_t swap_endians(uint32_t value) noexcept { return byteswap(value); }
+
+	// value stored in the given byte order converted from/to the order of this machine, no-ops where they match
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T to_little(T value) noexcept {
+			if _MSTD_CONSTEXPR17 (endian::native == endian::little) { return value; }
+			else { return byteswap(value); }
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T to_big(T value) noexcept {
+			if _MSTD_CONSTEXPR17 (endian::native == endian::big) { return value; }
+			else { return byteswap(value); }
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T from_little(T value) noexcept {
+		return to_little(value);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T from_big(T value) noexcept {
+		return to_big(value);
+	}
+
+		#pragma endregion // BYTESWAP
+	namespace utils {
+		#pragma region BYTESWAP_KERNELS
+
+		// reverses every Size byte element of a buffer, 16 or 32 bytes per shuffle and one element at a time for the tail
+		template<size_t Size>
+		struct byteswap_kernels {
+			static void run(const unsigned char* src, unsigned char* dst, size_t count) noexcept {
+				const size_t bytes = count * Size;
+				size_t i		   = 0;
+		#if _MSTD_HAS_AVX2
+				const __m256i mask256 = _mm256_broadcastsi128_si256(_mask());
+					for (; i + 32 <= bytes; i += 32) {
+						const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(value, mask256));
+					}
+		#endif
+		#if _MSTD_HAS_SSSE3
+				const __m128i mask = _mask();
+					for (; i + 16 <= bytes; i += 16) {
+						const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(value, mask));
+					}
+		#elif _MSTD_HAS_NEON
+					for (; i + 16 <= bytes; i += 16) { vst1q_u8(dst + i, _reverse(vld1q_u8(src + i))); }
+		#endif
+					for (; i != bytes; i += Size) { _swap_one(src + i, dst + i); }
+			}
+
+		private:
+			// memcpy keeps the tail free of alignment and aliasing assumptions, it compiles to a plain load and store
+			static void _swap_one(const unsigned char* src, unsigned char* dst) noexcept {
+					if _MSTD_CONSTEXPR17 (Size == 16) {
+						uint64_t lo;
+						uint64_t hi;
+						std::memcpy(&lo, src, sizeof(uint64_t));
+						std::memcpy(&hi, src + sizeof(uint64_t), sizeof(uint64_t));
+						lo = byteswap_unsigned(lo);
+						hi = byteswap_unsigned(hi);
+						std::memcpy(dst, &hi, sizeof(uint64_t));
+						std::memcpy(dst + sizeof(uint64_t), &lo, sizeof(uint64_t));
+					}
+					else {
+						typename unsigned_of_size<Size>::type value;
+						std::memcpy(&value, src, Size);
+						value = byteswap_unsigned(value);
+						std::memcpy(dst, &value, Size);
+					}
+			}
+
+		#if _MSTD_HAS_SSSE3
+			// byte j of every element comes from byte Size - 1 - j of the same element
+			static __m128i _mask() noexcept {
+				alignas(16) char indices[16];
+					for (size_t j = 0; j != 16; ++j) { indices[j] = static_cast<char>(j - j % Size + Size - 1 - j % Size); }
+				return _mm_load_si128(reinterpret_cast<const __m128i*>(indices));
+			}
+		#elif _MSTD_HAS_NEON
+			static uint8x16_t _reverse(uint8x16_t value) noexcept {
+					if _MSTD_CONSTEXPR17 (Size == 2) { return vrev16q_u8(value); }
+					else if _MSTD_CONSTEXPR17 (Size == 4) { return vrev32q_u8(value); }
+					else if _MSTD_CONSTEXPR17 (Size == 8) { return vrev64q_u8(value); }
+					else {
+						const uint8x16_t halves = vrev64q_u8(value);
+						return vextq_u8(halves, halves, 8);
+					}
+			}
+		#endif
+		};
+
+		template<>
+		struct byteswap_kernels<1> {
+			static void run(const unsigned char* src, unsigned char* dst, size_t count) noexcept {
+					if (src != dst) { std::memmove(dst, src, count); }
+			}
+		};
+
+		#pragma endregion // BYTESWAP_KERNELS
+	} // namespace utils
+
+	// Bulk conversions. dst may be the same buffer as src (in place), other overlaps are not allowed.
+
+		#pragma region BULK_BYTESWAP
+
+	// dst[i] = byteswap(src[i])
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	void byteswap(const T* src, T* dst, size_t count) noexcept {
+		utils::byteswap_kernels<sizeof(T)>::run(reinterpret_cast<const unsigned char*>(src),
+		  reinterpret_cast<unsigned char*>(dst), count);
+	}
+
+	// data[i] = byteswap(data[i])
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	void byteswap(T* data, size_t count) noexcept {
+		byteswap(static_cast<const T*>(data), data, count);
+	}
+
+	namespace utils {
+		template<endian Order, class T>
+		void convert_order(const T* src, T* dst, size_t count) noexcept {
+				if _MSTD_CONSTEXPR17 (Order == endian::native) {
+						if (src != dst) { std::memmove(dst, src, count * sizeof(T)); }
+				}
+				else { byteswap(src, dst, count); }
+		}
+	} // namespace utils
+
+	// dst[i] = to_little(src[i])
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	void to_little(const T* src, T* dst, size_t count) noexcept {
+		utils::convert_order<endian::little>(src, dst, count);
+	}
+
+	// dst[i] = to_big(src[i])
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	void to_big(const T* src, T* dst, size_t count) noexcept {
+		utils::convert_order<endian::big>(src, dst, count);
+	}
+
+	// dst[i] = from_little(src[i])
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	void from_little(const T* src, T* dst, size_t count) noexcept {
+		utils::convert_order<endian::little>(src, dst, count);
+	}
+
+	// dst[i] = from_big(src[i])
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_byteswappable_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_byteswappable_v<T>, bool> = true>
+		#endif
+	void from_big(const T* src, T* dst, size_t count) noexcept {
+		utils::convert_order<endian::big>(src, dst, count);
+	}
+
+		#pragma endregion // BULK_BYTESWAP
+
+	namespace utils {
+		#pragma region BIT_FALLBACKS
+
+		// unsigned integers without bool, the types the bit counting functions accept
+		template<class T>
+		static _MSTD_CONSTEXPR17 const bool is_bit_integer_v
+		  = std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= sizeof(uint64_t);
+
+		// Portable versions of the bit counting intrinsics. They are used for constant evaluation where the intrinsics are
+		// not constexpr and when the instruction is not available.
+
+		template<class T>
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 int popcount_fallback(T value) noexcept {
+			uint64_t x = value;
+			x		   = x - ((x >> 1) & 0x5555'5555'5555'5555ull);
+			x		   = (x & 0x3333'3333'3333'3333ull) + ((x >> 2) & 0x3333'3333'3333'3333ull);
+			x		   = (x + (x >> 4)) & 0x0F0F'0F0F'0F0F'0F0Full;
+			return static_cast<int>((x * 0x0101'0101'0101'0101ull) >> 56);
+		}
+
+		template<class T>
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 int countl_zero_fallback(T value) noexcept {
+			// every bit below the highest set one is set, the zeros are whatever popcount did not count
+			uint64_t x = value;
+			x |= x >> 1;
+			x |= x >> 2;
+			x |= x >> 4;
+			x |= x >> 8;
+			x |= x >> 16;
+			x |= x >> 32;
+			return std::numeric_limits<T>::digits - popcount_fallback(x);
+		}
+
+		template<class T>
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 int countr_zero_fallback(T value) noexcept {
+				if (value == 0) { return std::numeric_limits<T>::digits; }
+			const uint64_t x = value;
+			return popcount_fallback((x & (~x + 1)) - 1);
+		}
+
+		// deposits the low bits of value at the set bits of mask, lowest first
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint64_t pdep_fallback(uint64_t value, uint64_t mask) noexcept {
+			uint64_t res = 0;
+				for (uint64_t bit = 1; mask != 0; bit += bit) {
+						if ((value & bit) != 0) { res |= mask & (~mask + 1); }
+					mask &= mask - 1;
+				}
+			return res;
+		}
+
+		// gathers the bits of value at the set bits of mask into the low bits, lowest first
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint64_t pext_fallback(uint64_t value, uint64_t mask) noexcept {
+			uint64_t res = 0;
+				for (uint64_t bit = 1; mask != 0; bit += bit) {
+						if ((value & mask & (~mask + 1)) != 0) { res |= bit; }
+					mask &= mask - 1;
+				}
+			return res;
+		}
+
+		#pragma endregion // BIT_FALLBACKS
+	} // namespace utils
+
+		#pragma region BIT_COUNTING
+
+	// number of set bits
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 int popcount(T value) noexcept {
+		#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_popcountll(value);
+		#else
+			#if defined(_MSC_VER) && defined(__AVX__) && (defined(_M_X64) || defined(_M_ARM64))
+			if (!_MSTD_IS_CONSTANT_EVALUATED()) { return static_cast<int>(__popcnt64(value)); }
+			#endif
+		return utils::popcount_fallback(value);
+		#endif
+	}
+
+	// number of zero bits above the highest set bit, every bit for 0
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 int countl_zero(T value) noexcept {
+		#if defined(__GNUC__) || defined(__clang__)
+		_MSTD_CONSTEXPR17 const int extra_bits
+		  = std::numeric_limits<unsigned long long>::digits - std::numeric_limits<T>::digits;
+		return value == 0 ? std::numeric_limits<T>::digits : __builtin_clzll(value) - extra_bits;
+		#else
+			#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+			if (!_MSTD_IS_CONSTANT_EVALUATED() && value != 0) {
+				unsigned long index = 0;
+				_BitScanReverse64(&index, value);
+				return std::numeric_limits<T>::digits - 1 - static_cast<int>(index);
+			}
+			#endif
+		return utils::countl_zero_fallback(value);
+		#endif
 	}
+
+	// number of zero bits below the lowest set bit, every bit for 0
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 int countr_zero(T value) noexcept {
+		#if defined(__GNUC__) || defined(__clang__)
+		return value == 0 ? std::numeric_limits<T>::digits : __builtin_ctzll(value);
+		#else
+			#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+			if (!_MSTD_IS_CONSTANT_EVALUATED() && value != 0) {
+				unsigned long index = 0;
+				_BitScanForward64(&index, value);
+				return static_cast<int>(index);
+			}
+			#endif
+		return utils::countr_zero_fallback(value);
+		#endif
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 int countl_one(T value) noexcept {
+		return countl_zero(static_cast<T>(~value));
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 int countr_one(T value) noexcept {
+		return countr_zero(static_cast<T>(~value));
+	}
+
+	// number of bits needed to store value, 0 for 0
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 int bit_width(T value) noexcept {
+		return std::numeric_limits<T>::digits - countl_zero(value);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool has_single_bit(T value) noexcept {
+		return value != 0 && (value & (value - 1)) == 0;
+	}
+
+	// smallest power of two not less than value, the result has to fit in T
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T bit_ceil(T value) noexcept {
+			if (value <= 1) { return static_cast<T>(1); }
+		return static_cast<T>(static_cast<uint64_t>(1) << bit_width(static_cast<T>(value - 1)));
+	}
+
+	// largest power of two not greater than value, 0 for 0
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T bit_floor(T value) noexcept {
+			if (value == 0) { return static_cast<T>(0); }
+		return static_cast<T>(static_cast<uint64_t>(1) << (bit_width(value) - 1));
+	}
+
+		#pragma endregion // BIT_COUNTING
+
+		#pragma region BIT_PERMUTATIONS
+
+	// rotates left by shift bits, a negative shift rotates right
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T rotl(T value, int shift) noexcept {
+		_MSTD_CONSTEXPR17 const int digits = std::numeric_limits<T>::digits;
+		const int s						   = shift & (digits - 1);
+			if (s == 0) { return value; }
+		return static_cast<T>(static_cast<T>(value << s) | static_cast<T>(value >> (digits - s)));
+	}
+
+	// rotates right by shift bits, a negative shift rotates left
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T rotr(T value, int shift) noexcept {
+		return rotl(value, -shift);
+	}
+
+	// bit i moves to bit digits - 1 - i
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T bit_reverse(T value) noexcept {
+		// bits are reversed inside every byte, then the bytes are reversed
+		uint64_t x = value;
+		x		   = ((x >> 1) & 0x5555'5555'5555'5555ull) | ((x & 0x5555'5555'5555'5555ull) << 1);
+		x		   = ((x >> 2) & 0x3333'3333'3333'3333ull) | ((x & 0x3333'3333'3333'3333ull) << 2);
+		x		   = ((x >> 4) & 0x0F0F'0F0F'0F0F'0F0Full) | ((x & 0x0F0F'0F0F'0F0F'0F0Full) << 4);
+		return byteswap(static_cast<T>(x));
+	}
+
+	// deposits the low bits of value at the set bits of mask (BMI2 pdep)
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint64_t pdep(uint64_t value, uint64_t mask) noexcept {
+		#if _MSTD_HAS_BMI2
+			if (!_MSTD_IS_CONSTANT_EVALUATED()) { return _pdep_u64(value, mask); }
+		#endif
+		return utils::pdep_fallback(value, mask);
+	}
+
+	// gathers the bits of value at the set bits of mask into the low bits (BMI2 pext)
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint64_t pext(uint64_t value, uint64_t mask) noexcept {
+		#if _MSTD_HAS_BMI2
+			if (!_MSTD_IS_CONSTANT_EVALUATED()) { return _pext_u64(value, mask); }
+		#endif
+		return utils::pext_fallback(value, mask);
+	}
+
+		#pragma endregion // BIT_PERMUTATIONS
+
+	namespace utils {
+		#pragma region MORTON_HELPERS
+
+		static _MSTD_CONSTEXPR17 const uint64_t morton2_mask = 0x5555'5555'5555'5555ull;
+		static _MSTD_CONSTEXPR17 const uint64_t morton3_mask = 0x1249'2492'4924'9249ull;
+
+		// Spreads the bits of value so there are Dims - 1 zero bits between them, shifts and masks instead of pdep for
+		// constant evaluation and machines without BMI2.
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint64_t morton_spread2(uint32_t value) noexcept {
+			uint64_t x = value;
+			x		   = (x | (x << 16)) & 0x0000'FFFF'0000'FFFFull;
+			x		   = (x | (x << 8)) & 0x00FF'00FF'00FF'00FFull;
+			x		   = (x | (x << 4)) & 0x0F0F'0F0F'0F0F'0F0Full;
+			x		   = (x | (x << 2)) & 0x3333'3333'3333'3333ull;
+			return (x | (x << 1)) & morton2_mask;
+		}
+
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint32_t morton_compact2(uint64_t code) noexcept {
+			uint64_t x = code & morton2_mask;
+			x		   = (x | (x >> 1)) & 0x3333'3333'3333'3333ull;
+			x		   = (x | (x >> 2)) & 0x0F0F'0F0F'0F0F'0F0Full;
+			x		   = (x | (x >> 4)) & 0x00FF'00FF'00FF'00FFull;
+			x		   = (x | (x >> 8)) & 0x0000'FFFF'0000'FFFFull;
+			return static_cast<uint32_t>(x | (x >> 16));
+		}
+
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint64_t morton_spread3(uint32_t value) noexcept {
+			uint64_t x = value & 0x1F'FFFFu;
+			x		   = (x | (x << 32)) & 0x001F'0000'0000'FFFFull;
+			x		   = (x | (x << 16)) & 0x001F'0000'FF00'00FFull;
+			x		   = (x | (x << 8)) & 0x100F'00F0'0F00'F00Full;
+			x		   = (x | (x << 4)) & 0x10C3'0C30'C30C'30C3ull;
+			return (x | (x << 2)) & morton3_mask;
+		}
+
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint32_t morton_compact3(uint64_t code) noexcept {
+			uint64_t x = code & morton3_mask;
+			x		   = (x | (x >> 2)) & 0x10C3'0C30'C30C'30C3ull;
+			x		   = (x | (x >> 4)) & 0x100F'00F0'0F00'F00Full;
+			x		   = (x | (x >> 8)) & 0x001F'0000'FF00'00FFull;
+			x		   = (x | (x >> 16)) & 0x001F'0000'0000'FFFFull;
+			return static_cast<uint32_t>((x | (x >> 32)) & 0x1F'FFFFu);
+		}
+
+		#pragma endregion // MORTON_HELPERS
+	} // namespace utils
+
+		#pragma region MORTON
+
+	// Z-order code of a 2D position, bit i of x goes to bit 2i and bit i of y to bit 2i + 1
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint64_t morton_encode(const vec<2, uint32_t>& pos) noexcept {
+		#if _MSTD_HAS_BMI2
+			if (!_MSTD_IS_CONSTANT_EVALUATED()) {
+				return _pdep_u64(pos[0], utils::morton2_mask) | _pdep_u64(pos[1], utils::morton2_mask << 1);
+			}
+		#endif
+		return utils::morton_spread2(pos[0]) | (utils::morton_spread2(pos[1]) << 1);
+	}
+
+	// Z-order code of a 3D position, every component keeps its low 21 bits
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 uint64_t morton_encode(const vec<3, uint32_t>& pos) noexcept {
+		#if _MSTD_HAS_BMI2
+			if (!_MSTD_IS_CONSTANT_EVALUATED()) {
+				return _pdep_u64(pos[0], utils::morton3_mask) | _pdep_u64(pos[1], utils::morton3_mask << 1)
+					   | _pdep_u64(pos[2], utils::morton3_mask << 2);
+			}
+		#endif
+		return utils::morton_spread3(pos[0]) | (utils::morton_spread3(pos[1]) << 1)
+			   | (utils::morton_spread3(pos[2]) << 2);
+	}
+
+	// position of a 2D (N = 2) or 3D (N = 3) Z-order code
+		#if _MSTD_HAS_CXX20
+	template<size_t N>
+	requires (N == 2 || N == 3)
+		#else
+	template<size_t N, std::enable_if_t<(N == 2 || N == 3), bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 vec<N, uint32_t> morton_decode(uint64_t code) noexcept {
+		vec<N, uint32_t> res;
+		#if _MSTD_HAS_BMI2
+			if (!_MSTD_IS_CONSTANT_EVALUATED()) {
+				_MSTD_CONSTEXPR17 const uint64_t mask = N == 2 ? utils::morton2_mask : utils::morton3_mask;
+					for (size_t i = 0; i != N; ++i) { res[i] = static_cast<uint32_t>(_pext_u64(code, mask << i)); }
+				return res;
+			}
+		#endif
+			for (size_t i = 0; i != N; ++i) {
+				res[i] = N == 2 ? utils::morton_compact2(code >> i) : utils::morton_compact3(code >> i);
+			}
+		return res;
+	}
+
+		#pragma endregion // MORTON
+
+	namespace utils {
+		inline size_t popcount_bytes(const unsigned char* data, size_t bytes) noexcept {
+			size_t res = 0;
+			size_t i   = 0;
+		#if _MSTD_HAS_AVX2 && !defined(__AVX512VPOPCNTDQ__)
+			// every nibble counted by a 16 entry shuffle table, the byte counts of up to 8 blocks (at most 64 per byte)
+			// summed into 64 bit lanes by one psadbw. With vpopcntq the word loop below vectorizes better on its own.
+			const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1,
+			  2, 2, 3, 2, 3, 3, 4);
+			const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+			__m256i total			 = _mm256_setzero_si256();
+				while (i + 32 <= bytes) {
+					__m256i byteCounts = _mm256_setzero_si256();
+						for (size_t block = 0; block != 8 && i + 32 <= bytes; ++block, i += 32) {
+							const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+							const __m256i lo	= _mm256_shuffle_epi8(table, _mm256_and_si256(value, lowNibbles));
+							const __m256i hi =
+							  _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(value, 4), lowNibbles));
+							byteCounts = _mm256_add_epi8(byteCounts, _mm256_add_epi8(lo, hi));
+						}
+					total = _mm256_add_epi64(total, _mm256_sad_epu8(byteCounts, _mm256_setzero_si256()));
+				}
+			alignas(32) uint64_t lanes[4];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), total);
+			res = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+		#endif
+				for (; i + sizeof(uint64_t) <= bytes; i += sizeof(uint64_t)) {
+					uint64_t word;
+					std::memcpy(&word, data + i, sizeof(uint64_t));
+					res += static_cast<size_t>(popcount(word));
+				}
+				for (; i != bytes; ++i) { res += static_cast<size_t>(popcount(data[i])); }
+			return res;
+		}
+	} // namespace utils
+
+	// Bulk versions. dst may be the same buffer as src when the element types match.
+
+		#pragma region BULK_BITS
+
+	// number of set bits in the whole buffer
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	size_t popcount(const T* data, size_t count) noexcept {
+		return utils::popcount_bytes(reinterpret_cast<const unsigned char*>(data), count * sizeof(T));
+	}
+
+	// dst[i] = popcount(src[i])
+		#if _MSTD_HAS_CXX20
+	template<class T, class R>
+	requires (utils::is_bit_integer_v<T> && std::is_integral_v<R>)
+		#else
+	template<class T, class R, std::enable_if_t<(utils::is_bit_integer_v<T> && std::is_integral_v<R>), bool> = true>
+		#endif
+	void popcount(const T* src, R* dst, size_t count) noexcept {
+			for (size_t i = 0; i != count; ++i) { dst[i] = static_cast<R>(popcount(src[i])); }
+	}
+
+	// dst[i] = bit_reverse(src[i])
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::is_bit_integer_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::is_bit_integer_v<T>, bool> = true>
+		#endif
+	void bit_reverse(const T* src, T* dst, size_t count) noexcept {
+			for (size_t i = 0; i != count; ++i) { dst[i] = bit_reverse(src[i]); }
+	}
+
+	// dst[i] = pdep(src[i], mask)
+	inline void pdep(const uint64_t* src, uint64_t mask, uint64_t* dst, size_t count) noexcept {
+			for (size_t i = 0; i != count; ++i) { dst[i] = pdep(src[i], mask); }
+	}
+
+	// dst[i] = pext(src[i], mask)
+	inline void pext(const uint64_t* src, uint64_t mask, uint64_t* dst, size_t count) noexcept {
+			for (size_t i = 0; i != count; ++i) { dst[i] = pext(src[i], mask); }
+	}
+
+	// dst[i] = morton_encode(src[i])
+		#if _MSTD_HAS_CXX20
+	template<size_t N>
+	requires (N == 2 || N == 3)
+		#else
+	template<size_t N, std::enable_if_t<(N == 2 || N == 3), bool> = true>
+		#endif
+	void morton_encode(const vec<N, uint32_t>* src, uint64_t* dst, size_t count) noexcept {
+			for (size_t i = 0; i != count; ++i) { dst[i] = morton_encode(src[i]); }
+	}
+
+	// dst[i] = morton_decode<N>(src[i])
+		#if _MSTD_HAS_CXX20
+	template<size_t N>
+	requires (N == 2 || N == 3)
+		#else
+	template<size_t N, std::enable_if_t<(N == 2 || N == 3), bool> = true>
+		#endif
+	void morton_decode(const uint64_t* src, vec<N, uint32_t>* dst, size_t count) noexcept {
+			for (size_t i = 0; i != count; ++i) { dst[i] = morton_decode<N>(src[i]); }
+	}
+
+		#pragma endregion // BULK_BITS
 } // namespace mstd
 	#endif
-#endif
\ No newline at end of file
+#endif
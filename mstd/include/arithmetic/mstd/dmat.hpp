@@ -0,0 +1,596 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_DMAT_HPP_
+	#define _MSTD_DMAT_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/dvec.hpp>
+		#include <mstd/mat.hpp>
+
+namespace mstd {
+	// non owning column major view, column x starts stride values after column x - 1. T may be const. mat, dmat and raw
+	// buffers convert to it without copying
+	template<class T>
+	class dmat_view {
+	public:
+		using value_type = std::remove_const_t<T>;
+
+	private:
+		T* _data		= nullptr;
+		size_t _columns = 0;
+		size_t _rows	= 0;
+		size_t _stride	= 0;
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 dmat_view() noexcept = default;
+
+		_MSTD_CONSTEXPR20 dmat_view(T* data, size_t columns, size_t rows) noexcept
+			: _data(data), _columns(columns), _rows(rows), _stride(rows) {}
+
+		_MSTD_CONSTEXPR20 dmat_view(T* data, size_t columns, size_t rows, size_t stride) noexcept
+			: _data(data), _columns(columns), _rows(rows), _stride(stride) {}
+
+		template<size_t C, size_t R>
+		_MSTD_CONSTEXPR20 dmat_view(mat<C, R, value_type>& matrix) noexcept
+			: _data(static_cast<value_type*>(matrix[0])), _columns(C), _rows(R), _stride(R) {}
+
+		template<size_t C, size_t R>
+		_MSTD_CONSTEXPR20 dmat_view(const mat<C, R, value_type>& matrix) noexcept
+			: _data(static_cast<const value_type*>(matrix[0])), _columns(C), _rows(R), _stride(R) {
+			static_assert(std::is_const_v<T>, "a const mat can only be viewed through dmat_view<const T>");
+		}
+
+		template<class Allocator>
+		_MSTD_CONSTEXPR20 dmat_view(dmat<value_type, Allocator>& matrix) noexcept
+			: _data(matrix.data()), _columns(matrix.columns()), _rows(matrix.rows()), _stride(matrix.rows()) {}
+
+		template<class Allocator>
+		_MSTD_CONSTEXPR20 dmat_view(const dmat<value_type, Allocator>& matrix) noexcept
+			: _data(matrix.data()), _columns(matrix.columns()), _rows(matrix.rows()), _stride(matrix.rows()) {
+			static_assert(std::is_const_v<T>, "a const dmat can only be viewed through dmat_view<const T>");
+		}
+
+		// dmat_view<T> -> dmat_view<const T>
+		template<class U, std::enable_if_t<std::is_same_v<const U, T>, bool> = true>
+		_MSTD_CONSTEXPR20 dmat_view(const dmat_view<U>& other) noexcept
+			: _data(other.data()), _columns(other.columns()), _rows(other.rows()), _stride(other.stride()) {}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region GETTERS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* data() const noexcept { return _data; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t columns() const noexcept { return _columns; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t rows() const noexcept { return _rows; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t stride() const noexcept { return _stride; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _columns == 0 || _rows == 0; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 dvec_view<T> column(size_t idx) const noexcept {
+			return dvec_view<T>(_data + idx * _stride, _rows);
+		}
+
+		// columns x rows block starting at (firstColumn, firstRow), clipped to the viewed values
+		[[nodiscard]] _MSTD_CONSTEXPR20 dmat_view block(size_t firstColumn, size_t firstRow, size_t columns,
+		  size_t rows) const noexcept {
+			firstColumn = std::min(firstColumn, _columns);
+			firstRow	= std::min(firstRow, _rows);
+			return dmat_view(_data + firstColumn * _stride + firstRow, std::min(columns, _columns - firstColumn),
+			  std::min(rows, _rows - firstRow), _stride);
+		}
+
+		// pointer to the first value of column idx, view[x][y] is the value in column x and row y
+		_MSTD_CONSTEXPR20 T* operator[](size_t idx) const noexcept { return _data + idx * _stride; }
+
+		#pragma endregion // GETTERS
+	};
+
+	namespace utils {
+		// rows of dst updated together, four column segments of this length stay in L1 while the inner loop runs
+		static _MSTD_CONSTEXPR17 const size_t gemm_row_block	  = 256;
+		// columns of a (rows of b) per pass, the gemm_row_block x gemm_inner_block block of a stays in L2
+		static _MSTD_CONSTEXPR17 const size_t gemm_inner_block  = 128;
+		// columns of dst sharing every load of a column of a
+		static _MSTD_CONSTEXPR17 const size_t gemm_column_block = 4;
+		// below this many multiply adds per thread starting a thread costs more than it saves
+		static _MSTD_CONSTEXPR17 const size_t gemm_min_work	  = 1 << 20;
+
+		template<size_t Columns, class T>
+		void gemm_columns(const dmat_view<const T>& a, const dmat_view<const T>& b, const dmat_view<T>& dst, size_t x,
+		  size_t firstRow, size_t rowCount, size_t firstInner, size_t lastInner) {
+			T* columns[Columns];
+				for (size_t c = 0; c != Columns; ++c) { columns[c] = dst[x + c] + firstRow; }
+
+			T values[Columns];
+				for (size_t k = firstInner; k != lastInner; ++k) {
+						for (size_t c = 0; c != Columns; ++c) { values[c] = b[x + c][k]; }
+					lane_kernels<T>::fma_columns(columns, a[k] + firstRow, values, rowCount);
+				}
+		}
+
+		// columns [first, last) of dst = a * b. Blocked so the parts of a and dst in use stay in cache, every value of a
+		// loaded into a register updates gemm_column_block columns of dst
+		template<class T>
+		void gemm_range(const dmat_view<const T>& a, const dmat_view<const T>& b, const dmat_view<T>& dst, size_t first,
+		  size_t last) {
+			const size_t rows  = a.rows();
+			const size_t inner = std::min(a.columns(), b.rows());
+				for (size_t x = first; x != last; ++x) { std::fill_n(dst[x], rows, static_cast<T>(0)); }
+
+				for (size_t firstInner = 0; firstInner < inner; firstInner += gemm_inner_block) {
+					const size_t lastInner = std::min(firstInner + gemm_inner_block, inner);
+						for (size_t firstRow = 0; firstRow < rows; firstRow += gemm_row_block) {
+							const size_t rowCount = std::min(gemm_row_block, rows - firstRow);
+
+							size_t x = first;
+								for (; x + gemm_column_block <= last; x += gemm_column_block) {
+									gemm_columns<gemm_column_block>(a, b, dst, x, firstRow, rowCount, firstInner, lastInner);
+								}
+								for (; x != last; ++x) {
+									gemm_columns<1>(a, b, dst, x, firstRow, rowCount, firstInner, lastInner);
+								}
+						}
+				}
+		}
+	} // namespace utils
+
+	// dst = a * b for column major views. dst needs a.rows() rows and b.columns() columns and must not overlap a or b, the
+	// inner dimension is min(a.columns(), b.rows()). threads > 1 splits the columns of dst across that many threads (0 uses
+	// every hardware thread). Fixed size matrices are passed as gemm<T>(a, b, dst)
+	template<class T>
+	void gemm(const dmat_view<const T>& a, const dmat_view<const T>& b, const dmat_view<T>& dst, size_t threads = 1) {
+		const size_t columns = std::min(b.columns(), dst.columns());
+		const size_t work	 = std::max<size_t>(a.rows() * std::min(a.columns(), b.rows()), 1);
+
+		utils::parallel_for(columns, threads, std::max<size_t>(utils::gemm_min_work / work, 1),
+		  [&a, &b, &dst](size_t first, size_t last) { utils::gemm_range(a, b, dst, first, last); });
+	}
+
+	// heap allocated column major matrix with sizes chosen at runtime, m[x][y] is the value in column x and row y.
+	// Element wise operations between two dmats work on the overlapping columns and rows, the storage is aligned by the
+	// allocator for the SIMD lane kernels
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> >
+		#endif
+	class dmat {
+	public:
+		using value_type	  = T;
+		using allocator_type  = Allocator;
+		using view_type		  = dmat_view<T>;
+		using const_view_type = dmat_view<const T>;
+		using column_type	  = dvec<T, Allocator>;
+
+	private:
+		using _storage_type = std::vector<T, Allocator>;
+		using _kernels		= utils::lane_kernels<T>;
+
+		// tile edge of the blocked transpose, a tile of the source and one of the result fit in L1 together
+		static _MSTD_CONSTEXPR17 const size_t _transpose_block = 32;
+
+		size_t _columns = 0;
+		size_t _rows	= 0;
+		_storage_type _values;
+
+		#pragma region PRIVATE_METHODS
+
+		// func(dst, src, count) for every overlapping column, one call when the column lengths match
+		template<class Func>
+		_MSTD_CONSTEXPR20 void _zip(const dmat& other, const Func& func) {
+			const size_t columns = std::min(_columns, other._columns);
+				if (_rows == other._rows) {
+					func(data(), other.data(), columns * _rows);
+					return;
+				}
+
+			const size_t rows = std::min(_rows, other._rows);
+				for (size_t x = 0; x != columns; ++x) { func((*this)[x], other[x], rows); }
+		}
+
+		#pragma endregion // PRIVATE_METHODS
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 dmat() = default;
+
+		_MSTD_CONSTEXPR20 explicit dmat(const Allocator& allocator) : _values(allocator) {}
+
+		_MSTD_CONSTEXPR20 dmat(size_t columns, size_t rows, const Allocator& allocator = Allocator())
+			: _columns(columns), _rows(rows), _values(columns * rows, static_cast<T>(0), allocator) {}
+
+		_MSTD_CONSTEXPR20 dmat(size_t columns, size_t rows, const T& value, const Allocator& allocator = Allocator())
+			: _columns(columns), _rows(rows), _values(columns * rows, value, allocator) {}
+
+		_MSTD_CONSTEXPR20 explicit dmat(const const_view_type& view, const Allocator& allocator = Allocator())
+			: dmat(view.columns(), view.rows(), allocator) {
+				for (size_t x = 0; x != _columns; ++x) { std::copy_n(view[x], _rows, (*this)[x]); }
+		}
+
+		template<size_t C, size_t R>
+		_MSTD_CONSTEXPR20 dmat(const mat<C, R, T>& matrix, const Allocator& allocator = Allocator())
+			: dmat(const_view_type(matrix), allocator) {}
+
+		_MSTD_CONSTEXPR20 dmat(const dmat& other)	  = default;
+		_MSTD_CONSTEXPR20 dmat(dmat&& other) noexcept = default;
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region DESTRUCTOR
+		_MSTD_CONSTEXPR20 ~dmat() noexcept = default;
+		#pragma endregion // DESTRUCTOR
+
+		#pragma region ASSIGN
+		_MSTD_CONSTEXPR20 dmat& operator=(const dmat& other)	 = default;
+		_MSTD_CONSTEXPR20 dmat& operator=(dmat&& other) noexcept = default;
+		#pragma endregion // ASSIGN
+
+		#pragma region PREDEFINED
+
+		static _MSTD_CONSTEXPR20 dmat zero(size_t columns, size_t rows) { return dmat(columns, rows); }
+
+		static _MSTD_CONSTEXPR20 dmat one(size_t columns, size_t rows) { return fill(columns, rows, static_cast<T>(1)); }
+
+		static _MSTD_CONSTEXPR20 dmat fill(size_t columns, size_t rows, const T& value) { return dmat(columns, rows, value); }
+
+		static _MSTD_CONSTEXPR20 dmat identity(size_t size) { return fill_identity(size, static_cast<T>(1)); }
+
+		static _MSTD_CONSTEXPR20 dmat fill_identity(size_t size, const T& value) {
+			dmat res(size, size);
+				for (size_t i = 0; i != size; ++i) { res[i][i] = value; }
+			return res;
+		}
+
+		#pragma endregion // PREDEFINED
+
+		#pragma region PREDEFINED_CHECKS
+
+		_MSTD_CONSTEXPR20 bool is_zero() const { return is_filled_with(static_cast<T>(0)); }
+
+		_MSTD_CONSTEXPR20 bool is_one() const { return is_filled_with(static_cast<T>(1)); }
+
+		_MSTD_CONSTEXPR20 bool is_filled_with(const T& value) const {
+			return std::all_of(_values.begin(), _values.end(), [&value](const T& element) { return element == value; });
+		}
+
+		_MSTD_CONSTEXPR20 bool is_square() const noexcept { return _columns == _rows; }
+
+		_MSTD_CONSTEXPR20 bool is_identity() const { return is_identity_filled_with(static_cast<T>(1)); }
+
+		_MSTD_CONSTEXPR20 bool is_identity_filled_with(const T& value) const {
+				if (!is_square()) { return false; }
+				for (size_t x = 0; x != _columns; ++x) {
+						for (size_t y = 0; y != _rows; ++y) {
+								if ((*this)[x][y] != (x == y ? value : static_cast<T>(0))) { return false; }
+						}
+				}
+			return true;
+		}
+
+		#pragma endregion // PREDEFINED_CHECKS
+
+		#pragma region GETTERS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t columns() const noexcept { return _columns; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t rows() const noexcept { return _rows; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t size() const noexcept { return _values.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _values.empty(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* data() noexcept { return _values.data(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const T* data() const noexcept { return _values.data(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const noexcept { return _values.get_allocator(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 view_type view() noexcept { return view_type(data(), _columns, _rows); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_view_type view() const noexcept {
+			return const_view_type(data(), _columns, _rows);
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 column_type column(size_t idx) const {
+			return column_type((*this)[idx], _rows, get_allocator());
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 column_type row(size_t idx) const {
+			column_type res(_columns, get_allocator());
+				for (size_t x = 0; x != _columns; ++x) { res[x] = (*this)[x][idx]; }
+			return res;
+		}
+
+		// copies the overlapping columns and rows, the rest is zero
+		template<size_t C, size_t R>
+		[[nodiscard]] _MSTD_CONSTEXPR20 mat<C, R, T> to_mat() const {
+			mat<C, R, T> res;
+				for (size_t x = 0; x != std::min(C, _columns); ++x) {
+					std::copy_n((*this)[x], std::min(R, _rows), static_cast<T*>(res[x]));
+				}
+			return res;
+		}
+
+		#pragma endregion // GETTERS
+
+		#pragma region CAPACITY
+
+		// keeps the overlapping columns and rows, new values are zero
+		_MSTD_CONSTEXPR20 void resize(size_t columns, size_t rows) {
+				if (rows == _rows) {
+					_values.resize(columns * rows, static_cast<T>(0));
+					_columns = columns;
+					return;
+				}
+
+			dmat res(columns, rows, get_allocator());
+				for (size_t x = 0; x != std::min(columns, _columns); ++x) {
+					std::copy_n((*this)[x], std::min(rows, _rows), res[x]);
+				}
+			*this = std::move(res);
+		}
+
+		#pragma endregion // CAPACITY
+
+		#pragma region MATRIX_OPERATIONS
+
+		_MSTD_CONSTEXPR20 dmat transposed() const {
+			dmat res(_rows, _columns, get_allocator());
+				for (size_t firstX = 0; firstX < _columns; firstX += _transpose_block) {
+					const size_t lastX = std::min(firstX + _transpose_block, _columns);
+						for (size_t firstY = 0; firstY < _rows; firstY += _transpose_block) {
+							const size_t lastY = std::min(firstY + _transpose_block, _rows);
+								for (size_t x = firstX; x != lastX; ++x) {
+									const T* column = (*this)[x];
+										for (size_t y = firstY; y != lastY; ++y) { res[y][x] = column[y]; }
+								}
+						}
+				}
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dmat& transpose() {
+				if (!is_square()) {
+					*this = transposed();
+					return *this;
+				}
+
+				for (size_t x = 0; x != _columns; ++x) {
+						for (size_t y = 0; y != x; ++y) { std::swap((*this)[x][y], (*this)[y][x]); }
+				}
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat& clamp(const T& minVal, const T& maxVal) {
+			_kernels::clamp(data(), data(), minVal, maxVal, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat clampped(const T& minVal, const T& maxVal) const {
+			dmat res = *this;
+			return res.clamp(minVal, maxVal);
+		}
+
+		_MSTD_CONSTEXPR20 dmat& clamp(const dmat& minVal, const dmat& maxVal) {
+			_zip(minVal, [](T* dst, const T* src, size_t count) { _kernels::max(dst, dst, src, count); });
+			_zip(maxVal, [](T* dst, const T* src, size_t count) { _kernels::min(dst, dst, src, count); });
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat clampped(const dmat& minVal, const dmat& maxVal) const {
+			dmat res = *this;
+			return res.clamp(minVal, maxVal);
+		}
+
+		// zero for non square matrices
+		_MSTD_CONSTEXPR20 T determinant() const {
+				if (!is_square()) { return static_cast<T>(0); }
+				if _MSTD_CONSTEXPR17 (std::is_floating_point_v<T>) { return lu().determinant(); }
+				else {
+					dmat values = *this;
+					return utils::bareiss_determinant<T>(_rows, [&values](size_t x) { return values[x]; });
+				}
+		}
+
+		// a non square matrix gives a singular decomposition. Floating point only, integer pivot divisions would truncate
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_floating_point_v<Type>))
+
+		_MSTD_CONSTEXPR20 dmat_lu<T, Allocator> lu() const _MSTD_REQUIRES(std::floating_point<T>) {
+			return dmat_lu<T, Allocator>(*this);
+		}
+
+		// returns zero matrix when the matrix is singular or not square
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_floating_point_v<Type>))
+
+		_MSTD_CONSTEXPR20 dmat inverted() const _MSTD_REQUIRES(std::floating_point<T>) {
+				if (!is_square()) { return dmat(_columns, _rows, get_allocator()); }
+			return lu().inverse();
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_floating_point_v<Type>))
+
+		_MSTD_CONSTEXPR20 dmat& invert() _MSTD_REQUIRES(std::floating_point<T>) {
+			*this = inverted();
+			return *this;
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_floating_point_v<Type>))
+
+		_MSTD_CONSTEXPR20 column_type solve(const column_type& b) const _MSTD_REQUIRES(std::floating_point<T>) {
+			return lu().solve(b);
+		}
+
+		// this * other with the columns of the result split across threads (0 uses every hardware thread)
+		dmat mul(const dmat& other, size_t threads) const {
+			dmat res(other._columns, _rows, get_allocator());
+			gemm<T>(view(), other.view(), res.view(), threads);
+			return res;
+		}
+
+		#pragma endregion // MATRIX_OPERATIONS
+
+		#pragma region OPERATORS
+
+		_MSTD_CONSTEXPR20 dmat& operator+=(const dmat& other) {
+			_zip(other, [](T* dst, const T* src, size_t count) { _kernels::add(dst, dst, src, count); });
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat& operator-=(const dmat& other) {
+			_zip(other, [](T* dst, const T* src, size_t count) { _kernels::sub(dst, dst, src, count); });
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat& operator+=(const T& other) {
+			_kernels::add(data(), data(), other, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat& operator-=(const T& other) {
+			_kernels::sub(data(), data(), other, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat& operator*=(const T& other) {
+			_kernels::mul(data(), data(), other, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat& operator/=(const T& other) {
+				if (other == static_cast<T>(0)) { return *this; }
+			_kernels::div(data(), data(), other, size());
+			return *this;
+		}
+
+		dmat& operator*=(const dmat& other) {
+			*this = *this * other;
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dmat operator+(const dmat& other) const {
+			dmat res = *this;
+			res		+= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dmat operator-(const dmat& other) const {
+			dmat res = *this;
+			res		-= other;
+			return res;
+		}
+
+		dmat operator*(const dmat& other) const { return mul(other, 1); }
+
+		_MSTD_CONSTEXPR20 dmat operator+(const T& other) const {
+			dmat res = *this;
+			res		+= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dmat operator-(const T& other) const {
+			dmat res = *this;
+			res		-= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dmat operator*(const T& other) const {
+			dmat res = *this;
+			res		*= other;
+			return res;
+		}
+
+		friend _MSTD_CONSTEXPR20 dmat operator*(const T& other, const dmat& matrix) { return matrix * other; }
+
+		_MSTD_CONSTEXPR20 dmat operator/(const T& other) const {
+			dmat res = *this;
+			res		/= other;
+			return res;
+		}
+
+		// the vector is treated as a single column, the inner dimension is min(columns(), other.size())
+		column_type operator*(const column_type& other) const {
+			column_type res(_rows, get_allocator());
+			gemm<T>(view(), const_view_type(other.data(), 1, other.size()), dmat_view<T>(res.data(), 1, _rows));
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dmat operator+() const { return dmat(*this); }
+
+		_MSTD_CONSTEXPR20 dmat operator-() const { return *this * static_cast<T>(-1); }
+
+		_MSTD_CONSTEXPR20 bool operator==(const dmat& other) const {
+			return _columns == other._columns && _rows == other._rows && std::equal(data(), data() + size(), other.data());
+		}
+
+		_MSTD_CONSTEXPR20 bool operator!=(const dmat& other) const { return !(*this == other); }
+
+		_MSTD_CONSTEXPR20 operator view_type() noexcept { return view(); }
+
+		_MSTD_CONSTEXPR20 operator const_view_type() const noexcept { return view(); }
+
+		_MSTD_CONSTEXPR20 T* operator[](size_t idx) { return data() + idx * _rows; }
+
+		_MSTD_CONSTEXPR20 const T* operator[](size_t idx) const { return data() + idx * _rows; }
+
+		friend std::ostream& operator<<(std::ostream& str, const dmat& matrix) {
+				for (size_t y = 0; y != matrix.rows(); ++y) {
+					str << "[";
+						for (size_t x = 0; x != matrix.columns(); ++x) {
+							str << std::to_string(matrix[x][y]);
+								if (x != matrix.columns() - 1) { str << ", "; }
+						}
+					str << "]";
+						if (y != matrix.rows() - 1) { str << std::endl; }
+				}
+			return str;
+		}
+
+		#pragma endregion // OPERATORS
+	};
+
+		#pragma region EXTRA_OPERATIONS
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 dmat<T, Allocator> clamp(const dmat<T, Allocator>& a, const T& minVal,
+	  const T& maxVal) {
+		return a.clampped(minVal, maxVal);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 dmat<T, Allocator> clamp(const dmat<T, Allocator>& a, const dmat<T, Allocator>& minVal,
+	  const dmat<T, Allocator>& maxVal) {
+		return a.clampped(minVal, maxVal);
+	}
+
+		#pragma endregion // EXTRA_OPERATIONS
+} // namespace mstd
+
+		#include <mstd/dmat_lu.hpp>
+	#endif
+#endif
@@ -0,0 +1,174 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_DMAT_LU_HPP_
+	#define _MSTD_DMAT_LU_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/dmat.hpp>
+
+namespace mstd {
+	// PA = LU decomposition of a dmat with partial (row) pivoting, same algorithm and layout as mat_lu. A non square
+	// matrix is reported as singular
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> >
+		#endif
+	class dmat_lu {
+		static_assert(std::is_floating_point_v<T>, "dmat_lu needs a floating point T");
+
+	public:
+		using mat_type	 = dmat<T, Allocator>;
+		using vec_type	 = dvec<T, Allocator>;
+		using value_type = T;
+
+	private:
+		// column major like dmat, _values[x][y] for y > x holds L, the rest holds U
+		mat_type _values;
+		// row y of PA is row _pivots[y] of the decomposed matrix
+		std::vector<size_t> _pivots;
+		bool _oddPermutation = false;
+		bool _singular		 = false;
+
+		#pragma region PRIVATE_METHODS
+
+		_MSTD_CONSTEXPR20 void _decompose() {
+			_singular = !utils::lu_decompose<T>(size(), [this](size_t x) { return _values[x]; }, _pivots.data(),
+			  _oddPermutation);
+		}
+
+		// expects values already permuted by _pivots
+		_MSTD_CONSTEXPR20 void _solve_in_place(T* values) const {
+			utils::lu_solve_in_place<T>(size(), [this](size_t x) { return _values[x]; }, values);
+		}
+
+		#pragma endregion // PRIVATE_METHODS
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 dmat_lu() = default;
+
+		_MSTD_CONSTEXPR20 explicit dmat_lu(const mat_type& matrix)
+			: _values(matrix), _pivots(std::min(matrix.columns(), matrix.rows())) {
+				if (!matrix.is_square()) {
+					_values = mat_type::identity(_pivots.size());
+						for (size_t y = 0; y != _pivots.size(); ++y) { _pivots[y] = y; }
+					_singular = true;
+					return;
+				}
+			_decompose();
+		}
+
+		_MSTD_CONSTEXPR20 dmat_lu(const dmat_lu& other)		= default;
+		_MSTD_CONSTEXPR20 dmat_lu(dmat_lu&& other) noexcept = default;
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region DESTRUCTOR
+		_MSTD_CONSTEXPR20 ~dmat_lu() noexcept = default;
+		#pragma endregion // DESTRUCTOR
+
+		#pragma region ASSIGN
+		_MSTD_CONSTEXPR20 dmat_lu& operator=(const dmat_lu& other)	   = default;
+		_MSTD_CONSTEXPR20 dmat_lu& operator=(dmat_lu&& other) noexcept = default;
+		#pragma endregion // ASSIGN
+
+		#pragma region GETTERS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t size() const noexcept { return _pivots.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool is_singular() const noexcept { return _singular; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t pivot(size_t row) const noexcept { return _pivots[row]; }
+
+		_MSTD_CONSTEXPR20 mat_type lower() const {
+			mat_type res = mat_type::identity(size());
+				for (size_t x = 0; x != size(); ++x) {
+						for (size_t y = x + 1; y != size(); ++y) { res[x][y] = _values[x][y]; }
+				}
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 mat_type upper() const {
+			mat_type res(size(), size());
+				for (size_t x = 0; x != size(); ++x) {
+						for (size_t y = 0; y <= x; ++y) { res[x][y] = _values[x][y]; }
+				}
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 mat_type permutation() const {
+			mat_type res(size(), size());
+				for (size_t y = 0; y != size(); ++y) { res[_pivots[y]][y] = static_cast<T>(1); }
+			return res;
+		}
+
+		#pragma endregion // GETTERS
+
+		#pragma region OPERATIONS
+
+		_MSTD_CONSTEXPR20 T determinant() const {
+				if (_singular) { return static_cast<T>(0); }
+
+			T det = static_cast<T>(1);
+				for (size_t i = 0; i != size(); ++i) { det *= _values[i][i]; }
+			return _oddPermutation ? -det : det;
+		}
+
+		// returns zero vector when the matrix is singular, missing values of b are zero
+		_MSTD_CONSTEXPR20 vec_type solve(const vec_type& b) const {
+			vec_type res(size());
+				if (_singular) { return res; }
+
+				for (size_t y = 0; y != size(); ++y) { res[y] = _pivots[y] < b.size() ? b[_pivots[y]] : static_cast<T>(0); }
+			_solve_in_place(res.data());
+			return res;
+		}
+
+		// solves every column of b, returns zero matrix when the matrix is singular
+		_MSTD_CONSTEXPR20 mat_type solve(const mat_type& b) const {
+			mat_type res(b.columns(), size());
+				if (_singular) { return res; }
+
+				for (size_t x = 0; x != b.columns(); ++x) {
+						for (size_t y = 0; y != size(); ++y) {
+							res[x][y] = _pivots[y] < b.rows() ? b[x][_pivots[y]] : static_cast<T>(0);
+						}
+					_solve_in_place(res[x]);
+				}
+			return res;
+		}
+
+		// returns zero matrix when the matrix is singular
+		_MSTD_CONSTEXPR20 mat_type inverse() const {
+			mat_type res(size(), size());
+				if (_singular) { return res; }
+
+				for (size_t x = 0; x != size(); ++x) {
+						for (size_t y = 0; y != size(); ++y) {
+							res[x][y] = _pivots[y] == x ? static_cast<T>(1) : static_cast<T>(0);
+						}
+					_solve_in_place(res[x]);
+				}
+			return res;
+		}
+
+		#pragma endregion // OPERATIONS
+	};
+} // namespace mstd
+	#endif
+#endif
@@ -0,0 +1,435 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_DVEC_HPP_
+	#define _MSTD_DVEC_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/simd.hpp>
+		#include <mstd/vec.hpp>
+
+namespace mstd {
+	// non owning view of size contiguous values, T may be const. vec, dvec and raw buffers convert to it without copying
+	template<class T>
+	class dvec_view {
+	public:
+		using value_type = std::remove_const_t<T>;
+
+	private:
+		T* _data	 = nullptr;
+		size_t _size = 0;
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 dvec_view() noexcept = default;
+
+		_MSTD_CONSTEXPR20 dvec_view(T* data, size_t size) noexcept : _data(data), _size(size) {}
+
+		template<size_t N>
+		_MSTD_CONSTEXPR20 dvec_view(vec<N, value_type>& vector) noexcept : _data(&vector[0]), _size(N) {}
+
+		template<size_t N>
+		_MSTD_CONSTEXPR20 dvec_view(const vec<N, value_type>& vector) noexcept
+			: _data(static_cast<const value_type*>(vector)), _size(N) {
+			static_assert(std::is_const_v<T>, "a const vec can only be viewed through dvec_view<const T>");
+		}
+
+		template<class Allocator>
+		_MSTD_CONSTEXPR20 dvec_view(dvec<value_type, Allocator>& vector) noexcept
+			: _data(vector.data()), _size(vector.size()) {}
+
+		template<class Allocator>
+		_MSTD_CONSTEXPR20 dvec_view(const dvec<value_type, Allocator>& vector) noexcept
+			: _data(vector.data()), _size(vector.size()) {
+			static_assert(std::is_const_v<T>, "a const dvec can only be viewed through dvec_view<const T>");
+		}
+
+		// dvec_view<T> -> dvec_view<const T>
+		template<class U, std::enable_if_t<std::is_same_v<const U, T>, bool> = true>
+		_MSTD_CONSTEXPR20 dvec_view(const dvec_view<U>& other) noexcept : _data(other.data()), _size(other.size()) {}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region GETTERS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* data() const noexcept { return _data; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t size() const noexcept { return _size; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _size == 0; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* begin() const noexcept { return _data; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* end() const noexcept { return _data + _size; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 dvec_view subview(size_t first, size_t count) const noexcept {
+			first = std::min(first, _size);
+			return dvec_view(_data + first, std::min(count, _size - first));
+		}
+
+		_MSTD_CONSTEXPR20 T& operator[](size_t idx) const noexcept { return _data[idx]; }
+
+		#pragma endregion // GETTERS
+	};
+
+	// heap allocated vector with a size chosen at runtime. Operations between two dvecs work on the first
+	// min(size(), other.size()) values, the storage is aligned by the allocator for the SIMD lane kernels
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> >
+		#endif
+	class dvec {
+	public:
+		using value_type	  = T;
+		using allocator_type  = Allocator;
+		using view_type		  = dvec_view<T>;
+		using const_view_type = dvec_view<const T>;
+
+	private:
+		using _storage_type = std::vector<T, Allocator>;
+		using _kernels		= utils::lane_kernels<T>;
+
+		_storage_type _values;
+
+		_MSTD_CONSTEXPR20 size_t _common_size(const dvec& other) const noexcept { return std::min(size(), other.size()); }
+
+	public:
+		using size_type		 = _MSTD_TYPENAME17 _storage_type::size_type;
+		using iterator		 = _MSTD_TYPENAME17 _storage_type::iterator;
+		using const_iterator = _MSTD_TYPENAME17 _storage_type::const_iterator;
+
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 dvec() = default;
+
+		_MSTD_CONSTEXPR20 explicit dvec(const Allocator& allocator) : _values(allocator) {}
+
+		_MSTD_CONSTEXPR20 explicit dvec(size_type size, const Allocator& allocator = Allocator())
+			: _values(size, static_cast<T>(0), allocator) {}
+
+		_MSTD_CONSTEXPR20 dvec(size_type size, const T& value, const Allocator& allocator = Allocator())
+			: _values(size, value, allocator) {}
+
+		_MSTD_CONSTEXPR20 dvec(const T* values, size_type size, const Allocator& allocator = Allocator())
+			: _values(values, values + size, allocator) {}
+
+		_MSTD_CONSTEXPR20 dvec(std::initializer_list<T> values, const Allocator& allocator = Allocator())
+			: _values(values, allocator) {}
+
+		_MSTD_CONSTEXPR20 explicit dvec(const const_view_type& view, const Allocator& allocator = Allocator())
+			: _values(view.begin(), view.end(), allocator) {}
+
+		template<size_t N>
+		_MSTD_CONSTEXPR20 dvec(const vec<N, T>& vector, const Allocator& allocator = Allocator())
+			: _values(static_cast<const T*>(vector), static_cast<const T*>(vector) + N, allocator) {}
+
+		_MSTD_CONSTEXPR20 dvec(const dvec& other)	  = default;
+		_MSTD_CONSTEXPR20 dvec(dvec&& other) noexcept = default;
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region DESTRUCTOR
+		_MSTD_CONSTEXPR20 ~dvec() noexcept = default;
+		#pragma endregion // DESTRUCTOR
+
+		#pragma region ASSIGN
+		_MSTD_CONSTEXPR20 dvec& operator=(const dvec& other)	 = default;
+		_MSTD_CONSTEXPR20 dvec& operator=(dvec&& other) noexcept = default;
+		#pragma endregion // ASSIGN
+
+		#pragma region PREDEFINED
+
+		static _MSTD_CONSTEXPR20 dvec zero(size_type size) { return dvec(size); }
+
+		static _MSTD_CONSTEXPR20 dvec one(size_type size) { return fill(size, static_cast<T>(1)); }
+
+		static _MSTD_CONSTEXPR20 dvec fill(size_type size, const T& value) { return dvec(size, value); }
+
+		#pragma endregion // PREDEFINED
+
+		#pragma region PREDEFINED_CHECKS
+
+		_MSTD_CONSTEXPR20 bool is_zero() const { return is_filled_with(static_cast<T>(0)); }
+
+		_MSTD_CONSTEXPR20 bool is_one() const { return is_filled_with(static_cast<T>(1)); }
+
+		_MSTD_CONSTEXPR20 bool is_filled_with(const T& value) const {
+			return std::all_of(_values.begin(), _values.end(), [&value](const T& element) { return element == value; });
+		}
+
+		_MSTD_CONSTEXPR20 bool is_normalized() const { return length() == static_cast<T>(1); }
+
+		#pragma endregion // PREDEFINED_CHECKS
+
+		#pragma region GETTERS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const noexcept { return _values.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _values.empty(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* data() noexcept { return _values.data(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const T* data() const noexcept { return _values.data(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const noexcept { return _values.get_allocator(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 iterator begin() noexcept { return _values.begin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator begin() const noexcept { return _values.begin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 iterator end() noexcept { return _values.end(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator end() const noexcept { return _values.end(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 view_type view() noexcept { return view_type(data(), size()); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_view_type view() const noexcept { return const_view_type(data(), size()); }
+
+		// copies the first min(N, size()) values, the rest is zero
+		template<size_t N>
+		[[nodiscard]] _MSTD_CONSTEXPR20 vec<N, T> to_vec() const {
+			return vec<N, T>(data(), static_cast<size_t>(size()));
+		}
+
+		#pragma endregion // GETTERS
+
+		#pragma region CAPACITY
+
+		_MSTD_CONSTEXPR20 void resize(size_type size, const T& value = static_cast<T>(0)) { _values.resize(size, value); }
+
+		_MSTD_CONSTEXPR20 void clear() noexcept { _values.clear(); }
+
+		#pragma endregion // CAPACITY
+
+		#pragma region VECTOR_OPERATIONS
+
+		_MSTD_CONSTEXPR20 T length() const { return static_cast<T>(sqrt(dot(*this))); }
+
+		_MSTD_CONSTEXPR20 dvec& normalize() {
+			T len = length();
+				if (len == static_cast<T>(0)) { return *this; }
+			*this /= len;
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec normalized() const {
+			dvec res = *this;
+			return res.normalize();
+		}
+
+		_MSTD_CONSTEXPR20 T dot(const dvec& other) const { return _kernels::dot(data(), other.data(), _common_size(other)); }
+
+		_MSTD_CONSTEXPR20 dvec& clamp(const T& minVal, const T& maxVal) {
+			_kernels::clamp(data(), data(), minVal, maxVal, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec clampped(const T& minVal, const T& maxVal) const {
+			dvec res = *this;
+			return res.clamp(minVal, maxVal);
+		}
+
+		_MSTD_CONSTEXPR20 dvec& clamp(const dvec& minVal, const dvec& maxVal) {
+			const size_t count = std::min(_common_size(minVal), maxVal.size());
+			_kernels::max(data(), data(), minVal.data(), count);
+			_kernels::min(data(), data(), maxVal.data(), count);
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec clampped(const dvec& minVal, const dvec& maxVal) const {
+			dvec res = *this;
+			return res.clamp(minVal, maxVal);
+		}
+
+		#pragma endregion // VECTOR_OPERATIONS
+
+		#pragma region OPERATORS
+
+		_MSTD_CONSTEXPR20 dvec& operator+=(const dvec& other) {
+			_kernels::add(data(), data(), other.data(), _common_size(other));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec& operator-=(const dvec& other) {
+			_kernels::sub(data(), data(), other.data(), _common_size(other));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec& operator*=(const dvec& other) {
+			_kernels::mul(data(), data(), other.data(), _common_size(other));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec& operator/=(const dvec& other) {
+				if (other.is_zero()) { return *this; }
+			_kernels::div(data(), data(), other.data(), _common_size(other));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec& operator+=(const T& other) {
+			_kernels::add(data(), data(), other, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec& operator-=(const T& other) {
+			_kernels::sub(data(), data(), other, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec& operator*=(const T& other) {
+			_kernels::mul(data(), data(), other, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec& operator/=(const T& other) {
+				if (other == static_cast<T>(0)) { return *this; }
+			_kernels::div(data(), data(), other, size());
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 dvec operator+(const dvec& other) const {
+			dvec res = *this;
+			res		+= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dvec operator-(const dvec& other) const {
+			dvec res = *this;
+			res		-= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dvec operator*(const dvec& other) const {
+			dvec res = *this;
+			res		*= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dvec operator/(const dvec& other) const {
+			dvec res = *this;
+			res		/= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dvec operator+(const T& other) const {
+			dvec res = *this;
+			res		+= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dvec operator-(const T& other) const {
+			dvec res = *this;
+			res		-= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dvec operator*(const T& other) const {
+			dvec res = *this;
+			res		*= other;
+			return res;
+		}
+
+		friend _MSTD_CONSTEXPR20 dvec operator*(const T& other, const dvec& vector) { return vector * other; }
+
+		_MSTD_CONSTEXPR20 dvec operator/(const T& other) const {
+			dvec res = *this;
+			res		/= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 dvec operator+() const { return dvec(*this); }
+
+		_MSTD_CONSTEXPR20 dvec operator-() const { return *this * static_cast<T>(-1); }
+
+		_MSTD_CONSTEXPR20 bool operator==(const dvec& other) const {
+			return size() == other.size() && std::equal(data(), data() + size(), other.data());
+		}
+
+		_MSTD_CONSTEXPR20 bool operator!=(const dvec& other) const { return !(*this == other); }
+
+		_MSTD_CONSTEXPR20 operator view_type() noexcept { return view(); }
+
+		_MSTD_CONSTEXPR20 operator const_view_type() const noexcept { return view(); }
+
+		_MSTD_CONSTEXPR20 T& operator[](size_type idx) { return _values[idx]; }
+
+		_MSTD_CONSTEXPR20 T operator[](size_type idx) const { return _values[idx]; }
+
+		friend std::ostream& operator<<(std::ostream& str, const dvec& vector) {
+			str << "[";
+				for (size_t i = 0; i != vector.size(); ++i) {
+					str << std::to_string(vector[i]);
+						if (i != vector.size() - 1) { str << ", "; }
+				}
+			return str << "]";
+		}
+
+		#pragma endregion // OPERATORS
+	};
+
+		#pragma region EXTRA_OPERATORS
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T length(const dvec<T, Allocator>& a) {
+		return a.length();
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 dvec<T, Allocator> normalize(const dvec<T, Allocator>& a) {
+		return a.normalized();
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T dot(const dvec<T, Allocator>& a, const dvec<T, Allocator>& b) {
+		return a.dot(b);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 dvec<T, Allocator> clamp(const dvec<T, Allocator>& a, const T& minVal,
+	  const T& maxVal) {
+		return a.clampped(minVal, maxVal);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T, class Allocator>
+		#else
+	template<class T, class Allocator, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 dvec<T, Allocator> clamp(const dvec<T, Allocator>& a, const dvec<T, Allocator>& minVal,
+	  const dvec<T, Allocator>& maxVal) {
+		return a.clampped(minVal, maxVal);
+	}
+
+		#pragma endregion // EXTRA_OPERATORS
+} // namespace mstd
+	#endif
+#endif
@@ -0,0 +1,293 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_EXPR_HPP_
+	#define _MSTD_EXPR_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/mat.hpp>
+
+		#if _MSTD_HAS_CXX20
+			#define _MSTD_EXPR_TEMPLATE(condition, ...) template<__VA_ARGS__> requires condition
+		#else
+			#define _MSTD_EXPR_TEMPLATE(condition, ...) template<__VA_ARGS__, std::enable_if_t<condition, bool> = true>
+		#endif
+
+namespace mstd {
+	// Opt-in expression templates for the element wise vec and mat operators. Wrapping an operand in lazy() makes every
+	// operator it takes part in return a small node instead of a full temporary, the whole expression is computed in one
+	// loop when it is assigned to a vec/mat, converted to one or when eval() is called:
+	//
+	//     vec<64, float> res = lazy(a) * s + b - lazy(c) * t;
+	//
+	// Nodes keep references to their vec/mat operands, so an expression kept in an auto variable must not outlive them,
+	// use eval() to get the value. Matrix products are not element wise and stay eager, so mat expressions only support
+	// +, -, scaling by a scalar and negation. Division by a zero scalar leaves the dividend, like vec/mat::operator/.
+	template<class Derived, class Result>
+	class expr : public utils::expr_base {
+	public:
+		using result_type = Result;
+		using value_type  = typename Result::value_type;
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 result_type eval() const {
+			result_type res;
+			res = static_cast<const Derived&>(*this);
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 operator result_type() const { return eval(); }
+	};
+
+	namespace utils {
+		#pragma region EXPR_OPERATIONS
+
+		struct expr_add {
+			template<class T>
+			static _MSTD_CONSTEXPR20 T apply(const T& a, const T& b) {
+				return a + b;
+			}
+		};
+
+		struct expr_sub {
+			template<class T>
+			static _MSTD_CONSTEXPR20 T apply(const T& a, const T& b) {
+				return a - b;
+			}
+		};
+
+		struct expr_mul {
+			template<class T>
+			static _MSTD_CONSTEXPR20 T apply(const T& a, const T& b) {
+				return a * b;
+			}
+		};
+
+		struct expr_div {
+			template<class T>
+			static _MSTD_CONSTEXPR20 T apply(const T& a, const T& b) {
+				return b == static_cast<T>(0) ? a : a / b;
+			}
+		};
+
+		#pragma endregion // EXPR_OPERATIONS
+
+		#pragma region EXPR_NODES
+
+		// vec or mat operand
+		template<class Value>
+		class expr_ref : public expr<expr_ref<Value>, Value> {
+		private:
+			const Value& _value;
+
+		public:
+			using value_type = typename Value::value_type;
+
+			_MSTD_CONSTEXPR20 explicit expr_ref(const Value& value) : _value(value) {}
+
+			_MSTD_CONSTEXPR20 value_type operator()(size_t idx) const { return _value[idx]; }
+
+			_MSTD_CONSTEXPR20 value_type operator()(size_t x, size_t y) const { return _value[x][y]; }
+		};
+
+		// scalar broadcast to every element
+		template<class Result>
+		class expr_scalar : public expr<expr_scalar<Result>, Result> {
+		public:
+			using value_type = typename Result::value_type;
+
+		private:
+			value_type _value;
+
+		public:
+			_MSTD_CONSTEXPR20 explicit expr_scalar(const value_type& value) : _value(value) {}
+
+			template<class... Idxs>
+			_MSTD_CONSTEXPR20 value_type operator()(const Idxs&...) const {
+				return _value;
+			}
+		};
+
+		template<class Op, class LE, class RE>
+		class expr_binary : public expr<expr_binary<Op, LE, RE>, typename LE::result_type> {
+		private:
+			LE _lhs;
+			RE _rhs;
+
+		public:
+			using value_type = typename LE::value_type;
+
+			_MSTD_CONSTEXPR20 expr_binary(const LE& lhs, const RE& rhs) : _lhs(lhs), _rhs(rhs) {}
+
+			template<class... Idxs>
+			_MSTD_CONSTEXPR20 value_type operator()(const Idxs&... idxs) const {
+				return Op::apply(_lhs(idxs...), _rhs(idxs...));
+			}
+		};
+
+		template<class E>
+		class expr_negate : public expr<expr_negate<E>, typename E::result_type> {
+		private:
+			E _expr;
+
+		public:
+			using value_type = typename E::value_type;
+
+			_MSTD_CONSTEXPR20 explicit expr_negate(const E& expr) : _expr(expr) {}
+
+			// same as vec/mat::operator-() which multiplies by -1
+			template<class... Idxs>
+			_MSTD_CONSTEXPR20 value_type operator()(const Idxs&... idxs) const {
+				return _expr(idxs...) * static_cast<value_type>(-1);
+			}
+		};
+
+		#pragma endregion // EXPR_NODES
+
+		template<class Result>
+		struct is_vec_result : std::false_type {};
+
+		template<size_t N, class T>
+		struct is_vec_result<vec<N, T>> : std::true_type {};
+
+		template<class Result>
+		static _MSTD_CONSTEXPR17 const bool is_vec_result_v = is_vec_result<Result>::value;
+
+		template<class Op, class LE, class RE>
+		_MSTD_CONSTEXPR20 expr_binary<Op, LE, RE> make_expr_binary(const LE& lhs, const RE& rhs) {
+			return expr_binary<Op, LE, RE>(lhs, rhs);
+		}
+	} // namespace utils
+
+		#pragma region LAZY
+
+	template<size_t N, class T>
+	_MSTD_CONSTEXPR20 utils::expr_ref<vec<N, T>> lazy(const vec<N, T>& value) {
+		return utils::expr_ref<vec<N, T>>(value);
+	}
+
+	template<size_t C, size_t R, class T>
+	_MSTD_CONSTEXPR20 utils::expr_ref<mat<C, R, T>> lazy(const mat<C, R, T>& value) {
+		return utils::expr_ref<mat<C, R, T>>(value);
+	}
+
+	// the node would outlive the temporary
+	template<size_t N, class T>
+	void lazy(const vec<N, T>&& value) = delete;
+
+	template<size_t C, size_t R, class T>
+	void lazy(const mat<C, R, T>&& value) = delete;
+
+		#pragma endregion // LAZY
+
+		#pragma region EXPR_OPERATORS
+
+	// expr + expr, expr + value, value + expr and expr + scalar for one element wise operation
+		#define _MSTD_EXPR_OPERATOR(op, node)                                                                            \
+			_MSTD_EXPR_TEMPLATE((utils::is_expr_v<LE> && utils::is_expr_of_v<RE, typename LE::result_type>), class LE,   \
+			  class RE)                                                                                                  \
+			_MSTD_CONSTEXPR20 auto operator op(const LE& lhs, const RE& rhs) {                                           \
+				return utils::make_expr_binary<node>(lhs, rhs);                                                          \
+			}                                                                                                            \
+                                                                                                                         \
+			_MSTD_EXPR_TEMPLATE((utils::is_expr_v<LE>), class LE)                                                        \
+			_MSTD_CONSTEXPR20 auto operator op(const LE& lhs, const typename LE::result_type& rhs) {                     \
+				return utils::make_expr_binary<node>(lhs, utils::expr_ref<typename LE::result_type>(rhs));               \
+			}                                                                                                            \
+                                                                                                                         \
+			_MSTD_EXPR_TEMPLATE((utils::is_expr_v<RE>), class RE)                                                        \
+			_MSTD_CONSTEXPR20 auto operator op(const typename RE::result_type& lhs, const RE& rhs) {                     \
+				return utils::make_expr_binary<node>(utils::expr_ref<typename RE::result_type>(lhs), rhs);               \
+			}                                                                                                            \
+                                                                                                                         \
+			_MSTD_EXPR_TEMPLATE((utils::is_expr_v<LE>), class LE)                                                        \
+			_MSTD_CONSTEXPR20 auto operator op(const LE& lhs, const typename LE::value_type& rhs) {                      \
+				return utils::make_expr_binary<node>(lhs, utils::expr_scalar<typename LE::result_type>(rhs));            \
+			}
+
+	_MSTD_EXPR_OPERATOR(+, utils::expr_add)
+	_MSTD_EXPR_OPERATOR(-, utils::expr_sub)
+
+		#undef _MSTD_EXPR_OPERATOR
+
+	// element wise product, only for vectors as mat * mat is the matrix product
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<LE> && utils::is_vec_result_v<typename LE::result_type> &&
+						  utils::is_expr_of_v<RE, typename LE::result_type>),
+	  class LE, class RE)
+	_MSTD_CONSTEXPR20 auto operator*(const LE& lhs, const RE& rhs) {
+		return utils::make_expr_binary<utils::expr_mul>(lhs, rhs);
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<LE> && utils::is_vec_result_v<typename LE::result_type>), class LE)
+	_MSTD_CONSTEXPR20 auto operator*(const LE& lhs, const typename LE::result_type& rhs) {
+		return utils::make_expr_binary<utils::expr_mul>(lhs, utils::expr_ref<typename LE::result_type>(rhs));
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<RE> && utils::is_vec_result_v<typename RE::result_type>), class RE)
+	_MSTD_CONSTEXPR20 auto operator*(const typename RE::result_type& lhs, const RE& rhs) {
+		return utils::make_expr_binary<utils::expr_mul>(utils::expr_ref<typename RE::result_type>(lhs), rhs);
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<LE>), class LE)
+	_MSTD_CONSTEXPR20 auto operator*(const LE& lhs, const typename LE::value_type& rhs) {
+		return utils::make_expr_binary<utils::expr_mul>(lhs, utils::expr_scalar<typename LE::result_type>(rhs));
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<RE>), class RE)
+	_MSTD_CONSTEXPR20 auto operator*(const typename RE::value_type& lhs, const RE& rhs) {
+		return utils::make_expr_binary<utils::expr_mul>(utils::expr_scalar<typename RE::result_type>(lhs), rhs);
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<LE>), class LE)
+	_MSTD_CONSTEXPR20 auto operator/(const LE& lhs, const typename LE::value_type& rhs) {
+		return utils::make_expr_binary<utils::expr_div>(lhs, utils::expr_scalar<typename LE::result_type>(rhs));
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<E>), class E)
+	_MSTD_CONSTEXPR20 utils::expr_negate<E> operator-(const E& value) {
+		return utils::expr_negate<E>(value);
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<E>), class E)
+	_MSTD_CONSTEXPR20 const E& operator+(const E& value) {
+		return value;
+	}
+
+		#pragma endregion // EXPR_OPERATORS
+
+		#pragma region EXPR_COMPOUND_ASSIGN
+
+	// value op= expr, updates value in place without a temporary
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<E>), class E)
+	_MSTD_CONSTEXPR20 typename E::result_type& operator+=(typename E::result_type& value, const E& expr) {
+		return value = utils::make_expr_binary<utils::expr_add>(utils::expr_ref<typename E::result_type>(value), expr);
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<E>), class E)
+	_MSTD_CONSTEXPR20 typename E::result_type& operator-=(typename E::result_type& value, const E& expr) {
+		return value = utils::make_expr_binary<utils::expr_sub>(utils::expr_ref<typename E::result_type>(value), expr);
+	}
+
+	_MSTD_EXPR_TEMPLATE((utils::is_expr_v<E> && utils::is_vec_result_v<typename E::result_type>), class E)
+	_MSTD_CONSTEXPR20 typename E::result_type& operator*=(typename E::result_type& value, const E& expr) {
+		return value = utils::make_expr_binary<utils::expr_mul>(utils::expr_ref<typename E::result_type>(value), expr);
+	}
+
+		#pragma endregion // EXPR_COMPOUND_ASSIGN
+} // namespace mstd
+
+		#undef _MSTD_EXPR_TEMPLATE
+	#endif
+#endif
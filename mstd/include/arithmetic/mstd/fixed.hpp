@@ -0,0 +1,550 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_FIXED_HPP_
+	#define _MSTD_FIXED_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/arithmetic_types.hpp>
+		#include <mstd/overflow_operations.hpp>
+
+namespace mstd {
+	// what fixed does with a result outside of its range: wrap keeps the low IntBits + FracBits bits like integer
+	// arithmetic does, saturate clamps to lowest/max
+	enum class fixed_overflow : uint8_t { wrap = 0, saturate = 1 };
+
+	namespace utils {
+		#pragma region FIXED_STORAGE
+
+		template<size_t Bits>
+		using fixed_storage_t = std::conditional_t<(Bits <= 8), int8_t,
+		  std::conditional_t<(Bits <= 16), int16_t, std::conditional_t<(Bits <= 32), int32_t, int64_t> > >;
+
+		// integer holding the full product of two storage values, 64 bit storage needs __int128
+		template<size_t Size>
+		struct fixed_wide_of_size {
+			using type			= int32_t;
+			using unsigned_type = uint32_t;
+		};
+
+		template<>
+		struct fixed_wide_of_size<4> {
+			using type			= int64_t;
+			using unsigned_type = uint64_t;
+		};
+
+		#ifdef __SIZEOF_INT128__
+		static _MSTD_CONSTEXPR17 const bool fixed_has_wide_64 = true;
+
+		template<>
+		struct fixed_wide_of_size<8> {
+			using type			= __int128;
+			using unsigned_type = unsigned __int128;
+		};
+		#else
+		static _MSTD_CONSTEXPR17 const bool fixed_has_wide_64 = false;
+		#endif
+
+		#pragma endregion // FIXED_STORAGE
+
+		#pragma region FIXED_RAW_OPERATIONS
+
+		// The raw (scaled by 2^FracBits) arithmetic behind fixed. Every operation is done exactly in the wide type and then
+		// brought back to the range with wrap or saturate, so the results are the same on every platform.
+		template<size_t IntBits, size_t FracBits, class Storage>
+		struct fixed_raw_ops {
+			using wide			   = typename fixed_wide_of_size<sizeof(Storage)>::type;
+			using wide_unsigned	   = typename fixed_wide_of_size<sizeof(Storage)>::unsigned_type;
+			using storage_unsigned = std::make_unsigned_t<Storage>;
+
+			static _MSTD_CONSTEXPR17 const size_t bits		  = IntBits + FracBits;
+			static _MSTD_CONSTEXPR17 const size_t unused_bits = sizeof(Storage) * 8 - bits;
+
+			static _MSTD_CONSTEXPR17 const wide one		= static_cast<wide>(1) << FracBits;
+			static _MSTD_CONSTEXPR17 const wide raw_max = (static_cast<wide>(1) << (bits - 1)) - 1;
+			static _MSTD_CONSTEXPR17 const wide raw_min = -raw_max - 1;
+
+			// integer part limits, used to check integer conversions before they are scaled
+			static _MSTD_CONSTEXPR17 const int64_t int_max = static_cast<int64_t>(raw_max >> FracBits);
+			static _MSTD_CONSTEXPR17 const int64_t int_min = static_cast<int64_t>(raw_min >> FracBits);
+
+			static _MSTD_CONSTEXPR17 bool in_range(const wide& value) noexcept {
+				return value >= raw_min && value <= raw_max;
+			}
+
+			static _MSTD_CONSTEXPR17 Storage wrap(const wide& value) noexcept {
+				const storage_unsigned low = static_cast<storage_unsigned>(value);
+					if _MSTD_CONSTEXPR17 (unused_bits == 0) { return static_cast<Storage>(low); }
+					else {
+						// sign extends from the top bit of the range
+						return static_cast<Storage>(
+						  static_cast<Storage>(static_cast<storage_unsigned>(low << unused_bits)) >> unused_bits);
+					}
+			}
+
+			// the wrapped value where it is exact, max or lowest by the sign otherwise. A single select so loops over it
+			// vectorize, the two compares of a clamp turn into branches once inlined
+			static _MSTD_CONSTEXPR17 Storage saturate(const wide& value) noexcept {
+				const Storage wrapped = wrap(value);
+				const Storage limit	  = static_cast<Storage>(raw_max ^ (value >> (sizeof(wide) * 8 - 1)));
+				return static_cast<wide>(wrapped) == value ? wrapped : limit;
+			}
+
+			// product rounded to nearest with ties up, a single widening multiply (64 bit imul for 32 bit storage, the
+			// 64x64 -> 128 bit imul for 64 bit storage) followed by a shift
+			static _MSTD_CONSTEXPR17 wide mul(const Storage& a, const Storage& b) noexcept {
+				const wide res = static_cast<wide>(a) * static_cast<wide>(b);
+					if _MSTD_CONSTEXPR17 (FracBits == 0) { return res; }
+					else { return (res + (static_cast<wide>(1) << (FracBits - 1))) >> FracBits; }
+			}
+
+			// quotient truncated toward zero like integer division, b must not be 0
+			static _MSTD_CONSTEXPR17 wide div(const Storage& a, const Storage& b) noexcept {
+				return (static_cast<wide>(a) * one) / static_cast<wide>(b);
+			}
+
+			// a / 0 gives max or lowest by the sign of a, the same values div_overflow uses
+			static _MSTD_CONSTEXPR17 Storage div_by_zero(const Storage& a) noexcept {
+				return static_cast<Storage>(a < 0 ? raw_min : raw_max);
+			}
+
+			template<class I>
+			static _MSTD_CONSTEXPR17 bool int_above_range(const I& value) noexcept {
+					if _MSTD_CONSTEXPR17 (std::is_signed_v<I>) { return static_cast<int64_t>(value) > int_max; }
+					else { return static_cast<uint64_t>(value) > static_cast<uint64_t>(int_max); }
+			}
+
+			template<class I>
+			static _MSTD_CONSTEXPR17 bool int_below_range(const I& value) noexcept {
+					if _MSTD_CONSTEXPR17 (std::is_signed_v<I>) { return static_cast<int64_t>(value) < int_min; }
+					else { return false; }
+			}
+
+			// the integer scaled in the unsigned wide type, so it wraps instead of overflowing
+			template<class I>
+			static _MSTD_CONSTEXPR17 wide scaled_int(const I& value) noexcept {
+				return static_cast<wide>(static_cast<wide_unsigned>(value) << FracBits);
+			}
+
+			// round to nearest with ties away from zero, out of range values are clamped and nan gives 0 in both modes
+			template<class F>
+			static _MSTD_CONSTEXPR17 Storage from_floating(const F& value) noexcept {
+				const F scaled = value * static_cast<F>(one);
+					if (scaled != scaled) { return 0; }
+					if (scaled >= static_cast<F>(raw_max)) { return static_cast<Storage>(raw_max); }
+					if (scaled <= static_cast<F>(raw_min)) { return static_cast<Storage>(raw_min); }
+
+				// the difference to the truncated value is exact, adding 0.5 before truncating is not
+				wide res	   = static_cast<wide>(scaled);
+				const F diff = scaled - static_cast<F>(res);
+					if (diff >= static_cast<F>(0.5)) { ++res; }
+					else if (diff <= static_cast<F>(-0.5)) { --res; }
+				return static_cast<Storage>(res);
+			}
+
+			template<class F>
+			static _MSTD_CONSTEXPR17 F to_floating(const Storage& raw) noexcept {
+				return static_cast<F>(raw) * (static_cast<F>(1) / static_cast<F>(one));
+			}
+		};
+
+		// floor(sqrt(value)) bit by bit
+		template<class U>
+		_MSTD_INLINE17 _MSTD_CONSTEXPR17 U fixed_isqrt_bits(U value) noexcept {
+			U res = 0;
+			U bit = static_cast<U>(1) << (sizeof(U) * 8 - 2);
+				while (bit > value) { bit >>= 2; }
+				while (bit != 0) {
+						if (value >= res + bit) {
+							value -= res + bit;
+							res	   = (res >> 1) + bit;
+						}
+						else { res >>= 1; }
+					bit >>= 2;
+				}
+			return res;
+		}
+
+		// floor(sqrt(value)), values below 2^62 start from the correctly rounded double square root (the same on every
+		// IEEE 754 platform) and correct it by at most a few steps
+		template<class U>
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 U fixed_isqrt(const U& value) noexcept {
+				if _MSTD_CONSTEXPR17 (sizeof(U) <= sizeof(uint64_t)) {
+					const uint64_t wideValue = static_cast<uint64_t>(value);
+						if (!_MSTD_IS_CONSTANT_EVALUATED() && wideValue < (static_cast<uint64_t>(1) << 62)) {
+							uint64_t res = static_cast<uint64_t>(std::sqrt(static_cast<double>(wideValue)));
+								while (res * res > wideValue) { --res; }
+								while ((res + 1) * (res + 1) <= wideValue) { ++res; }
+							return static_cast<U>(res);
+						}
+				}
+			return fixed_isqrt_bits(value);
+		}
+
+		#pragma endregion // FIXED_RAW_OPERATIONS
+	} // namespace utils
+
+	// Signed binary fixed point number with IntBits integer bits (the sign bit included) and FracBits fraction bits,
+	// stored as an integer scaled by 2^FracBits. Every operation is integer only and gives the same bits on every platform
+	// and compiler, which floating point does not guarantee. Multiplication rounds to nearest, division truncates toward
+	// zero, results outside of the range wrap or saturate depending on Overflow and the checked versions are the
+	// add/sub/mul/div_overflow overloads below. Integers convert implicitly, floating point only explicitly.
+	template<size_t IntBits, size_t FracBits, class Storage = utils::fixed_storage_t<IntBits + FracBits>,
+	  fixed_overflow Overflow = fixed_overflow::wrap>
+	class fixed {
+		static_assert(is_signed_integral_v<Storage>, "fixed needs a signed integer storage");
+		static_assert(IntBits > 0, "IntBits counts the sign bit so it has to be at least 1");
+		static_assert(IntBits + FracBits <= sizeof(Storage) * 8, "IntBits + FracBits does not fit in the storage");
+		static_assert(sizeof(Storage) < sizeof(int64_t) || utils::fixed_has_wide_64,
+		  "64 bit storage needs a compiler with __int128");
+
+	public:
+		using storage_type										= Storage;
+		static _MSTD_CONSTEXPR17 const size_t int_bits			= IntBits;
+		static _MSTD_CONSTEXPR17 const size_t frac_bits			= FracBits;
+		static _MSTD_CONSTEXPR17 const fixed_overflow overflow = Overflow;
+
+	private:
+		using _ops	= utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+		using _wide = typename _ops::wide;
+
+		Storage _raw = 0;
+
+		static _MSTD_CONSTEXPR17 Storage _narrow(const _wide& value) noexcept {
+				if _MSTD_CONSTEXPR17 (Overflow == fixed_overflow::saturate) { return _ops::saturate(value); }
+				else { return _ops::wrap(value); }
+		}
+
+		template<class I>
+		static _MSTD_CONSTEXPR17 Storage _from_integer(const I& value) noexcept {
+				if _MSTD_CONSTEXPR17 (Overflow == fixed_overflow::saturate) {
+						if (_ops::int_above_range(value)) { return static_cast<Storage>(_ops::raw_max); }
+						if (_ops::int_below_range(value)) { return static_cast<Storage>(_ops::raw_min); }
+					return static_cast<Storage>(static_cast<_wide>(value) * _ops::one);
+				}
+				else { return _ops::wrap(_ops::scaled_int(value)); }
+		}
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR17 fixed() noexcept = default;
+
+		#if _MSTD_HAS_CXX20
+		template<integral I>
+		#else
+		template<class I, std::enable_if_t<std::is_integral_v<I>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR17 fixed(const I& value) noexcept : _raw(_from_integer(value)) {
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<floating_point F>
+		#else
+		template<class F, std::enable_if_t<std::is_floating_point_v<F>, bool> = true>
+		#endif
+		explicit _MSTD_CONSTEXPR17 fixed(const F& value) noexcept : _raw(_ops::from_floating(value)) {
+		}
+
+		static _MSTD_CONSTEXPR17 fixed from_raw(const Storage& raw) noexcept {
+			fixed res;
+			res._raw = raw;
+			return res;
+		}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region GETTERS
+
+		_MSTD_CONSTEXPR17 Storage raw() const noexcept { return _raw; }
+
+		#pragma endregion // GETTERS
+
+		#pragma region CONVERSIONS
+
+		// integers get the value truncated toward zero, bool is true for any non zero value
+		#if _MSTD_HAS_CXX20
+		template<arithmetic T>
+		#else
+		template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+		explicit _MSTD_CONSTEXPR17 operator T() const noexcept {
+				if _MSTD_CONSTEXPR17 (std::is_same_v<T, bool>) { return _raw != 0; }
+				else if _MSTD_CONSTEXPR17 (std::is_floating_point_v<T>) { return _ops::template to_floating<T>(_raw); }
+				else { return static_cast<T>(static_cast<_wide>(_raw) / _ops::one); }
+		}
+
+		#pragma endregion // CONVERSIONS
+
+		#pragma region OPERATORS
+
+		_MSTD_CONSTEXPR17 fixed& operator+=(const fixed& other) noexcept {
+			_raw = _narrow(static_cast<_wide>(_raw) + static_cast<_wide>(other._raw));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR17 fixed& operator-=(const fixed& other) noexcept {
+			_raw = _narrow(static_cast<_wide>(_raw) - static_cast<_wide>(other._raw));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR17 fixed& operator*=(const fixed& other) noexcept {
+			_raw = _narrow(_ops::mul(_raw, other._raw));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR17 fixed& operator/=(const fixed& other) noexcept {
+			_raw = other._raw == 0 ? _ops::div_by_zero(_raw) : _narrow(_ops::div(_raw, other._raw));
+			return *this;
+		}
+
+		friend _MSTD_CONSTEXPR17 fixed operator+(fixed a, const fixed& b) noexcept { return a += b; }
+
+		friend _MSTD_CONSTEXPR17 fixed operator-(fixed a, const fixed& b) noexcept { return a -= b; }
+
+		friend _MSTD_CONSTEXPR17 fixed operator*(fixed a, const fixed& b) noexcept { return a *= b; }
+
+		friend _MSTD_CONSTEXPR17 fixed operator/(fixed a, const fixed& b) noexcept { return a /= b; }
+
+		_MSTD_CONSTEXPR17 fixed operator+() const noexcept { return *this; }
+
+		_MSTD_CONSTEXPR17 fixed operator-() const noexcept { return from_raw(_narrow(-static_cast<_wide>(_raw))); }
+
+		friend _MSTD_CONSTEXPR17 bool operator==(const fixed& a, const fixed& b) noexcept { return a._raw == b._raw; }
+
+		friend _MSTD_CONSTEXPR17 bool operator!=(const fixed& a, const fixed& b) noexcept { return a._raw != b._raw; }
+
+		friend _MSTD_CONSTEXPR17 bool operator<(const fixed& a, const fixed& b) noexcept { return a._raw < b._raw; }
+
+		friend _MSTD_CONSTEXPR17 bool operator<=(const fixed& a, const fixed& b) noexcept { return a._raw <= b._raw; }
+
+		friend _MSTD_CONSTEXPR17 bool operator>(const fixed& a, const fixed& b) noexcept { return a._raw > b._raw; }
+
+		friend _MSTD_CONSTEXPR17 bool operator>=(const fixed& a, const fixed& b) noexcept { return a._raw >= b._raw; }
+
+		friend std::ostream& operator<<(std::ostream& str, const fixed& value) {
+			return str << static_cast<double>(value);
+		}
+
+		#pragma endregion // OPERATORS
+	};
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	struct is_arithmetic_like<fixed<IntBits, FracBits, Storage, Overflow> > : std::true_type {};
+
+		#pragma region PREDEFINED_FIXED
+	using fixed8_8	 = fixed<8, 8>;
+	using fixed16_16 = fixed<16, 16>;
+	using fixed24_8	 = fixed<24, 8>;
+		#ifdef __SIZEOF_INT128__
+	using fixed32_32 = fixed<32, 32>;
+		#endif
+		#pragma endregion // PREDEFINED_FIXED
+
+		#pragma region FIXED_MATH
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 fixed<IntBits, FracBits, Storage, Overflow> abs(
+	  const fixed<IntBits, FracBits, Storage, Overflow>& x) noexcept {
+		return x.raw() < 0 ? -x : x;
+	}
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 fixed<IntBits, FracBits, Storage, Overflow> floor(
+	  const fixed<IntBits, FracBits, Storage, Overflow>& x) noexcept {
+		using fixed_type = fixed<IntBits, FracBits, Storage, Overflow>;
+		using unsigned_t = std::make_unsigned_t<Storage>;
+
+		// clearing the fraction bits rounds toward -inf for negative values too
+		_MSTD_CONSTEXPR17 const unsigned_t int_mask = static_cast<unsigned_t>(~((static_cast<unsigned_t>(1) << FracBits) - 1));
+		return fixed_type::from_raw(static_cast<Storage>(static_cast<unsigned_t>(x.raw()) & int_mask));
+	}
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 fixed<IntBits, FracBits, Storage, Overflow> ceil(
+	  const fixed<IntBits, FracBits, Storage, Overflow>& x) noexcept {
+		using fixed_type = fixed<IntBits, FracBits, Storage, Overflow>;
+		using ops		 = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+		using unsigned_t = std::make_unsigned_t<Storage>;
+
+		// -floor(-x) would saturate -lowest(), instead the fraction mask is added with the overflow handling of Overflow
+		// and the fraction bits are cleared. Saturating past max() gives max()
+		_MSTD_CONSTEXPR17 const unsigned_t frac_mask = static_cast<unsigned_t>((static_cast<unsigned_t>(1) << FracBits) - 1);
+		const typename ops::wide res				 = static_cast<typename ops::wide>(x.raw()) + frac_mask;
+			if _MSTD_CONSTEXPR17 (Overflow == fixed_overflow::saturate) {
+					if (res > ops::raw_max) { return fixed_type::from_raw(static_cast<Storage>(ops::raw_max)); }
+			}
+		return fixed_type::from_raw(static_cast<Storage>(static_cast<unsigned_t>(ops::wrap(res)) & ~frac_mask));
+	}
+
+	// rounded to nearest, negative values give 0
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 fixed<IntBits, FracBits, Storage, Overflow> sqrt(
+	  const fixed<IntBits, FracBits, Storage, Overflow>& x) noexcept {
+		using fixed_type = fixed<IntBits, FracBits, Storage, Overflow>;
+		using ops		 = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+		using unsigned_t = typename ops::wide_unsigned;
+
+			if (x.raw() <= 0) { return fixed_type(); }
+
+		// sqrt(raw / 2^F) * 2^F == sqrt(raw * 2^F)
+		const unsigned_t value = static_cast<unsigned_t>(x.raw()) << FracBits;
+		unsigned_t res		   = utils::fixed_isqrt(value);
+			if (value - res * res > res) { ++res; }
+		return fixed_type::from_raw(
+		  static_cast<Storage>(res > static_cast<unsigned_t>(ops::raw_max) ? static_cast<unsigned_t>(ops::raw_max) : res));
+	}
+
+		#pragma endregion // FIXED_MATH
+
+		#pragma region FIXED_OVERFLOW_OPERATIONS
+
+	// same contract as the integer versions from overflow_operations.hpp: true on overflow, out is only written when there
+	// was none and division by zero writes max or lowest by the sign of a
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 bool add_overflow(const fixed<IntBits, FracBits, Storage, Overflow>& a,
+	  const fixed<IntBits, FracBits, Storage, Overflow>& b, fixed<IntBits, FracBits, Storage, Overflow>& out) noexcept {
+		using ops = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+
+		const typename ops::wide res = static_cast<typename ops::wide>(a.raw()) + static_cast<typename ops::wide>(b.raw());
+			if (!ops::in_range(res)) { return true; }
+		out = fixed<IntBits, FracBits, Storage, Overflow>::from_raw(static_cast<Storage>(res));
+		return false;
+	}
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 bool sub_overflow(const fixed<IntBits, FracBits, Storage, Overflow>& a,
+	  const fixed<IntBits, FracBits, Storage, Overflow>& b, fixed<IntBits, FracBits, Storage, Overflow>& out) noexcept {
+		using ops = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+
+		const typename ops::wide res = static_cast<typename ops::wide>(a.raw()) - static_cast<typename ops::wide>(b.raw());
+			if (!ops::in_range(res)) { return true; }
+		out = fixed<IntBits, FracBits, Storage, Overflow>::from_raw(static_cast<Storage>(res));
+		return false;
+	}
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 bool mul_overflow(const fixed<IntBits, FracBits, Storage, Overflow>& a,
+	  const fixed<IntBits, FracBits, Storage, Overflow>& b, fixed<IntBits, FracBits, Storage, Overflow>& out) noexcept {
+		using ops = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+
+		const typename ops::wide res = ops::mul(a.raw(), b.raw());
+			if (!ops::in_range(res)) { return true; }
+		out = fixed<IntBits, FracBits, Storage, Overflow>::from_raw(static_cast<Storage>(res));
+		return false;
+	}
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 bool div_overflow(const fixed<IntBits, FracBits, Storage, Overflow>& a,
+	  const fixed<IntBits, FracBits, Storage, Overflow>& b, fixed<IntBits, FracBits, Storage, Overflow>& out) noexcept {
+		using fixed_type = fixed<IntBits, FracBits, Storage, Overflow>;
+		using ops		 = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+
+			if (b.raw() == 0) {
+				out = fixed_type::from_raw(ops::div_by_zero(a.raw()));
+				return false;
+			}
+
+		const typename ops::wide res = ops::div(a.raw(), b.raw());
+			if (!ops::in_range(res)) { return true; }
+		out = fixed_type::from_raw(static_cast<Storage>(res));
+		return false;
+	}
+
+	// clamped to lowest/max whatever Overflow is
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 fixed<IntBits, FracBits, Storage, Overflow> saturating_add(
+	  const fixed<IntBits, FracBits, Storage, Overflow>& a, const fixed<IntBits, FracBits, Storage, Overflow>& b) noexcept {
+		using ops = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+
+		return fixed<IntBits, FracBits, Storage, Overflow>::from_raw(
+		  ops::saturate(static_cast<typename ops::wide>(a.raw()) + static_cast<typename ops::wide>(b.raw())));
+	}
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 fixed<IntBits, FracBits, Storage, Overflow> saturating_sub(
+	  const fixed<IntBits, FracBits, Storage, Overflow>& a, const fixed<IntBits, FracBits, Storage, Overflow>& b) noexcept {
+		using ops = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+
+		return fixed<IntBits, FracBits, Storage, Overflow>::from_raw(
+		  ops::saturate(static_cast<typename ops::wide>(a.raw()) - static_cast<typename ops::wide>(b.raw())));
+	}
+
+	template<size_t IntBits, size_t FracBits, class Storage, fixed_overflow Overflow>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 fixed<IntBits, FracBits, Storage, Overflow> saturating_mul(
+	  const fixed<IntBits, FracBits, Storage, Overflow>& a, const fixed<IntBits, FracBits, Storage, Overflow>& b) noexcept {
+		using ops = utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+
+		return fixed<IntBits, FracBits, Storage, Overflow>::from_raw(ops::saturate(ops::mul(a.raw(), b.raw())));
+	}
+
+		#pragma endregion // FIXED_OVERFLOW_OPERATIONS
+} // namespace mstd
+
+namespace std {
+	// like the integer specializations: min is lowest, epsilon is the smallest step and the special values are 0
+	template<size_t IntBits, size_t FracBits, class Storage, mstd::fixed_overflow Overflow>
+	class numeric_limits<mstd::fixed<IntBits, FracBits, Storage, Overflow> > {
+		using _fixed = mstd::fixed<IntBits, FracBits, Storage, Overflow>;
+		using _ops	 = mstd::utils::fixed_raw_ops<IntBits, FracBits, Storage>;
+
+	public:
+		static _MSTD_CONSTEXPR17 const bool is_specialized				= true;
+		static _MSTD_CONSTEXPR17 const bool is_signed					= true;
+		static _MSTD_CONSTEXPR17 const bool is_integer					= FracBits == 0;
+		static _MSTD_CONSTEXPR17 const bool is_exact					= true;
+		static _MSTD_CONSTEXPR17 const bool has_infinity				= false;
+		static _MSTD_CONSTEXPR17 const bool has_quiet_NaN				= false;
+		static _MSTD_CONSTEXPR17 const bool has_signaling_NaN			= false;
+		static _MSTD_CONSTEXPR17 const float_denorm_style has_denorm	= denorm_absent;
+		static _MSTD_CONSTEXPR17 const bool has_denorm_loss				= false;
+		static _MSTD_CONSTEXPR17 const float_round_style round_style	= round_indeterminate;
+		static _MSTD_CONSTEXPR17 const bool is_iec559					= false;
+		static _MSTD_CONSTEXPR17 const bool is_bounded					= true;
+		static _MSTD_CONSTEXPR17 const bool is_modulo					= Overflow == mstd::fixed_overflow::wrap;
+		static _MSTD_CONSTEXPR17 const int digits						= static_cast<int>(IntBits + FracBits - 1);
+		static _MSTD_CONSTEXPR17 const int digits10						= digits * 30103 / 100000;
+		static _MSTD_CONSTEXPR17 const int max_digits10					= 0;
+		static _MSTD_CONSTEXPR17 const int radix						= 2;
+		static _MSTD_CONSTEXPR17 const int min_exponent					= 0;
+		static _MSTD_CONSTEXPR17 const int min_exponent10				= 0;
+		static _MSTD_CONSTEXPR17 const int max_exponent					= 0;
+		static _MSTD_CONSTEXPR17 const int max_exponent10				= 0;
+		static _MSTD_CONSTEXPR17 const bool traps						= false;
+		static _MSTD_CONSTEXPR17 const bool tinyness_before				= false;
+
+		static _MSTD_CONSTEXPR17 _fixed min() noexcept { return lowest(); }
+
+		static _MSTD_CONSTEXPR17 _fixed lowest() noexcept { return _fixed::from_raw(static_cast<Storage>(_ops::raw_min)); }
+
+		static _MSTD_CONSTEXPR17 _fixed max() noexcept { return _fixed::from_raw(static_cast<Storage>(_ops::raw_max)); }
+
+		static _MSTD_CONSTEXPR17 _fixed epsilon() noexcept { return _fixed::from_raw(1); }
+
+		static _MSTD_CONSTEXPR17 _fixed round_error() noexcept { return _fixed(); }
+
+		static _MSTD_CONSTEXPR17 _fixed infinity() noexcept { return _fixed(); }
+
+		static _MSTD_CONSTEXPR17 _fixed quiet_NaN() noexcept { return _fixed(); }
+
+		static _MSTD_CONSTEXPR17 _fixed signaling_NaN() noexcept { return _fixed(); }
+
+		static _MSTD_CONSTEXPR17 _fixed denorm_min() noexcept { return _fixed(); }
+	};
+} // namespace std
+	#endif
+#endif
@@ -0,0 +1,756 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_GEOMETRY_HPP_
+	#define _MSTD_GEOMETRY_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/mat.hpp>
+		#include <mstd/vec_soa.hpp>
+
+namespace mstd {
+		#pragma region AABB
+
+	// axis aligned box between min and max (both inclusive). It is empty when min > max on any axis, the default box is
+	// the empty one every expand() can start from
+		#if _MSTD_HAS_CXX20
+	template<size_t N, arithmetic T>
+	requires (N > 0)
+		#else
+	template<size_t N, class T, std::enable_if_t<(N > 0 && std::is_arithmetic_v<T>), bool> >
+		#endif
+	class aabb {
+	public:
+		using value_type = T;
+		using vec_type	 = vec<N, T>;
+
+		vec_type min;
+		vec_type max;
+
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 aabb()
+			: min(vec_type::fill(std::numeric_limits<T>::max())), max(vec_type::fill(std::numeric_limits<T>::lowest())) {}
+
+		_MSTD_CONSTEXPR20 aabb(const vec_type& minCorner, const vec_type& maxCorner) : min(minCorner), max(maxCorner) {}
+
+		static _MSTD_CONSTEXPR20 aabb from_center(const vec_type& center, const vec_type& halfExtents) {
+			return aabb(center - halfExtents, center + halfExtents);
+		}
+
+		static _MSTD_CONSTEXPR20 aabb from_points(const vec_type* points, size_t count) {
+			aabb res;
+				for (size_t i = 0; i != count; ++i) { res.expand(points[i]); }
+			return res;
+		}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region PROPERTIES
+
+		_MSTD_CONSTEXPR20 bool empty() const {
+				for (size_t i = 0; i != N; ++i) {
+						if (min[i] > max[i]) { return true; }
+				}
+			return false;
+		}
+
+		_MSTD_CONSTEXPR20 vec_type center() const { return (min + max) / static_cast<T>(2); }
+
+		_MSTD_CONSTEXPR20 vec_type size() const { return max - min; }
+
+		_MSTD_CONSTEXPR20 vec_type extents() const { return size() / static_cast<T>(2); }
+
+		_MSTD_CONSTEXPR20 T volume() const {
+				if (empty()) { return static_cast<T>(0); }
+			const vec_type sizes = size();
+			T res				 = sizes[0];
+				for (size_t i = 1; i != N; ++i) { res *= sizes[i]; }
+			return res;
+		}
+
+		// the cost measure of surface area heuristics
+		_MSTD_CONSTEXPR20 T surface_area() const _MSTD_REQUIRES(N == 3) {
+				if (empty()) { return static_cast<T>(0); }
+			const vec_type sizes = size();
+			return static_cast<T>(2) * (sizes[0] * sizes[1] + sizes[1] * sizes[2] + sizes[2] * sizes[0]);
+		}
+
+		#pragma endregion // PROPERTIES
+
+		#pragma region OPERATIONS
+
+		_MSTD_CONSTEXPR20 aabb& expand(const vec_type& point) {
+			min = mstd::min(min, point);
+			max = mstd::max(max, point);
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 aabb& expand(const aabb& other) {
+			min = mstd::min(min, other.min);
+			max = mstd::max(max, other.max);
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 aabb expanded(const vec_type& point) const {
+			aabb res = *this;
+			return res.expand(point);
+		}
+
+		_MSTD_CONSTEXPR20 aabb expanded(const aabb& other) const {
+			aabb res = *this;
+			return res.expand(other);
+		}
+
+		// empty when the boxes do not overlap
+		_MSTD_CONSTEXPR20 aabb intersection(const aabb& other) const {
+			return aabb(mstd::max(min, other.min), mstd::min(max, other.max));
+		}
+
+		_MSTD_CONSTEXPR20 vec_type closest_point(const vec_type& point) const { return mstd::clamp(point, min, max); }
+
+		_MSTD_CONSTEXPR20 T distance_squared(const vec_type& point) const {
+			const vec_type diff = closest_point(point) - point;
+			return diff.dot(diff);
+		}
+
+		// the box of the 8 transformed corners, computed from the columns of m without transforming them one by one
+		_MSTD_CONSTEXPR20 aabb transformed(const mat<4, 4, T>& m) const _MSTD_REQUIRES(N == 3) {
+				if (empty()) { return aabb(); }
+
+			aabb res(vec_type(m[3][0], m[3][1], m[3][2]), vec_type(m[3][0], m[3][1], m[3][2]));
+				for (size_t c = 0; c != 3; ++c) {
+						for (size_t r = 0; r != 3; ++r) {
+							const T a = m[c][r] * min[c];
+							const T b = m[c][r] * max[c];
+							res.min[r] += std::min(a, b);
+							res.max[r] += std::max(a, b);
+						}
+				}
+			return res;
+		}
+
+		#pragma endregion // OPERATIONS
+
+		#pragma region TESTS
+
+		_MSTD_CONSTEXPR20 bool contains(const vec_type& point) const {
+				for (size_t i = 0; i != N; ++i) {
+						if (point[i] < min[i] || point[i] > max[i]) { return false; }
+				}
+			return true;
+		}
+
+		// an empty box is inside of every box
+		_MSTD_CONSTEXPR20 bool contains(const aabb& other) const {
+				if (other.empty()) { return true; }
+			return contains(other.min) && contains(other.max);
+		}
+
+		// touching boxes intersect
+		_MSTD_CONSTEXPR20 bool intersects(const aabb& other) const {
+				for (size_t i = 0; i != N; ++i) {
+						if (other.max[i] < min[i] || other.min[i] > max[i]) { return false; }
+				}
+			return true;
+		}
+
+		#pragma endregion // TESTS
+
+		#pragma region OPERATORS
+
+		_MSTD_CONSTEXPR20 bool operator==(const aabb& other) const { return min == other.min && max == other.max; }
+
+		_MSTD_CONSTEXPR20 bool operator!=(const aabb& other) const { return !(*this == other); }
+
+		friend std::ostream& operator<<(std::ostream& str, const aabb& box) {
+			return str << "aabb(" << box.min << ", " << box.max << ")";
+		}
+
+		#pragma endregion // OPERATORS
+	};
+
+		#pragma endregion // AABB
+
+		#pragma region SPHERE
+
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> >
+		#endif
+	class sphere {
+	public:
+		using value_type = T;
+		using vec_type	 = vec<3, T>;
+
+		vec_type center;
+		T radius = static_cast<T>(0);
+
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 sphere() = default;
+
+		_MSTD_CONSTEXPR20 sphere(const vec_type& sphereCenter, const T& sphereRadius)
+			: center(sphereCenter), radius(sphereRadius) {}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region OPERATIONS
+
+		_MSTD_CONSTEXPR20 aabb<3, T> bounds() const {
+			return aabb<3, T>::from_center(center, vec_type::fill(radius));
+		}
+
+		_MSTD_CONSTEXPR20 bool contains(const vec_type& point) const {
+			const vec_type diff = point - center;
+			return diff.dot(diff) <= radius * radius;
+		}
+
+		_MSTD_CONSTEXPR20 bool intersects(const sphere& other) const {
+			const vec_type diff = other.center - center;
+			const T radii		= radius + other.radius;
+			return diff.dot(diff) <= radii * radii;
+		}
+
+		_MSTD_CONSTEXPR20 bool intersects(const aabb<3, T>& box) const {
+			return box.distance_squared(center) <= radius * radius;
+		}
+
+		_MSTD_CONSTEXPR20 bool operator==(const sphere& other) const {
+			return center == other.center && radius == other.radius;
+		}
+
+		_MSTD_CONSTEXPR20 bool operator!=(const sphere& other) const { return !(*this == other); }
+
+		#pragma endregion // OPERATIONS
+	};
+
+		#pragma endregion // SPHERE
+
+		#pragma region PLANE
+
+	// points p with dot(normal, p) + distance == 0, normal points to the positive side. The normal does not have to be
+	// unit length, signed_distance is only an actual distance after normalize()
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> >
+		#endif
+	class plane {
+	public:
+		using value_type = T;
+		using vec_type	 = vec<3, T>;
+
+		vec_type normal;
+		T distance = static_cast<T>(0);
+
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 plane() = default;
+
+		_MSTD_CONSTEXPR20 plane(const vec_type& planeNormal, const T& planeDistance)
+			: normal(planeNormal), distance(planeDistance) {}
+
+		_MSTD_CONSTEXPR20 plane(const vec_type& planeNormal, const vec_type& point)
+			: normal(planeNormal), distance(-planeNormal.dot(point)) {}
+
+		// counterclockwise a, b, c look at the positive side
+		static _MSTD_CONSTEXPR20 plane from_points(const vec_type& a, const vec_type& b, const vec_type& c) {
+			return plane((b - a).cross(c - a).normalized(), a);
+		}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region OPERATIONS
+
+		_MSTD_CONSTEXPR20 plane& normalize() {
+			const T length = normal.length();
+				if (length != static_cast<T>(0)) {
+					normal	 /= length;
+					distance /= length;
+				}
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 plane normalized() const {
+			plane res = *this;
+			return res.normalize();
+		}
+
+		_MSTD_CONSTEXPR20 T signed_distance(const vec_type& point) const { return normal.dot(point) + distance; }
+
+		// for a normalized plane
+		_MSTD_CONSTEXPR20 vec_type project(const vec_type& point) const { return point - normal * signed_distance(point); }
+
+		_MSTD_CONSTEXPR20 bool operator==(const plane& other) const {
+			return normal == other.normal && distance == other.distance;
+		}
+
+		_MSTD_CONSTEXPR20 bool operator!=(const plane& other) const { return !(*this == other); }
+
+		#pragma endregion // OPERATIONS
+	};
+
+		#pragma endregion // PLANE
+
+		#pragma region RAY
+
+	// origin + t * direction for t >= 0. The inverse of the direction is kept for the box tests, so both are only set by
+	// the constructor. Intersection tests give the nearest t >= 0 through their out parameter
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> >
+		#endif
+	class ray {
+	public:
+		using value_type = T;
+		using vec_type	 = vec<3, T>;
+
+	private:
+		vec_type _origin;
+		vec_type _direction;
+		vec_type _invDirection;
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 ray() : ray(vec_type(), vec_type(static_cast<T>(0), static_cast<T>(0), static_cast<T>(1))) {}
+
+		// zero components of direction give infinite inverses, which the box tests handle
+		_MSTD_CONSTEXPR20 ray(const vec_type& origin, const vec_type& direction)
+			: _origin(origin), _direction(direction), _invDirection(vec_type::one() / direction) {}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region GETTERS
+
+		_MSTD_CONSTEXPR20 const vec_type& origin() const { return _origin; }
+
+		_MSTD_CONSTEXPR20 const vec_type& direction() const { return _direction; }
+
+		_MSTD_CONSTEXPR20 const vec_type& inv_direction() const { return _invDirection; }
+
+		_MSTD_CONSTEXPR20 vec_type at(const T& t) const { return _origin + _direction * t; }
+
+		#pragma endregion // GETTERS
+
+		#pragma region INTERSECTIONS
+
+		// slab test, [tNear, tFar] is the part of the ray inside the box. A ray starting inside gets tNear = 0
+		_MSTD_CONSTEXPR20 bool intersects(const aabb<3, T>& box, T& tNear, T& tFar) const {
+			T nearRes = static_cast<T>(0);
+			T farRes  = std::numeric_limits<T>::infinity();
+				for (size_t i = 0; i != 3; ++i) {
+					const T t1 = (box.min[i] - _origin[i]) * _invDirection[i];
+					const T t2 = (box.max[i] - _origin[i]) * _invDirection[i];
+					// NaN (a ray lying in a slab plane) is dropped by the argument order of std::min/max
+					nearRes	   = std::max(nearRes, std::min(t1, t2));
+					farRes	   = std::min(farRes, std::max(t1, t2));
+				}
+				if (nearRes > farRes) { return false; }
+			tNear = nearRes;
+			tFar  = farRes;
+			return true;
+		}
+
+		_MSTD_CONSTEXPR20 bool intersects(const aabb<3, T>& box) const {
+			T tNear = static_cast<T>(0);
+			T tFar	= static_cast<T>(0);
+			return intersects(box, tNear, tFar);
+		}
+
+		_MSTD_CONSTEXPR20 bool intersects(const sphere<T>& target, T& t) const {
+			const vec_type offset = _origin - target.center;
+			const T a			  = _direction.dot(_direction);
+			const T b			  = offset.dot(_direction);
+			const T c			  = offset.dot(offset) - target.radius * target.radius;
+			const T discriminant  = b * b - a * c;
+				if (discriminant < static_cast<T>(0) || a == static_cast<T>(0)) { return false; }
+
+			const T root = static_cast<T>(mstd::sqrt(discriminant));
+			T res		 = (-b - root) / a;
+				if (res < static_cast<T>(0)) { res = (-b + root) / a; }
+				if (res < static_cast<T>(0)) { return false; }
+			t = res;
+			return true;
+		}
+
+		// a ray parallel to the plane never hits it, even when it lies in it
+		_MSTD_CONSTEXPR20 bool intersects(const plane<T>& target, T& t) const {
+			const T denominator = target.normal.dot(_direction);
+				if (denominator == static_cast<T>(0)) { return false; }
+
+			const T res = -target.signed_distance(_origin) / denominator;
+				if (res < static_cast<T>(0)) { return false; }
+			t = res;
+			return true;
+		}
+
+		#pragma endregion // INTERSECTIONS
+	};
+
+		#pragma endregion // RAY
+
+		#pragma region AABB_SOA
+
+	// boxes stored as two vec_soa (mins and maxs), the layout the batched frustum culling reads
+		#if _MSTD_HAS_CXX20
+	template<size_t N, arithmetic T>
+	requires (N > 0)
+		#else
+	template<size_t N, class T, std::enable_if_t<(N > 0 && std::is_arithmetic_v<T>), bool> >
+		#endif
+	class aabb_soa {
+	public:
+		using value_type = T;
+		using aabb_type	 = aabb<N, T>;
+		using soa_type	 = vec_soa<N, T>;
+		using size_type	 = _MSTD_TYPENAME17 soa_type::size_type;
+
+	private:
+		soa_type _mins;
+		soa_type _maxs;
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 aabb_soa() = default;
+
+		_MSTD_CONSTEXPR20 aabb_soa(const std::initializer_list<aabb_type>& init) {
+			reserve(init.size());
+				for (const auto& box : init) { push_back(box); }
+		}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region CAPACITY
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const noexcept { return _mins.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _mins.empty(); }
+
+		_MSTD_CONSTEXPR20 void reserve(size_type count) {
+			_mins.reserve(count);
+			_maxs.reserve(count);
+		}
+
+		_MSTD_CONSTEXPR20 void resize(size_type count) {
+			_mins.resize(count);
+			_maxs.resize(count);
+		}
+
+		_MSTD_CONSTEXPR20 void clear() noexcept {
+			_mins.clear();
+			_maxs.clear();
+		}
+
+		#pragma endregion // CAPACITY
+
+		#pragma region MODIFIERS
+
+		_MSTD_CONSTEXPR20 void push_back(const aabb_type& box) {
+			_mins.push_back(box.min);
+			_maxs.push_back(box.max);
+		}
+
+		_MSTD_CONSTEXPR20 void pop_back() {
+			_mins.pop_back();
+			_maxs.pop_back();
+		}
+
+		_MSTD_CONSTEXPR20 void set(size_type idx, const aabb_type& box) {
+			_mins.set(idx, box.min);
+			_maxs.set(idx, box.max);
+		}
+
+		#pragma endregion // MODIFIERS
+
+		#pragma region ACCESS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 aabb_type get(size_type idx) const { return aabb_type(_mins.get(idx), _maxs.get(idx)); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const soa_type& mins() const noexcept { return _mins; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const soa_type& maxs() const noexcept { return _maxs; }
+
+		#pragma endregion // ACCESS
+	};
+
+		#pragma endregion // AABB_SOA
+
+	namespace utils {
+		#pragma region CULL_KERNELS
+
+		// planes are (nx, ny, nz, d) with normals pointing into the frustum. A box is visible unless its corner furthest
+		// along a normal is behind that plane, which keeps some boxes near the frustum edges that are outside of it but
+		// never drops a visible one. Visible boxes set bit i % 64 of mask[i / 64], mask has (count + 63) / 64 words
+		template<class T>
+		struct scalar_cull_kernels {
+			static _MSTD_CONSTEXPR20 bool visible(const T (&planes)[6][4], const T (&mins)[3], const T (&maxs)[3]) noexcept {
+					for (size_t p = 0; p != 6; ++p) {
+						const T x = planes[p][0] >= static_cast<T>(0) ? maxs[0] : mins[0];
+						const T y = planes[p][1] >= static_cast<T>(0) ? maxs[1] : mins[1];
+						const T z = planes[p][2] >= static_cast<T>(0) ? maxs[2] : mins[2];
+							if (!(planes[p][0] * x + planes[p][1] * y + planes[p][2] * z + planes[p][3] >= static_cast<T>(0))) {
+								return false;
+							}
+					}
+				return true;
+			}
+
+			static void cull(const T (&planes)[6][4], const T* const (&mins)[3], const T* const (&maxs)[3], size_t count,
+			  uint64_t* mask) noexcept {
+				std::fill_n(mask, (count + 63) / 64, uint64_t(0));
+				cull_range(planes, mins, maxs, 0, count, mask);
+			}
+
+		protected:
+			static void cull_range(const T (&planes)[6][4], const T* const (&mins)[3], const T* const (&maxs)[3],
+			  size_t first, size_t last, uint64_t* mask) noexcept {
+					for (size_t i = first; i != last; ++i) {
+						const T boxMin[3] = { mins[0][i], mins[1][i], mins[2][i] };
+						const T boxMax[3] = { maxs[0][i], maxs[1][i], maxs[2][i] };
+						mask[i / 64] |= static_cast<uint64_t>(visible(planes, boxMin, boxMax)) << (i % 64);
+					}
+			}
+		};
+
+		template<class T>
+		struct cull_kernels : scalar_cull_kernels<T> {};
+
+		#pragma endregion // CULL_KERNELS
+
+		#if _MSTD_HAS_SIMD
+			#pragma region SIMD_CULL_KERNELS
+
+		// 16 (AVX-512), 8 (AVX) or 4 (SSE, NEON) boxes per step. The corner of every plane is picked once per batch by
+		// choosing the min or max lane, the distances are computed in the order of the scalar test so both give the same
+		// result for every box
+		template<>
+		struct cull_kernels<float> : scalar_cull_kernels<float> {
+		private:
+			using _scalar = scalar_cull_kernels<float>;
+
+		public:
+			static void cull(const float (&planes)[6][4], const float* const (&mins)[3], const float* const (&maxs)[3],
+			  size_t count, uint64_t* mask) noexcept {
+				std::fill_n(mask, (count + 63) / 64, uint64_t(0));
+
+				const float* corners[6][3];
+					for (size_t p = 0; p != 6; ++p) {
+							for (size_t c = 0; c != 3; ++c) { corners[p][c] = planes[p][c] >= 0.f ? maxs[c] : mins[c]; }
+					}
+
+				size_t i = 0;
+			#if _MSTD_HAS_AVX512VL
+					for (; i + 16 <= count; i += 16) {
+						__mmask16 visible = 0xFFFF;
+							for (size_t p = 0; p != 6; ++p) {
+								__m512 dist = _mm512_mul_ps(_mm512_set1_ps(planes[p][0]), _mm512_loadu_ps(corners[p][0] + i));
+								dist		= _mm512_add_ps(dist,
+									   _mm512_mul_ps(_mm512_set1_ps(planes[p][1]), _mm512_loadu_ps(corners[p][1] + i)));
+								dist		= _mm512_add_ps(dist,
+									   _mm512_mul_ps(_mm512_set1_ps(planes[p][2]), _mm512_loadu_ps(corners[p][2] + i)));
+								dist		= _mm512_add_ps(dist, _mm512_set1_ps(planes[p][3]));
+								visible		= _mm512_mask_cmp_ps_mask(visible, dist, _mm512_setzero_ps(), _CMP_GE_OQ);
+							}
+						mask[i / 64] |= static_cast<uint64_t>(visible) << (i % 64);
+					}
+			#endif
+			#if _MSTD_HAS_AVX
+					for (; i + 8 <= count; i += 8) {
+						__m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+							for (size_t p = 0; p != 6; ++p) {
+								__m256 dist = _mm256_mul_ps(_mm256_set1_ps(planes[p][0]), _mm256_loadu_ps(corners[p][0] + i));
+								dist		= _mm256_add_ps(dist,
+									   _mm256_mul_ps(_mm256_set1_ps(planes[p][1]), _mm256_loadu_ps(corners[p][1] + i)));
+								dist		= _mm256_add_ps(dist,
+									   _mm256_mul_ps(_mm256_set1_ps(planes[p][2]), _mm256_loadu_ps(corners[p][2] + i)));
+								dist		= _mm256_add_ps(dist, _mm256_set1_ps(planes[p][3]));
+								visible		= _mm256_and_ps(visible, _mm256_cmp_ps(dist, _mm256_setzero_ps(), _CMP_GE_OQ));
+							}
+						mask[i / 64] |= static_cast<uint64_t>(_mm256_movemask_ps(visible)) << (i % 64);
+					}
+			#elif _MSTD_HAS_SSE2
+					for (; i + 4 <= count; i += 4) {
+						__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+							for (size_t p = 0; p != 6; ++p) {
+								__m128 dist = _mm_mul_ps(_mm_set1_ps(planes[p][0]), _mm_loadu_ps(corners[p][0] + i));
+								dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(planes[p][1]), _mm_loadu_ps(corners[p][1] + i)));
+								dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(planes[p][2]), _mm_loadu_ps(corners[p][2] + i)));
+								dist = _mm_add_ps(dist, _mm_set1_ps(planes[p][3]));
+								visible = _mm_and_ps(visible, _mm_cmpge_ps(dist, _mm_setzero_ps()));
+							}
+						mask[i / 64] |= static_cast<uint64_t>(_mm_movemask_ps(visible)) << (i % 64);
+					}
+			#elif _MSTD_HAS_NEON
+				const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+				const uint32x4_t bits	   = vld1q_u32(laneBits);
+					for (; i + 4 <= count; i += 4) {
+						uint32x4_t visible = vdupq_n_u32(0xFFFFFFFFu);
+							for (size_t p = 0; p != 6; ++p) {
+								float32x4_t dist = vmulq_n_f32(vld1q_f32(corners[p][0] + i), planes[p][0]);
+								dist			 = vaddq_f32(dist, vmulq_n_f32(vld1q_f32(corners[p][1] + i), planes[p][1]));
+								dist			 = vaddq_f32(dist, vmulq_n_f32(vld1q_f32(corners[p][2] + i), planes[p][2]));
+								dist			 = vaddq_f32(dist, vdupq_n_f32(planes[p][3]));
+								visible			 = vandq_u32(visible, vcgeq_f32(dist, vdupq_n_f32(0.f)));
+							}
+						mask[i / 64] |= static_cast<uint64_t>(vaddvq_u32(vandq_u32(visible, bits))) << (i % 64);
+					}
+			#endif
+				_scalar::cull_range(planes, mins, maxs, i, count, mask);
+			}
+		};
+
+			#pragma endregion // SIMD_CULL_KERNELS
+		#endif
+	} // namespace utils
+
+		#pragma region FRUSTUM
+
+	enum class frustum_plane : uint8_t { left = 0, right = 1, bottom = 2, top = 3, near = 4, far = 5 };
+
+	// the 6 planes of a view frustum, extracted from a projection or view projection matrix (Gribb-Hartmann). Normals
+	// are unit length and point inside. clipNear and clipFar are the clip space depths of the near and far plane: -1, 1
+	// for the defaults of mat::perspective/frustrum, 0, 1 for zero to one depth and 1, 0 for reversed depth
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> >
+		#endif
+	class frustum {
+	public:
+		using value_type = T;
+		using vec_type	 = vec<3, T>;
+		using plane_type = plane<T>;
+
+	private:
+		plane_type _planes[6];
+
+		static _MSTD_CONSTEXPR20 plane_type _make_plane(const T (&rows)[4][4], size_t row, const T& rowSign,
+		  const T& wScale) {
+			T coefficients[4];
+				for (size_t c = 0; c != 4; ++c) { coefficients[c] = rows[3][c] * wScale + rows[row][c] * rowSign; }
+			return plane_type(vec_type(coefficients[0], coefficients[1], coefficients[2]), coefficients[3]).normalized();
+		}
+
+		// planes packed for cull_kernels
+		_MSTD_CONSTEXPR20 void _packed(T (&planes)[6][4]) const {
+				for (size_t p = 0; p != 6; ++p) {
+						for (size_t c = 0; c != 3; ++c) { planes[p][c] = _planes[p].normal[c]; }
+					planes[p][3] = _planes[p].distance;
+				}
+		}
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 frustum() = default;
+
+		_MSTD_CONSTEXPR20 explicit frustum(const mat<4, 4, T>& viewProjection, const T& clipNear = static_cast<T>(-1),
+		  const T& clipFar = static_cast<T>(1)) {
+			T rows[4][4];
+				for (size_t r = 0; r != 4; ++r) {
+						for (size_t c = 0; c != 4; ++c) { rows[r][c] = viewProjection[c][r]; }
+				}
+
+			// -w <= x <= w, -w <= y <= w and z between clipNear * w and clipFar * w
+			const T one		= static_cast<T>(1);
+			const T nearDir = clipNear < clipFar ? one : -one;
+			_planes[static_cast<size_t>(frustum_plane::left)]	= _make_plane(rows, 0, one, one);
+			_planes[static_cast<size_t>(frustum_plane::right)]	= _make_plane(rows, 0, -one, one);
+			_planes[static_cast<size_t>(frustum_plane::bottom)] = _make_plane(rows, 1, one, one);
+			_planes[static_cast<size_t>(frustum_plane::top)]	= _make_plane(rows, 1, -one, one);
+			_planes[static_cast<size_t>(frustum_plane::near)]	= _make_plane(rows, 2, nearDir, -clipNear * nearDir);
+			_planes[static_cast<size_t>(frustum_plane::far)]	= _make_plane(rows, 2, -nearDir, clipFar * nearDir);
+		}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region GETTERS
+
+		_MSTD_CONSTEXPR20 const plane_type& operator[](const frustum_plane& idx) const {
+			return _planes[static_cast<size_t>(idx)];
+		}
+
+		_MSTD_CONSTEXPR20 const plane_type& operator[](size_t idx) const { return _planes[idx]; }
+
+		#pragma endregion // GETTERS
+
+		#pragma region TESTS
+
+		_MSTD_CONSTEXPR20 bool contains(const vec_type& point) const {
+				for (const plane_type& plane : _planes) {
+						if (plane.signed_distance(point) < static_cast<T>(0)) { return false; }
+				}
+			return true;
+		}
+
+		_MSTD_CONSTEXPR20 bool intersects(const sphere<T>& target) const {
+				for (const plane_type& plane : _planes) {
+						if (plane.signed_distance(target.center) < -target.radius) { return false; }
+				}
+			return true;
+		}
+
+		// the same conservative test as cull
+		_MSTD_CONSTEXPR20 bool intersects(const aabb<3, T>& box) const {
+			T planes[6][4];
+			_packed(planes);
+			const T mins[3] = { box.min[0], box.min[1], box.min[2] };
+			const T maxs[3] = { box.max[0], box.max[1], box.max[2] };
+			return utils::scalar_cull_kernels<T>::visible(planes, mins, maxs);
+		}
+
+		#pragma endregion // TESTS
+
+		#pragma region CULLING
+
+		// bit i % 64 of mask[i / 64] is set when intersects(boxes.get(i)) is true, mask needs (boxes.size() + 63) / 64
+		// words and the unused bits of the last one are cleared
+		void cull(const aabb_soa<3, T>& boxes, uint64_t* mask) const {
+			T planes[6][4];
+			_packed(planes);
+			const T* const mins[3] = { boxes.mins().lane(0), boxes.mins().lane(1), boxes.mins().lane(2) };
+			const T* const maxs[3] = { boxes.maxs().lane(0), boxes.maxs().lane(1), boxes.maxs().lane(2) };
+			utils::cull_kernels<T>::cull(planes, mins, maxs, boxes.size(), mask);
+		}
+
+		[[nodiscard]] std::vector<uint64_t> cull(const aabb_soa<3, T>& boxes) const {
+			std::vector<uint64_t> res((boxes.size() + 63) / 64);
+			cull(boxes, res.data());
+			return res;
+		}
+
+		#pragma endregion // CULLING
+	};
+
+		#pragma endregion // FRUSTUM
+
+		#pragma region PREDEFINED_GEOMETRY
+
+	using aabb2	 = aabb<2, float>;
+	using aabb3	 = aabb<3, float>;
+	using daabb2 = aabb<2, double>;
+	using daabb3 = aabb<3, double>;
+	using iaabb2 = aabb<2, int>;
+	using iaabb3 = aabb<3, int>;
+
+		#pragma endregion // PREDEFINED_GEOMETRY
+} // namespace mstd
+	#endif
+#endif
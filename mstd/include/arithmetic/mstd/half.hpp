@@ -0,0 +1,533 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_HALF_HPP_
+	#define _MSTD_HALF_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/arithmetic_types.hpp>
+		#include <mstd/bit_operations.hpp>
+		#include <mstd/simd.hpp>
+
+namespace mstd {
+	// 16 bit floating point layouts: binary16 is IEEE 754 half precision (5 exponent and 10 mantissa bits), bfloat16 keeps
+	// the 8 exponent bits of float and its top 7 mantissa bits
+	enum class float16_format : uint8_t { binary16 = 0, bfloat16 = 1 };
+
+	namespace utils {
+		#pragma region FLOAT16_FORMATS
+
+		// bit level conversions from and to float. Both round to nearest even, values past max become infinity and NaNs
+		// stay NaNs with the quiet bit set
+		template<float16_format Format>
+		struct float16_traits;
+
+		template<>
+		struct float16_traits<float16_format::binary16> {
+			static _MSTD_CONSTEXPR17 const uint16_t mantissa_bits = 10;
+			static _MSTD_CONSTEXPR17 const uint16_t exponent_bits = 5;
+			static _MSTD_CONSTEXPR17 const int digits10			  = 3;
+			static _MSTD_CONSTEXPR17 const int max_digits10		  = 5;
+			static _MSTD_CONSTEXPR17 const int min_exponent10	  = -4;
+			static _MSTD_CONSTEXPR17 const int max_exponent10	  = 4;
+
+			static _MSTD_CONSTEXPR17 uint16_t from_float_bits(uint32_t bits) noexcept {
+				const uint32_t sign = (bits >> 16) & 0x8000u;
+				uint32_t abs		= bits & 0x7FFFFFFFu;
+
+					if (abs >= 0x7F800000u) {
+						// infinity or NaN, NaNs keep the top mantissa bits
+						const uint32_t mantissa = abs > 0x7F800000u ? 0x200u | ((abs >> 13) & 0x3FFu) : 0u;
+						return static_cast<uint16_t>(sign | 0x7C00u | mantissa);
+					}
+					// 65520 is halfway between max (65504) and 65536, ties go to the even infinity
+					if (abs >= 0x477FF000u) { return static_cast<uint16_t>(sign | 0x7C00u); }
+					if (abs >= 0x38800000u) {
+						// normal, rebias the exponent (127 - 15 = 112) and round away the 13 lowest mantissa bits, a
+						// carry out of the mantissa correctly moves to the next exponent
+						abs += 0xC8000FFFu + ((abs >> 13) & 1u);
+						return static_cast<uint16_t>(sign | (abs >> 13));
+					}
+					// 2^-25 is halfway between 0 and the smallest subnormal (2^-24), ties go to the even 0
+					if (abs <= 0x33000000u) { return static_cast<uint16_t>(sign); }
+
+				// subnormal, value * 2^24 rounded to nearest even is the mantissa (which may round up to the smallest
+				// normal, whose bits come out right as well)
+				const uint32_t exponent = abs >> 23;
+				const uint32_t mantissa = (abs & 0x7FFFFFu) | 0x800000u;
+				const uint32_t shift	= 126u - exponent;
+				uint32_t res			= mantissa >> shift;
+				const uint32_t rest		= mantissa & ((1u << shift) - 1u);
+				const uint32_t halfway	= 1u << (shift - 1u);
+					if (rest > halfway || (rest == halfway && (res & 1u) != 0)) { ++res; }
+				return static_cast<uint16_t>(sign | res);
+			}
+
+			static _MSTD_CONSTEXPR17 uint32_t to_float_bits(uint16_t bits) noexcept {
+				const uint32_t sign		= static_cast<uint32_t>(bits & 0x8000u) << 16;
+				const uint32_t exponent = (bits >> 10) & 0x1Fu;
+				uint32_t mantissa		= bits & 0x3FFu;
+
+					if (exponent == 0x1Fu) { return sign | 0x7F800000u | (mantissa != 0 ? 0x400000u | (mantissa << 13) : 0u); }
+					if (exponent != 0) { return sign | ((exponent + 112u) << 23) | (mantissa << 13); }
+					if (mantissa == 0) { return sign; }
+
+				// subnormal, shift the mantissa up until it has the implicit bit
+				uint32_t floatExponent = 113;
+					while ((mantissa & 0x400u) == 0) {
+						mantissa <<= 1;
+						--floatExponent;
+					}
+				return sign | (floatExponent << 23) | ((mantissa & 0x3FFu) << 13);
+			}
+
+			static _MSTD_CONSTEXPR20 uint16_t from_float(float value) noexcept {
+		#if _MSTD_HAS_F16C
+					if (!_MSTD_IS_CONSTANT_EVALUATED()) {
+						return static_cast<uint16_t>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+					}
+		#endif
+				return from_float_bits(bit_cast<uint32_t>(value));
+			}
+
+			static _MSTD_CONSTEXPR20 float to_float(uint16_t bits) noexcept {
+		#if _MSTD_HAS_F16C
+					if (!_MSTD_IS_CONSTANT_EVALUATED()) { return _cvtsh_ss(bits); }
+		#endif
+				return bit_cast<float>(to_float_bits(bits));
+			}
+		};
+
+		template<>
+		struct float16_traits<float16_format::bfloat16> {
+			static _MSTD_CONSTEXPR17 const uint16_t mantissa_bits = 7;
+			static _MSTD_CONSTEXPR17 const uint16_t exponent_bits = 8;
+			static _MSTD_CONSTEXPR17 const int digits10			  = 2;
+			static _MSTD_CONSTEXPR17 const int max_digits10		  = 4;
+			static _MSTD_CONSTEXPR17 const int min_exponent10	  = -37;
+			static _MSTD_CONSTEXPR17 const int max_exponent10	  = 38;
+
+			// the upper half of the float, rounded on the lower one. A carry into the exponent is the correct result,
+			// up to infinity
+			static _MSTD_CONSTEXPR17 uint16_t from_float_bits(uint32_t bits) noexcept {
+					if ((bits & 0x7FFFFFFFu) > 0x7F800000u) { return static_cast<uint16_t>((bits >> 16) | 0x40u); }
+				return static_cast<uint16_t>((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+			}
+
+			static _MSTD_CONSTEXPR17 uint32_t to_float_bits(uint16_t bits) noexcept { return static_cast<uint32_t>(bits) << 16; }
+
+			static _MSTD_CONSTEXPR20 uint16_t from_float(float value) noexcept {
+				return from_float_bits(bit_cast<uint32_t>(value));
+			}
+
+			static _MSTD_CONSTEXPR20 float to_float(uint16_t bits) noexcept { return bit_cast<float>(to_float_bits(bits)); }
+		};
+
+		#pragma endregion // FLOAT16_FORMATS
+	} // namespace utils
+
+	// 16 bit floating point storage. Every operation converts to float, computes there and rounds the result back, float
+	// has enough precision for +, -, *, / and sqrt to come out correctly rounded for both formats. Converting to float
+	// is exact and implicit, everything else converts explicitly (doubles and integers through float)
+	template<float16_format Format>
+	class float16 {
+	public:
+		using bits_type										  = uint16_t;
+		static _MSTD_CONSTEXPR17 const float16_format format = Format;
+
+	private:
+		using _traits = utils::float16_traits<Format>;
+
+		uint16_t _bits = 0;
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR17 float16() noexcept = default;
+
+		#if _MSTD_HAS_CXX20
+		template<arithmetic T>
+		#else
+		template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+		explicit _MSTD_CONSTEXPR20 float16(const T& value) noexcept : _bits(_traits::from_float(static_cast<float>(value))) {
+		}
+
+		template<float16_format OtherFormat>
+		explicit _MSTD_CONSTEXPR20 float16(const float16<OtherFormat>& other) noexcept
+			: _bits(_traits::from_float(static_cast<float>(other))) {}
+
+		static _MSTD_CONSTEXPR17 float16 from_bits(const uint16_t& bits) noexcept {
+			float16 res;
+			res._bits = bits;
+			return res;
+		}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region GETTERS
+
+		_MSTD_CONSTEXPR17 uint16_t bits() const noexcept { return _bits; }
+
+		#pragma endregion // GETTERS
+
+		#pragma region CONVERSIONS
+
+		_MSTD_CONSTEXPR20 operator float() const noexcept { return _traits::to_float(_bits); }
+
+		#pragma endregion // CONVERSIONS
+
+		#pragma region OPERATORS
+
+		_MSTD_CONSTEXPR20 float16& operator+=(const float16& other) noexcept {
+			_bits = _traits::from_float(static_cast<float>(*this) + static_cast<float>(other));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 float16& operator-=(const float16& other) noexcept {
+			_bits = _traits::from_float(static_cast<float>(*this) - static_cast<float>(other));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 float16& operator*=(const float16& other) noexcept {
+			_bits = _traits::from_float(static_cast<float>(*this) * static_cast<float>(other));
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 float16& operator/=(const float16& other) noexcept {
+			_bits = _traits::from_float(static_cast<float>(*this) / static_cast<float>(other));
+			return *this;
+		}
+
+		friend _MSTD_CONSTEXPR20 float16 operator+(float16 a, const float16& b) noexcept { return a += b; }
+
+		friend _MSTD_CONSTEXPR20 float16 operator-(float16 a, const float16& b) noexcept { return a -= b; }
+
+		friend _MSTD_CONSTEXPR20 float16 operator*(float16 a, const float16& b) noexcept { return a *= b; }
+
+		friend _MSTD_CONSTEXPR20 float16 operator/(float16 a, const float16& b) noexcept { return a /= b; }
+
+		_MSTD_CONSTEXPR17 float16 operator+() const noexcept { return *this; }
+
+		// flips the sign bit, exact for every value including NaNs
+		_MSTD_CONSTEXPR17 float16 operator-() const noexcept { return from_bits(static_cast<uint16_t>(_bits ^ 0x8000u)); }
+
+		friend _MSTD_CONSTEXPR20 bool operator==(const float16& a, const float16& b) noexcept {
+			return static_cast<float>(a) == static_cast<float>(b);
+		}
+
+		friend _MSTD_CONSTEXPR20 bool operator!=(const float16& a, const float16& b) noexcept {
+			return static_cast<float>(a) != static_cast<float>(b);
+		}
+
+		friend _MSTD_CONSTEXPR20 bool operator<(const float16& a, const float16& b) noexcept {
+			return static_cast<float>(a) < static_cast<float>(b);
+		}
+
+		friend _MSTD_CONSTEXPR20 bool operator<=(const float16& a, const float16& b) noexcept {
+			return static_cast<float>(a) <= static_cast<float>(b);
+		}
+
+		friend _MSTD_CONSTEXPR20 bool operator>(const float16& a, const float16& b) noexcept {
+			return static_cast<float>(a) > static_cast<float>(b);
+		}
+
+		friend _MSTD_CONSTEXPR20 bool operator>=(const float16& a, const float16& b) noexcept {
+			return static_cast<float>(a) >= static_cast<float>(b);
+		}
+
+		friend std::ostream& operator<<(std::ostream& str, const float16& value) {
+			return str << static_cast<float>(value);
+		}
+
+		#pragma endregion // OPERATORS
+	};
+
+	template<float16_format Format>
+	struct is_arithmetic_like<float16<Format> > : std::true_type {};
+
+		#pragma region PREDEFINED_FLOAT16
+
+	using half	   = float16<float16_format::binary16>;
+	using bfloat16 = float16<float16_format::bfloat16>;
+
+		#pragma endregion // PREDEFINED_FLOAT16
+
+		#pragma region FLOAT16_MATH
+
+	template<float16_format Format>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR17 float16<Format> abs(const float16<Format>& x) noexcept {
+		return float16<Format>::from_bits(static_cast<uint16_t>(x.bits() & 0x7FFFu));
+	}
+
+	template<float16_format Format>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 float16<Format> sqrt(const float16<Format>& x) noexcept {
+		return float16<Format>(sqrt(static_cast<float>(x)));
+	}
+
+		#pragma endregion // FLOAT16_MATH
+
+	namespace utils {
+		#pragma region FLOAT16_VEC_KERNELS
+
+		// vec<N, float16> keeps the 16 bit storage but sums dot products in float, so they are rounded only once
+		template<size_t N, float16_format Format>
+		struct vec_kernels<N, float16<Format> > : scalar_vec_kernels<N, float16<Format> > {
+			static _MSTD_CONSTEXPR20 float16<Format> dot(const float16<Format>* a, const float16<Format>* b) noexcept {
+				float res = 0.f;
+					for (size_t i = 0; i != N; ++i) { res += static_cast<float>(a[i]) * static_cast<float>(b[i]); }
+				return float16<Format>(res);
+			}
+		};
+
+		#pragma endregion // FLOAT16_VEC_KERNELS
+
+		#pragma region FLOAT16_KERNELS
+
+		// whole buffer conversions, 16 values per step with AVX-512, 8 with F16C/AVX2 or SSE2, 4 with NEON and the scalar
+		// conversion for the tail. Every path rounds exactly like the scalar one, so the results do not depend on the
+		// instruction set. The AVX-512 code uses the zero masking forms with every lane set, the plain ones trip a false
+		// maybe-uninitialized warning in GCC 12
+		template<float16_format Format>
+		struct float16_kernels;
+
+		template<>
+		struct float16_kernels<float16_format::binary16> {
+			static void from_float(const float* src, half* dst, size_t count) noexcept {
+				size_t i = 0;
+		#if _MSTD_HAS_AVX512VL
+					for (; i + 16 <= count; i += 16) {
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+						  _mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+					}
+		#endif
+		#if _MSTD_HAS_F16C
+					for (; i + 8 <= count; i += 8) {
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+						  _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+					}
+		#elif _MSTD_HAS_NEON
+					for (; i + 4 <= count; i += 4) {
+						vst1_u16(reinterpret_cast<uint16_t*>(dst + i), vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+					}
+		#endif
+					for (; i != count; ++i) { dst[i] = half(src[i]); }
+			}
+
+			static void to_float(const half* src, float* dst, size_t count) noexcept {
+				size_t i = 0;
+		#if _MSTD_HAS_AVX512VL
+					for (; i + 16 <= count; i += 16) {
+						const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+						_mm512_storeu_ps(dst + i, _mm512_maskz_cvtph_ps(0xFFFF, bits));
+					}
+		#endif
+		#if _MSTD_HAS_F16C
+					for (; i + 8 <= count; i += 8) {
+						const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+						_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(bits));
+					}
+		#elif _MSTD_HAS_NEON
+					for (; i + 4 <= count; i += 4) {
+						const uint16x4_t bits = vld1_u16(reinterpret_cast<const uint16_t*>(src + i));
+						vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(bits)));
+					}
+		#endif
+					for (; i != count; ++i) { dst[i] = static_cast<float>(src[i]); }
+			}
+		};
+
+		// no instruction is needed for bfloat16, the rounding of float16_traits is a few integer operations that vectorize
+		// on every instruction set. The AVX-512 BF16 conversion is not used, it flushes subnormals to zero
+		template<>
+		struct float16_kernels<float16_format::bfloat16> {
+			static void from_float(const float* src, bfloat16* dst, size_t count) noexcept {
+				size_t i = 0;
+		#if _MSTD_HAS_AVX512VL
+					for (; i + 16 <= count; i += 16) {
+						const __m512 value = _mm512_loadu_ps(src + i);
+						const __m512i bits = _mm512_castps_si512(value);
+						const __m512i lsb  = _mm512_and_si512(_mm512_maskz_srli_epi32(0xFFFF, bits, 16), _mm512_set1_epi32(1));
+						const __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(_mm512_set1_epi32(0x7FFF), lsb));
+						const __m512i res	  = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(value, value, _CMP_UNORD_Q), rounded,
+							 _mm512_or_si512(bits, _mm512_set1_epi32(0x400000)));
+						const __m256i packed = _mm512_maskz_cvtepi32_epi16(0xFFFF, _mm512_maskz_srli_epi32(0xFFFF, res, 16));
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), packed);
+					}
+		#endif
+		#if _MSTD_HAS_AVX2
+					for (; i + 8 <= count; i += 8) {
+						const __m256 value = _mm256_loadu_ps(src + i);
+						const __m256i bits = _mm256_castps_si256(value);
+						const __m256i lsb	  = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+						const __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), lsb));
+						const __m256i nan	  = _mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_UNORD_Q));
+						// the arithmetic shift keeps the results in int16 range, so the saturating pack is exact
+						const __m256i res = _mm256_srai_epi32(
+						  _mm256_blendv_epi8(rounded, _mm256_or_si256(bits, _mm256_set1_epi32(0x400000)), nan), 16);
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+						  _mm_packs_epi32(_mm256_castsi256_si128(res), _mm256_extracti128_si256(res, 1)));
+					}
+		#elif _MSTD_HAS_SSE2
+					for (; i + 8 <= count; i += 8) {
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+						  _mm_packs_epi32(_from_float(_mm_loadu_ps(src + i)), _from_float(_mm_loadu_ps(src + i + 4))));
+					}
+		#elif _MSTD_HAS_NEON
+					for (; i + 4 <= count; i += 4) {
+						const float32x4_t value = vld1q_f32(src + i);
+						const uint32x4_t bits	= vreinterpretq_u32_f32(value);
+						const uint32x4_t lsb	 = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+						const uint32x4_t rounded = vaddq_u32(bits, vaddq_u32(vdupq_n_u32(0x7FFF), lsb));
+						const uint32x4_t res
+						  = vbslq_u32(vceqq_f32(value, value), rounded, vorrq_u32(bits, vdupq_n_u32(0x400000)));
+						vst1_u16(reinterpret_cast<uint16_t*>(dst + i), vshrn_n_u32(res, 16));
+					}
+		#endif
+					for (; i != count; ++i) { dst[i] = bfloat16(src[i]); }
+			}
+
+			static void to_float(const bfloat16* src, float* dst, size_t count) noexcept {
+				size_t i = 0;
+		#if _MSTD_HAS_AVX512VL
+					for (; i + 16 <= count; i += 16) {
+						const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+						const __m512i wide = _mm512_maskz_cvtepu16_epi32(0xFFFF, bits);
+						_mm512_storeu_ps(dst + i, _mm512_castsi512_ps(_mm512_maskz_slli_epi32(0xFFFF, wide, 16)));
+					}
+		#endif
+		#if _MSTD_HAS_AVX2
+					for (; i + 8 <= count; i += 8) {
+						const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+						_mm256_storeu_ps(dst + i, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(bits), 16)));
+					}
+		#elif _MSTD_HAS_SSE2
+					for (; i + 8 <= count; i += 8) {
+						// interleaving zeros below every value is the shift by 16
+						const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+						_mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), bits)));
+						_mm_storeu_ps(dst + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), bits)));
+					}
+		#elif _MSTD_HAS_NEON
+					for (; i + 4 <= count; i += 4) {
+						const uint16x4_t bits = vld1_u16(reinterpret_cast<const uint16_t*>(src + i));
+						vst1q_f32(dst + i, vreinterpretq_f32_u32(vshll_n_u16(bits, 16)));
+					}
+		#endif
+					for (; i != count; ++i) { dst[i] = static_cast<float>(src[i]); }
+			}
+
+		private:
+		#if _MSTD_HAS_SSE2 && !_MSTD_HAS_AVX2
+			// rounded bits shifted down arithmetically, so the saturating pack is exact
+			static __m128i _from_float(__m128 value) noexcept {
+				const __m128i bits = _mm_castps_si128(value);
+				const __m128i lsb	  = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+				const __m128i rounded = _mm_add_epi32(bits, _mm_add_epi32(_mm_set1_epi32(0x7FFF), lsb));
+				const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(value, value));
+				const __m128i res = _mm_or_si128(_mm_and_si128(nan, _mm_or_si128(bits, _mm_set1_epi32(0x400000))),
+				  _mm_andnot_si128(nan, rounded));
+				return _mm_srai_epi32(res, 16);
+			}
+		#endif
+		};
+
+		#pragma endregion // FLOAT16_KERNELS
+	} // namespace utils
+
+	// Bulk conversions between float and 16 bit buffers, src and dst may not overlap. Results are bit for bit the same as
+	// converting every value on its own
+
+		#pragma region BULK_FLOAT16
+
+	// dst[i] = float16<Format>(src[i])
+	template<float16_format Format>
+	void convert(const float* src, float16<Format>* dst, size_t count) noexcept {
+		utils::float16_kernels<Format>::from_float(src, dst, count);
+	}
+
+	// dst[i] = static_cast<float>(src[i])
+	template<float16_format Format>
+	void convert(const float16<Format>* src, float* dst, size_t count) noexcept {
+		utils::float16_kernels<Format>::to_float(src, dst, count);
+	}
+
+		#pragma endregion // BULK_FLOAT16
+} // namespace mstd
+
+namespace std {
+	template<mstd::float16_format Format>
+	class numeric_limits<mstd::float16<Format> > {
+		using _float16 = mstd::float16<Format>;
+		using _traits  = mstd::utils::float16_traits<Format>;
+
+		static _MSTD_CONSTEXPR17 const int _bias		   = (1 << (_traits::exponent_bits - 1)) - 1;
+		static _MSTD_CONSTEXPR17 const uint16_t _infinity = static_cast<uint16_t>(((1u << _traits::exponent_bits) - 1u)
+																					<< _traits::mantissa_bits);
+
+		static _MSTD_CONSTEXPR17 _float16 _from_exponent(int exponent) noexcept {
+			return _float16::from_bits(static_cast<uint16_t>(static_cast<unsigned>(exponent + _bias) << _traits::mantissa_bits));
+		}
+
+	public:
+		static _MSTD_CONSTEXPR17 const bool is_specialized			 = true;
+		static _MSTD_CONSTEXPR17 const bool is_signed				 = true;
+		static _MSTD_CONSTEXPR17 const bool is_integer				 = false;
+		static _MSTD_CONSTEXPR17 const bool is_exact				 = false;
+		static _MSTD_CONSTEXPR17 const bool has_infinity			 = true;
+		static _MSTD_CONSTEXPR17 const bool has_quiet_NaN			 = true;
+		static _MSTD_CONSTEXPR17 const bool has_signaling_NaN		 = true;
+		static _MSTD_CONSTEXPR17 const float_denorm_style has_denorm = denorm_present;
+		static _MSTD_CONSTEXPR17 const bool has_denorm_loss			 = false;
+		static _MSTD_CONSTEXPR17 const float_round_style round_style = round_to_nearest;
+		static _MSTD_CONSTEXPR17 const bool is_iec559				 = Format == mstd::float16_format::binary16;
+		static _MSTD_CONSTEXPR17 const bool is_bounded				 = true;
+		static _MSTD_CONSTEXPR17 const bool is_modulo				 = false;
+		static _MSTD_CONSTEXPR17 const int digits					 = _traits::mantissa_bits + 1;
+		static _MSTD_CONSTEXPR17 const int digits10					 = _traits::digits10;
+		static _MSTD_CONSTEXPR17 const int max_digits10				 = _traits::max_digits10;
+		static _MSTD_CONSTEXPR17 const int radix					 = 2;
+		static _MSTD_CONSTEXPR17 const int min_exponent				 = 2 - _bias;
+		static _MSTD_CONSTEXPR17 const int min_exponent10			 = _traits::min_exponent10;
+		static _MSTD_CONSTEXPR17 const int max_exponent				 = _bias + 1;
+		static _MSTD_CONSTEXPR17 const int max_exponent10			 = _traits::max_exponent10;
+		static _MSTD_CONSTEXPR17 const bool traps					 = false;
+		static _MSTD_CONSTEXPR17 const bool tinyness_before			 = false;
+
+		static _MSTD_CONSTEXPR17 _float16 min() noexcept { return _from_exponent(1 - _bias); }
+
+		static _MSTD_CONSTEXPR17 _float16 lowest() noexcept { return -max(); }
+
+		static _MSTD_CONSTEXPR17 _float16 max() noexcept { return _float16::from_bits(static_cast<uint16_t>(_infinity - 1u)); }
+
+		static _MSTD_CONSTEXPR17 _float16 epsilon() noexcept { return _from_exponent(-static_cast<int>(_traits::mantissa_bits)); }
+
+		static _MSTD_CONSTEXPR17 _float16 round_error() noexcept { return _from_exponent(-1); }
+
+		static _MSTD_CONSTEXPR17 _float16 infinity() noexcept { return _float16::from_bits(_infinity); }
+
+		static _MSTD_CONSTEXPR17 _float16 quiet_NaN() noexcept {
+			return _float16::from_bits(static_cast<uint16_t>(_infinity | (1u << (_traits::mantissa_bits - 1u))));
+		}
+
+		static _MSTD_CONSTEXPR17 _float16 signaling_NaN() noexcept {
+			return _float16::from_bits(static_cast<uint16_t>(_infinity | (1u << (_traits::mantissa_bits - 2u))));
+		}
+
+		static _MSTD_CONSTEXPR17 _float16 denorm_min() noexcept { return _float16::from_bits(1); }
+	};
+} // namespace std
+	#endif
+#endif
@@ -26,10 +26,10 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 
 namespace mstd {
 		#if _MSTD_HAS_CXX20
-	template<size_t C, size_t R, arithmetic T>
+	template<size_t C, size_t R, arithmetic_like T>
 	requires (C > 0 && R > 0)
 		#else
-	template<size_t C, size_t R, class T, std::enable_if_t<(C > 0 && R > 0 && std::is_arithmetic_v<T>), bool> >
+	template<size_t C, size_t R, class T, std::enable_if_t<(C > 0 && R > 0 && is_arithmetic_like_v<T>), bool> >
 		#endif
 	class mat {
 	public:
@@ -133,22 +133,32 @@ namespace mstd {
 
 		#pragma endregion // COLUMN_CLASS
 	private:
-		T _values[C][R] = {};
+		#if _MSTD_HAS_CXX20
+		template<size_t OC, size_t OR, arithmetic_like OT>
+		requires (OC > 0 && OR > 0)
+		#else
+		template<size_t OC, size_t OR, class OT, std::enable_if_t<(OC > 0 && OR > 0 && is_arithmetic_like_v<OT>), bool> >
+		#endif
+		friend class mat;
+
+		using _kernels = utils::mat_kernels<C, R, T>;
+
+		alignas(_kernels::alignment) T _values[C][R] = {};
 
 		#pragma region PRIVATE_METHODS
 		#if _MSTD_HAS_CXX20
-		template<arithmetic... Ts, size_t... Idxs>
+		template<arithmetic_like... Ts, size_t... Idxs>
 		#else
-		template<class... Ts, size_t... Idxs, std::enable_if_t<are_arithmetic_v<Ts...>, bool> = true>
+		template<class... Ts, size_t... Idxs, std::enable_if_t<are_all_v<is_arithmetic_like, Ts...>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _set_values(const std::index_sequence<Idxs...>&, const Ts&... values) {
 			((_values[Idxs / R][Idxs % R] = static_cast<T>(values)), ...);
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t VN, arithmetic VT>
+		template<size_t VN, arithmetic_like VT>
 		#else
-		template<size_t VN, class VT, std::enable_if_t<std::is_arithmetic_v<VT>, bool> = true>
+		template<size_t VN, class VT, std::enable_if_t<is_arithmetic_like_v<VT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _set_column(const size_t idx, const vec<VN, VT>& column) {
 			size_t maxSize = std::min(VN, R);
@@ -162,9 +172,9 @@ namespace mstd {
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t VN, arithmetic... Ts, size_t... Idxs>
+		template<size_t VN, arithmetic_like... Ts, size_t... Idxs>
 		#else
-		template<size_t VN, class... Ts, size_t... Idxs, std::enable_if_t<are_arithmetic_v<Ts...>, bool> = true>
+		template<size_t VN, class... Ts, size_t... Idxs, std::enable_if_t<are_all_v<is_arithmetic_like, Ts...>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _set_values(const std::index_sequence<Idxs...>&, const vec<VN, Ts>&... columns) {
 			(_set_column(Idxs, columns), ...);
@@ -181,7 +191,10 @@ namespace mstd {
 			std::fill_n(&_values[colIdx][firstIdx], R - firstIdx, value);
 		}
 
-		_MSTD_CONSTEXPR20 void _fill_values(const T& value) { std::fill_n(&_values[0][0], R * C, value); }
+		// filled column by column, walking past the first column through a flat pointer is not allowed in constant evaluation
+		_MSTD_CONSTEXPR20 void _fill_values(const T& value) {
+				for (size_t x = 0; x != C; ++x) { std::fill_n(_values[x], R, value); }
+		}
 
 		_MSTD_CONSTEXPR20 void _fill_values_from(size_t firstIdx, const T& value) {
 				if (firstIdx >= size) { return; }
@@ -189,15 +202,15 @@ namespace mstd {
 		}
 
 		_MSTD_CONSTEXPR20 void _set_identity_values(const T& value) {
-			std::fill_n(&_values[0][0], size, T(0));
+			_fill_values(T(0));
 			size_t minSize = std::min(C, R);
 				for (size_t i = 0; i != minSize; ++i) { _values[i][i] = value; }
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<arithmetic OT>
+		template<arithmetic_like OT>
 		#else
-		template<class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _copy_values_from(const OT* values, size_t size) {
 				if _MSTD_CONSTEXPR17 (std::is_same_v<T, OT>) {
@@ -216,9 +229,9 @@ namespace mstd {
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<arithmetic OT>
+		template<arithmetic_like OT>
 		#else
-		template<class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _copy_values_from(const OT* values, size_t columns, size_t rows) {
 			size_t colSize = std::min(columns, C);
@@ -238,27 +251,27 @@ namespace mstd {
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t ON, arithmetic OT>
+		template<size_t ON, arithmetic_like OT>
 		#else
-		template<size_t ON, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t ON, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _copy_values_from(const OT (&values)[ON]) {
 			_copy_values_from(&values, ON);
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t OC, size_t OR, arithmetic OT>
+		template<size_t OC, size_t OR, arithmetic_like OT>
 		#else
-		template<size_t OC, size_t OR, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t OC, size_t OR, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _copy_values_from(const OT (&values)[OC][OR]) {
 			_copy_values_from(&values, OC, OR);
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t VN, arithmetic OT>
+		template<size_t VN, arithmetic_like OT>
 		#else
-		template<size_t VN, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t VN, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _copy_values_from(const vec<VN, OT>* columns, size_t size) {
 			size_t colSize = std::min(C, size);
@@ -278,18 +291,18 @@ namespace mstd {
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t VN, size_t N, arithmetic OT>
+		template<size_t VN, size_t N, arithmetic_like OT>
 		#else
-		template<size_t VN, size_t N, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t VN, size_t N, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _copy_values_from(const vec<VN, OT> (&columns)[N]) {
 			_copy_values_from(&columns, N);
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t OC, size_t OR, arithmetic OT>
+		template<size_t OC, size_t OR, arithmetic_like OT>
 		#else
-		template<size_t OC, size_t OR, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t OC, size_t OR, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 void _copy_values_from(const mat<OC, OR, OT>& other) {
 			size_t colSize = std::min(OC, C);
@@ -308,17 +321,24 @@ namespace mstd {
 				}
 		}
 
+		// fraction-free (Bareiss) elimination, every division is exact so integer determinants stay exact in O(N^3)
+		_MSTD_CONSTEXPR20 T _bareiss_determinant() const {
+			T values[C][R] = {};
+				for (size_t x = 0; x != C; ++x) { std::copy_n(_values[x], R, values[x]); }
+			return utils::bareiss_determinant<T>(R, [&values](size_t x) { return values[x]; });
+		}
+
 		#pragma endregion // PRIVATE_METHOD
 
 	public:
 		#pragma region CONSTRUCTORS
 
-		_MSTD_CONSTEXPR20 mat() { _fill_values(0); }
+		_MSTD_CONSTEXPR20 mat() { _fill_values(T(0)); }
 
 		#if _MSTD_HAS_CXX20
-		template<arithmetic OT>
+		template<arithmetic_like OT>
 		#else
-		template<class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat(const OT* values, size_t size) {
 			_copy_values_from(values, size);
@@ -326,57 +346,57 @@ namespace mstd {
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<arithmetic OT>
+		template<arithmetic_like OT>
 		#else
-		template<class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat(const OT* values, size_t columns, size_t rows) {
 			_copy_values_from(values, columns, rows);
 			_fill_values_from(columns * R, static_cast<T>(0));
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t ON, arithmetic OT>
+		template<size_t ON, arithmetic_like OT>
 		#else
-		template<size_t ON, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t ON, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat(const OT (&values)[ON]) : mat(&values, ON) {
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t OC, size_t OR, arithmetic OT>
+		template<size_t OC, size_t OR, arithmetic_like OT>
 		#else
-		template<size_t OC, size_t OR, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t OC, size_t OR, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat(const OT (&values)[OC][OR]) : mat(&values, OC, OR) {
 		}
 		#if _MSTD_HAS_CXX20
-		template<arithmetic... Ts>
+		template<arithmetic_like... Ts>
 		requires (sizeof...(Ts) > 0 && sizeof...(Ts) <= size)
 		#else
 		template<class... Ts,
-		  std::enable_if_t<((sizeof...(Ts) > 0) && (sizeof...(Ts) <= size) && mstd::are_arithmetic_v<Ts...>), bool> = true>
+		  std::enable_if_t<((sizeof...(Ts) > 0) && (sizeof...(Ts) <= size) && are_all_v<is_arithmetic_like, Ts...>), bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat(const Ts&... values) {
 			_set_values(std::index_sequence_for<Ts...>(), values...);
 			_fill_values_from(sizeof...(Ts), static_cast<T>(0));
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t VN, arithmetic OT>
+		template<size_t VN, arithmetic_like OT>
 		#else
-		template<size_t VN, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t VN, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat(const vec<VN, OT>* columns, size_t size) {
 			_copy_values_from(columns, size);
 			_fill_values_from(size * R, static_cast<T>(0));
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t N, size_t VN, arithmetic OT>
+		template<size_t N, size_t VN, arithmetic_like OT>
 		#else
-		template<size_t N, size_t VN, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t N, size_t VN, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat(const vec<VN, OT> (&columns)[N]) : mat(&columns, N) {
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t VN, arithmetic... Ts>
+		template<size_t VN, arithmetic_like... Ts>
 		requires (sizeof...(Ts) > 0 && sizeof...(Ts) <= C)
 		#else
 		template<size_t VN, class... Ts, std::enable_if_t<(sizeof...(Ts) > 0 && sizeof...(Ts) <= C), bool> = true>
@@ -386,9 +406,9 @@ namespace mstd {
 			_fill_values_from(sizeof...(Ts) * R, static_cast<T>(0));
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t OC, size_t OR, arithmetic OT>
+		template<size_t OC, size_t OR, arithmetic_like OT>
 		#else
-		template<size_t OC, size_t OR, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t OC, size_t OR, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat(const mat<OC, OR, OT>& other) {
 			_copy_values_from(other);
@@ -403,9 +423,9 @@ namespace mstd {
 
 		#pragma region ASSIGN
 		#if _MSTD_HAS_CXX20
-		template<size_t ON, arithmetic OT>
+		template<size_t ON, arithmetic_like OT>
 		#else
-		template<size_t ON, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t ON, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat<C, R, T>& operator=(const OT (&values)[ON]) {
 			_copy_values_from(values);
@@ -413,9 +433,9 @@ namespace mstd {
 			return *this;
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t OC, size_t OR, arithmetic OT>
+		template<size_t OC, size_t OR, arithmetic_like OT>
 		#else
-		template<size_t OC, size_t OR, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t OC, size_t OR, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat<C, R, T>& operator=(const OT (&values)[OC][OR]) {
 			_copy_values_from(values);
@@ -423,9 +443,9 @@ namespace mstd {
 			return *this;
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t VN, arithmetic OT, size_t N>
+		template<size_t VN, arithmetic_like OT, size_t N>
 		#else
-		template<size_t VN, class OT, size_t N, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t VN, class OT, size_t N, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat<C, R, T>& operator=(const vec<VN, OT> (&columns)[N]) {
 			_copy_values_from(columns);
@@ -433,9 +453,9 @@ namespace mstd {
 			return *this;
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t OC, size_t OR, arithmetic OT>
+		template<size_t OC, size_t OR, arithmetic_like OT>
 		#else
-		template<size_t OC, size_t OR, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t OC, size_t OR, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 mat<C, R, T>& operator=(const mat<OC, OR, OT>& other) {
 			_copy_values_from(other);
@@ -443,6 +463,20 @@ namespace mstd {
 			return *this;
 		}
 
+		// evaluates a lazy expression (see expr.hpp) straight into this matrix, every element is computed in one pass
+		#if _MSTD_HAS_CXX20
+		template<class Expr>
+		requires (utils::is_expr_of_v<Expr, mat<C, R, T>>)
+		#else
+		template<class Expr, std::enable_if_t<utils::is_expr_of_v<Expr, mat<C, R, T>>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 mat<C, R, T>& operator=(const Expr& expr) {
+				for (size_t x = 0; x != C; ++x) {
+						for (size_t y = 0; y != R; ++y) { _values[x][y] = expr(x, y); }
+				}
+			return *this;
+		}
+
 		#pragma endregion // ASSIGN
 
 		#pragma region PREDEFINED
@@ -497,8 +531,8 @@ namespace mstd {
 
 		static _MSTD_CONSTEXPR20 mat<C, R, T> screen(const T& left, const T& right, const T& bottom, const T& top, const T& width,
 		  const T& height) _MSTD_REQUIRES(C == R && C == 3) {
-			const T& invBt	 = 1.0 / (bottom - top);
-			const T& invRl	 = 1.0 / (right - left);
+			const T& invBt	 = static_cast<T>(1) / (bottom - top);
+			const T& invRl	 = static_cast<T>(1) / (right - left);
 
 			mat<C, R, T> res = mat<C, R, T>::zero();
 			res[0][0]		 = width * invRl;
@@ -518,11 +552,15 @@ namespace mstd {
 		#pragma endregion // PREDEFINED_MATRIX_3x3
 
 		#pragma region PREDEFINED_MATRIX_4x4
-		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && C == 4 && std::is_same_v<Type, value_type>))
+		// the rotations take sin and cos of floating point, so they need a T converting to it implicitly. fixed does not,
+		// its results would stop being the same on every platform
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type,
+		  (C == R && C == 4 && std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
 
-		static _MSTD_CONSTEXPR20 mat<C, R, T> rot_x(const T& radians) _MSTD_REQUIRES(C == R && C == 4) {
-			T cosA			 = static_cast<T>(std::cos(radians));
-			T sinA			 = static_cast<T>(std::sin(radians));
+		static _MSTD_CONSTEXPR20 mat<C, R, T> rot_x(const T& radians)
+		  _MSTD_REQUIRES((C == R && C == 4 && std::is_convertible_v<T, double>)) {
+			T cosA			 = static_cast<T>(cos(radians));
+			T sinA			 = static_cast<T>(sin(radians));
 
 			// 4x4
 			mat<C, R, T> res = mat<C, R, T>::identity();
@@ -533,11 +571,13 @@ namespace mstd {
 			return res;
 		}
 
-		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && C == 4 && std::is_same_v<Type, value_type>))
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type,
+		  (C == R && C == 4 && std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
 
-		static _MSTD_CONSTEXPR20 mat<C, R, T> rot_y(const T& radians) _MSTD_REQUIRES(C == R && C == 4) {
-			T cosA			 = static_cast<T>(std::cos(radians));
-			T sinA			 = static_cast<T>(std::sin(radians));
+		static _MSTD_CONSTEXPR20 mat<C, R, T> rot_y(const T& radians)
+		  _MSTD_REQUIRES((C == R && C == 4 && std::is_convertible_v<T, double>)) {
+			T cosA			 = static_cast<T>(cos(radians));
+			T sinA			 = static_cast<T>(sin(radians));
 
 			// 4x4
 			mat<C, R, T> res = mat<C, R, T>::identity();
@@ -548,11 +588,13 @@ namespace mstd {
 			return res;
 		}
 
-		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && C == 4 && std::is_same_v<Type, value_type>))
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type,
+		  (C == R && C == 4 && std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
 
-		static _MSTD_CONSTEXPR20 mat<C, R, T> rot_z(const T& radians) _MSTD_REQUIRES(C == R && C == 4) {
-			T cosA			 = static_cast<T>(std::cos(radians));
-			T sinA			 = static_cast<T>(std::sin(radians));
+		static _MSTD_CONSTEXPR20 mat<C, R, T> rot_z(const T& radians)
+		  _MSTD_REQUIRES((C == R && C == 4 && std::is_convertible_v<T, double>)) {
+			T cosA			 = static_cast<T>(cos(radians));
+			T sinA			 = static_cast<T>(sin(radians));
 
 			// 4x4
 			mat<C, R, T> res = mat<C, R, T>::identity();
@@ -563,11 +605,13 @@ namespace mstd {
 			return res;
 		}
 
-		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && C == 4 && std::is_same_v<Type, value_type>))
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type,
+		  (C == R && C == 4 && std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
 
-		static _MSTD_CONSTEXPR20 mat<C, R, T> rot(const vec<R - 1, T>& axis, const T& radians) _MSTD_REQUIRES(C == R && C == 4) {
-			const T& sinA		   = static_cast<T>(std::sin(radians));
-			const T& cosA		   = static_cast<T>(std::cos(radians));
+		static _MSTD_CONSTEXPR20 mat<C, R, T> rot(const vec<R - 1, T>& axis, const T& radians)
+		  _MSTD_REQUIRES((C == R && C == 4 && std::is_convertible_v<T, double>)) {
+			const T& sinA		   = static_cast<T>(sin(radians));
+			const T& cosA		   = static_cast<T>(cos(radians));
 			const T& oneMinCosA	   = static_cast<T>(1) - cosA;
 
 			vec<R - 1, T> normAxis = axis;
@@ -575,15 +619,15 @@ namespace mstd {
 
 			mat<C, R, T> res = mat<C, R, T>::identity();
 			res[0][0]		 = (normAxis[0] * normAxis[0]) + (cosA * (1 - (normAxis[0] * normAxis[0])));
-			res[0][1]		 = ((normAxis[0] * normAxis[1]) * oneMinCosA) - (sinA * normAxis[2]);
+			res[0][1]		 = ((normAxis[0] * normAxis[1]) * oneMinCosA) + (sinA * normAxis[2]);
 			res[0][2]		 = ((normAxis[0] * normAxis[2]) * oneMinCosA) - (sinA * normAxis[1]);
 
-			res[1][0]		 = ((normAxis[0] * normAxis[1]) * oneMinCosA) + (sinA * normAxis[2]);
+			res[1][0]		 = ((normAxis[0] * normAxis[1]) * oneMinCosA) - (sinA * normAxis[2]);
 			res[1][1]		 = (normAxis[1] * normAxis[1]) + (cosA * (1 - (normAxis[1] * normAxis[1])));
-			res[1][2]		 = ((normAxis[1] * normAxis[2]) * oneMinCosA) - (sinA * normAxis[0]);
+			res[1][2]		 = ((normAxis[1] * normAxis[2]) * oneMinCosA) + (sinA * normAxis[0]);
 
-			res[2][0]		 = ((normAxis[0] * normAxis[2]) * oneMinCosA) - (sinA * normAxis[1]);
-			res[2][1]		 = ((normAxis[1] * normAxis[2]) * oneMinCosA) + (sinA * normAxis[0]);
+			res[2][0]		 = ((normAxis[0] * normAxis[2]) * oneMinCosA) + (sinA * normAxis[1]);
+			res[2][1]		 = ((normAxis[1] * normAxis[2]) * oneMinCosA) - (sinA * normAxis[0]);
 			res[2][2]		 = (normAxis[2] * normAxis[2]) + (cosA * (1 - (normAxis[2] * normAxis[2])));
 
 			return res;
@@ -592,31 +636,31 @@ namespace mstd {
 		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && C == 4 && std::is_same_v<Type, value_type>))
 
 		static _MSTD_CONSTEXPR20 mat<C, R, T> rot(const quat<T>& quaternion) _MSTD_REQUIRES(C == R && C == 4) {
-			_MSTD_CONSTEXPR17 const float two = 2.f;
-
-			const T& x2						  = quaternion.v[0] * quaternion.v[0];
-			const T& y2						  = quaternion.v[1] * quaternion.v[1];
-			const T& z2						  = quaternion.v[2] * quaternion.v[2];
-
-			const T& sx						  = quaternion.s * quaternion.v[0];
-			const T& sy						  = quaternion.s * quaternion.v[1];
-			const T& sz						  = quaternion.s * quaternion.v[2];
-			const T& xy						  = quaternion.v[0] * quaternion.v[1];
-			const T& xz						  = quaternion.v[0] * quaternion.v[2];
-			const T& yz						  = quaternion.v[1] * quaternion.v[2];
-
-			mat<C, R, T> res				  = mat<C, R, T>::identity();
-			res[0][0]						  = 1.f - (two * (y2 + z2));
-			res[1][0]						  = two * (xy - sz);
-			res[2][0]						  = two * (xz + sy);
-
-			res[0][1]						  = two * (xy + sz);
-			res[1][1]						  = 1.f - (two * (x2 + z2));
-			res[2][1]						  = two * (yz - sx);
-
-			res[0][2]						  = two * (xz - sy);
-			res[1][2]						  = two * (yz + sx);
-			res[2][2]						  = 1.f - (two * (x2 + y2));
+			const T two		 = static_cast<T>(2);
+
+			const T& x2		 = quaternion.v[0] * quaternion.v[0];
+			const T& y2		 = quaternion.v[1] * quaternion.v[1];
+			const T& z2		 = quaternion.v[2] * quaternion.v[2];
+
+			const T& sx		 = quaternion.s * quaternion.v[0];
+			const T& sy		 = quaternion.s * quaternion.v[1];
+			const T& sz		 = quaternion.s * quaternion.v[2];
+			const T& xy		 = quaternion.v[0] * quaternion.v[1];
+			const T& xz		 = quaternion.v[0] * quaternion.v[2];
+			const T& yz		 = quaternion.v[1] * quaternion.v[2];
+
+			mat<C, R, T> res = mat<C, R, T>::identity();
+			res[0][0]		 = static_cast<T>(1) - (two * (y2 + z2));
+			res[1][0]		 = two * (xy - sz);
+			res[2][0]		 = two * (xz + sy);
+
+			res[0][1]		 = two * (xy + sz);
+			res[1][1]		 = static_cast<T>(1) - (two * (x2 + z2));
+			res[2][1]		 = two * (yz - sx);
+
+			res[0][2]		 = two * (xz - sy);
+			res[1][2]		 = two * (yz + sx);
+			res[2][2]		 = static_cast<T>(1) - (two * (x2 + y2));
 			return res;
 		}
 
@@ -626,16 +670,16 @@ namespace mstd {
 		  const T& near, const T& far, const T& resLeft = static_cast<T>(-1), const T& resRight = static_cast<T>(1),
 		  const T& resBottom = static_cast<T>(-1), const T& resTop = static_cast<T>(1), const T& resNear = static_cast<T>(-1),
 		  const T& resFar = static_cast<T>(1)) _MSTD_REQUIRES(C == R && C == 4) {
-			const T& absNear = std::abs(near);
-			const T& absFar	 = std::abs(far);
+			const T& absNear = abs(near);
+			const T& absFar	 = abs(far);
 
 			const T& xDir	 = right > left ? static_cast<T>(1) : static_cast<T>(-1);
 			const T& yDir	 = top > bottom ? static_cast<T>(1) : static_cast<T>(-1);
 			const T& zDir	 = -(xDir * yDir);
 
-			const T& invRl	 = right == left ? 0.f : (1.f / (right - left));
-			const T& invTb	 = top == bottom ? 0.f : (1.f / (top - bottom));
-			const T& invFn	 = absFar == absNear ? 0.f : (1.f / (absFar - absNear));
+			const T& invRl	 = right == left ? static_cast<T>(0) : static_cast<T>(1) / (right - left);
+			const T& invTb	 = top == bottom ? static_cast<T>(0) : static_cast<T>(1) / (top - bottom);
+			const T& invFn	 = absFar == absNear ? static_cast<T>(0) : static_cast<T>(1) / (absFar - absNear);
 
 			mat<C, R, T> res;
 			res[0][0] = (resRight - resLeft) * absNear * invRl;
@@ -663,19 +707,20 @@ namespace mstd {
 		  bool rightPosX = true, bool topPosY = true, bool horizontalFov = true, const T& resRight = static_cast<T>(1),
 		  const T& resTop = static_cast<T>(1), const T& resNear = static_cast<T>(-1),
 		  const T& resFar = static_cast<T>(1)) _MSTD_REQUIRES(C == R && C == 4) {
+			// the tangent is taken in double whatever T is
 			_MSTD_CONSTEXPR17 const double half = 0.5;
 
-			const T& absNear					= std::abs(near);
-			const T& absFar						= std::abs(far);
+			const T& absNear					= abs(near);
+			const T& absFar						= abs(far);
 
 			T right;
 			T top;
 				if (horizontalFov) {
-					right = static_cast<T>(std::tan(fov * half) * absNear);
+					right = static_cast<T>(tan(static_cast<double>(fov) * half) * static_cast<double>(absNear));
 					top	  = aspect == static_cast<T>(0) ? static_cast<T>(0) : (right / aspect);
 				}
 				else {
-					top	  = static_cast<T>(std::tan(fov * half) * absNear);
+					top	  = static_cast<T>(tan(static_cast<double>(fov) * half) * static_cast<double>(absNear));
 					right = top * aspect;
 				}
 
@@ -689,16 +734,16 @@ namespace mstd {
 		  const T& near, const T& far, const T& resLeft = static_cast<T>(-1), const T& resRight = static_cast<T>(1),
 		  const T& resBottom = static_cast<T>(-1), const T& resTop = static_cast<T>(1), const T& resNear = static_cast<T>(-1),
 		  const T& resFar = static_cast<T>(1)) _MSTD_REQUIRES(C == R && C == 4) {
-			const T& absNear = std::abs(near);
-			const T& absFar	 = std::abs(far);
+			const T& absNear = abs(near);
+			const T& absFar	 = abs(far);
 
 			const T& xDir	 = right > left ? static_cast<T>(1) : static_cast<T>(-1);
 			const T& yDir	 = top > bottom ? static_cast<T>(1) : static_cast<T>(-1);
 			const T& zDir	 = -(xDir * yDir);
 
-			const T& invRl	 = right == left ? 0.0 : (1.0 / (right - left));
-			const T& invTb	 = top == bottom ? 0.0 : (1.0 / (top - bottom));
-			const T& invFn	 = absFar == absNear ? 0.0 : (1.0 / (absFar - absNear));
+			const T& invRl	 = right == left ? static_cast<T>(0) : static_cast<T>(1) / (right - left);
+			const T& invTb	 = top == bottom ? static_cast<T>(0) : static_cast<T>(1) / (top - bottom);
+			const T& invFn	 = absFar == absNear ? static_cast<T>(0) : static_cast<T>(1) / (absFar - absNear);
 
 			mat<C, R, T> res;
 			res[0][0] = (resRight - resLeft) * invRl;
@@ -783,6 +828,16 @@ namespace mstd {
 			return true;
 		}
 
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && R > 1 && std::is_same_v<Type, value_type>))
+
+		// last row is exactly (0, ..., 0, 1)
+		_MSTD_CONSTEXPR20 bool is_affine() const _MSTD_REQUIRES(C == R && R > 1) {
+				for (size_t x = 0; x != C - 1; ++x) {
+						if (_values[x][R - 1] != static_cast<T>(0)) { return false; }
+				}
+			return _values[C - 1][R - 1] == static_cast<T>(1);
+		}
+
 		#pragma endregion // PREDEFINED_SQUARE_MATRIX_CHECKS
 		#pragma endregion // PREDEFINED_CHECKS
 
@@ -895,7 +950,7 @@ namespace mstd {
 				if _MSTD_CONSTEXPR17 (R == 1) { return _values[0][0]; }
 				else if _MSTD_CONSTEXPR17 (R == 2) { return (_values[0][0] * _values[1][1]) - (_values[0][1] * _values[1][0]); }
 				else if _MSTD_CONSTEXPR17 (R == 3) {
-					T det = 0;
+					T det = T(0);
 						if (_values[0][0] != static_cast<T>(0)) {
 							det += _values[0][0] * ((_values[1][1] * _values[2][2]) - (_values[2][1] * _values[1][2]));
 						}
@@ -908,7 +963,7 @@ namespace mstd {
 					return det;
 				}
 				else if _MSTD_CONSTEXPR17 (R == 4) {
-					T det = 0;
+					T det = T(0);
 						if (_values[0][0] != static_cast<T>(0)) {
 							det += _values[0][0] *
 								   ((_values[1][1] * ((_values[2][2] * _values[3][3]) - (_values[3][2] * _values[2][3]))) +
@@ -935,26 +990,8 @@ namespace mstd {
 						}
 					return det;
 				}
-				else {
-					T det	 = 0;
-					int sign = 1;
-						for (size_t x = 0; x != C; ++x) {
-								if (_values[x][0] != static_cast<T>(0)) {
-									// get sub matrix
-									mat<C - 1, R - 1, T> subMat = get_sub_matrix(0, x);
-
-									// get sub matrixes det
-									T subDet					= subMat.determinant();
-
-									// add sub det
-									det += sign * _values[x][0] * subDet;
-								}
-
-							// change sign
-							sign *= -1;
-						}
-					return det;
-				}
+				else if _MSTD_CONSTEXPR17 (std::is_floating_point_v<T>) { return lu().determinant(); }
+				else { return _bareiss_determinant(); }
 		}
 
 		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && std::is_same_v<Type, value_type>))
@@ -967,60 +1004,135 @@ namespace mstd {
 		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && std::is_same_v<Type, value_type>))
 
 		_MSTD_CONSTEXPR20 mat<C, R, T> inverted() const _MSTD_REQUIRES(R == C) {
-			// calculate det
-			T det  = determinant();
-
-			T invD = static_cast<T>(det == static_cast<T>(0) ? 0.0 : (1.0 / det));
+				if _MSTD_CONSTEXPR17 (R > 2 && std::is_floating_point_v<T>) {
+						// affine matrices only need their linear block inverted
+						if (is_affine()) { return inverted_affine(); }
+				}
 
-				if _MSTD_CONSTEXPR17 (R == 1) { return mat<C, R, T>(invD); }
+				// cofactor expansion grows factorially, above 4x4 the pivoted LU inverse is O(N^3)
+				if _MSTD_CONSTEXPR17 (R > 4 && std::is_floating_point_v<T>) { return lu().inverse(); }
 				else {
-					mat<C, R, T> res;
-						if _MSTD_CONSTEXPR17 (R == 2) {
-							res[0][0] = _values[1][1] * invD;
-							res[1][0] = -_values[1][0] * invD;
-							res[0][1] = -_values[0][1] * invD;
-							res[1][1] = _values[0][0] * invD;
-						}
-						else if _MSTD_CONSTEXPR17 (R == 3) {
-							res[0][0] = ((_values[1][1] * _values[2][2]) - (_values[2][1] * _values[1][2])) * invD;
-							res[1][0] = ((_values[2][0] * _values[1][2]) - (_values[1][0] * _values[2][2])) * invD;
-							res[2][0] = ((_values[1][0] * _values[2][1]) - (_values[2][0] * _values[1][1])) * invD;
-							res[0][1] = ((_values[0][2] * _values[2][1]) - (_values[0][1] * _values[2][2])) * invD;
-							res[1][1] = ((_values[0][0] * _values[2][2]) - (_values[2][0] * _values[0][2])) * invD;
-							res[2][1] = ((_values[2][0] * _values[0][1]) - (_values[0][0] * _values[2][1])) * invD;
-							res[0][2] = ((_values[0][1] * _values[1][2]) - (_values[1][1] * _values[0][2])) * invD;
-							res[1][2] = ((_values[1][0] * _values[0][2]) - (_values[0][0] * _values[1][2])) * invD;
-							res[2][2] = ((_values[0][0] * _values[1][1]) - (_values[0][1] * _values[1][0])) * invD;
-						}
+					// calculate det
+					T det  = determinant();
+
+					T invD = det == static_cast<T>(0) ? static_cast<T>(0) : static_cast<T>(1) / det;
+
+						if _MSTD_CONSTEXPR17 (R == 1) { return mat<C, R, T>(invD); }
 						else {
-							// transponowana (z niej tworzymy mniejsze macierze, usuwając kolumne (x) i wiersz (y), których obliczamy det
-							// det staje się wartością elementu na pozycji (x, y) ze znakiem w zależności ((x + y) % 2 == 0) -> 1 else -1
-							// na koniec mnożymy wartość elementu na pozycji (x, y) razy invD
-							const mat<R, C, T>& trans = transposed();
-								for (size_t x = 0; x != C; ++x) {
-										for (size_t y = 0; y != R; ++y) {
-											// utworzyć mniejszą macierz
-											mat<R - 1, C - 1, T> subMat = get_sub_matrix(y, x);
-
-											// transponujemy sub_mat
-											subMat.transpose();
-
-											// obliczyć det mniejszej macierzy
-											T subDet = subMat.determinant();
-
-												// jeśli sub_det != 0
-												if (subDet != static_cast<T>(0)) {
-													// ustawiamy wartość elementu x, y
-													res[x][y] = ((x + y) % 2 == 0 ? 1 : -1) * subDet * invD;
+							mat<C, R, T> res;
+								if _MSTD_CONSTEXPR17 (R == 2) {
+									res[0][0] = _values[1][1] * invD;
+									res[1][0] = -_values[1][0] * invD;
+									res[0][1] = -_values[0][1] * invD;
+									res[1][1] = _values[0][0] * invD;
+								}
+								else if _MSTD_CONSTEXPR17 (R == 3) {
+									res[0][0] = ((_values[1][1] * _values[2][2]) - (_values[2][1] * _values[1][2])) * invD;
+									res[1][0] = ((_values[2][0] * _values[1][2]) - (_values[1][0] * _values[2][2])) * invD;
+									res[2][0] = ((_values[1][0] * _values[2][1]) - (_values[2][0] * _values[1][1])) * invD;
+									res[0][1] = ((_values[0][2] * _values[2][1]) - (_values[0][1] * _values[2][2])) * invD;
+									res[1][1] = ((_values[0][0] * _values[2][2]) - (_values[2][0] * _values[0][2])) * invD;
+									res[2][1] = ((_values[2][0] * _values[0][1]) - (_values[0][0] * _values[2][1])) * invD;
+									res[0][2] = ((_values[0][1] * _values[1][2]) - (_values[1][1] * _values[0][2])) * invD;
+									res[1][2] = ((_values[1][0] * _values[0][2]) - (_values[0][0] * _values[1][2])) * invD;
+									res[2][2] = ((_values[0][0] * _values[1][1]) - (_values[0][1] * _values[1][0])) * invD;
+								}
+								else {
+									// transponowana (z niej tworzymy mniejsze macierze, usuwając kolumne (x) i wiersz (y), których obliczamy det
+									// det staje się wartością elementu na pozycji (x, y) ze znakiem w zależności ((x + y) % 2 == 0) -> 1 else -1
+									// na koniec mnożymy wartość elementu na pozycji (x, y) razy invD
+										for (size_t x = 0; x != C; ++x) {
+												for (size_t y = 0; y != R; ++y) {
+													// utworzyć mniejszą macierz
+													mat<R - 1, C - 1, T> subMat = get_sub_matrix(y, x);
+
+													// transponujemy sub_mat
+													subMat.transpose();
+
+													// obliczyć det mniejszej macierzy
+													T subDet = subMat.determinant();
+
+														// jeśli sub_det != 0
+														if (subDet != static_cast<T>(0)) {
+															// ustawiamy wartość elementu x, y
+															res[x][y] = ((x + y) % 2 == 0 ? 1 : -1) * subDet * invD;
+														}
 												}
 										}
+									res.transpose();
 								}
-							res.transpose();
+							return res;
 						}
-					return res;
 				}
 		}
 
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && R > 2 && std::is_same_v<Type, value_type>))
+
+		// expects the last row to be (0, ..., 0, 1), returns zero matrix when the linear block is singular
+		_MSTD_CONSTEXPR20 mat<C, R, T> inverted_affine() const _MSTD_REQUIRES(C == R && R > 2) {
+			mat<C, R, T> res;
+
+			const mat<C - 1, R - 1, T> linear = mat<C - 1, R - 1, T>(*this).inverted();
+				if (linear.is_zero()) { return res; }
+
+				for (size_t x = 0; x != C - 1; ++x) {
+						for (size_t y = 0; y != R - 1; ++y) {
+							res._values[x][y]	   = linear[x][y];
+							res._values[C - 1][y] -= linear[x][y] * _values[C - 1][x];
+						}
+				}
+			res._values[C - 1][R - 1] = static_cast<T>(1);
+			return res;
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && R > 2 && std::is_same_v<Type, value_type>))
+
+		// expects an orthonormal linear block and the last row to be (0, ..., 0, 1): transposes the rotation and moves the
+		// negated translation through it
+		_MSTD_CONSTEXPR20 mat<C, R, T> inverted_rigid() const _MSTD_REQUIRES(C == R && R > 2) {
+			mat<C, R, T> res;
+				for (size_t x = 0; x != C - 1; ++x) {
+						for (size_t y = 0; y != R - 1; ++y) {
+							res._values[x][y]	   = _values[y][x];
+							res._values[C - 1][x] -= _values[x][y] * _values[C - 1][y];
+						}
+				}
+			res._values[C - 1][R - 1] = static_cast<T>(1);
+			return res;
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && R > 2 && std::is_same_v<Type, value_type>))
+
+		// uses the closed form inverse matching what is known about the matrix
+		_MSTD_CONSTEXPR20 mat<C, R, T> inverted(transform_type type) const _MSTD_REQUIRES(C == R && R > 2) {
+				if (type == transform_type::rigid) { return inverted_rigid(); }
+				if (type == transform_type::affine) { return inverted_affine(); }
+			return inverted();
+		}
+
+		// integral T would truncate the pivot divisions
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && std::is_same_v<Type, value_type> && !std::is_integral_v<Type>))
+
+		_MSTD_CONSTEXPR20 mat_lu<R, T> lu() const _MSTD_REQUIRES(R == C && !std::is_integral_v<T>) {
+			return mat_lu<R, T>(*this);
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (C == R && std::is_same_v<Type, value_type> && !std::is_integral_v<Type>))
+
+		_MSTD_CONSTEXPR20 vec<R, T> solve(const vec<R, T>& b) const _MSTD_REQUIRES(R == C && !std::is_integral_v<T>) {
+			return lu().solve(b);
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<size_t OC>
+		requires (R == C && !std::is_integral_v<T>)
+		#else
+		template<size_t OC, size_t Size = R, std::enable_if_t<(Size == C && !std::is_integral_v<T>), bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 mat<OC, R, T> solve(const mat<OC, R, T>& b) const {
+			return lu().solve(b);
+		}
+
 		#pragma endregion // SQUARE_MATRIX_OPERATIONS
 		#pragma endregion // MATRIX_OPERATIONS
 
@@ -1084,11 +1196,7 @@ namespace mstd {
 		template<size_t OC>
 		_MSTD_CONSTEXPR20 mat<OC, R, T> operator*(const mat<OC, C, T>& other) const {
 			mat<OC, R, T> res;
-				for (size_t x = 0; x != OC; ++x) {
-						for (size_t y = 0; y != R; ++y) {
-								for (size_t i = 0; i != C; ++i) { res[x][y] += _values[i][y] * other[x][i]; }
-						}
-				}
+			_kernels::mul(res._values, _values, other._values);
 			return res;
 		}
 
@@ -1120,9 +1228,7 @@ namespace mstd {
 
 		_MSTD_CONSTEXPR20 vec<R, T> operator*(const vec<C, T>& other) const {
 			vec<R, T> res;
-				for (size_t y = 0; y != R; ++y) {
-						for (size_t x = 0; x != C; ++x) { res[y] += _values[x][y] * other[x]; }
-				}
+			_kernels::mul(&res[0], _values, static_cast<const T*>(other));
 			return res;
 		}
 
@@ -1228,18 +1334,18 @@ namespace mstd {
 
 		#pragma region EXTRA_OPERATIONS
 		#if _MSTD_HAS_CXX20
-	template<size_t C, size_t R, arithmetic T>
+	template<size_t C, size_t R, arithmetic_like T>
 		#else
-	template<size_t C, size_t R, class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+	template<size_t C, size_t R, class T, std::enable_if_t<is_arithmetic_like_v<T>, bool> = true>
 		#endif
 	_MSTD_INLINE17 _MSTD_CONSTEXPR20 mat<C, R, T> clamp(const mat<C, R, T>& a, const T& minVal, const T& maxVal) {
 		return a.clampped(minVal, maxVal);
 	}
 
 		#if _MSTD_HAS_CXX20
-	template<size_t C, size_t R, arithmetic T>
+	template<size_t C, size_t R, arithmetic_like T>
 		#else
-	template<size_t C, size_t R, class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+	template<size_t C, size_t R, class T, std::enable_if_t<is_arithmetic_like_v<T>, bool> = true>
 		#endif
 	_MSTD_INLINE17 _MSTD_CONSTEXPR20 mat<C, R, T> clamp(const mat<C, R, T>& a, const mat<C, R, T>& minVal,
 	  const mat<C, R, T>& maxVal) {
@@ -1248,5 +1354,7 @@ namespace mstd {
 
 		#pragma endregion // EXTRA_OPERATIONS
 } // namespace mstd
+
+		#include <mstd/mat_lu.hpp>
 	#endif
 #endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_MAT_LU_HPP_
+	#define _MSTD_MAT_LU_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/mat.hpp>
+
+namespace mstd {
+	// PA = LU decomposition with partial (row) pivoting, L has an implicit unit diagonal and is stored together with U
+		#if _MSTD_HAS_CXX20
+	template<size_t N, arithmetic_like T>
+	requires (N > 0)
+		#else
+	template<size_t N, class T, std::enable_if_t<(N > 0 && is_arithmetic_like_v<T>), bool> >
+		#endif
+	class mat_lu {
+		static_assert(!std::is_integral_v<T>, "dividing by integral pivots would truncate, mat_lu needs a non integral T");
+
+	public:
+		static _MSTD_CONSTEXPR17 const size_t size = N;
+		using mat_type							   = mat<N, N, T>;
+		using vec_type							   = vec<N, T>;
+		using value_type						   = T;
+
+	private:
+		// column major like mat, _values[x][y] for y > x holds L, the rest holds U
+		T _values[N][N]		 = {};
+		// row y of PA is row _pivots[y] of the decomposed matrix
+		size_t _pivots[N]	 = {};
+		bool _oddPermutation = false;
+		bool _singular		 = false;
+
+		#pragma region PRIVATE_METHODS
+
+		_MSTD_CONSTEXPR20 void _decompose() {
+			_singular = !utils::lu_decompose<T>(N, [this](size_t x) { return _values[x]; }, _pivots, _oddPermutation);
+		}
+
+		// expects values already permuted by _pivots
+		_MSTD_CONSTEXPR20 void _solve_in_place(T* values) const {
+			utils::lu_solve_in_place<T>(N, [this](size_t x) { return _values[x]; }, values);
+		}
+
+		#pragma endregion // PRIVATE_METHODS
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 mat_lu() {
+				for (size_t i = 0; i != N; ++i) {
+					_values[i][i] = static_cast<T>(1);
+					_pivots[i]	  = i;
+				}
+		}
+
+		_MSTD_CONSTEXPR20 explicit mat_lu(const mat_type& matrix) {
+				for (size_t x = 0; x != N; ++x) { std::copy_n(static_cast<const T*>(matrix[x]), N, _values[x]); }
+			_decompose();
+		}
+
+		_MSTD_CONSTEXPR20 mat_lu(const mat_lu& other) = default;
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region DESTRUCTOR
+		_MSTD_CONSTEXPR20 ~mat_lu() noexcept = default;
+		#pragma endregion // DESTRUCTOR
+
+		#pragma region ASSIGN
+		_MSTD_CONSTEXPR20 mat_lu& operator=(const mat_lu& other) = default;
+		#pragma endregion // ASSIGN
+
+		#pragma region GETTERS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool is_singular() const noexcept { return _singular; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t pivot(size_t row) const noexcept { return _pivots[row]; }
+
+		_MSTD_CONSTEXPR20 mat_type lower() const {
+			mat_type res = mat_type::identity();
+				for (size_t x = 0; x != N; ++x) {
+						for (size_t y = x + 1; y != N; ++y) { res[x][y] = _values[x][y]; }
+				}
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 mat_type upper() const {
+			mat_type res;
+				for (size_t x = 0; x != N; ++x) {
+						for (size_t y = 0; y <= x; ++y) { res[x][y] = _values[x][y]; }
+				}
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 mat_type permutation() const {
+			mat_type res;
+				for (size_t y = 0; y != N; ++y) { res[_pivots[y]][y] = static_cast<T>(1); }
+			return res;
+		}
+
+		#pragma endregion // GETTERS
+
+		#pragma region OPERATIONS
+
+		_MSTD_CONSTEXPR20 T determinant() const {
+				if (_singular) { return static_cast<T>(0); }
+
+			T det = static_cast<T>(1);
+				for (size_t i = 0; i != N; ++i) { det *= _values[i][i]; }
+			return _oddPermutation ? -det : det;
+		}
+
+		// returns zero vector when the matrix is singular
+		_MSTD_CONSTEXPR20 vec_type solve(const vec_type& b) const {
+			vec_type res;
+				if (_singular) { return res; }
+
+				for (size_t y = 0; y != N; ++y) { res[y] = b[_pivots[y]]; }
+			_solve_in_place(&res[0]);
+			return res;
+		}
+
+		// solves every column of b, returns zero matrix when the matrix is singular
+		template<size_t C>
+		_MSTD_CONSTEXPR20 mat<C, N, T> solve(const mat<C, N, T>& b) const {
+			mat<C, N, T> res;
+				if (_singular) { return res; }
+
+				for (size_t x = 0; x != C; ++x) {
+						for (size_t y = 0; y != N; ++y) { res[x][y] = b[x][_pivots[y]]; }
+					_solve_in_place(static_cast<T*>(res[x]));
+				}
+			return res;
+		}
+
+		// returns zero matrix when the matrix is singular
+		_MSTD_CONSTEXPR20 mat_type inverse() const {
+			mat_type res;
+				if (_singular) { return res; }
+
+				for (size_t x = 0; x != N; ++x) {
+						for (size_t y = 0; y != N; ++y) { res[x][y] = _pivots[y] == x ? static_cast<T>(1) : static_cast<T>(0); }
+					_solve_in_place(static_cast<T*>(res[x]));
+				}
+			return res;
+		}
+
+		#pragma endregion // OPERATIONS
+	};
+} // namespace mstd
+	#endif
+#endif
@@ -0,0 +1,286 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_MAT_TRANSFORM_HPP_
+	#define _MSTD_MAT_TRANSFORM_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/half.hpp>
+		#include <mstd/mat.hpp>
+
+namespace mstd {
+	namespace utils {
+		// below this many elements per thread starting a thread costs more than it saves
+		static _MSTD_CONSTEXPR17 const size_t transform_min_chunk = 16384;
+
+		template<class T>
+		void transform(const mat<4, 4, T>& m, const transform_batch<T>& batch, size_t count, size_t threads) {
+				if (count == 0) { return; }
+
+			T values[4][4];
+				for (size_t x = 0; x != 4; ++x) { std::copy_n(static_cast<const T*>(m[x]), 4, values[x]); }
+
+			parallel_for(count, threads, transform_min_chunk,
+			  [&values, &batch](size_t first, size_t last) { apply_transform(values, batch, first, last); });
+		}
+
+		// inverse transpose of the upper 3x3 block, row and column 3 stay zero so w never leaks into the normals
+		template<class T>
+		mat<4, 4, T> normal_matrix(const mat<4, 4, T>& m) {
+			const mat<3, 3, T> normal = mat<3, 3, T>(m).inverted().transposed();
+			mat<4, 4, T> res;
+				for (size_t x = 0; x != 3; ++x) { std::copy_n(static_cast<const T*>(normal[x]), 3, static_cast<T*>(res[x])); }
+			return res;
+		}
+
+		template<size_t SN, size_t DN, class T>
+		transform_batch<T> make_transform_batch(const vec<SN, T>* src, vec<DN, T>* dst, const T& w, bool normalize) {
+			transform_batch<T> batch;
+			batch.src			= reinterpret_cast<const unsigned char*>(src);
+			batch.srcStride		= sizeof(vec<SN, T>);
+			batch.srcComponents = SN;
+			batch.dst			= reinterpret_cast<unsigned char*>(dst);
+			batch.dstStride		= sizeof(vec<DN, T>);
+			batch.dstComponents = DN;
+			batch.w				= w;
+			batch.normalize		= normalize;
+			return batch;
+		}
+
+		template<class T>
+		transform_batch<T> make_transform_batch(const T* src, size_t srcStride, T* dst, size_t dstStride, const T& w,
+		  bool normalize) {
+			transform_batch<T> batch;
+			batch.src		= reinterpret_cast<const unsigned char*>(src);
+			batch.srcStride = srcStride;
+			batch.dst		= reinterpret_cast<unsigned char*>(dst);
+			batch.dstStride = dstStride;
+			batch.w			= w;
+			batch.normalize = normalize;
+			return batch;
+		}
+
+		// elements widened to float at a time by the float16 overloads, the two buffers stay in L1
+		static _MSTD_CONSTEXPR17 const size_t float16_transform_block = 256;
+
+		// converts blocks of src to float, runs the float kernels on them and rounds the results back to dst. A whole
+		// block is read before any of it is written, so src and dst may be the same buffer
+		template<size_t SN, size_t DN, float16_format Format>
+		void transform(const mat<4, 4, float>& m, const vec<SN, float16<Format> >* src, vec<DN, float16<Format> >* dst,
+		  size_t srcComponents, float w, bool normalize, size_t count, size_t threads) {
+			static_assert(sizeof(vec<SN, float16<Format> >) == SN * sizeof(float16<Format>)
+							&& sizeof(vec<DN, float16<Format> >) == DN * sizeof(float16<Format>),
+			  "vec of float16 is expected to be packed");
+
+				if (count == 0) { return; }
+
+			float values[4][4];
+				for (size_t x = 0; x != 4; ++x) { std::copy_n(static_cast<const float*>(m[x]), 4, values[x]); }
+
+			// every thread points a copy of it at its own float buffers
+			transform_batch<float> layout;
+			layout.srcStride	 = SN * sizeof(float);
+			layout.srcComponents = srcComponents;
+			layout.dstStride	 = DN * sizeof(float);
+			layout.dstComponents = DN;
+			layout.w			 = w;
+			layout.normalize	 = normalize;
+
+			parallel_for(count, threads, transform_min_chunk, [&values, &layout, src, dst](size_t first, size_t last) {
+				float in[float16_transform_block * SN];
+				float out[float16_transform_block * DN];
+
+				transform_batch<float> batch = layout;
+				batch.src					 = reinterpret_cast<const unsigned char*>(in);
+				batch.dst					 = reinterpret_cast<unsigned char*>(out);
+					for (size_t i = first; i < last; i += float16_transform_block) {
+						const size_t size = std::min(float16_transform_block, last - i);
+						convert(reinterpret_cast<const float16<Format>*>(src + i), in, size * SN);
+						apply_transform(values, batch, 0, size);
+						convert(out, reinterpret_cast<float16<Format>*>(dst + i), size * DN);
+					}
+			});
+		}
+	} // namespace utils
+
+	// Batched mat4 transforms. src and dst may be the same buffer, threads > 1 splits large batches across that many
+	// threads (0 uses every hardware thread). The strided overloads take pointers to the x component of the first element
+	// and byte strides between elements, so positions or normals can be transformed inside interleaved vertex buffers.
+
+		#pragma region TRANSFORM_POINTS
+
+	// dst[i] = (m * vec4(src[i], 1)).xyz
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void transform_points(const mat<4, 4, T>& m, const vec<3, T>* src, vec<3, T>* dst, size_t count, size_t threads = 1) {
+		utils::transform(m, utils::make_transform_batch(src, dst, static_cast<T>(1), false), count, threads);
+	}
+
+	// dst[i] = m * src[i]
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void transform_points(const mat<4, 4, T>& m, const vec<4, T>* src, vec<4, T>* dst, size_t count, size_t threads = 1) {
+		utils::transform(m, utils::make_transform_batch(src, dst, static_cast<T>(1), false), count, threads);
+	}
+
+	// strided xyz points, w = 1
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void transform_points(const mat<4, 4, T>& m, const T* src, size_t srcStride, T* dst, size_t dstStride, size_t count,
+	  size_t threads = 1) {
+		utils::transform(m, utils::make_transform_batch(src, srcStride, dst, dstStride, static_cast<T>(1), false), count,
+		  threads);
+	}
+
+		#pragma endregion // TRANSFORM_POINTS
+
+		#pragma region TRANSFORM_VECTORS
+
+	// dst[i] = (m * vec4(src[i], 0)).xyz, translation does not apply
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void transform_vectors(const mat<4, 4, T>& m, const vec<3, T>* src, vec<3, T>* dst, size_t count, size_t threads = 1) {
+		utils::transform(m, utils::make_transform_batch(src, dst, static_cast<T>(0), false), count, threads);
+	}
+
+	// dst[i] = m * vec4(src[i].xyz, 0), the w of src is ignored
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void transform_vectors(const mat<4, 4, T>& m, const vec<4, T>* src, vec<4, T>* dst, size_t count, size_t threads = 1) {
+		utils::transform_batch<T> batch = utils::make_transform_batch(src, dst, static_cast<T>(0), false);
+		batch.srcComponents				= 3;
+		utils::transform(m, batch, count, threads);
+	}
+
+	// strided xyz vectors, w = 0
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void transform_vectors(const mat<4, 4, T>& m, const T* src, size_t srcStride, T* dst, size_t dstStride, size_t count,
+	  size_t threads = 1) {
+		utils::transform(m, utils::make_transform_batch(src, srcStride, dst, dstStride, static_cast<T>(0), false), count,
+		  threads);
+	}
+
+		#pragma endregion // TRANSFORM_VECTORS
+
+		#pragma region TRANSFORM_NORMALS
+
+	// dst[i] = normalize(inverse(transpose(mat3(m))) * src[i]), so normals stay perpendicular under non uniform scale.
+	// A singular upper 3x3 block gives zero normals
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void transform_normals(const mat<4, 4, T>& m, const vec<3, T>* src, vec<3, T>* dst, size_t count, size_t threads = 1) {
+		utils::transform(utils::normal_matrix(m), utils::make_transform_batch(src, dst, static_cast<T>(0), true), count,
+		  threads);
+	}
+
+	// same as above for xyz of src, the w of dst is set to 0
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void transform_normals(const mat<4, 4, T>& m, const vec<4, T>* src, vec<4, T>* dst, size_t count, size_t threads = 1) {
+		utils::transform_batch<T> batch = utils::make_transform_batch(src, dst, static_cast<T>(0), true);
+		batch.srcComponents				= 3;
+		utils::transform(utils::normal_matrix(m), batch, count, threads);
+	}
+
+	// strided xyz normals
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void transform_normals(const mat<4, 4, T>& m, const T* src, size_t srcStride, T* dst, size_t dstStride, size_t count,
+	  size_t threads = 1) {
+		utils::transform(utils::normal_matrix(m),
+		  utils::make_transform_batch(src, srcStride, dst, dstStride, static_cast<T>(0), true), count, threads);
+	}
+
+		#pragma endregion // TRANSFORM_NORMALS
+
+		#pragma region TRANSFORM_FLOAT16
+
+	// the same transforms for half and bfloat16 vecs: m and the math stay float, only the storage is 16 bit, which halves
+	// the memory traffic of large batches. Every result is the float result rounded once
+
+	// dst[i] = (m * vec4(src[i], 1)).xyz
+	template<float16_format Format>
+	void transform_points(const mat<4, 4, float>& m, const vec<3, float16<Format> >* src, vec<3, float16<Format> >* dst,
+	  size_t count, size_t threads = 1) {
+		utils::transform(m, src, dst, 3, 1.f, false, count, threads);
+	}
+
+	// dst[i] = m * src[i]
+	template<float16_format Format>
+	void transform_points(const mat<4, 4, float>& m, const vec<4, float16<Format> >* src, vec<4, float16<Format> >* dst,
+	  size_t count, size_t threads = 1) {
+		utils::transform(m, src, dst, 4, 1.f, false, count, threads);
+	}
+
+	// dst[i] = (m * vec4(src[i], 0)).xyz
+	template<float16_format Format>
+	void transform_vectors(const mat<4, 4, float>& m, const vec<3, float16<Format> >* src, vec<3, float16<Format> >* dst,
+	  size_t count, size_t threads = 1) {
+		utils::transform(m, src, dst, 3, 0.f, false, count, threads);
+	}
+
+	// dst[i] = m * vec4(src[i].xyz, 0)
+	template<float16_format Format>
+	void transform_vectors(const mat<4, 4, float>& m, const vec<4, float16<Format> >* src, vec<4, float16<Format> >* dst,
+	  size_t count, size_t threads = 1) {
+		utils::transform(m, src, dst, 3, 0.f, false, count, threads);
+	}
+
+	// dst[i] = normalize(inverse(transpose(mat3(m))) * src[i])
+	template<float16_format Format>
+	void transform_normals(const mat<4, 4, float>& m, const vec<3, float16<Format> >* src, vec<3, float16<Format> >* dst,
+	  size_t count, size_t threads = 1) {
+		utils::transform(utils::normal_matrix(m), src, dst, 3, 0.f, true, count, threads);
+	}
+
+	// same as above for xyz of src, the w of dst is set to 0
+	template<float16_format Format>
+	void transform_normals(const mat<4, 4, float>& m, const vec<4, float16<Format> >* src, vec<4, float16<Format> >* dst,
+	  size_t count, size_t threads = 1) {
+		utils::transform(utils::normal_matrix(m), src, dst, 3, 0.f, true, count, threads);
+	}
+
+		#pragma endregion // TRANSFORM_FLOAT16
+} // namespace mstd
+	#endif
+#endif
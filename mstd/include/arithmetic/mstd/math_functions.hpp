@@ -125,6 +125,7 @@ namespace mstd {
 			else { return 0; }
 	}
 
+	// the Quake III approximation, 1.8e-3 relative error. rsqrt from simd_math.hpp is both faster and within 1.5 ulp
 	_MSTD_INLINE17 _MSTD_CONSTEXPR20 float q_rsqrt(float number) noexcept {
 		_MSTD_CONSTEXPR17 const uint32_t magi_number = 0x5F37'59DF;
 		_MSTD_CONSTEXPR17 const float one_half		 = 1.5f;
@@ -137,6 +138,194 @@ namespace mstd {
 		#endif
 		return y * (one_half - (number * half * y * y));
 	}
+
+		#pragma region CONSTEXPR_MATH
+
+	namespace utils {
+		// result type of the <cmath> functions, integers are promoted to double
+		template<class T>
+		using math_result_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+		// pi / 2 split into parts with 33 significant bits, k * pio2_1 and k * pio2_2 are exact for |k| < 2^20
+		static _MSTD_CONSTEXPR17 const double pio2_1	 = 1.57079632673412561417e+00;
+		static _MSTD_CONSTEXPR17 const double pio2_2	 = 6.07710050630396597660e-11;
+		static _MSTD_CONSTEXPR17 const double pio2_3	 = 2.02226624871116645580e-21;
+		static _MSTD_CONSTEXPR17 const double pio2_3t	 = 8.47842766036889956997e-32;
+		static _MSTD_CONSTEXPR17 const double two_over_pi = 6.36619772367581382433e-01;
+
+		_MSTD_CONSTEXPR17 double constexpr_trunc(double x) noexcept {
+			// every double past 2^52 is already an integer
+				if (!(x < 0x1p52 && x > -0x1p52)) { return x; }
+			return static_cast<double>(static_cast<int64_t>(x));
+		}
+
+		_MSTD_CONSTEXPR17 double constexpr_round(double x) noexcept {
+			const double t = constexpr_trunc(x);
+				if (x - t >= 0.5) { return t + 1.0; }
+				if (x - t <= -0.5) { return t - 1.0; }
+			return t;
+		}
+
+		// Newton iterations on x scaled by powers of 4 into [0.25, 4], within 1 ulp of the correctly rounded result
+		_MSTD_CONSTEXPR17 double constexpr_sqrt(double x) noexcept {
+				if (x == 0.0 || !(x <= std::numeric_limits<double>::max())) {
+					return x < 0.0 ? std::numeric_limits<double>::quiet_NaN() : x;
+				}
+				if (x < 0.0) { return std::numeric_limits<double>::quiet_NaN(); }
+
+			double scale = 1.0;
+				while (x > 0x1p64) {
+					x	  *= 0x1p-64;
+					scale *= 0x1p32;
+				}
+				while (x < 0x1p-64) {
+					x	  *= 0x1p64;
+					scale *= 0x1p-32;
+				}
+				while (x > 4.0) {
+					x	  *= 0.25;
+					scale *= 2.0;
+				}
+				while (x < 0.25) {
+					x	  *= 4.0;
+					scale *= 0.5;
+				}
+
+			double y = 0.5 * (1.0 + x);
+				for (size_t i = 0; i != 8; ++i) { y = 0.5 * (y + x / y); }
+			return y * scale;
+		}
+
+		// minimax polynomials for |r| <= pi / 4 (fdlibm __kernel_sin / __kernel_cos)
+		_MSTD_CONSTEXPR17 double constexpr_sin_kernel(double r) noexcept {
+			const double z = r * r;
+			return r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 +
+			  z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08 +
+			  z * 1.58969099521155010221e-10)))));
+		}
+
+		_MSTD_CONSTEXPR17 double constexpr_cos_kernel(double r) noexcept {
+			const double z = r * r;
+			return 1.0 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 +
+			  z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 +
+			  z * -1.13596475577881948265e-11)))));
+		}
+
+		// x = k * pi / 2 + r with |r| <= pi / 4, returns k mod 4. The reduction is exact for |x| < 2^20 * pi / 2, past
+		// that the error grows with |x|
+		_MSTD_CONSTEXPR17 int reduce_half_pi(double x, double& r) noexcept {
+			const double k = constexpr_round(x * two_over_pi);
+			r			   = x - k * pio2_1;
+			r			  -= k * pio2_2;
+			r			  -= k * pio2_3;
+			r			  -= k * pio2_3t;
+			return static_cast<int>(k - 4.0 * constexpr_trunc(k * 0.25)) & 3;
+		}
+
+		_MSTD_CONSTEXPR17 double constexpr_sin(double x) noexcept {
+				if (!(x - x == 0.0)) { return x - x; }
+				// below 2^-27 sin(x) rounds to x, returning x also keeps the sign of -0
+				if (x < 0x1p-27 && x > -0x1p-27) { return x; }
+			double r			= 0.0;
+			const int quadrant	= reduce_half_pi(x, r);
+				switch (quadrant) {
+					case 0: return constexpr_sin_kernel(r);
+					case 1: return constexpr_cos_kernel(r);
+					case 2: return -constexpr_sin_kernel(r);
+					default: return -constexpr_cos_kernel(r);
+				}
+		}
+
+		_MSTD_CONSTEXPR17 double constexpr_cos(double x) noexcept {
+				if (!(x - x == 0.0)) { return x - x; }
+			double r			= 0.0;
+			const int quadrant	= reduce_half_pi(x, r);
+				switch (quadrant) {
+					case 0: return constexpr_cos_kernel(r);
+					case 1: return -constexpr_sin_kernel(r);
+					case 2: return -constexpr_cos_kernel(r);
+					default: return constexpr_sin_kernel(r);
+				}
+		}
+
+		_MSTD_CONSTEXPR17 double constexpr_tan(double x) noexcept {
+				if (!(x - x == 0.0)) { return x - x; }
+				// below 2^-27 tan(x) rounds to x as well
+				if (x < 0x1p-27 && x > -0x1p-27) { return x; }
+			double r		  = 0.0;
+			const int quadrant = reduce_half_pi(x, r);
+			const double sinR = constexpr_sin_kernel(r);
+			const double cosR = constexpr_cos_kernel(r);
+			return (quadrant & 1) == 0 ? sinR / cosR : -cosR / sinR;
+		}
+	} // namespace utils
+
+	// sqrt, sin, cos, tan and abs from <cmath> that also work in constant expressions. At runtime they call std::, when
+	// constant evaluated they use the utils::constexpr_ versions above. Those compute in double precision and stay within
+	// 1 ulp (sqrt), 2 ulp (sin, cos) and 3 ulp (tan) of the double result, floats are rounded from it
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 utils::math_result_t<T> sqrt(const T& x) noexcept {
+			if (_MSTD_IS_CONSTANT_EVALUATED()) {
+				return static_cast<utils::math_result_t<T>>(utils::constexpr_sqrt(static_cast<double>(x)));
+			}
+		return std::sqrt(x);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 utils::math_result_t<T> sin(const T& x) noexcept {
+			if (_MSTD_IS_CONSTANT_EVALUATED()) {
+				return static_cast<utils::math_result_t<T>>(utils::constexpr_sin(static_cast<double>(x)));
+			}
+		return std::sin(x);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 utils::math_result_t<T> cos(const T& x) noexcept {
+			if (_MSTD_IS_CONSTANT_EVALUATED()) {
+				return static_cast<utils::math_result_t<T>>(utils::constexpr_cos(static_cast<double>(x)));
+			}
+		return std::cos(x);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 utils::math_result_t<T> tan(const T& x) noexcept {
+			if (_MSTD_IS_CONSTANT_EVALUATED()) {
+				return static_cast<utils::math_result_t<T>>(utils::constexpr_tan(static_cast<double>(x)));
+			}
+		return std::tan(x);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T abs(const T& x) noexcept {
+			if _MSTD_CONSTEXPR17 (std::is_unsigned_v<T>) { return x; }
+			else {
+					if (_MSTD_IS_CONSTANT_EVALUATED()) { return x < static_cast<T>(0) ? -x : x + static_cast<T>(0); }
+				return std::abs(x);
+			}
+	}
+
+		#pragma endregion // CONSTEXPR_MATH
 } // namespace mstd
 	#endif
 #endif
\ No newline at end of file
@@ -21,25 +21,147 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/types.hpp>
 
 namespace mstd {
+	namespace utils {
+		#pragma region OVERFLOW_FALLBACKS
+
+		// integers the __builtin_*_overflow functions accept, bool and floating point go through the fallbacks
+		template<class... Ts>
+		static _MSTD_CONSTEXPR17 const bool are_overflow_integers_v =
+		  ((std::is_integral_v<Ts> && !std::is_same_v<std::remove_cv_t<Ts>, bool>) && ...);
+
+		#if _MSTD_HAS_CXX20
+		template<arithmetic N, arithmetic Na, arithmetic Nb>
+		#else
+		template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
+		#endif
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool add_overflow_fallback(const Na& a, const Nb& b, N& out) {
+			using limits = std::numeric_limits<N>;
+
+				if _MSTD_CONSTEXPR17 (are_unsigned_v<N, Na, Nb>) {
+						if (a > limits::max() - b) { return true; }
+				}
+				else {
+						if (b >= 0 && a > limits::max() - b) { return true; }
+
+						if (b <= 0 && a < limits::lowest() - b) { return true; }
+				}
+
+			out = static_cast<N>(a + b);
+			return false;
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<arithmetic N, arithmetic Na, arithmetic Nb>
+		#else
+		template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
+		#endif
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool sub_overflow_fallback(const Na& a, const Nb& b, N& out) {
+			using limits = std::numeric_limits<N>;
+
+				if _MSTD_CONSTEXPR17 (are_unsigned_v<N, Na, Nb>) {
+						if (a < limits::lowest() + b) { return true; }
+				}
+				else {
+						if (b <= 0 && a > limits::max() + b) { return true; }
+
+						if (b >= 0 && a < limits::lowest() + b) { return true; }
+				}
+
+			out = static_cast<N>(a - b);
+			return false;
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<arithmetic N, arithmetic Na, arithmetic Nb>
+		#else
+		template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
+		#endif
+		_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool mul_overflow_fallback(const Na& a, const Nb& b, N& out) {
+			using limits = std::numeric_limits<N>;
+
+				if _MSTD_CONSTEXPR17 (are_unsigned_v<N, Na, Nb>) {
+						if (a != 0 && b != 0 && a > limits::max() / b) { return true; }
+				}
+				else {
+						// the bound to compare against depends on the signs of both operands
+						if (a > 0) {
+								if (b > 0 && a > limits::max() / b) { return true; }
+
+								if (b < 0 && b < limits::lowest() / a) { return true; }
+						}
+						else if (a < 0) {
+								if (b > 0 && a < limits::lowest() / b) { return true; }
+
+								if (b < 0 && b < limits::max() / a) { return true; }
+						}
+				}
+
+			out = static_cast<N>(a * b);
+			return false;
+		}
+
+		#pragma endregion // OVERFLOW_FALLBACKS
+	} // namespace utils
+
+	// The integer versions lower to __builtin_*_overflow (a flag check after the plain instruction) on GCC and clang,
+	// which also works in constant evaluation. Floating point operands and other compilers use the fallbacks.
+	// out is only written when there was no overflow.
+
 		#if _MSTD_HAS_CXX20
 	template<arithmetic N, arithmetic Na, arithmetic Nb>
 		#else
 	template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
 		#endif
 	_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool add_overflow(const Na& a, const Nb& b, N& out) {
-		using limits = std::numeric_limits<N>;
-
-			if _MSTD_CONSTEXPR17 (are_unsigned_v<N, Na, Nb>) {
-					if (a > limits::max() - b) { return true; }
+		#if defined(__GNUC__) || defined(__clang__)
+			if _MSTD_CONSTEXPR17 (utils::are_overflow_integers_v<N, Na, Nb>) {
+				N res = 0;
+					if (__builtin_add_overflow(a, b, &res)) { return true; }
+				out = res;
+				return false;
 			}
-			else {
-					if (b >= 0 && a > limits::max() - b) { return true; }
+			else { return utils::add_overflow_fallback(a, b, out); }
+		#else
+		return utils::add_overflow_fallback(a, b, out);
+		#endif
+	}
 
-					if (b <= 0 && a < limits::min() - b) { return true; }
+		#if _MSTD_HAS_CXX20
+	template<arithmetic N, arithmetic Na, arithmetic Nb>
+		#else
+	template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool sub_overflow(const Na& a, const Nb& b, N& out) {
+		#if defined(__GNUC__) || defined(__clang__)
+			if _MSTD_CONSTEXPR17 (utils::are_overflow_integers_v<N, Na, Nb>) {
+				N res = 0;
+					if (__builtin_sub_overflow(a, b, &res)) { return true; }
+				out = res;
+				return false;
 			}
+			else { return utils::sub_overflow_fallback(a, b, out); }
+		#else
+		return utils::sub_overflow_fallback(a, b, out);
+		#endif
+	}
 
-		out = static_cast<N>(a + b);
-		return false;
+		#if _MSTD_HAS_CXX20
+	template<arithmetic N, arithmetic Na, arithmetic Nb>
+		#else
+	template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool mul_overflow(const Na& a, const Nb& b, N& out) {
+		#if defined(__GNUC__) || defined(__clang__)
+			if _MSTD_CONSTEXPR17 (utils::are_overflow_integers_v<N, Na, Nb>) {
+				N res = 0;
+					if (__builtin_mul_overflow(a, b, &res)) { return true; }
+				out = res;
+				return false;
+			}
+			else { return utils::mul_overflow_fallback(a, b, out); }
+		#else
+		return utils::mul_overflow_fallback(a, b, out);
+		#endif
 	}
 
 		#if _MSTD_HAS_CXX20
@@ -47,66 +169,408 @@ namespace mstd {
 		#else
 	template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
 		#endif
-	_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool sub_overflow(const Na& a, const Nb& b, N& out) {
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool div_overflow(const Na& a, const Nb& b, N& out) {
 		using limits = std::numeric_limits<N>;
 
-			if _MSTD_CONSTEXPR17 (are_unsigned_v<N, Na, Nb>) {
-					if (a < limits::min() + b) { return true; }
-			}
+			if _MSTD_CONSTEXPR17 (are_unsigned_v<N, Na, Nb>) { out = static_cast<N>(b == 0 ? limits::max() : a / b); }
 			else {
-					if (b <= 0 && a > limits::max() + b) { return true; }
+					if (a == limits::min() && b == -1) { return true; }
 
-					if (b >= 0 && a < limits::min() + b) { return true; }
+				N badValue = a < 0 ? limits::min() : limits::max();
+				out		   = static_cast<N>(b == 0 ? badValue : a / b);
 			}
-
-		out = static_cast<N>(a - b);
 		return false;
 	}
 
+		#pragma region SATURATING
+
+	// Results clamped to the range of T instead of wrapping. add and sub are branchless on the unsigned bit patterns so
+	// loops over them vectorize.
+
 		#if _MSTD_HAS_CXX20
-	template<arithmetic N, arithmetic Na, arithmetic Nb>
+	template<class T>
+	requires (utils::are_overflow_integers_v<T>)
 		#else
-	template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
+	template<class T, std::enable_if_t<utils::are_overflow_integers_v<T>, bool> = true>
 		#endif
-	_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool mul_overflow(const Na& a, const Nb& b, N& out) {
-		using limits = std::numeric_limits<N>;
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T saturating_add(T a, T b) noexcept {
+		using UT = std::make_unsigned_t<T>;
 
-			if _MSTD_CONSTEXPR17 (are_unsigned_v<N, Na, Nb>) {
-					if (a != 0 && b != 0 && a > limits::max() / b) { return true; }
+		const UT res = static_cast<UT>(static_cast<UT>(a) + static_cast<UT>(b));
+			if _MSTD_CONSTEXPR17 (std::is_unsigned_v<T>) { return res < a ? std::numeric_limits<T>::max() : res; }
+			else {
+				_MSTD_CONSTEXPR17 const int sign_shift = std::numeric_limits<UT>::digits - 1;
+
+				// max when a is positive, min (max + 1) when negative
+				const UT saturated = static_cast<UT>((static_cast<UT>(a) >> sign_shift) + std::numeric_limits<T>::max());
+				const UT overflow  = static_cast<UT>(~(static_cast<UT>(a) ^ static_cast<UT>(b)) & (static_cast<UT>(a) ^ res));
+				return static_cast<T>((overflow >> sign_shift) != 0 ? saturated : res);
 			}
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::are_overflow_integers_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::are_overflow_integers_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T saturating_sub(T a, T b) noexcept {
+		using UT = std::make_unsigned_t<T>;
+
+		const UT res = static_cast<UT>(static_cast<UT>(a) - static_cast<UT>(b));
+			if _MSTD_CONSTEXPR17 (std::is_unsigned_v<T>) { return res > a ? T(0) : res; }
 			else {
-					if (a != 0 && b != 0) {
-							if (a == -1 && b == static_cast<Nb>(limits::min())) { return true; }
+				_MSTD_CONSTEXPR17 const int sign_shift = std::numeric_limits<UT>::digits - 1;
 
-							if (a == limits::min() && b == static_cast<Nb>(-1)) { return true; }
+				const UT saturated = static_cast<UT>((static_cast<UT>(a) >> sign_shift) + std::numeric_limits<T>::max());
+				const UT overflow  = static_cast<UT>((static_cast<UT>(a) ^ static_cast<UT>(b)) & (static_cast<UT>(a) ^ res));
+				return static_cast<T>((overflow >> sign_shift) != 0 ? saturated : res);
+			}
+	}
 
-							if (a > static_cast<Na>(limits::max() / b)) { return true; }
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::are_overflow_integers_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::are_overflow_integers_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T saturating_mul(T a, T b) noexcept {
+		using limits = std::numeric_limits<T>;
 
-							if (a < static_cast<Na>(limits::min() / b)) { return true; }
-					}
+		T res		 = 0;
+			if (!mul_overflow(a, b, res)) { return res; }
+
+			if _MSTD_CONSTEXPR17 (std::is_unsigned_v<T>) { return limits::max(); }
+			else { return (a < 0) != (b < 0) ? limits::min() : limits::max(); }
+	}
+
+		#pragma endregion // SATURATING
+
+	namespace utils {
+		#pragma region SATURATING_KERNELS
+
+		// Hardware saturating adds exist for 8 and 16 bit lanes on x86 and for every width on NEON, the rest is left
+		// to the vectorizer. Returns the number of processed elements.
+		template<class T, bool Sub>
+		_MSTD_INLINE17 size_t saturating_kernel(const T* a, const T* b, T* dst, size_t count) noexcept {
+			size_t i = 0;
+		#if _MSTD_HAS_SSE2
+				if _MSTD_CONSTEXPR17 (sizeof(T) <= 2) {
+		#endif
+		#if _MSTD_HAS_AVX2
+							for (; i + 32 / sizeof(T) <= count; i += 32 / sizeof(T)) {
+								const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+								const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+								__m256i res;
+									if _MSTD_CONSTEXPR17 (sizeof(T) == 1 && std::is_signed_v<T>) {
+										res = Sub ? _mm256_subs_epi8(va, vb) : _mm256_adds_epi8(va, vb);
+									}
+									else if _MSTD_CONSTEXPR17 (sizeof(T) == 1) {
+										res = Sub ? _mm256_subs_epu8(va, vb) : _mm256_adds_epu8(va, vb);
+									}
+									else if _MSTD_CONSTEXPR17 (std::is_signed_v<T>) {
+										res = Sub ? _mm256_subs_epi16(va, vb) : _mm256_adds_epi16(va, vb);
+									}
+									else { res = Sub ? _mm256_subs_epu16(va, vb) : _mm256_adds_epu16(va, vb); }
+								_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), res);
+							}
+		#endif
+		#if _MSTD_HAS_SSE2
+						for (; i + 16 / sizeof(T) <= count; i += 16 / sizeof(T)) {
+							const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+							const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+							__m128i res;
+								if _MSTD_CONSTEXPR17 (sizeof(T) == 1 && std::is_signed_v<T>) {
+									res = Sub ? _mm_subs_epi8(va, vb) : _mm_adds_epi8(va, vb);
+								}
+								else if _MSTD_CONSTEXPR17 (sizeof(T) == 1) {
+									res = Sub ? _mm_subs_epu8(va, vb) : _mm_adds_epu8(va, vb);
+								}
+								else if _MSTD_CONSTEXPR17 (std::is_signed_v<T>) {
+									res = Sub ? _mm_subs_epi16(va, vb) : _mm_adds_epi16(va, vb);
+								}
+								else { res = Sub ? _mm_subs_epu16(va, vb) : _mm_adds_epu16(va, vb); }
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), res);
+						}
+				}
+		#elif _MSTD_HAS_NEON
+				if _MSTD_CONSTEXPR17 (sizeof(T) <= 8) {
+						for (; i + 16 / sizeof(T) <= count; i += 16 / sizeof(T)) {
+							const uint8x16_t va = vld1q_u8(reinterpret_cast<const uint8_t*>(a + i));
+							const uint8x16_t vb = vld1q_u8(reinterpret_cast<const uint8_t*>(b + i));
+							uint8x16_t res;
+								if _MSTD_CONSTEXPR17 (sizeof(T) == 1 && std::is_signed_v<T>) {
+									res = vreinterpretq_u8_s8(Sub ? vqsubq_s8(vreinterpretq_s8_u8(va), vreinterpretq_s8_u8(vb))
+																  : vqaddq_s8(vreinterpretq_s8_u8(va), vreinterpretq_s8_u8(vb)));
+								}
+								else if _MSTD_CONSTEXPR17 (sizeof(T) == 1) {
+									res = Sub ? vqsubq_u8(va, vb) : vqaddq_u8(va, vb);
+								}
+								else if _MSTD_CONSTEXPR17 (sizeof(T) == 2 && std::is_signed_v<T>) {
+									const int16x8_t sa = vreinterpretq_s16_u8(va);
+									const int16x8_t sb = vreinterpretq_s16_u8(vb);
+									res = vreinterpretq_u8_s16(Sub ? vqsubq_s16(sa, sb) : vqaddq_s16(sa, sb));
+								}
+								else if _MSTD_CONSTEXPR17 (sizeof(T) == 2) {
+									const uint16x8_t ua = vreinterpretq_u16_u8(va);
+									const uint16x8_t ub = vreinterpretq_u16_u8(vb);
+									res = vreinterpretq_u8_u16(Sub ? vqsubq_u16(ua, ub) : vqaddq_u16(ua, ub));
+								}
+								else if _MSTD_CONSTEXPR17 (sizeof(T) == 4 && std::is_signed_v<T>) {
+									const int32x4_t sa = vreinterpretq_s32_u8(va);
+									const int32x4_t sb = vreinterpretq_s32_u8(vb);
+									res = vreinterpretq_u8_s32(Sub ? vqsubq_s32(sa, sb) : vqaddq_s32(sa, sb));
+								}
+								else if _MSTD_CONSTEXPR17 (sizeof(T) == 4) {
+									const uint32x4_t ua = vreinterpretq_u32_u8(va);
+									const uint32x4_t ub = vreinterpretq_u32_u8(vb);
+									res = vreinterpretq_u8_u32(Sub ? vqsubq_u32(ua, ub) : vqaddq_u32(ua, ub));
+								}
+								else if _MSTD_CONSTEXPR17 (std::is_signed_v<T>) {
+									const int64x2_t sa = vreinterpretq_s64_u8(va);
+									const int64x2_t sb = vreinterpretq_s64_u8(vb);
+									res = vreinterpretq_u8_s64(Sub ? vqsubq_s64(sa, sb) : vqaddq_s64(sa, sb));
+								}
+								else {
+									const uint64x2_t ua = vreinterpretq_u64_u8(va);
+									const uint64x2_t ub = vreinterpretq_u64_u8(vb);
+									res = vreinterpretq_u8_u64(Sub ? vqsubq_u64(ua, ub) : vqaddq_u64(ua, ub));
+								}
+							vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), res);
+						}
+				}
+		#else
+			(void)a;
+			(void)b;
+			(void)dst;
+			(void)count;
+		#endif
+			return i;
+		}
+
+		#pragma endregion // SATURATING_KERNELS
+	} // namespace utils
+
+		#pragma region SATURATING_BULK
+
+	// dst[i] = saturating_add(a[i], b[i]), dst may be a or b
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::are_overflow_integers_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::are_overflow_integers_v<T>, bool> = true>
+		#endif
+	void saturating_add(const T* a, const T* b, T* dst, size_t count) noexcept {
+			for (size_t i = utils::saturating_kernel<T, false>(a, b, dst, count); i != count; ++i) {
+				dst[i] = saturating_add(a[i], b[i]);
 			}
+	}
 
-		out = static_cast<N>(a * b);
-		return false;
+	// dst[i] = saturating_sub(a[i], b[i]), dst may be a or b
+		#if _MSTD_HAS_CXX20
+	template<class T>
+	requires (utils::are_overflow_integers_v<T>)
+		#else
+	template<class T, std::enable_if_t<utils::are_overflow_integers_v<T>, bool> = true>
+		#endif
+	void saturating_sub(const T* a, const T* b, T* dst, size_t count) noexcept {
+			for (size_t i = utils::saturating_kernel<T, true>(a, b, dst, count); i != count; ++i) {
+				dst[i] = saturating_sub(a[i], b[i]);
+			}
 	}
 
+	// dst[i] = saturating_mul(a[i], b[i]), dst may be a or b
 		#if _MSTD_HAS_CXX20
-	template<arithmetic N, arithmetic Na, arithmetic Nb>
+	template<class T>
+	requires (utils::are_overflow_integers_v<T>)
 		#else
-	template<class N, class Na, class Nb, std::enable_if_t<are_arithmetic_v<N, Na, Nb>, bool> = true>
+	template<class T, std::enable_if_t<utils::are_overflow_integers_v<T>, bool> = true>
 		#endif
-	_MSTD_INLINE17 _MSTD_CONSTEXPR20 bool div_overflow(const Na& a, const Nb& b, N& out) {
-		using limits = std::numeric_limits<N>;
+	void saturating_mul(const T* a, const T* b, T* dst, size_t count) noexcept {
+			for (size_t i = 0; i != count; ++i) { dst[i] = saturating_mul(a[i], b[i]); }
+	}
 
-			if _MSTD_CONSTEXPR17 (are_unsigned_v<N, Na, Nb>) { out = static_cast<N>(b == 0 ? limits::max() : a / b); }
-			else {
-					if (a == limits::min() && b == -1) { return true; }
+		#pragma endregion // SATURATING_BULK
 
-				N badValue = a < 0 ? limits::min() : limits::max();
-				out		   = static_cast<N>(b == 0 ? badValue : a / b);
+	namespace utils {
+		#pragma region CHECKED_ACCUMULATION
+
+		// Exact 128 bit two's complement accumulator. Every term is at most 64 bits wide so the only overflow left to
+		// check is the one of the final value into the result type.
+		struct wide_sum {
+			uint64_t lo = 0;
+			uint64_t hi = 0;
+
+			template<class W>
+			_MSTD_CONSTEXPR20 void add(W value) noexcept {
+				const uint64_t bits = static_cast<uint64_t>(value);
+				lo += bits;
+				hi += static_cast<uint64_t>(lo < bits);
+					if _MSTD_CONSTEXPR17 (std::is_signed_v<W>) { hi -= static_cast<uint64_t>(value < 0); }
 			}
-		return false;
+
+			_MSTD_CONSTEXPR20 void add(const wide_sum& other) noexcept {
+				lo += other.lo;
+				hi += other.hi + static_cast<uint64_t>(lo < other.lo);
+			}
+
+			// true when the value does not fit R
+			template<class R>
+			_MSTD_CONSTEXPR20 bool to(R& out) const noexcept {
+					if _MSTD_CONSTEXPR17 (std::is_signed_v<R>) {
+						const auto value = static_cast<int64_t>(lo);
+							if (hi != (value < 0 ? ~uint64_t(0) : uint64_t(0))) { return true; }
+
+							if (value < static_cast<int64_t>(std::numeric_limits<R>::min())
+								|| value > static_cast<int64_t>(std::numeric_limits<R>::max())) {
+								return true;
+							}
+					}
+					else if (hi != 0 || lo > static_cast<uint64_t>(std::numeric_limits<R>::max())) { return true; }
+				out = static_cast<R>(lo);
+				return false;
+			}
+		};
+
+		// 64 bit lanes of the accumulator, the carry out of lo is a compare of the sign flipped values
+		#if _MSTD_HAS_AVX2
+		template<bool Signed>
+		_MSTD_INLINE17 void avx2_wide_add(__m256i& lo, __m256i& hi, __m256i value) noexcept {
+			const __m256i signBit = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+			lo					  = _mm256_add_epi64(lo, value);
+			// lo < value as unsigned gives -1
+			const __m256i carry	  = _mm256_cmpgt_epi64(_mm256_xor_si256(value, signBit), _mm256_xor_si256(lo, signBit));
+			hi					  = _mm256_sub_epi64(hi, carry);
+				if _MSTD_CONSTEXPR17 (Signed) { hi = _mm256_add_epi64(hi, _mm256_cmpgt_epi64(_mm256_setzero_si256(), value)); }
+		}
+
+		inline wide_sum avx2_wide_reduce(__m256i lo, __m256i hi) noexcept {
+			alignas(32) uint64_t los[4];
+			alignas(32) uint64_t his[4];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(los), lo);
+			_mm256_store_si256(reinterpret_cast<__m256i*>(his), hi);
+			wide_sum res;
+				for (size_t i = 0; i != 4; ++i) { res.add(wide_sum { los[i], his[i] }); }
+			return res;
+		}
+		#endif
+
+		// at most 64 bits so every term fits the accumulator
+		template<class... Ts>
+		static _MSTD_CONSTEXPR17 const bool are_checked_integers_v =
+		  are_overflow_integers_v<Ts...> && ((sizeof(Ts) <= 8) && ...);
+
+		template<class T>
+		using wide_term_t = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+
+		// terms of up to 32 bits never overflow 64 bits in a block this long
+		static _MSTD_CONSTEXPR17 const size_t checked_block = size_t(1) << 30;
+
+		template<class T>
+		_MSTD_INLINE17 wide_sum checked_sum(const T* data, size_t count) noexcept {
+			using W = wide_term_t<T>;
+
+			wide_sum res;
+			size_t i = 0;
+				if _MSTD_CONSTEXPR17 (sizeof(T) <= 4) {
+					// plain widening adds, vectorized by the compiler
+						while (i != count) {
+							const size_t end = i + std::min(count - i, checked_block);
+							W blockSum		 = 0;
+								for (; i != end; ++i) { blockSum += static_cast<W>(data[i]); }
+							res.add(blockSum);
+						}
+				}
+				else {
+		#if _MSTD_HAS_AVX2
+					__m256i lo = _mm256_setzero_si256();
+					__m256i hi = _mm256_setzero_si256();
+						for (; i + 4 <= count; i += 4) {
+							avx2_wide_add<std::is_signed_v<T>>(lo, hi,
+							  _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+						}
+					res = avx2_wide_reduce(lo, hi);
+		#endif
+						for (; i != count; ++i) { res.add(static_cast<W>(data[i])); }
+				}
+			return res;
+		}
+
+		// false when a single 64 bit product already overflows
+		template<class T>
+		_MSTD_INLINE17 bool checked_dot(const T* a, const T* b, size_t count, wide_sum& res) noexcept {
+			using W	 = wide_term_t<T>;
+
+			size_t i = 0;
+				if _MSTD_CONSTEXPR17 (sizeof(T) <= 2) {
+						while (i != count) {
+							const size_t end = i + std::min(count - i, checked_block);
+							W blockSum		 = 0;
+								for (; i != end; ++i) { blockSum += static_cast<W>(a[i]) * static_cast<W>(b[i]); }
+							res.add(blockSum);
+						}
+				}
+				else {
+		#if _MSTD_HAS_AVX2
+						if _MSTD_CONSTEXPR17 (sizeof(T) == 4) {
+							__m256i lo = _mm256_setzero_si256();
+							__m256i hi = _mm256_setzero_si256();
+								for (; i + 4 <= count; i += 4) {
+									const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+									const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+										if _MSTD_CONSTEXPR17 (std::is_signed_v<T>) {
+											avx2_wide_add<true>(lo, hi,
+											  _mm256_mul_epi32(_mm256_cvtepi32_epi64(va), _mm256_cvtepi32_epi64(vb)));
+										}
+										else {
+											avx2_wide_add<false>(lo, hi,
+											  _mm256_mul_epu32(_mm256_cvtepu32_epi64(va), _mm256_cvtepu32_epi64(vb)));
+										}
+								}
+							res = avx2_wide_reduce(lo, hi);
+						}
+		#endif
+						for (; i < count; ++i) {
+							W product = 0;
+								if (mul_overflow(static_cast<W>(a[i]), static_cast<W>(b[i]), product)) { return false; }
+							res.add(product);
+						}
+				}
+			return true;
+		}
+
+		#pragma endregion // CHECKED_ACCUMULATION
+	} // namespace utils
+
+		#pragma region CHECKED_SPANS
+
+	// Sum of the whole buffer, true when it does not fit R. Terms are accumulated exactly (128 bits wide) so
+	// intermediate sums may leave the range of R as long as the final one is back in it.
+		#if _MSTD_HAS_CXX20
+	template<class T, class R>
+	requires (utils::are_checked_integers_v<T, R>)
+		#else
+	template<class T, class R, std::enable_if_t<utils::are_checked_integers_v<T, R>, bool> = true>
+		#endif
+	bool sum_overflow(const T* data, size_t count, R& out) noexcept {
+		return utils::checked_sum(data, count).to(out);
+	}
+
+	// Dot product of a and b, true when it does not fit R. Products of 64 bit values which do not fit 64 bits on
+	// their own count as an overflow too.
+		#if _MSTD_HAS_CXX20
+	template<class T, class R>
+	requires (utils::are_checked_integers_v<T, R>)
+		#else
+	template<class T, class R, std::enable_if_t<utils::are_checked_integers_v<T, R>, bool> = true>
+		#endif
+	bool dot_overflow(const T* a, const T* b, size_t count, R& out) noexcept {
+		utils::wide_sum res;
+			if (!utils::checked_dot(a, b, count, res)) { return true; }
+		return res.to(out);
 	}
+
+		#pragma endregion // CHECKED_SPANS
 } // namespace mstd
 	#endif
-#endif
\ No newline at end of file
+#endif
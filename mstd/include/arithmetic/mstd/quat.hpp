@@ -23,10 +23,33 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/vec.hpp>
 
 namespace mstd {
+	namespace utils {
+		// weights of a and b in slerp(a, b, t) given cosTheta = dot(a, b). b is flipped (negative weight) when that gives
+		// the shorter arc and nearly equal quaternions fall back to nlerp weights, where sin(theta) would lose precision
+		template<class T>
+		_MSTD_CONSTEXPR20 void slerp_weights(T cosTheta, const T& t, T& aWeight, T& bWeight) {
+			const T sign = cosTheta < static_cast<T>(0) ? static_cast<T>(-1) : static_cast<T>(1);
+			const T u	 = static_cast<T>(1) - t;
+			cosTheta	*= sign;
+
+				if (cosTheta > static_cast<T>(0.9995)) {
+					const T length = static_cast<T>(sqrt(u * u + t * t + static_cast<T>(2) * u * t * cosTheta));
+					aWeight		   = u / length;
+					bWeight		   = sign * t / length;
+					return;
+				}
+
+			const T theta	 = static_cast<T>(std::acos(cosTheta));
+			const T sinTheta = static_cast<T>(sqrt(static_cast<T>(1) - cosTheta * cosTheta));
+			aWeight			 = static_cast<T>(sin(u * theta)) / sinTheta;
+			bWeight			 = sign * static_cast<T>(sin(t * theta)) / sinTheta;
+		}
+	} // namespace utils
+
 		#if _MSTD_HAS_CXX20
-	template<arithmetic T>
+	template<arithmetic_like T>
 		#else
-	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> >
+	template<class T, std::enable_if_t<is_arithmetic_like_v<T>, bool> >
 		#endif
 	class quat {
 	public:
@@ -36,6 +59,11 @@ namespace mstd {
 		T s;
 		vec_type v;
 
+	private:
+		using _kernels = utils::quat_kernels<T>;
+
+	public:
+
 		#pragma region CONSTRUCTORS
 
 		_MSTD_CONSTEXPR20 quat() : s(0), v() {}
@@ -78,10 +106,10 @@ namespace mstd {
 
 			quat<T> q;
 				if (!axis.is_zero()) {
-					q = quat<T>(static_cast<T>(std::cos(radians * half)),
-					  axis.normalized() * static_cast<T>(std::sin(radians * half)));
+					q = quat<T>(static_cast<T>(cos(radians * half)),
+					  axis.normalized() * static_cast<T>(sin(radians * half)));
 				}
-				else { q = quat<T>(static_cast<T>(std::cos(radians * half)), axis); }
+				else { q = quat<T>(static_cast<T>(cos(radians * half)), axis); }
 				if (q.magnitude() != static_cast<T>(0)) { q.normalize(); }
 			return q;
 		}
@@ -105,7 +133,7 @@ namespace mstd {
 
 		#pragma region QUATERNION_OPERATIONS
 
-		_MSTD_CONSTEXPR20 T magnitude() const { return std::sqrt((s * s) + v.dot(v)); }
+		_MSTD_CONSTEXPR20 T magnitude() const { return sqrt((s * s) + v.dot(v)); }
 
 		_MSTD_CONSTEXPR20 quat<T>& normalize() {
 			T m = magnitude();
@@ -118,6 +146,26 @@ namespace mstd {
 			return res.normalize();
 		}
 
+		// scales by the fast rsqrt of the squared magnitude, same bounds and fallbacks as vec::normalize_fast
+		_MSTD_CONSTEXPR20 quat<T>& normalize_fast() {
+				if _MSTD_CONSTEXPR17 (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+					T scale = static_cast<T>(0);
+						if (_MSTD_IS_CONSTANT_EVALUATED() ||
+							!utils::math_algorithms<utils::scalar_math_ops<T>, math_precision::fast>::rsqrt(
+							  (s * s) + v.dot(v), scale)) {
+							return normalize();
+						}
+					*this *= scale;
+					return *this;
+				}
+				else { return normalize(); }
+		}
+
+		_MSTD_CONSTEXPR20 quat<T> normalized_fast() const {
+			quat<T> res = *this;
+			return res.normalize_fast();
+		}
+
 		_MSTD_CONSTEXPR20 quat<T>& conjugate() {
 			v *= -1;
 			return *this;
@@ -161,8 +209,8 @@ namespace mstd {
 			res[0]	   = static_cast<T>(std::atan2(sinxCosp, cosxCosp));
 
 			// pitch (y-axis rotation)
-			T siny	   = static_cast<T>(std::sqrt(1.0 + (two * ((q.s * q.v[1]) - (q.v[0] * q.v[2])))));
-			T cosy	   = static_cast<T>(std::sqrt(1.0 - (two * ((q.s * q.v[1]) - (q.v[0] * q.v[2])))));
+			T siny	   = static_cast<T>(sqrt(1.0 + (two * ((q.s * q.v[1]) - (q.v[0] * q.v[2])))));
+			T cosy	   = static_cast<T>(sqrt(1.0 - (two * ((q.s * q.v[1]) - (q.v[0] * q.v[2])))));
 			res[1]	   = static_cast<T>((two * std::atan2(siny, cosy)) - (M_PI * half));
 
 			// yaw (z-axis rotation)
@@ -181,7 +229,15 @@ namespace mstd {
 			return res;
 		}
 
-		_MSTD_CONSTEXPR20 T scalar(const quat<T>& other) { return (s * other.s) + v.dot(other.v); }
+		_MSTD_CONSTEXPR20 T scalar(const quat<T>& other) const { return _kernels::dot(s, v, other.s, other.v); }
+
+		// rotates vector by this unit quaternion, same as (*this * quat(0, vector) * conjugated()).v without building the
+		// intermediate quaternions
+		_MSTD_CONSTEXPR20 vec_type rotate(const vec_type& vector) const {
+			vec_type res;
+			_kernels::rotate(&res[0], s, v, vector);
+			return res;
+		}
 
 		#pragma endregion // QUATERNION_OPERATIONS
 
@@ -200,9 +256,7 @@ namespace mstd {
 		}
 
 		_MSTD_CONSTEXPR20 quat<T>& operator*=(const quat<T>& other) {
-			T t = s;
-			s	= (s * other.s) - v.dot(other.v);
-			v	= (other.v * t) + (v * other.s) + v.cross(other.v);
+			_kernels::mul(s, &v[0], s, v, other.s, other.v);
 			return *this;
 		}
 
@@ -309,6 +363,33 @@ namespace mstd {
 
 		#pragma endregion // OPERATORS
 	};
+
+		#pragma region EXTRA_OPERATORS
+
+	// normalized linear interpolation between unit quaternions along the shorter arc. The angular speed is not constant
+	// but it is much cheaper than slerp
+	template<class T>
+	_MSTD_CONSTEXPR20 quat<T> nlerp(const quat<T>& a, const quat<T>& b, const T& t) {
+		const T bWeight = a.scalar(b) < static_cast<T>(0) ? -t : t;
+
+		quat<T> res;
+		utils::quat_kernels<T>::template blend<true>(res.s, &res.v[0], a.s, a.v, static_cast<T>(1) - t, b.s, b.v, bWeight);
+		return res;
+	}
+
+	// spherical linear interpolation between unit quaternions along the shorter arc
+	template<class T>
+	_MSTD_CONSTEXPR20 quat<T> slerp(const quat<T>& a, const quat<T>& b, const T& t) {
+		T aWeight;
+		T bWeight;
+		utils::slerp_weights(a.scalar(b), t, aWeight, bWeight);
+
+		quat<T> res;
+		utils::quat_kernels<T>::template blend<false>(res.s, &res.v[0], a.s, a.v, aWeight, b.s, b.v, bWeight);
+		return res;
+	}
+
+		#pragma endregion // EXTRA_OPERATORS
 } // namespace mstd
 	#endif
 #endif
\ No newline at end of file
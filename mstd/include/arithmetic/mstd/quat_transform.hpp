@@ -0,0 +1,151 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_QUAT_TRANSFORM_HPP_
+	#define _MSTD_QUAT_TRANSFORM_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/quat.hpp>
+
+namespace mstd {
+	namespace utils {
+		// below this many elements per thread starting a thread costs more than it saves
+		static _MSTD_CONSTEXPR17 const size_t quat_min_chunk = 8192;
+
+		// q is taken by value, so the stores through dst can not force it to be reloaded
+		template<class T>
+		void rotate_range(const quat<T> q, const vec<3, T>* src, vec<3, T>* dst, size_t first, size_t last) {
+				for (size_t i = first; i != last; ++i) { quat_kernels<T>::rotate(&dst[i][0], q.s, q.v, src[i]); }
+		}
+
+		template<bool Spherical, class T, class Weights>
+		void interpolate_range(const quat<T>* a, const quat<T>* b, const Weights& weights, quat<T>* dst, size_t first,
+		  size_t last) {
+				for (size_t i = first; i != last; ++i) {
+					const T t	  = weights(i);
+					const T cosAB = quat_kernels<T>::dot(a[i].s, a[i].v, b[i].s, b[i].v);
+					T aWeight	  = static_cast<T>(1) - t;
+					T bWeight	  = cosAB < static_cast<T>(0) ? -t : t;
+						if _MSTD_CONSTEXPR17 (Spherical) { slerp_weights(cosAB, t, aWeight, bWeight); }
+					quat_kernels<T>::template blend<!Spherical>(dst[i].s, &dst[i].v[0], a[i].s, a[i].v, aWeight, b[i].s,
+					  b[i].v, bWeight);
+				}
+		}
+
+		template<bool Spherical, class T, class Weights>
+		void interpolate(const quat<T>* a, const quat<T>* b, const Weights& weights, quat<T>* dst, size_t count,
+		  size_t threads) {
+			parallel_for(count, threads, quat_min_chunk, [a, b, &weights, dst](size_t first, size_t last) {
+				interpolate_range<Spherical>(a, b, weights, dst, first, last);
+			});
+		}
+	} // namespace utils
+
+	// Batched quaternion operations. dst may be the same buffer as any source, threads > 1 splits large batches across
+	// that many threads (0 uses every hardware thread). Rotations and interpolations expect unit quaternions.
+
+		#pragma region ROTATE_VECTORS
+
+	// dst[i] = q.rotate(src[i])
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void rotate_vectors(const quat<T>& q, const vec<3, T>* src, vec<3, T>* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::quat_min_chunk,
+		  [&q, src, dst](size_t first, size_t last) { utils::rotate_range(q, src, dst, first, last); });
+	}
+
+	// dst[i] = q[i].rotate(src[i])
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void rotate_vectors(const quat<T>* q, const vec<3, T>* src, vec<3, T>* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::quat_min_chunk, [q, src, dst](size_t first, size_t last) {
+				for (size_t i = first; i != last; ++i) {
+					utils::quat_kernels<T>::rotate(&dst[i][0], q[i].s, q[i].v, src[i]);
+				}
+		});
+	}
+
+		#pragma endregion // ROTATE_VECTORS
+
+		#pragma region MUL_QUATS
+
+	// dst[i] = a[i] * b[i]
+		#if _MSTD_HAS_CXX20
+	template<arithmetic T>
+		#else
+	template<class T, std::enable_if_t<std::is_arithmetic_v<T>, bool> = true>
+		#endif
+	void mul_quats(const quat<T>* a, const quat<T>* b, quat<T>* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::quat_min_chunk, [a, b, dst](size_t first, size_t last) {
+				for (size_t i = first; i != last; ++i) {
+					utils::quat_kernels<T>::mul(dst[i].s, &dst[i].v[0], a[i].s, a[i].v, b[i].s, b[i].v);
+				}
+		});
+	}
+
+		#pragma endregion // MUL_QUATS
+
+		#pragma region INTERPOLATE
+
+	// dst[i] = slerp(a[i], b[i], t)
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void slerp(const quat<T>* a, const quat<T>* b, const T& t, quat<T>* dst, size_t count, size_t threads = 1) {
+		utils::interpolate<true>(a, b, [t](size_t) { return t; }, dst, count, threads);
+	}
+
+	// dst[i] = slerp(a[i], b[i], t[i])
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void slerp(const quat<T>* a, const quat<T>* b, const T* t, quat<T>* dst, size_t count, size_t threads = 1) {
+		utils::interpolate<true>(a, b, [t](size_t idx) { return t[idx]; }, dst, count, threads);
+	}
+
+	// dst[i] = nlerp(a[i], b[i], t)
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void nlerp(const quat<T>* a, const quat<T>* b, const T& t, quat<T>* dst, size_t count, size_t threads = 1) {
+		utils::interpolate<false>(a, b, [t](size_t) { return t; }, dst, count, threads);
+	}
+
+	// dst[i] = nlerp(a[i], b[i], t[i])
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void nlerp(const quat<T>* a, const quat<T>* b, const T* t, quat<T>* dst, size_t count, size_t threads = 1) {
+		utils::interpolate<false>(a, b, [t](size_t idx) { return t[idx]; }, dst, count, threads);
+	}
+
+		#pragma endregion // INTERPOLATE
+} // namespace mstd
+	#endif
+#endif
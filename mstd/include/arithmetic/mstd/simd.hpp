@@ -0,0 +1,1433 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_SIMD_HPP_
+	#define _MSTD_SIMD_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/arithmetic_types.hpp>
+		#include <mstd/math_functions.hpp>
+
+namespace mstd::utils {
+		#pragma region SCALAR_VEC_KERNELS
+
+	// element-wise kernels used by vec<N, T>, every SIMD specialization falls back to these during constant evaluation
+	template<size_t N, class T>
+	struct scalar_vec_kernels {
+		static _MSTD_CONSTEXPR17 const size_t storage_size = N;
+		static _MSTD_CONSTEXPR17 const size_t alignment	   = alignof(T);
+
+		static _MSTD_CONSTEXPR20 void add(T* dst, const T* src) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] += src[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(T* dst, const T* src) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] -= src[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(T* dst, const T* src) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] *= src[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void div(T* dst, const T* src) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] /= src[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void add(T* dst, const T& value) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] += value; }
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(T* dst, const T& value) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] -= value; }
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(T* dst, const T& value) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] *= value; }
+		}
+
+		static _MSTD_CONSTEXPR20 void div(T* dst, const T& value) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] /= value; }
+		}
+
+		static _MSTD_CONSTEXPR20 T dot(const T* a, const T* b) noexcept {
+			T res = static_cast<T>(0);
+				for (size_t i = 0; i != N; ++i) { res += a[i] * b[i]; }
+			return res;
+		}
+
+		static _MSTD_CONSTEXPR20 void min(T* dst, const T* a, const T* b) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] = std::min(a[i], b[i]); }
+		}
+
+		static _MSTD_CONSTEXPR20 void max(T* dst, const T* a, const T* b) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] = std::max(a[i], b[i]); }
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(T* dst, const T* minVal, const T* maxVal) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] = std::clamp(dst[i], minVal[i], maxVal[i]); }
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(T* dst, const T& minVal, const T& maxVal) noexcept {
+				for (size_t i = 0; i != N; ++i) { dst[i] = std::clamp(dst[i], minVal, maxVal); }
+		}
+	};
+
+	template<size_t N, class T>
+	struct vec_kernels : scalar_vec_kernels<N, T> {};
+
+		#pragma endregion // SCALAR_VEC_KERNELS
+
+		#if _MSTD_HAS_SSE2
+			#pragma region SSE_VEC_KERNELS
+
+	// vec<3, float> is padded to 4 lanes, the padding lane is kept at zero so dot can always use all 4 lanes
+	template<size_t N>
+	struct sse_float_vec_kernels : scalar_vec_kernels<N, float> {
+	private:
+		using _scalar = scalar_vec_kernels<N, float>;
+
+		static __m128 _masked(__m128 value) noexcept {
+				if _MSTD_CONSTEXPR17 (N == 3) {
+					return _mm_and_ps(value, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+				}
+				else { return value; }
+		}
+
+		static float _hsum(__m128 value) noexcept {
+			__m128 shuf = _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1));
+			__m128 sums = _mm_add_ps(value, shuf);
+			shuf		= _mm_movehl_ps(shuf, sums);
+			sums		= _mm_add_ss(sums, shuf);
+			return _mm_cvtss_f32(sums);
+		}
+
+	public:
+		static _MSTD_CONSTEXPR17 const size_t storage_size = 4;
+		static _MSTD_CONSTEXPR17 const size_t alignment	   = 16;
+
+		static _MSTD_CONSTEXPR20 void add(float* dst, const float* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::add(dst, src); }
+			_mm_store_ps(dst, _mm_add_ps(_mm_load_ps(dst), _mm_load_ps(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(float* dst, const float* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sub(dst, src); }
+			_mm_store_ps(dst, _mm_sub_ps(_mm_load_ps(dst), _mm_load_ps(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(float* dst, const float* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, src); }
+			_mm_store_ps(dst, _mm_mul_ps(_mm_load_ps(dst), _mm_load_ps(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void div(float* dst, const float* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::div(dst, src); }
+			_mm_store_ps(dst, _masked(_mm_div_ps(_mm_load_ps(dst), _mm_load_ps(src))));
+		}
+
+		static _MSTD_CONSTEXPR20 void add(float* dst, const float& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::add(dst, value); }
+			_mm_store_ps(dst, _masked(_mm_add_ps(_mm_load_ps(dst), _mm_set1_ps(value))));
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(float* dst, const float& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sub(dst, value); }
+			_mm_store_ps(dst, _masked(_mm_sub_ps(_mm_load_ps(dst), _mm_set1_ps(value))));
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(float* dst, const float& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, value); }
+			_mm_store_ps(dst, _masked(_mm_mul_ps(_mm_load_ps(dst), _mm_set1_ps(value))));
+		}
+
+		static _MSTD_CONSTEXPR20 void div(float* dst, const float& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::div(dst, value); }
+			_mm_store_ps(dst, _masked(_mm_div_ps(_mm_load_ps(dst), _mm_set1_ps(value))));
+		}
+
+		static _MSTD_CONSTEXPR20 float dot(const float* a, const float* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::dot(a, b); }
+			return _hsum(_mm_mul_ps(_mm_load_ps(a), _mm_load_ps(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void min(float* dst, const float* a, const float* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::min(dst, a, b); }
+			_mm_store_ps(dst, _mm_min_ps(_mm_load_ps(a), _mm_load_ps(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void max(float* dst, const float* a, const float* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::max(dst, a, b); }
+			_mm_store_ps(dst, _mm_max_ps(_mm_load_ps(a), _mm_load_ps(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(float* dst, const float* minVal, const float* maxVal) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::clamp(dst, minVal, maxVal); }
+			__m128 value = _mm_max_ps(_mm_load_ps(dst), _mm_load_ps(minVal));
+			_mm_store_ps(dst, _masked(_mm_min_ps(value, _mm_load_ps(maxVal))));
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(float* dst, const float& minVal, const float& maxVal) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::clamp(dst, minVal, maxVal); }
+			__m128 value = _mm_max_ps(_mm_load_ps(dst), _mm_set1_ps(minVal));
+			_mm_store_ps(dst, _masked(_mm_min_ps(value, _mm_set1_ps(maxVal))));
+		}
+	};
+
+	template<>
+	struct vec_kernels<4, float> : sse_float_vec_kernels<4> {};
+
+	template<>
+	struct vec_kernels<3, float> : sse_float_vec_kernels<3> {};
+
+	template<>
+	struct vec_kernels<4, double> : scalar_vec_kernels<4, double> {
+	private:
+		using _scalar = scalar_vec_kernels<4, double>;
+
+			#if _MSTD_HAS_AVX
+		using _reg = __m256d;
+
+		static _reg _load(const double* src) noexcept { return _mm256_load_pd(src); }
+
+		static void _store(double* dst, _reg value) noexcept { _mm256_store_pd(dst, value); }
+
+		static _reg _set1(double value) noexcept { return _mm256_set1_pd(value); }
+
+		static _reg _add(_reg a, _reg b) noexcept { return _mm256_add_pd(a, b); }
+
+		static _reg _sub(_reg a, _reg b) noexcept { return _mm256_sub_pd(a, b); }
+
+		static _reg _mul(_reg a, _reg b) noexcept { return _mm256_mul_pd(a, b); }
+
+		static _reg _div(_reg a, _reg b) noexcept { return _mm256_div_pd(a, b); }
+
+		static _reg _min(_reg a, _reg b) noexcept { return _mm256_min_pd(a, b); }
+
+		static _reg _max(_reg a, _reg b) noexcept { return _mm256_max_pd(a, b); }
+
+		static double _hsum(_reg value) noexcept {
+			__m128d sums = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+			return _mm_cvtsd_f64(_mm_add_sd(sums, _mm_unpackhi_pd(sums, sums)));
+		}
+			#else
+		struct _reg {
+			__m128d lo;
+			__m128d hi;
+		};
+
+		static _reg _load(const double* src) noexcept { return { _mm_load_pd(src), _mm_load_pd(src + 2) }; }
+
+		static void _store(double* dst, _reg value) noexcept {
+			_mm_store_pd(dst, value.lo);
+			_mm_store_pd(dst + 2, value.hi);
+		}
+
+		static _reg _set1(double value) noexcept { return { _mm_set1_pd(value), _mm_set1_pd(value) }; }
+
+		static _reg _add(_reg a, _reg b) noexcept { return { _mm_add_pd(a.lo, b.lo), _mm_add_pd(a.hi, b.hi) }; }
+
+		static _reg _sub(_reg a, _reg b) noexcept { return { _mm_sub_pd(a.lo, b.lo), _mm_sub_pd(a.hi, b.hi) }; }
+
+		static _reg _mul(_reg a, _reg b) noexcept { return { _mm_mul_pd(a.lo, b.lo), _mm_mul_pd(a.hi, b.hi) }; }
+
+		static _reg _div(_reg a, _reg b) noexcept { return { _mm_div_pd(a.lo, b.lo), _mm_div_pd(a.hi, b.hi) }; }
+
+		static _reg _min(_reg a, _reg b) noexcept { return { _mm_min_pd(a.lo, b.lo), _mm_min_pd(a.hi, b.hi) }; }
+
+		static _reg _max(_reg a, _reg b) noexcept { return { _mm_max_pd(a.lo, b.lo), _mm_max_pd(a.hi, b.hi) }; }
+
+		static double _hsum(_reg value) noexcept {
+			__m128d sums = _mm_add_pd(value.lo, value.hi);
+			return _mm_cvtsd_f64(_mm_add_sd(sums, _mm_unpackhi_pd(sums, sums)));
+		}
+			#endif
+
+	public:
+		static _MSTD_CONSTEXPR17 const size_t alignment = _MSTD_HAS_AVX ? 32 : 16;
+
+		static _MSTD_CONSTEXPR20 void add(double* dst, const double* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::add(dst, src); }
+			_store(dst, _add(_load(dst), _load(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(double* dst, const double* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sub(dst, src); }
+			_store(dst, _sub(_load(dst), _load(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(double* dst, const double* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, src); }
+			_store(dst, _mul(_load(dst), _load(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void div(double* dst, const double* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::div(dst, src); }
+			_store(dst, _div(_load(dst), _load(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void add(double* dst, const double& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::add(dst, value); }
+			_store(dst, _add(_load(dst), _set1(value)));
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(double* dst, const double& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sub(dst, value); }
+			_store(dst, _sub(_load(dst), _set1(value)));
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(double* dst, const double& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, value); }
+			_store(dst, _mul(_load(dst), _set1(value)));
+		}
+
+		static _MSTD_CONSTEXPR20 void div(double* dst, const double& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::div(dst, value); }
+			_store(dst, _div(_load(dst), _set1(value)));
+		}
+
+		static _MSTD_CONSTEXPR20 double dot(const double* a, const double* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::dot(a, b); }
+			return _hsum(_mul(_load(a), _load(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void min(double* dst, const double* a, const double* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::min(dst, a, b); }
+			_store(dst, _min(_load(a), _load(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void max(double* dst, const double* a, const double* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::max(dst, a, b); }
+			_store(dst, _max(_load(a), _load(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(double* dst, const double* minVal, const double* maxVal) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::clamp(dst, minVal, maxVal); }
+			_store(dst, _min(_max(_load(dst), _load(minVal)), _load(maxVal)));
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(double* dst, const double& minVal, const double& maxVal) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::clamp(dst, minVal, maxVal); }
+			_store(dst, _min(_max(_load(dst), _set1(minVal)), _set1(maxVal)));
+		}
+	};
+
+			#pragma endregion // SSE_VEC_KERNELS
+		#elif _MSTD_HAS_NEON
+			#pragma region NEON_VEC_KERNELS
+
+	// vec<3, float> is padded to 4 lanes, the padding lane is kept at zero so dot can always use all 4 lanes
+	template<size_t N>
+	struct neon_float_vec_kernels : scalar_vec_kernels<N, float> {
+	private:
+		using _scalar = scalar_vec_kernels<N, float>;
+
+		static float32x4_t _masked(float32x4_t value) noexcept {
+				if _MSTD_CONSTEXPR17 (N == 3) { return vsetq_lane_f32(0.0f, value, 3); }
+				else { return value; }
+		}
+
+	public:
+		static _MSTD_CONSTEXPR17 const size_t storage_size = 4;
+		static _MSTD_CONSTEXPR17 const size_t alignment	   = 16;
+
+		static _MSTD_CONSTEXPR20 void add(float* dst, const float* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::add(dst, src); }
+			vst1q_f32(dst, vaddq_f32(vld1q_f32(dst), vld1q_f32(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(float* dst, const float* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sub(dst, src); }
+			vst1q_f32(dst, vsubq_f32(vld1q_f32(dst), vld1q_f32(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(float* dst, const float* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, src); }
+			vst1q_f32(dst, vmulq_f32(vld1q_f32(dst), vld1q_f32(src)));
+		}
+
+		static _MSTD_CONSTEXPR20 void div(float* dst, const float* src) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::div(dst, src); }
+			vst1q_f32(dst, _masked(vdivq_f32(vld1q_f32(dst), vld1q_f32(src))));
+		}
+
+		static _MSTD_CONSTEXPR20 void add(float* dst, const float& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::add(dst, value); }
+			vst1q_f32(dst, _masked(vaddq_f32(vld1q_f32(dst), vdupq_n_f32(value))));
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(float* dst, const float& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sub(dst, value); }
+			vst1q_f32(dst, _masked(vsubq_f32(vld1q_f32(dst), vdupq_n_f32(value))));
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(float* dst, const float& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, value); }
+			vst1q_f32(dst, _masked(vmulq_n_f32(vld1q_f32(dst), value)));
+		}
+
+		static _MSTD_CONSTEXPR20 void div(float* dst, const float& value) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::div(dst, value); }
+			vst1q_f32(dst, _masked(vdivq_f32(vld1q_f32(dst), vdupq_n_f32(value))));
+		}
+
+		static _MSTD_CONSTEXPR20 float dot(const float* a, const float* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::dot(a, b); }
+			return vaddvq_f32(vmulq_f32(vld1q_f32(a), vld1q_f32(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void min(float* dst, const float* a, const float* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::min(dst, a, b); }
+			vst1q_f32(dst, vminq_f32(vld1q_f32(a), vld1q_f32(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void max(float* dst, const float* a, const float* b) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::max(dst, a, b); }
+			vst1q_f32(dst, vmaxq_f32(vld1q_f32(a), vld1q_f32(b)));
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(float* dst, const float* minVal, const float* maxVal) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::clamp(dst, minVal, maxVal); }
+			float32x4_t value = vmaxq_f32(vld1q_f32(dst), vld1q_f32(minVal));
+			vst1q_f32(dst, _masked(vminq_f32(value, vld1q_f32(maxVal))));
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(float* dst, const float& minVal, const float& maxVal) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::clamp(dst, minVal, maxVal); }
+			float32x4_t value = vmaxq_f32(vld1q_f32(dst), vdupq_n_f32(minVal));
+			vst1q_f32(dst, _masked(vminq_f32(value, vdupq_n_f32(maxVal))));
+		}
+	};
+
+	template<>
+	struct vec_kernels<4, float> : neon_float_vec_kernels<4> {};
+
+	template<>
+	struct vec_kernels<3, float> : neon_float_vec_kernels<3> {};
+
+			#pragma endregion // NEON_VEC_KERNELS
+		#endif
+
+		#pragma region SCALAR_MAT_KERNELS
+
+	// column major C x R kernels, every result element is summed in a local since the compiler can not prove dst does not
+	// alias the inputs
+	template<size_t C, size_t R, class T>
+	struct scalar_mat_kernels {
+		static _MSTD_CONSTEXPR17 const size_t alignment = alignof(T);
+
+		// dst = a * v, one dot product per row
+		static _MSTD_CONSTEXPR20 void mul(T* dst, const T (&a)[C][R], const T* v) noexcept {
+				for (size_t y = 0; y != R; ++y) {
+					T res = static_cast<T>(0);
+						for (size_t i = 0; i != C; ++i) { res += a[i][y] * v[i]; }
+					dst[y] = res;
+				}
+		}
+
+		// dst = a * b, four result columns are summed together so every loaded element of a is used four times
+		template<size_t OC>
+		static _MSTD_CONSTEXPR20 void mul(T (&dst)[OC][R], const T (&a)[C][R], const T (&b)[OC][C]) noexcept {
+			_MSTD_CONSTEXPR17 const size_t block_size = 4;
+			_MSTD_CONSTEXPR17 const size_t blocked	  = OC - OC % block_size;
+
+				for (size_t x = 0; x != blocked; x += block_size) {
+						for (size_t y = 0; y != R; ++y) {
+							T res0 = static_cast<T>(0);
+							T res1 = static_cast<T>(0);
+							T res2 = static_cast<T>(0);
+							T res3 = static_cast<T>(0);
+								for (size_t i = 0; i != C; ++i) {
+									const T value  = a[i][y];
+									res0		  += value * b[x][i];
+									res1		  += value * b[x + 1][i];
+									res2		  += value * b[x + 2][i];
+									res3		  += value * b[x + 3][i];
+								}
+							dst[x][y]	  = res0;
+							dst[x + 1][y] = res1;
+							dst[x + 2][y] = res2;
+							dst[x + 3][y] = res3;
+						}
+				}
+				for (size_t x = blocked; x != OC; ++x) { mul(dst[x], a, b[x]); }
+		}
+	};
+
+	template<size_t C, size_t R, class T>
+	struct mat_kernels : scalar_mat_kernels<C, R, T> {};
+
+		#pragma endregion // SCALAR_MAT_KERNELS
+
+		#if _MSTD_HAS_SSE2
+			#pragma region SSE_MAT_KERNELS
+
+	// every result column is a broadcast-and-accumulate of the 4 columns of a, which stay in registers
+	template<>
+	struct mat_kernels<4, 4, float> : scalar_mat_kernels<4, 4, float> {
+	private:
+		using _scalar = scalar_mat_kernels<4, 4, float>;
+
+		static __m128 _fmadd(__m128 a, __m128 b, __m128 c) noexcept {
+			#if _MSTD_HAS_FMA
+			return _mm_fmadd_ps(a, b, c);
+			#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+			#endif
+		}
+
+		static __m128 _column(const __m128 (&columns)[4], const float* v) noexcept {
+			__m128 res = _mm_mul_ps(columns[0], _mm_set1_ps(v[0]));
+			res		   = _fmadd(columns[1], _mm_set1_ps(v[1]), res);
+			res		   = _fmadd(columns[2], _mm_set1_ps(v[2]), res);
+			return _fmadd(columns[3], _mm_set1_ps(v[3]), res);
+		}
+
+	public:
+		static _MSTD_CONSTEXPR17 const size_t alignment = 16;
+
+		static _MSTD_CONSTEXPR20 void mul(float* dst, const float (&a)[4][4], const float* v) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, a, v); }
+			const __m128 columns[4] = { _mm_load_ps(a[0]), _mm_load_ps(a[1]), _mm_load_ps(a[2]), _mm_load_ps(a[3]) };
+			_mm_storeu_ps(dst, _column(columns, v));
+		}
+
+		template<size_t OC>
+		static _MSTD_CONSTEXPR20 void mul(float (&dst)[OC][4], const float (&a)[4][4], const float (&b)[OC][4]) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, a, b); }
+			const __m128 columns[4] = { _mm_load_ps(a[0]), _mm_load_ps(a[1]), _mm_load_ps(a[2]), _mm_load_ps(a[3]) };
+				for (size_t x = 0; x != OC; ++x) { _mm_storeu_ps(dst[x], _column(columns, b[x])); }
+		}
+	};
+
+	template<>
+	struct mat_kernels<4, 4, double> : scalar_mat_kernels<4, 4, double> {
+	private:
+		using _scalar = scalar_mat_kernels<4, 4, double>;
+
+			#if _MSTD_HAS_AVX
+		using _columns = __m256d[4];
+
+		static _MSTD_CONSTEXPR17 const size_t _alignment = 32;
+
+		static void _load(_columns& columns, const double (&a)[4][4]) noexcept {
+				for (size_t i = 0; i != 4; ++i) { columns[i] = _mm256_load_pd(a[i]); }
+		}
+
+		static __m256d _fmadd(__m256d a, __m256d b, __m256d c) noexcept {
+				#if _MSTD_HAS_FMA
+			return _mm256_fmadd_pd(a, b, c);
+				#else
+			return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+				#endif
+		}
+
+		static void _column(double* dst, const _columns& columns, const double* v) noexcept {
+			__m256d res = _mm256_mul_pd(columns[0], _mm256_set1_pd(v[0]));
+			res			= _fmadd(columns[1], _mm256_set1_pd(v[1]), res);
+			res			= _fmadd(columns[2], _mm256_set1_pd(v[2]), res);
+			res			= _fmadd(columns[3], _mm256_set1_pd(v[3]), res);
+			_mm256_storeu_pd(dst, res);
+		}
+			#else
+		// columns[i][0] holds rows 0-1 and columns[i][1] rows 2-3 of column i
+		using _columns = __m128d[4][2];
+
+		static _MSTD_CONSTEXPR17 const size_t _alignment = 16;
+
+		static void _load(_columns& columns, const double (&a)[4][4]) noexcept {
+				for (size_t i = 0; i != 4; ++i) {
+					columns[i][0] = _mm_load_pd(a[i]);
+					columns[i][1] = _mm_load_pd(a[i] + 2);
+				}
+		}
+
+		static void _column(double* dst, const _columns& columns, const double* v) noexcept {
+			__m128d value = _mm_set1_pd(v[0]);
+			__m128d lo	  = _mm_mul_pd(columns[0][0], value);
+			__m128d hi	  = _mm_mul_pd(columns[0][1], value);
+				for (size_t i = 1; i != 4; ++i) {
+					value = _mm_set1_pd(v[i]);
+					lo	  = _mm_add_pd(lo, _mm_mul_pd(columns[i][0], value));
+					hi	  = _mm_add_pd(hi, _mm_mul_pd(columns[i][1], value));
+				}
+			_mm_storeu_pd(dst, lo);
+			_mm_storeu_pd(dst + 2, hi);
+		}
+			#endif
+
+	public:
+		static _MSTD_CONSTEXPR17 const size_t alignment = _alignment;
+
+		static _MSTD_CONSTEXPR20 void mul(double* dst, const double (&a)[4][4], const double* v) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, a, v); }
+			_columns columns;
+			_load(columns, a);
+			_column(dst, columns, v);
+		}
+
+		template<size_t OC>
+		static _MSTD_CONSTEXPR20 void mul(double (&dst)[OC][4], const double (&a)[4][4], const double (&b)[OC][4]) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, a, b); }
+			_columns columns;
+			_load(columns, a);
+				for (size_t x = 0; x != OC; ++x) { _column(dst[x], columns, b[x]); }
+		}
+	};
+
+			#pragma endregion // SSE_MAT_KERNELS
+		#elif _MSTD_HAS_NEON
+			#pragma region NEON_MAT_KERNELS
+
+	template<>
+	struct mat_kernels<4, 4, float> : scalar_mat_kernels<4, 4, float> {
+	private:
+		using _scalar = scalar_mat_kernels<4, 4, float>;
+
+		static float32x4_t _column(const float32x4_t (&columns)[4], const float* v) noexcept {
+			const float32x4_t values = vld1q_f32(v);
+			float32x4_t res			 = vmulq_laneq_f32(columns[0], values, 0);
+			res						 = vfmaq_laneq_f32(res, columns[1], values, 1);
+			res						 = vfmaq_laneq_f32(res, columns[2], values, 2);
+			return vfmaq_laneq_f32(res, columns[3], values, 3);
+		}
+
+	public:
+		static _MSTD_CONSTEXPR17 const size_t alignment = 16;
+
+		static _MSTD_CONSTEXPR20 void mul(float* dst, const float (&a)[4][4], const float* v) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, a, v); }
+			const float32x4_t columns[4] = { vld1q_f32(a[0]), vld1q_f32(a[1]), vld1q_f32(a[2]), vld1q_f32(a[3]) };
+			vst1q_f32(dst, _column(columns, v));
+		}
+
+		template<size_t OC>
+		static _MSTD_CONSTEXPR20 void mul(float (&dst)[OC][4], const float (&a)[4][4], const float (&b)[OC][4]) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, a, b); }
+			const float32x4_t columns[4] = { vld1q_f32(a[0]), vld1q_f32(a[1]), vld1q_f32(a[2]), vld1q_f32(a[3]) };
+				for (size_t x = 0; x != OC; ++x) { vst1q_f32(dst[x], _column(columns, b[x])); }
+		}
+	};
+
+			#pragma endregion // NEON_MAT_KERNELS
+		#endif
+
+		#pragma region SCALAR_TRANSFORM_KERNELS
+
+	// one batch of mat4 transforms. Elements are addressed through byte strides so interleaved vertex buffers work as well,
+	// inputs with 3 components use w as their fourth one
+	template<class T>
+	struct transform_batch {
+		const unsigned char* src = nullptr;
+		size_t srcStride		 = 0;
+		size_t srcComponents	 = 3;
+		unsigned char* dst		 = nullptr;
+		size_t dstStride		 = 0;
+		size_t dstComponents	 = 3;
+		T w						 = static_cast<T>(1);
+		// rescales xyz of every result to unit length, zero results stay zero
+		bool normalize = false;
+	};
+
+	template<class T>
+	struct scalar_transform_kernels {
+	private:
+		static void _normalize(T* values) noexcept {
+			const T length = static_cast<T>(std::sqrt(values[0] * values[0] + values[1] * values[1] + values[2] * values[2]));
+				if (length == static_cast<T>(0)) { return; }
+				for (size_t i = 0; i != 3; ++i) { values[i] /= length; }
+		}
+
+	public:
+		// transforms elements [first, last) of the batch by the column major m, every element is read before it is written
+		template<bool SrcFull, bool DstFull, bool Normalize>
+		static void apply(const T (&m)[4][4], const transform_batch<T>& batch, size_t first, size_t last) noexcept {
+			_MSTD_CONSTEXPR17 const size_t rows = DstFull ? 4 : 3;
+
+			// local copy, so the stores through dst can not force the matrix to be reloaded
+			T columns[4][rows];
+				for (size_t x = 0; x != 4; ++x) { std::copy_n(m[x], rows, columns[x]); }
+
+			const unsigned char* src = batch.src + first * batch.srcStride;
+			unsigned char* dst		 = batch.dst + first * batch.dstStride;
+				for (size_t i = first; i != last; ++i, src += batch.srcStride, dst += batch.dstStride) {
+					const T* in = reinterpret_cast<const T*>(src);
+					const T x	= in[0];
+					const T y	= in[1];
+					const T z	= in[2];
+					const T w	= SrcFull ? in[3] : batch.w;
+
+					T res[rows];
+						for (size_t r = 0; r != rows; ++r) {
+							res[r] = columns[0][r] * x + columns[1][r] * y + columns[2][r] * z + columns[3][r] * w;
+						}
+						if _MSTD_CONSTEXPR17 (Normalize) { _normalize(res); }
+					std::copy_n(res, rows, reinterpret_cast<T*>(dst));
+				}
+		}
+	};
+
+	template<class T>
+	struct transform_kernels : scalar_transform_kernels<T> {};
+
+	// picks the apply instantiation matching the batch layout, so the per element loop has no branches
+	template<class Kernels, bool SrcFull, bool DstFull, class T>
+	void apply_transform(const T (&m)[4][4], const transform_batch<T>& batch, size_t first, size_t last) noexcept {
+			if (batch.normalize) { Kernels::template apply<SrcFull, DstFull, true>(m, batch, first, last); }
+			else { Kernels::template apply<SrcFull, DstFull, false>(m, batch, first, last); }
+	}
+
+	template<class Kernels, bool SrcFull, class T>
+	void apply_transform(const T (&m)[4][4], const transform_batch<T>& batch, size_t first, size_t last) noexcept {
+			if (batch.dstComponents == 4) { apply_transform<Kernels, SrcFull, true>(m, batch, first, last); }
+			else { apply_transform<Kernels, SrcFull, false>(m, batch, first, last); }
+	}
+
+	template<class T>
+	void apply_transform(const T (&m)[4][4], const transform_batch<T>& batch, size_t first, size_t last) noexcept {
+			if (batch.srcComponents == 4) { apply_transform<transform_kernels<T>, true>(m, batch, first, last); }
+			else { apply_transform<transform_kernels<T>, false>(m, batch, first, last); }
+	}
+
+		#pragma endregion // SCALAR_TRANSFORM_KERNELS
+
+		#if _MSTD_HAS_SSE2
+			#pragma region SSE_TRANSFORM_KERNELS
+
+	// every element is one broadcast-and-accumulate of the 4 matrix columns, which stay in registers for the whole batch
+	template<>
+	struct transform_kernels<float> : scalar_transform_kernels<float> {
+	private:
+		static __m128 _fmadd(__m128 a, __m128 b, __m128 c) noexcept {
+			#if _MSTD_HAS_FMA
+			return _mm_fmadd_ps(a, b, c);
+			#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+			#endif
+		}
+
+		static __m128 _normalized(__m128 value) noexcept {
+			__m128 sum		 = _mm_and_ps(_mm_mul_ps(value, value), _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+			sum				 = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1)));
+			sum				 = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+			const __m128 len = _mm_sqrt_ps(sum);
+			return _mm_and_ps(_mm_div_ps(value, len), _mm_cmpgt_ps(len, _mm_setzero_ps()));
+		}
+
+	public:
+		template<bool SrcFull, bool DstFull, bool Normalize>
+		static void apply(const float (&m)[4][4], const transform_batch<float>& batch, size_t first, size_t last) noexcept {
+			const __m128 c0 = _mm_loadu_ps(m[0]);
+			const __m128 c1 = _mm_loadu_ps(m[1]);
+			const __m128 c2 = _mm_loadu_ps(m[2]);
+			const __m128 c3 = _mm_loadu_ps(m[3]);
+			// the constant w of 3 component inputs is folded into the translation column once
+			const __m128 base = _mm_mul_ps(c3, _mm_set1_ps(batch.w));
+
+			const unsigned char* src = batch.src + first * batch.srcStride;
+			unsigned char* dst		 = batch.dst + first * batch.dstStride;
+				for (size_t i = first; i != last; ++i, src += batch.srcStride, dst += batch.dstStride) {
+					const float* in = reinterpret_cast<const float*>(src);
+					float* out		= reinterpret_cast<float*>(dst);
+
+					__m128 res = SrcFull ? _mm_mul_ps(c3, _mm_set1_ps(in[3])) : base;
+					res		   = _fmadd(c0, _mm_set1_ps(in[0]), res);
+					res		   = _fmadd(c1, _mm_set1_ps(in[1]), res);
+					res		   = _fmadd(c2, _mm_set1_ps(in[2]), res);
+						if _MSTD_CONSTEXPR17 (Normalize) { res = _normalized(res); }
+
+						if _MSTD_CONSTEXPR17 (DstFull) { _mm_storeu_ps(out, res); }
+						else {
+							_mm_storel_pi(reinterpret_cast<__m64*>(out), res);
+							_mm_store_ss(out + 2, _mm_movehl_ps(res, res));
+						}
+				}
+		}
+	};
+
+			#if _MSTD_HAS_AVX
+	template<>
+	struct transform_kernels<double> : scalar_transform_kernels<double> {
+	private:
+		static __m256d _fmadd(__m256d a, __m256d b, __m256d c) noexcept {
+				#if _MSTD_HAS_FMA
+			return _mm256_fmadd_pd(a, b, c);
+				#else
+			return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+				#endif
+		}
+
+		static __m256d _normalized(__m256d value) noexcept {
+			__m256d sum		  = _mm256_blend_pd(_mm256_mul_pd(value, value), _mm256_setzero_pd(), 0x8);
+			sum				  = _mm256_add_pd(sum, _mm256_permute_pd(sum, 0x5));
+			sum				  = _mm256_add_pd(sum, _mm256_permute2f128_pd(sum, sum, 0x1));
+			const __m256d len = _mm256_sqrt_pd(sum);
+			return _mm256_and_pd(_mm256_div_pd(value, len), _mm256_cmp_pd(len, _mm256_setzero_pd(), _CMP_GT_OQ));
+		}
+
+	public:
+		template<bool SrcFull, bool DstFull, bool Normalize>
+		static void apply(const double (&m)[4][4], const transform_batch<double>& batch, size_t first, size_t last) noexcept {
+			const __m256d c0   = _mm256_loadu_pd(m[0]);
+			const __m256d c1   = _mm256_loadu_pd(m[1]);
+			const __m256d c2   = _mm256_loadu_pd(m[2]);
+			const __m256d c3   = _mm256_loadu_pd(m[3]);
+			const __m256d base = _mm256_mul_pd(c3, _mm256_set1_pd(batch.w));
+
+			const unsigned char* src = batch.src + first * batch.srcStride;
+			unsigned char* dst		 = batch.dst + first * batch.dstStride;
+				for (size_t i = first; i != last; ++i, src += batch.srcStride, dst += batch.dstStride) {
+					const double* in = reinterpret_cast<const double*>(src);
+					double* out		 = reinterpret_cast<double*>(dst);
+
+					__m256d res = SrcFull ? _mm256_mul_pd(c3, _mm256_broadcast_sd(in + 3)) : base;
+					res			= _fmadd(c0, _mm256_broadcast_sd(in), res);
+					res			= _fmadd(c1, _mm256_broadcast_sd(in + 1), res);
+					res			= _fmadd(c2, _mm256_broadcast_sd(in + 2), res);
+						if _MSTD_CONSTEXPR17 (Normalize) { res = _normalized(res); }
+
+						if _MSTD_CONSTEXPR17 (DstFull) { _mm256_storeu_pd(out, res); }
+						else {
+							_mm_storeu_pd(out, _mm256_castpd256_pd128(res));
+							_mm_store_sd(out + 2, _mm256_extractf128_pd(res, 1));
+						}
+				}
+		}
+	};
+			#endif
+
+			#pragma endregion // SSE_TRANSFORM_KERNELS
+		#elif _MSTD_HAS_NEON
+			#pragma region NEON_TRANSFORM_KERNELS
+
+	template<>
+	struct transform_kernels<float> : scalar_transform_kernels<float> {
+	private:
+		static float32x4_t _normalized(float32x4_t value) noexcept {
+			const float len = std::sqrt(vaddvq_f32(vsetq_lane_f32(0.0f, vmulq_f32(value, value), 3)));
+				if (len == 0.0f) { return vdupq_n_f32(0.0f); }
+			return vmulq_n_f32(value, 1.0f / len);
+		}
+
+	public:
+		template<bool SrcFull, bool DstFull, bool Normalize>
+		static void apply(const float (&m)[4][4], const transform_batch<float>& batch, size_t first, size_t last) noexcept {
+			const float32x4_t c0   = vld1q_f32(m[0]);
+			const float32x4_t c1   = vld1q_f32(m[1]);
+			const float32x4_t c2   = vld1q_f32(m[2]);
+			const float32x4_t c3   = vld1q_f32(m[3]);
+			const float32x4_t base = vmulq_n_f32(c3, batch.w);
+
+			const unsigned char* src = batch.src + first * batch.srcStride;
+			unsigned char* dst		 = batch.dst + first * batch.dstStride;
+				for (size_t i = first; i != last; ++i, src += batch.srcStride, dst += batch.dstStride) {
+					const float* in = reinterpret_cast<const float*>(src);
+					float* out		= reinterpret_cast<float*>(dst);
+
+					float32x4_t res = SrcFull ? vmulq_n_f32(c3, in[3]) : base;
+					res				= vfmaq_n_f32(res, c0, in[0]);
+					res				= vfmaq_n_f32(res, c1, in[1]);
+					res				= vfmaq_n_f32(res, c2, in[2]);
+						if _MSTD_CONSTEXPR17 (Normalize) { res = _normalized(res); }
+
+						if _MSTD_CONSTEXPR17 (DstFull) { vst1q_f32(out, res); }
+						else {
+							vst1_f32(out, vget_low_f32(res));
+							vst1q_lane_f32(out + 2, res, 2);
+						}
+				}
+		}
+	};
+
+			#pragma endregion // NEON_TRANSFORM_KERNELS
+		#endif
+
+		#pragma region SCALAR_QUAT_KERNELS
+
+	// kernels used by quat<T>. A quaternion is passed as its scalar part s and the storage of its vector part v, every
+	// result is computed before anything is written so the outputs may alias the inputs
+	template<class T>
+	struct scalar_quat_kernels {
+		// Hamilton product a * b
+		static _MSTD_CONSTEXPR20 void mul(T& dstS, T* dstV, const T& aS, const T* aV, const T& bS, const T* bV) noexcept {
+			const T s = aS * bS - (aV[0] * bV[0] + aV[1] * bV[1] + aV[2] * bV[2]);
+			const T x = bV[0] * aS + aV[0] * bS + (aV[1] * bV[2] - aV[2] * bV[1]);
+			const T y = bV[1] * aS + aV[1] * bS + (aV[2] * bV[0] - aV[0] * bV[2]);
+			const T z = bV[2] * aS + aV[2] * bS + (aV[0] * bV[1] - aV[1] * bV[0]);
+			dstS	  = s;
+			dstV[0]	  = x;
+			dstV[1]	  = y;
+			dstV[2]	  = z;
+		}
+
+		// q * (0, v) * q^-1 of a unit q without the intermediate quaternions: t = 2 (qv x v), v + s t + qv x t
+		static _MSTD_CONSTEXPR20 void rotate(T* dst, const T& qS, const T* qV, const T* v) noexcept {
+			const T tx = static_cast<T>(2) * (qV[1] * v[2] - qV[2] * v[1]);
+			const T ty = static_cast<T>(2) * (qV[2] * v[0] - qV[0] * v[2]);
+			const T tz = static_cast<T>(2) * (qV[0] * v[1] - qV[1] * v[0]);
+			const T x  = v[0] + qS * tx + (qV[1] * tz - qV[2] * ty);
+			const T y  = v[1] + qS * ty + (qV[2] * tx - qV[0] * tz);
+			const T z  = v[2] + qS * tz + (qV[0] * ty - qV[1] * tx);
+			dst[0]	   = x;
+			dst[1]	   = y;
+			dst[2]	   = z;
+		}
+
+		static _MSTD_CONSTEXPR20 T dot(const T& aS, const T* aV, const T& bS, const T* bV) noexcept {
+			return aS * bS + (aV[0] * bV[0] + aV[1] * bV[1] + aV[2] * bV[2]);
+		}
+
+		// a * aWeight + b * bWeight, rescaled to unit length when Normalize is set (a zero result stays zero)
+		template<bool Normalize>
+		static _MSTD_CONSTEXPR20 void blend(T& dstS, T* dstV, const T& aS, const T* aV, const T& aWeight, const T& bS,
+		  const T* bV, const T& bWeight) noexcept {
+			T s = aS * aWeight + bS * bWeight;
+			T x = aV[0] * aWeight + bV[0] * bWeight;
+			T y = aV[1] * aWeight + bV[1] * bWeight;
+			T z = aV[2] * aWeight + bV[2] * bWeight;
+				if _MSTD_CONSTEXPR17 (Normalize) {
+					const T length = static_cast<T>(mstd::sqrt(s * s + x * x + y * y + z * z));
+						if (length != static_cast<T>(0)) {
+							s /= length;
+							x /= length;
+							y /= length;
+							z /= length;
+						}
+				}
+			dstS	= s;
+			dstV[0] = x;
+			dstV[1] = y;
+			dstV[2] = z;
+		}
+	};
+
+	template<class T>
+	struct quat_kernels : scalar_quat_kernels<T> {};
+
+		#pragma endregion // SCALAR_QUAT_KERNELS
+
+		#if _MSTD_HAS_SSE2
+			#pragma region SSE_QUAT_KERNELS
+
+	// the vector part of quat<float> is a padded, 16 byte aligned vec<3, float>, so it is loaded as one register and the
+	// scalar part goes into its unused fourth lane
+	template<>
+	struct quat_kernels<float> : scalar_quat_kernels<float> {
+	private:
+		using _scalar = scalar_quat_kernels<float>;
+
+		// no fused multiply add here, so c * c - s * s of a unit quaternion cancels exactly like in the scalar kernels
+		static __m128 _fmadd(__m128 a, __m128 b, __m128 c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+		static __m128 _xyz_mask() noexcept { return _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)); }
+
+		// (x, y, z, s)
+		static __m128 _load(const float& s, const float* v) noexcept {
+			const __m128 xyz = _mm_load_ps(v);
+			return _mm_shuffle_ps(xyz, _mm_unpackhi_ps(xyz, _mm_set1_ps(s)), _MM_SHUFFLE(1, 0, 1, 0));
+		}
+
+		static void _store(float& s, float* v, __m128 value) noexcept {
+			_mm_store_ps(v, _mm_and_ps(value, _xyz_mask()));
+			s = _mm_cvtss_f32(_mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3)));
+		}
+
+		static float _hsum(__m128 value) noexcept {
+			__m128 shuf = _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1));
+			__m128 sums = _mm_add_ps(value, shuf);
+			shuf		= _mm_movehl_ps(shuf, sums);
+			sums		= _mm_add_ss(sums, shuf);
+			return _mm_cvtss_f32(sums);
+		}
+
+		// a x b in xyz, 0 in the fourth lane when both fourth lanes are finite
+		static __m128 _cross(__m128 a, __m128 b) noexcept {
+			const __m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 res  = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+			return _mm_shuffle_ps(res, res, _MM_SHUFFLE(3, 0, 2, 1));
+		}
+
+	public:
+		static _MSTD_CONSTEXPR20 void mul(float& dstS, float* dstV, const float& aS, const float* aV, const float& bS,
+		  const float* bV) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dstS, dstV, aS, aV, bS, bV); }
+			const __m128 a = _load(aS, aV);
+			const __m128 b = _load(bS, bV);
+
+			// every lane of the product is a signed dot of a with a permutation of b
+			const __m128 signsX = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+			const __m128 signsY = _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+			const __m128 signsZ = _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+			const __m128 bWzyx	= _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), signsX);
+			const __m128 bZwxy	= _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), signsY);
+			const __m128 bYxwz	= _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), signsZ);
+
+			__m128 res = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b);
+			res		   = _fmadd(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), bWzyx, res);
+			res		   = _fmadd(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), bZwxy, res);
+			res		   = _fmadd(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), bYxwz, res);
+
+			_store(dstS, dstV, res);
+		}
+
+		static _MSTD_CONSTEXPR20 void rotate(float* dst, const float& qS, const float* qV, const float* v) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::rotate(dst, qS, qV, v); }
+			const __m128 q = _mm_and_ps(_mm_load_ps(qV), _xyz_mask());
+			const __m128 p = _mm_and_ps(_mm_load_ps(v), _xyz_mask());
+			const __m128 t = _cross(_mm_add_ps(q, q), p);
+			_mm_store_ps(dst, _mm_add_ps(_fmadd(_mm_set1_ps(qS), t, p), _cross(q, t)));
+		}
+
+		static _MSTD_CONSTEXPR20 float dot(const float& aS, const float* aV, const float& bS, const float* bV) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::dot(aS, aV, bS, bV); }
+			return _hsum(_mm_mul_ps(_load(aS, aV), _load(bS, bV)));
+		}
+
+		template<bool Normalize>
+		static _MSTD_CONSTEXPR20 void blend(float& dstS, float* dstV, const float& aS, const float* aV,
+		  const float& aWeight, const float& bS, const float* bV, const float& bWeight) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) {
+					return _scalar::template blend<Normalize>(dstS, dstV, aS, aV, aWeight, bS, bV, bWeight);
+				}
+			__m128 res = _fmadd(_load(bS, bV), _mm_set1_ps(bWeight), _mm_mul_ps(_load(aS, aV), _mm_set1_ps(aWeight)));
+				if _MSTD_CONSTEXPR17 (Normalize) {
+					const __m128 length = _mm_sqrt_ps(_mm_set1_ps(_hsum(_mm_mul_ps(res, res))));
+					res					= _mm_and_ps(_mm_div_ps(res, length), _mm_cmpgt_ps(length, _mm_setzero_ps()));
+				}
+			_store(dstS, dstV, res);
+		}
+	};
+
+			#pragma endregion // SSE_QUAT_KERNELS
+		#endif
+
+		#pragma region SCALAR_LANE_KERNELS
+
+	// kernels working on contiguous lanes of count values, dst may alias any of the sources
+	template<class T>
+	struct scalar_lane_kernels {
+		static _MSTD_CONSTEXPR20 void add(T* dst, const T* a, const T* b, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] + b[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(T* dst, const T* a, const T* b, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] - b[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(T* dst, const T* a, const T* b, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] * b[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void div(T* dst, const T* a, const T* b, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] / b[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void add(T* dst, const T* a, const T& value, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] + value; }
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(T* dst, const T* a, const T& value, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] - value; }
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(T* dst, const T* a, const T& value, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] * value; }
+		}
+
+		static _MSTD_CONSTEXPR20 void div(T* dst, const T* a, const T& value, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] / value; }
+		}
+
+		// dst = a * b + c
+		static _MSTD_CONSTEXPR20 void fma(T* dst, const T* a, const T* b, const T* c, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] * b[i] + c[i]; }
+		}
+
+		// dst = a * value + c
+		static _MSTD_CONSTEXPR20 void fma(T* dst, const T* a, const T& value, const T* c, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = a[i] * value + c[i]; }
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(T* dst, const T* a, const T& minVal, const T& maxVal, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = std::clamp(a[i], minVal, maxVal); }
+		}
+
+		static _MSTD_CONSTEXPR20 void sqrt(T* dst, const T* a, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = static_cast<T>(mstd::sqrt(a[i])); }
+		}
+
+		static _MSTD_CONSTEXPR20 void min(T* dst, const T* a, const T* b, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = std::min(a[i], b[i]); }
+		}
+
+		static _MSTD_CONSTEXPR20 void max(T* dst, const T* a, const T* b, size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) { dst[i] = std::max(a[i], b[i]); }
+		}
+
+		static _MSTD_CONSTEXPR20 T dot(const T* a, const T* b, size_t count) noexcept {
+			T res = static_cast<T>(0);
+				for (size_t i = 0; i != count; ++i) { res += a[i] * b[i]; }
+			return res;
+		}
+
+		// dst[c][i] += a[i] * values[c] for every column c, a is loaded once for all of them and must not alias them
+		template<size_t C>
+		static _MSTD_CONSTEXPR20 void fma_columns(T* const (&dst)[C], const T* a, const T (&values)[C],
+		  size_t count) noexcept {
+				for (size_t i = 0; i != count; ++i) {
+					const T value = a[i];
+						for (size_t c = 0; c != C; ++c) { dst[c][i] += value * values[c]; }
+				}
+		}
+	};
+
+	template<class T>
+	struct lane_kernels : scalar_lane_kernels<T> {};
+
+		#pragma endregion // SCALAR_LANE_KERNELS
+
+		#if _MSTD_HAS_SIMD
+			#pragma region SIMD_LANE_KERNELS
+
+	// Traits provide: value_type, reg, width, load, store, set1, add, sub, mul, div, fma, min, max, sqrt
+	template<class Traits>
+	struct simd_lane_kernels : scalar_lane_kernels<typename Traits::value_type> {
+	private:
+		using T		  = typename Traits::value_type;
+		using _scalar = scalar_lane_kernels<T>;
+		using _t	  = Traits;
+
+		template<class BlockFunc, class TailFunc>
+		static void _run(size_t count, const BlockFunc& block, const TailFunc& tail) noexcept {
+			size_t i = 0;
+				for (; i + _t::width <= count; i += _t::width) { block(i); }
+				for (; i != count; ++i) { tail(i); }
+		}
+
+	public:
+		static _MSTD_CONSTEXPR20 void add(T* dst, const T* a, const T* b, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::add(dst, a, b, count); }
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::add(_t::load(a + i), _t::load(b + i))); },
+			  [&](size_t i) { dst[i] = a[i] + b[i]; });
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(T* dst, const T* a, const T* b, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sub(dst, a, b, count); }
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::sub(_t::load(a + i), _t::load(b + i))); },
+			  [&](size_t i) { dst[i] = a[i] - b[i]; });
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(T* dst, const T* a, const T* b, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, a, b, count); }
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::mul(_t::load(a + i), _t::load(b + i))); },
+			  [&](size_t i) { dst[i] = a[i] * b[i]; });
+		}
+
+		static _MSTD_CONSTEXPR20 void div(T* dst, const T* a, const T* b, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::div(dst, a, b, count); }
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::div(_t::load(a + i), _t::load(b + i))); },
+			  [&](size_t i) { dst[i] = a[i] / b[i]; });
+		}
+
+		static _MSTD_CONSTEXPR20 void add(T* dst, const T* a, const T& value, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::add(dst, a, value, count); }
+			const auto valueReg = _t::set1(value);
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::add(_t::load(a + i), valueReg)); },
+			  [&](size_t i) { dst[i] = a[i] + value; });
+		}
+
+		static _MSTD_CONSTEXPR20 void sub(T* dst, const T* a, const T& value, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sub(dst, a, value, count); }
+			const auto valueReg = _t::set1(value);
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::sub(_t::load(a + i), valueReg)); },
+			  [&](size_t i) { dst[i] = a[i] - value; });
+		}
+
+		static _MSTD_CONSTEXPR20 void mul(T* dst, const T* a, const T& value, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::mul(dst, a, value, count); }
+			const auto valueReg = _t::set1(value);
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::mul(_t::load(a + i), valueReg)); },
+			  [&](size_t i) { dst[i] = a[i] * value; });
+		}
+
+		static _MSTD_CONSTEXPR20 void div(T* dst, const T* a, const T& value, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::div(dst, a, value, count); }
+			const auto valueReg = _t::set1(value);
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::div(_t::load(a + i), valueReg)); },
+			  [&](size_t i) { dst[i] = a[i] / value; });
+		}
+
+		static _MSTD_CONSTEXPR20 void fma(T* dst, const T* a, const T* b, const T* c, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::fma(dst, a, b, c, count); }
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::fma(_t::load(a + i), _t::load(b + i), _t::load(c + i))); },
+			  [&](size_t i) { dst[i] = a[i] * b[i] + c[i]; });
+		}
+
+		static _MSTD_CONSTEXPR20 void fma(T* dst, const T* a, const T& value, const T* c, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::fma(dst, a, value, c, count); }
+			const auto valueReg = _t::set1(value);
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::fma(_t::load(a + i), valueReg, _t::load(c + i))); },
+			  [&](size_t i) { dst[i] = a[i] * value + c[i]; });
+		}
+
+		static _MSTD_CONSTEXPR20 void clamp(T* dst, const T* a, const T& minVal, const T& maxVal, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::clamp(dst, a, minVal, maxVal, count); }
+			const auto minReg = _t::set1(minVal);
+			const auto maxReg = _t::set1(maxVal);
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::min(_t::max(_t::load(a + i), minReg), maxReg)); },
+			  [&](size_t i) { dst[i] = std::clamp(a[i], minVal, maxVal); });
+		}
+
+		static _MSTD_CONSTEXPR20 void sqrt(T* dst, const T* a, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::sqrt(dst, a, count); }
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::sqrt(_t::load(a + i))); },
+			  [&](size_t i) { dst[i] = std::sqrt(a[i]); });
+		}
+
+		static _MSTD_CONSTEXPR20 void min(T* dst, const T* a, const T* b, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::min(dst, a, b, count); }
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::min(_t::load(a + i), _t::load(b + i))); },
+			  [&](size_t i) { dst[i] = std::min(a[i], b[i]); });
+		}
+
+		static _MSTD_CONSTEXPR20 void max(T* dst, const T* a, const T* b, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::max(dst, a, b, count); }
+			_run(
+			  count, [&](size_t i) { _t::store(dst + i, _t::max(_t::load(a + i), _t::load(b + i))); },
+			  [&](size_t i) { dst[i] = std::max(a[i], b[i]); });
+		}
+
+		static _MSTD_CONSTEXPR20 T dot(const T* a, const T* b, size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::dot(a, b, count); }
+			auto sum = _t::set1(static_cast<T>(0));
+			T tail	 = static_cast<T>(0);
+			_run(
+			  count, [&](size_t i) { sum = _t::fma(_t::load(a + i), _t::load(b + i), sum); },
+			  [&](size_t i) { tail += a[i] * b[i]; });
+
+			T lanes[_t::width];
+			_t::store(lanes, sum);
+				for (size_t i = 0; i != _t::width; ++i) { tail += lanes[i]; }
+			return tail;
+		}
+
+		template<size_t C>
+		static _MSTD_CONSTEXPR20 void fma_columns(T* const (&dst)[C], const T* a, const T (&values)[C],
+		  size_t count) noexcept {
+				if (_MSTD_IS_CONSTANT_EVALUATED()) { return _scalar::fma_columns(dst, a, values, count); }
+			typename _t::reg valueRegs[C];
+				for (size_t c = 0; c != C; ++c) { valueRegs[c] = _t::set1(values[c]); }
+			_run(
+			  count,
+			  [&](size_t i) {
+				  const auto aReg = _t::load(a + i);
+					  for (size_t c = 0; c != C; ++c) {
+						  _t::store(dst[c] + i, _t::fma(aReg, valueRegs[c], _t::load(dst[c] + i)));
+					  }
+			  },
+			  [&](size_t i) {
+					  for (size_t c = 0; c != C; ++c) { dst[c][i] += a[i] * values[c]; }
+			  });
+		}
+	};
+
+			#if _MSTD_HAS_AVX
+	struct avx_float_traits {
+		using value_type							= float;
+		using reg									= __m256;
+		static _MSTD_CONSTEXPR17 const size_t width = 8;
+
+		static reg load(const float* src) noexcept { return _mm256_loadu_ps(src); }
+
+		static void store(float* dst, reg value) noexcept { _mm256_storeu_ps(dst, value); }
+
+		static reg set1(float value) noexcept { return _mm256_set1_ps(value); }
+
+		static reg add(reg a, reg b) noexcept { return _mm256_add_ps(a, b); }
+
+		static reg sub(reg a, reg b) noexcept { return _mm256_sub_ps(a, b); }
+
+		static reg mul(reg a, reg b) noexcept { return _mm256_mul_ps(a, b); }
+
+		static reg div(reg a, reg b) noexcept { return _mm256_div_ps(a, b); }
+
+		static reg min(reg a, reg b) noexcept { return _mm256_min_ps(a, b); }
+
+		static reg max(reg a, reg b) noexcept { return _mm256_max_ps(a, b); }
+
+		static reg sqrt(reg a) noexcept { return _mm256_sqrt_ps(a); }
+
+		static reg fma(reg a, reg b, reg c) noexcept {
+				#if _MSTD_HAS_FMA
+			return _mm256_fmadd_ps(a, b, c);
+				#else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+				#endif
+		}
+	};
+
+	struct avx_double_traits {
+		using value_type							= double;
+		using reg									= __m256d;
+		static _MSTD_CONSTEXPR17 const size_t width = 4;
+
+		static reg load(const double* src) noexcept { return _mm256_loadu_pd(src); }
+
+		static void store(double* dst, reg value) noexcept { _mm256_storeu_pd(dst, value); }
+
+		static reg set1(double value) noexcept { return _mm256_set1_pd(value); }
+
+		static reg add(reg a, reg b) noexcept { return _mm256_add_pd(a, b); }
+
+		static reg sub(reg a, reg b) noexcept { return _mm256_sub_pd(a, b); }
+
+		static reg mul(reg a, reg b) noexcept { return _mm256_mul_pd(a, b); }
+
+		static reg div(reg a, reg b) noexcept { return _mm256_div_pd(a, b); }
+
+		static reg min(reg a, reg b) noexcept { return _mm256_min_pd(a, b); }
+
+		static reg max(reg a, reg b) noexcept { return _mm256_max_pd(a, b); }
+
+		static reg sqrt(reg a) noexcept { return _mm256_sqrt_pd(a); }
+
+		static reg fma(reg a, reg b, reg c) noexcept {
+				#if _MSTD_HAS_FMA
+			return _mm256_fmadd_pd(a, b, c);
+				#else
+			return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+				#endif
+		}
+	};
+
+	template<>
+	struct lane_kernels<float> : simd_lane_kernels<avx_float_traits> {};
+
+	template<>
+	struct lane_kernels<double> : simd_lane_kernels<avx_double_traits> {};
+			#elif _MSTD_HAS_SSE2
+	struct sse_float_traits {
+		using value_type							= float;
+		using reg									= __m128;
+		static _MSTD_CONSTEXPR17 const size_t width = 4;
+
+		static reg load(const float* src) noexcept { return _mm_loadu_ps(src); }
+
+		static void store(float* dst, reg value) noexcept { _mm_storeu_ps(dst, value); }
+
+		static reg set1(float value) noexcept { return _mm_set1_ps(value); }
+
+		static reg add(reg a, reg b) noexcept { return _mm_add_ps(a, b); }
+
+		static reg sub(reg a, reg b) noexcept { return _mm_sub_ps(a, b); }
+
+		static reg mul(reg a, reg b) noexcept { return _mm_mul_ps(a, b); }
+
+		static reg div(reg a, reg b) noexcept { return _mm_div_ps(a, b); }
+
+		static reg min(reg a, reg b) noexcept { return _mm_min_ps(a, b); }
+
+		static reg max(reg a, reg b) noexcept { return _mm_max_ps(a, b); }
+
+		static reg sqrt(reg a) noexcept { return _mm_sqrt_ps(a); }
+
+		static reg fma(reg a, reg b, reg c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+	};
+
+	struct sse_double_traits {
+		using value_type							= double;
+		using reg									= __m128d;
+		static _MSTD_CONSTEXPR17 const size_t width = 2;
+
+		static reg load(const double* src) noexcept { return _mm_loadu_pd(src); }
+
+		static void store(double* dst, reg value) noexcept { _mm_storeu_pd(dst, value); }
+
+		static reg set1(double value) noexcept { return _mm_set1_pd(value); }
+
+		static reg add(reg a, reg b) noexcept { return _mm_add_pd(a, b); }
+
+		static reg sub(reg a, reg b) noexcept { return _mm_sub_pd(a, b); }
+
+		static reg mul(reg a, reg b) noexcept { return _mm_mul_pd(a, b); }
+
+		static reg div(reg a, reg b) noexcept { return _mm_div_pd(a, b); }
+
+		static reg min(reg a, reg b) noexcept { return _mm_min_pd(a, b); }
+
+		static reg max(reg a, reg b) noexcept { return _mm_max_pd(a, b); }
+
+		static reg sqrt(reg a) noexcept { return _mm_sqrt_pd(a); }
+
+		static reg fma(reg a, reg b, reg c) noexcept { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+	};
+
+	template<>
+	struct lane_kernels<float> : simd_lane_kernels<sse_float_traits> {};
+
+	template<>
+	struct lane_kernels<double> : simd_lane_kernels<sse_double_traits> {};
+			#elif _MSTD_HAS_NEON
+	struct neon_float_traits {
+		using value_type							= float;
+		using reg									= float32x4_t;
+		static _MSTD_CONSTEXPR17 const size_t width = 4;
+
+		static reg load(const float* src) noexcept { return vld1q_f32(src); }
+
+		static void store(float* dst, reg value) noexcept { vst1q_f32(dst, value); }
+
+		static reg set1(float value) noexcept { return vdupq_n_f32(value); }
+
+		static reg add(reg a, reg b) noexcept { return vaddq_f32(a, b); }
+
+		static reg sub(reg a, reg b) noexcept { return vsubq_f32(a, b); }
+
+		static reg mul(reg a, reg b) noexcept { return vmulq_f32(a, b); }
+
+		static reg div(reg a, reg b) noexcept { return vdivq_f32(a, b); }
+
+		static reg min(reg a, reg b) noexcept { return vminq_f32(a, b); }
+
+		static reg max(reg a, reg b) noexcept { return vmaxq_f32(a, b); }
+
+		static reg sqrt(reg a) noexcept { return vsqrtq_f32(a); }
+
+		static reg fma(reg a, reg b, reg c) noexcept { return vfmaq_f32(c, a, b); }
+	};
+
+	template<>
+	struct lane_kernels<float> : simd_lane_kernels<neon_float_traits> {};
+			#endif
+
+			#pragma endregion // SIMD_LANE_KERNELS
+		#endif
+} // namespace mstd::utils
+
+	#endif
+#endif
@@ -0,0 +1,1226 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_SIMD_MATH_HPP_
+	#define _MSTD_SIMD_MATH_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/math_functions.hpp>
+		#include <mstd/simd.hpp>
+
+namespace mstd {
+	// Vectorized sin, cos, sincos, tan, atan2, exp, log, pow, rsqrt and rcp. Every register goes through the same code
+	// (tails are padded into a full register), registers with a lane outside the domain below are computed by <cmath>
+	// instead, so NaN, infinities, zeros, negative logarithms and overflowing results behave exactly like std::.
+	//
+	// Maximum error against the exact result, measured on 2^24 random points per function with the scalar, SSE2, AVX2
+	// and AVX-512 kernels. The points are uniform over the domain and over the exponents of its magnitudes (|x|, |y| in
+	// [2^-40, 2^40] for atan2), the trigonometric ones also next to multiples of pi / 2. The fast double tier is
+	// a relative error, the other tiers are in ulp:
+	//
+	//   function    domain                                 float precise  float fast  double precise  double fast
+	//   sin, cos    |x| <= 8192 (float), 1e6 (double)      2.4            27          2.5             3.8e-9
+	//   tan         |x| <= 8192 (float), 1e6 (double)      3.6            36          4.2             4.0e-9
+	//   exp         [-87, 88] (float), [-708, 709]         0.87           2.2         0.96            1.1e-9
+	//   log         positive normal x                      0.94           2.9         1.3             2.1e-9
+	//   atan2       finite, not both zero                  3.2            13          1.7             2.1e-8
+	//   pow         x in [2^-4, 2^4], |y| <= 2             0.5            9.9         8.7             2.5e-9
+	//   rsqrt       [2^-126, 2^126)                        1.5            3.4         1.5             3.9e-14
+	//   rcp         |x| in [2^-126, 2^126)                 1.4            2.9         1.3             8.2e-15
+	//
+	// rsqrt and rcp refine the rsqrtps / rcpps estimates (14 bit rsqrt14 / rcp14 with AVX-512, double goes through the
+	// float estimate without it) with Newton-Raphson steps, the fast tier with one step fewer. With AVX-512 both tiers
+	// reach the precise bounds. The single value rsqrt(x) and rcp(x) use the scalar estimate instructions the same way.
+	//
+	// pow is exp(y * log(x)), the rounding of y * log(x) grows with its size: outside the row above double precise stays
+	// within 2 + 1.5 * |y * log(x)| ulp, the fast tiers within the exp error plus the log error times |y * log(x)|. The
+	// precise float pow runs the double kernels and rounds once, so it is correctly rounded up to rare half ulp ties.
+	enum class math_precision : uint8_t { fast, precise };
+
+	namespace utils {
+		#pragma region MATH_COEFFICIENTS
+
+		// atan(a) = atan(c) + atan((a - c) / (1 + a * c)) is used for a > from
+		template<class T>
+		struct atan_point {
+			T from;
+			T c;
+			T atanHi;
+			T atanLo;
+		};
+
+		template<class T>
+		struct math_constants;
+
+		template<>
+		struct math_constants<float> {
+			static _MSTD_CONSTEXPR17 const float trig_limit		 = 8192.f;
+			static _MSTD_CONSTEXPR17 const float two_over_pi	 = 0.636619772367581343f;
+			// pi / 2 in parts with at most 11 significant bits and a tail, k * part stays exact for every k below the limit
+			static _MSTD_CONSTEXPR17 const float half_pi[5]		 = { 1.5703125f, 4.837512969970703e-4f, 7.549533620476723e-8f,
+				 2.5632829192545614e-12f, 6.123234262925839e-17f };
+			static _MSTD_CONSTEXPR17 const float half_pi_hi		 = 1.5707963705062866f;
+			static _MSTD_CONSTEXPR17 const float half_pi_lo		 = -4.37113900018624283e-8f;
+			static _MSTD_CONSTEXPR17 const float pi_hi			 = 3.1415927410125732f;
+			static _MSTD_CONSTEXPR17 const float pi_lo			 = -8.74227800037248566e-8f;
+			static _MSTD_CONSTEXPR17 const float log2e			 = 1.44269504088896341f;
+			static _MSTD_CONSTEXPR17 const float ln2[2]			 = { 0.693359375f, -2.12194440e-4f };
+			static _MSTD_CONSTEXPR17 const float sqrt2			 = 1.41421356237309504880f;
+			static _MSTD_CONSTEXPR17 const float exp_min		 = -87.f;
+			static _MSTD_CONSTEXPR17 const float exp_max		 = 88.f;
+			static _MSTD_CONSTEXPR17 const float min_normal		 = std::numeric_limits<float>::min();
+			static _MSTD_CONSTEXPR17 const float max			 = std::numeric_limits<float>::max();
+			// [estimate_min, estimate_max) is the range where the rsqrt and rcp estimates and their results stay normal floats
+			static _MSTD_CONSTEXPR17 const float estimate_min	 = 0x1p-126f;
+			static _MSTD_CONSTEXPR17 const float estimate_max	 = 0x1p126f;
+		};
+
+		template<>
+		struct math_constants<double> {
+			static _MSTD_CONSTEXPR17 const double trig_limit  = 1e6;
+			static _MSTD_CONSTEXPR17 const double two_over_pi = 6.36619772367581382433e-01;
+			// pi / 2 in parts with 33 significant bits and a tail (fdlibm)
+			static _MSTD_CONSTEXPR17 const double half_pi[4]  = { 1.57079632673412561417e+00, 6.07710050630396597660e-11,
+				 2.02226624871116645580e-21, 8.47842766036889956997e-32 };
+			static _MSTD_CONSTEXPR17 const double half_pi_hi  = 1.57079632679489655800e+00;
+			static _MSTD_CONSTEXPR17 const double half_pi_lo  = 6.12323399573676603587e-17;
+			static _MSTD_CONSTEXPR17 const double pi_hi		  = 3.14159265358979311600e+00;
+			static _MSTD_CONSTEXPR17 const double pi_lo		  = 1.22464679914735317720e-16;
+			static _MSTD_CONSTEXPR17 const double log2e		  = 1.44269504088896338700e+00;
+			static _MSTD_CONSTEXPR17 const double ln2[2]	  = { 6.93147180369123816490e-01, 1.90821492927058770002e-10 };
+			static _MSTD_CONSTEXPR17 const double sqrt2		  = 1.41421356237309504880;
+			static _MSTD_CONSTEXPR17 const double exp_min	  = -708.;
+			static _MSTD_CONSTEXPR17 const double exp_max	  = 709.;
+			static _MSTD_CONSTEXPR17 const double min_normal  = std::numeric_limits<double>::min();
+			static _MSTD_CONSTEXPR17 const double max		  = std::numeric_limits<double>::max();
+			// the double estimates go through float without AVX-512, so they share its range
+			static _MSTD_CONSTEXPR17 const double estimate_min = 0x1p-126;
+			static _MSTD_CONSTEXPR17 const double estimate_max = 0x1p126;
+		};
+
+		// Polynomials, highest power first:
+		//   sin(r) = r + r * z * sin(z)				 z = r^2, |r| <= pi / 4
+		//   cos(r) = 1 - z / 2 + z^2 * cos(z)
+		//   exp(r) = 1 + r + r^2 * exp(r)				 |r| <= ln(2) / 2
+		//   log(1 + f) = f - s * (f - 2 * z * log(z))	 s = f / (2 + f), z = s^2
+		//   atan(t) = t + t * z * atan(z)				 z = t^2
+		template<class T, math_precision Precision>
+		struct math_coefficients;
+
+		// Cephes single precision minimax polynomials, log is the atanh series
+		template<class T>
+		struct single_math_coefficients : math_constants<T> {
+			static _MSTD_CONSTEXPR17 const T sin[3] = { static_cast<T>(-1.9515295891e-4), static_cast<T>(8.3321608736e-3),
+				static_cast<T>(-1.6666654611e-1) };
+			static _MSTD_CONSTEXPR17 const T cos[3] = { static_cast<T>(2.443315711809948e-5),
+				static_cast<T>(-1.388731625493765e-3), static_cast<T>(4.166664568298827e-2) };
+			static _MSTD_CONSTEXPR17 const T exp[6] = { static_cast<T>(1.9875691500e-4), static_cast<T>(1.3981999507e-3),
+				static_cast<T>(8.3334519073e-3), static_cast<T>(4.1665795894e-2), static_cast<T>(1.6666665459e-1),
+				static_cast<T>(5.0000001201e-1) };
+			static _MSTD_CONSTEXPR17 const T log[4] = { static_cast<T>(1.0 / 9.0), static_cast<T>(1.0 / 7.0),
+				static_cast<T>(1.0 / 5.0), static_cast<T>(1.0 / 3.0) };
+			static _MSTD_CONSTEXPR17 const atan_point<T> atan_points[1] = { { static_cast<T>(0.41421356237309504880),
+				static_cast<T>(1), static_cast<T>(0.78539816339744830962), static_cast<T>(0) } };
+			static _MSTD_CONSTEXPR17 const T atan[4] = { static_cast<T>(8.05374449538e-2), static_cast<T>(-1.38776856032e-1),
+				static_cast<T>(1.99777106478e-1), static_cast<T>(-3.33329491539e-1) };
+		};
+
+		template<>
+		struct math_coefficients<float, math_precision::precise> : single_math_coefficients<float> {};
+
+		// lower degree fits of the same forms
+		template<>
+		struct math_coefficients<float, math_precision::fast> : math_constants<float> {
+			static _MSTD_CONSTEXPR17 const float sin[2]						= { 8.163282455958187e-3f, -1.6663390404224926e-1f };
+			static _MSTD_CONSTEXPR17 const float cos[2]						= { -1.364871125109004e-3f, 4.166107112916899e-2f };
+			static _MSTD_CONSTEXPR17 const float exp[4]						= { 8.31253314890156e-3f, 4.189012521688025e-2f,
+									  1.6667114412408388e-1f, 4.999923167664051e-1f };
+			static _MSTD_CONSTEXPR17 const float log[2]						= { 2.0601006364526292e-1f, 3.3327810773239824e-1f };
+			static _MSTD_CONSTEXPR17 const atan_point<float> atan_points[1] = { { 0.41421356237309504880f, 1.f,
+			  0.78539816339744830962f, 0.f } };
+			static _MSTD_CONSTEXPR17 const float atan[3] = { -1.1225107532252372e-1f, 1.9714129974575362e-1f,
+				-3.3325507003314225e-1f };
+		};
+
+		// fdlibm minimax polynomials for sin, cos and atan, Taylor series for exp and log
+		template<>
+		struct math_coefficients<double, math_precision::precise> : math_constants<double> {
+			static _MSTD_CONSTEXPR17 const double sin[6] = { 1.58969099521155010221e-10, -2.50507602534068634195e-08,
+				2.75573137070700676789e-06, -1.98412698298579493134e-04, 8.33333333332248946124e-03,
+				-1.66666666666666324348e-01 };
+			static _MSTD_CONSTEXPR17 const double cos[6] = { -1.13596475577881948265e-11, 2.08757232129817482790e-09,
+				-2.75573143513906633035e-07, 2.48015872894767294178e-05, -1.38888888888741095749e-03,
+				4.16666666666666019037e-02 };
+			static _MSTD_CONSTEXPR17 const double exp[12] = { 1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0,
+				1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0, 1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0,
+				1.0 / 2.0 };
+			static _MSTD_CONSTEXPR17 const double log[9] = { 1.0 / 19.0, 1.0 / 17.0, 1.0 / 15.0, 1.0 / 13.0, 1.0 / 11.0,
+				1.0 / 9.0, 1.0 / 7.0, 1.0 / 5.0, 1.0 / 3.0 };
+			static _MSTD_CONSTEXPR17 const atan_point<double> atan_points[2] = {
+				{ 7.0 / 16.0, 0.5, 4.63647609000806093515e-01, 2.26987774529616870924e-17 },
+				{ 11.0 / 16.0, 1.0, 7.85398163397448278999e-01, 3.06161699786838301793e-17 }
+			};
+			static _MSTD_CONSTEXPR17 const double atan[11] = { -1.62858201153657823623e-02, 3.65315727442169155270e-02,
+				-4.97687799461593236017e-02, 5.83357013379057348645e-02, -6.66107313738753120669e-02,
+				7.69187620504482999495e-02, -9.09088713343650656196e-02, 1.11111104054623557880e-01,
+				-1.42857142725034663711e-01, 1.99999999998764832476e-01, -3.33333333333329318027e-01 };
+		};
+
+		template<>
+		struct math_coefficients<double, math_precision::fast> : single_math_coefficients<double> {};
+
+		#pragma endregion // MATH_COEFFICIENTS
+
+		#pragma region MATH_OPS
+
+		// hardware estimates of 1 / sqrt(x) and 1 / x for a single float or double, with scalar_estimate_bits correct bits
+		#if _MSTD_HAS_AVX512VL
+		static _MSTD_CONSTEXPR17 const size_t scalar_estimate_bits = 14;
+
+		inline float scalar_rsqrt_estimate(float x) noexcept {
+			const __m128 v = _mm_set_ss(x);
+			return _mm_cvtss_f32(_mm_rsqrt14_ss(v, v));
+		}
+
+		inline double scalar_rsqrt_estimate(double x) noexcept {
+			const __m128d v = _mm_set_sd(x);
+			return _mm_cvtsd_f64(_mm_rsqrt14_sd(v, v));
+		}
+
+		inline float scalar_rcp_estimate(float x) noexcept {
+			const __m128 v = _mm_set_ss(x);
+			return _mm_cvtss_f32(_mm_rcp14_ss(v, v));
+		}
+
+		inline double scalar_rcp_estimate(double x) noexcept {
+			const __m128d v = _mm_set_sd(x);
+			return _mm_cvtsd_f64(_mm_rcp14_sd(v, v));
+		}
+		#elif _MSTD_HAS_SSE2
+		static _MSTD_CONSTEXPR17 const size_t scalar_estimate_bits = 11;
+
+		inline float scalar_rsqrt_estimate(float x) noexcept { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x))); }
+
+		inline double scalar_rsqrt_estimate(double x) noexcept {
+			return static_cast<double>(scalar_rsqrt_estimate(static_cast<float>(x)));
+		}
+
+		inline float scalar_rcp_estimate(float x) noexcept { return _mm_cvtss_f32(_mm_rcp_ss(_mm_set_ss(x))); }
+
+		inline double scalar_rcp_estimate(double x) noexcept {
+			return static_cast<double>(scalar_rcp_estimate(static_cast<float>(x)));
+		}
+		#elif _MSTD_HAS_NEON
+		static _MSTD_CONSTEXPR17 const size_t scalar_estimate_bits = 8;
+
+		inline float scalar_rsqrt_estimate(float x) noexcept { return vrsqrtes_f32(x); }
+
+		inline double scalar_rsqrt_estimate(double x) noexcept { return vrsqrted_f64(x); }
+
+		inline float scalar_rcp_estimate(float x) noexcept { return vrecpes_f32(x); }
+
+		inline double scalar_rcp_estimate(double x) noexcept { return vrecped_f64(x); }
+		#endif
+
+		// Ops extend the lane traits with: mask, abs, round (to nearest even), xor_sign (flips a where b is negative), lt,
+		// le, mask_and, mask_or, mask_xor, select (m ? a : b), all, pow2 (2^n for integral n in the normal range),
+		// split_exponent (x = m * 2^e with m in [1, 2) for positive normal x) and rsqrt_estimate, rcp_estimate (1 / sqrt(x)
+		// and 1 / x with estimate_bits correct bits for x in the estimate range)
+		template<class T>
+		struct scalar_math_ops {
+			using value_type							= T;
+			using reg									= T;
+			using mask									= bool;
+			static _MSTD_CONSTEXPR17 const size_t width = 1;
+			#if _MSTD_HAS_SSE2 || _MSTD_HAS_NEON
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = std::is_same_v<T, float> || std::is_same_v<T, double>
+																	  ? scalar_estimate_bits
+																	  : std::numeric_limits<T>::digits;
+			#else
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = std::numeric_limits<T>::digits;
+			#endif
+
+			static reg load(const T* src) noexcept { return *src; }
+
+			static void store(T* dst, reg value) noexcept { *dst = value; }
+
+			static reg set1(T value) noexcept { return value; }
+
+			static reg add(reg a, reg b) noexcept { return a + b; }
+
+			static reg sub(reg a, reg b) noexcept { return a - b; }
+
+			static reg mul(reg a, reg b) noexcept { return a * b; }
+
+			static reg div(reg a, reg b) noexcept { return a / b; }
+
+			static reg min(reg a, reg b) noexcept { return std::min(a, b); }
+
+			static reg max(reg a, reg b) noexcept { return std::max(a, b); }
+
+			static reg fma(reg a, reg b, reg c) noexcept { return a * b + c; }
+
+			static reg abs(reg a) noexcept { return std::abs(a); }
+
+			static reg round(reg a) noexcept { return std::nearbyint(a); }
+
+			static reg xor_sign(reg a, reg b) noexcept { return std::signbit(b) ? -a : a; }
+
+			static mask lt(reg a, reg b) noexcept { return a < b; }
+
+			static mask le(reg a, reg b) noexcept { return a <= b; }
+
+			static mask mask_and(mask a, mask b) noexcept { return a && b; }
+
+			static mask mask_or(mask a, mask b) noexcept { return a || b; }
+
+			static mask mask_xor(mask a, mask b) noexcept { return a != b; }
+
+			static reg select(mask m, reg a, reg b) noexcept { return m ? a : b; }
+
+			static bool all(mask m) noexcept { return m; }
+
+			static reg pow2(reg n) noexcept { return std::ldexp(static_cast<T>(1), static_cast<int>(n)); }
+
+			static reg split_exponent(reg x, reg& e) noexcept {
+				int exponent = 0;
+				const T m	 = std::frexp(x, &exponent);
+				e			 = static_cast<T>(exponent - 1);
+				return m * static_cast<T>(2);
+			}
+
+			// exact where there is no estimate instruction for T
+			static reg rsqrt_estimate(reg a) noexcept {
+			#if _MSTD_HAS_SSE2 || _MSTD_HAS_NEON
+					if _MSTD_CONSTEXPR17 (estimate_bits != std::numeric_limits<T>::digits) {
+						return scalar_rsqrt_estimate(a);
+					}
+					else { return static_cast<T>(1) / std::sqrt(a); }
+			#else
+				return static_cast<T>(1) / std::sqrt(a);
+			#endif
+			}
+
+			static reg rcp_estimate(reg a) noexcept {
+			#if _MSTD_HAS_SSE2 || _MSTD_HAS_NEON
+					if _MSTD_CONSTEXPR17 (estimate_bits != std::numeric_limits<T>::digits) { return scalar_rcp_estimate(a); }
+					else { return static_cast<T>(1) / a; }
+			#else
+				return static_cast<T>(1) / a;
+			#endif
+			}
+		};
+
+		#if _MSTD_HAS_AVX
+		struct avx_float_math_ops : avx_float_traits {
+			using mask = __m256;
+			#if _MSTD_HAS_AVX512VL
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = 14;
+			#else
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = 11;
+			#endif
+
+			static reg abs(reg a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a); }
+
+			static reg round(reg a) noexcept { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+			static reg xor_sign(reg a, reg b) noexcept { return _mm256_xor_ps(a, _mm256_and_ps(b, _mm256_set1_ps(-0.f))); }
+
+			static mask lt(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+
+			static mask le(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+
+			static mask mask_and(mask a, mask b) noexcept { return _mm256_and_ps(a, b); }
+
+			static mask mask_or(mask a, mask b) noexcept { return _mm256_or_ps(a, b); }
+
+			static mask mask_xor(mask a, mask b) noexcept { return _mm256_xor_ps(a, b); }
+
+			static reg select(mask m, reg a, reg b) noexcept { return _mm256_blendv_ps(b, a, m); }
+
+			static bool all(mask m) noexcept { return _mm256_movemask_ps(m) == 0xFF; }
+
+			static reg pow2(reg n) noexcept {
+				const __m256i k = _mm256_cvtps_epi32(n);
+			#if _MSTD_HAS_AVX2
+				return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(k, _mm256_set1_epi32(127)), 23));
+			#else
+				// AVX without AVX2 has no 256 bit integer arithmetic, the exponent bits are built in two halves
+				const __m128i bias = _mm_set1_epi32(127);
+				const __m128i lo   = _mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(k), bias), 23);
+				const __m128i hi   = _mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(k, 1), bias), 23);
+				return _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+			#endif
+			}
+
+			static reg split_exponent(reg x, reg& e) noexcept {
+				const __m256i bits = _mm256_castps_si256(x);
+			#if _MSTD_HAS_AVX2
+				e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+			#else
+				const __m128i bias = _mm_set1_epi32(127);
+				const __m128i lo   = _mm_sub_epi32(_mm_srli_epi32(_mm256_castsi256_si128(bits), 23), bias);
+				const __m128i hi   = _mm_sub_epi32(_mm_srli_epi32(_mm256_extractf128_si256(bits, 1), 23), bias);
+				e				   = _mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+			#endif
+				return _mm256_or_ps(_mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF))), _mm256_set1_ps(1.f));
+			}
+
+			static reg rsqrt_estimate(reg a) noexcept {
+			#if _MSTD_HAS_AVX512VL
+				return _mm256_rsqrt14_ps(a);
+			#else
+				return _mm256_rsqrt_ps(a);
+			#endif
+			}
+
+			static reg rcp_estimate(reg a) noexcept {
+			#if _MSTD_HAS_AVX512VL
+				return _mm256_rcp14_ps(a);
+			#else
+				return _mm256_rcp_ps(a);
+			#endif
+			}
+		};
+
+		struct avx_double_math_ops : avx_double_traits {
+			using mask = __m256d;
+			#if _MSTD_HAS_AVX512VL
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = 14;
+			#else
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = 11;
+			#endif
+
+			static reg abs(reg a) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+
+			static reg round(reg a) noexcept { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+			static reg xor_sign(reg a, reg b) noexcept { return _mm256_xor_pd(a, _mm256_and_pd(b, _mm256_set1_pd(-0.0))); }
+
+			static mask lt(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+
+			static mask le(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+
+			static mask mask_and(mask a, mask b) noexcept { return _mm256_and_pd(a, b); }
+
+			static mask mask_or(mask a, mask b) noexcept { return _mm256_or_pd(a, b); }
+
+			static mask mask_xor(mask a, mask b) noexcept { return _mm256_xor_pd(a, b); }
+
+			static reg select(mask m, reg a, reg b) noexcept { return _mm256_blendv_pd(b, a, m); }
+
+			static bool all(mask m) noexcept { return _mm256_movemask_pd(m) == 0xF; }
+
+			static reg pow2(reg n) noexcept {
+				const __m128i biased = _mm_add_epi32(_mm256_cvtpd_epi32(n), _mm_set1_epi32(1023));
+				const __m128i zero	 = _mm_setzero_si128();
+				const __m128i lo	 = _mm_slli_epi64(_mm_unpacklo_epi32(biased, zero), 52);
+				const __m128i hi	 = _mm_slli_epi64(_mm_unpackhi_epi32(biased, zero), 52);
+				return _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+			}
+
+			static reg split_exponent(reg x, reg& e) noexcept {
+				// the biased exponent becomes a double by placing it in the mantissa of 2^52
+				const __m256i bits = _mm256_castpd_si256(x);
+				const __m128i lo   = _mm_srli_epi64(_mm256_castsi256_si128(bits), 52);
+				const __m128i hi   = _mm_srli_epi64(_mm256_extractf128_si256(bits, 1), 52);
+				const reg biased = _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+				e = _mm256_sub_pd(_mm256_or_pd(biased, _mm256_set1_pd(0x1p52)), _mm256_set1_pd(0x1p52 + 1023.0));
+				return _mm256_or_pd(_mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFF))),
+				  _mm256_set1_pd(1.0));
+			}
+
+			// without AVX-512 there is no double estimate, the float one is widened
+			static reg rsqrt_estimate(reg a) noexcept {
+			#if _MSTD_HAS_AVX512VL
+				return _mm256_rsqrt14_pd(a);
+			#else
+				return _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(a)));
+			#endif
+			}
+
+			static reg rcp_estimate(reg a) noexcept {
+			#if _MSTD_HAS_AVX512VL
+				return _mm256_rcp14_pd(a);
+			#else
+				return _mm256_cvtps_pd(_mm_rcp_ps(_mm256_cvtpd_ps(a)));
+			#endif
+			}
+		};
+		#elif _MSTD_HAS_SSE2
+		struct sse_float_math_ops : sse_float_traits {
+			using mask											= __m128;
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = 11;
+
+			static reg abs(reg a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+
+			static reg round(reg a) noexcept {
+			#if _MSTD_HAS_SSE41
+				return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+			#else
+				// adding and removing 1.5 * 2^23 rounds to nearest even for |a| < 2^22, which covers every reduction here
+				const reg magic = _mm_set1_ps(12582912.f);
+				return _mm_sub_ps(_mm_add_ps(a, magic), magic);
+			#endif
+			}
+
+			static reg xor_sign(reg a, reg b) noexcept { return _mm_xor_ps(a, _mm_and_ps(b, _mm_set1_ps(-0.f))); }
+
+			static mask lt(reg a, reg b) noexcept { return _mm_cmplt_ps(a, b); }
+
+			static mask le(reg a, reg b) noexcept { return _mm_cmple_ps(a, b); }
+
+			static mask mask_and(mask a, mask b) noexcept { return _mm_and_ps(a, b); }
+
+			static mask mask_or(mask a, mask b) noexcept { return _mm_or_ps(a, b); }
+
+			static mask mask_xor(mask a, mask b) noexcept { return _mm_xor_ps(a, b); }
+
+			static reg select(mask m, reg a, reg b) noexcept { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+			static bool all(mask m) noexcept { return _mm_movemask_ps(m) == 0xF; }
+
+			static reg pow2(reg n) noexcept {
+				return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23));
+			}
+
+			static reg split_exponent(reg x, reg& e) noexcept {
+				const __m128i bits = _mm_castps_si128(x);
+				e				   = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+				return _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(1.f));
+			}
+
+			static reg rsqrt_estimate(reg a) noexcept { return _mm_rsqrt_ps(a); }
+
+			static reg rcp_estimate(reg a) noexcept { return _mm_rcp_ps(a); }
+		};
+
+		struct sse_double_math_ops : sse_double_traits {
+			using mask											= __m128d;
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = 11;
+
+			static reg abs(reg a) noexcept { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+
+			static reg round(reg a) noexcept {
+			#if _MSTD_HAS_SSE41
+				return _mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+			#else
+				// adding and removing 1.5 * 2^52 rounds to nearest even for |a| < 2^51
+				const reg magic = _mm_set1_pd(6755399441055744.0);
+				return _mm_sub_pd(_mm_add_pd(a, magic), magic);
+			#endif
+			}
+
+			static reg xor_sign(reg a, reg b) noexcept { return _mm_xor_pd(a, _mm_and_pd(b, _mm_set1_pd(-0.0))); }
+
+			static mask lt(reg a, reg b) noexcept { return _mm_cmplt_pd(a, b); }
+
+			static mask le(reg a, reg b) noexcept { return _mm_cmple_pd(a, b); }
+
+			static mask mask_and(mask a, mask b) noexcept { return _mm_and_pd(a, b); }
+
+			static mask mask_or(mask a, mask b) noexcept { return _mm_or_pd(a, b); }
+
+			static mask mask_xor(mask a, mask b) noexcept { return _mm_xor_pd(a, b); }
+
+			static reg select(mask m, reg a, reg b) noexcept { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+
+			static bool all(mask m) noexcept { return _mm_movemask_pd(m) == 0x3; }
+
+			static reg pow2(reg n) noexcept {
+				const __m128i biased = _mm_add_epi32(_mm_cvtpd_epi32(n), _mm_set1_epi32(1023));
+				return _mm_castsi128_pd(_mm_slli_epi64(_mm_unpacklo_epi32(biased, _mm_setzero_si128()), 52));
+			}
+
+			static reg split_exponent(reg x, reg& e) noexcept {
+				// the biased exponent becomes a double by placing it in the mantissa of 2^52
+				const reg biased = _mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(x), 52));
+				e				 = _mm_sub_pd(_mm_or_pd(biased, _mm_set1_pd(0x1p52)), _mm_set1_pd(0x1p52 + 1023.0));
+				return _mm_or_pd(_mm_and_pd(x, _mm_castsi128_pd(_mm_set1_epi64x(0x000FFFFFFFFFFFFF))), _mm_set1_pd(1.0));
+			}
+
+			// the float estimate widened, the upper two float lanes are unused
+			static reg rsqrt_estimate(reg a) noexcept { return _mm_cvtps_pd(_mm_rsqrt_ps(_mm_cvtpd_ps(a))); }
+
+			static reg rcp_estimate(reg a) noexcept { return _mm_cvtps_pd(_mm_rcp_ps(_mm_cvtpd_ps(a))); }
+		};
+		#elif _MSTD_HAS_NEON
+		struct neon_float_math_ops : neon_float_traits {
+			using mask											= uint32x4_t;
+			static _MSTD_CONSTEXPR17 const size_t estimate_bits = 8;
+
+			static reg abs(reg a) noexcept { return vabsq_f32(a); }
+
+			static reg round(reg a) noexcept { return vrndnq_f32(a); }
+
+			static reg xor_sign(reg a, reg b) noexcept {
+				return vreinterpretq_f32_u32(
+				  veorq_u32(vreinterpretq_u32_f32(a), vandq_u32(vreinterpretq_u32_f32(b), vdupq_n_u32(0x80000000))));
+			}
+
+			static mask lt(reg a, reg b) noexcept { return vcltq_f32(a, b); }
+
+			static mask le(reg a, reg b) noexcept { return vcleq_f32(a, b); }
+
+			static mask mask_and(mask a, mask b) noexcept { return vandq_u32(a, b); }
+
+			static mask mask_or(mask a, mask b) noexcept { return vorrq_u32(a, b); }
+
+			static mask mask_xor(mask a, mask b) noexcept { return veorq_u32(a, b); }
+
+			static reg select(mask m, reg a, reg b) noexcept { return vbslq_f32(m, a, b); }
+
+			static bool all(mask m) noexcept { return vminvq_u32(m) != 0; }
+
+			static reg pow2(reg n) noexcept {
+				return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtnq_s32_f32(n), vdupq_n_s32(127)), 23));
+			}
+
+			static reg split_exponent(reg x, reg& e) noexcept {
+				const int32x4_t bits = vreinterpretq_s32_f32(x);
+				e					 = vcvtq_f32_s32(vsubq_s32(vshrq_n_s32(bits, 23), vdupq_n_s32(127)));
+				return vreinterpretq_f32_s32(
+				  vorrq_s32(vandq_s32(bits, vdupq_n_s32(0x007FFFFF)), vreinterpretq_s32_f32(vdupq_n_f32(1.f))));
+			}
+
+			static reg rsqrt_estimate(reg a) noexcept { return vrsqrteq_f32(a); }
+
+			static reg rcp_estimate(reg a) noexcept { return vrecpeq_f32(a); }
+		};
+		#endif
+
+		#pragma endregion // MATH_OPS
+
+		#pragma region MATH_ALGORITHMS
+
+		// Newton-Raphson steps that take an estimate with bits correct bits to at least target bits, every step doubles
+		// the correct bits minus one
+		_MSTD_CONSTEXPR17 size_t newton_steps(size_t bits, size_t target) noexcept {
+			size_t steps = 0;
+				for (; bits < target; bits = 2 * bits - 1) { ++steps; }
+			return steps;
+		}
+
+		// every function returns false without touching res when a lane is outside its domain
+		template<class Ops, math_precision Precision>
+		struct math_algorithms {
+		private:
+			using T	   = typename Ops::value_type;
+			using reg  = typename Ops::reg;
+			using mask = typename Ops::mask;
+			using _c   = math_coefficients<T, Precision>;
+
+			static reg _set(T value) noexcept { return Ops::set1(value); }
+
+			template<size_t N>
+			static reg _poly(reg x, const T (&coefficients)[N]) noexcept {
+				reg res = _set(coefficients[0]);
+					for (size_t i = 1; i != N; ++i) { res = Ops::fma(res, x, _set(coefficients[i])); }
+				return res;
+			}
+
+			static reg _floor(reg a) noexcept {
+				const reg rounded = Ops::round(a);
+				return Ops::select(Ops::lt(a, rounded), Ops::sub(rounded, _set(static_cast<T>(1))), rounded);
+			}
+
+			// |x| = k * pi / 2 + r with |r| <= pi / 4, odd and second are bit 0 and bit 1 of k
+			static reg _reduce_half_pi(reg ax, mask& odd, mask& second) noexcept {
+				const reg k		  = Ops::round(Ops::mul(ax, _set(_c::two_over_pi)));
+				const reg minusK  = Ops::sub(_set(static_cast<T>(0)), k);
+				reg r			  = ax;
+					for (const T part : _c::half_pi) { r = Ops::fma(minusK, _set(part), r); }
+
+				const reg half	  = _floor(Ops::mul(k, _set(static_cast<T>(0.5))));
+				const reg quarter = _floor(Ops::mul(half, _set(static_cast<T>(0.5))));
+				odd				  = Ops::lt(_set(static_cast<T>(0.5)), Ops::sub(k, Ops::add(half, half)));
+				second			  = Ops::lt(_set(static_cast<T>(0.5)), Ops::sub(half, Ops::add(quarter, quarter)));
+				return r;
+			}
+
+			static reg _sin_kernel(reg r, reg z) noexcept { return Ops::fma(Ops::mul(r, z), _poly(z, _c::sin), r); }
+
+			static reg _cos_kernel(reg z) noexcept {
+				const reg tail = Ops::fma(Ops::mul(z, z), _poly(z, _c::cos), Ops::mul(z, _set(static_cast<T>(-0.5))));
+				return Ops::add(tail, _set(static_cast<T>(1)));
+			}
+
+			static reg _negate_if(mask m, reg a) noexcept {
+				return Ops::select(m, Ops::sub(_set(static_cast<T>(0)), a), a);
+			}
+
+			static mask _trig_domain(reg ax) noexcept { return Ops::le(ax, _set(_c::trig_limit)); }
+
+			static mask _exp_domain(reg x) noexcept {
+				return Ops::mask_and(Ops::le(_set(_c::exp_min), x), Ops::le(x, _set(_c::exp_max)));
+			}
+
+			static mask _log_domain(reg x) noexcept {
+				return Ops::mask_and(Ops::le(_set(_c::min_normal), x), Ops::le(x, _set(_c::max)));
+			}
+
+			static mask _estimate_domain(reg ax) noexcept {
+				return Ops::mask_and(Ops::le(_set(_c::estimate_min), ax), Ops::lt(ax, _set(_c::estimate_max)));
+			}
+
+			// fast stops a quarter of the mantissa short of precise
+			static _MSTD_CONSTEXPR17 const size_t _estimate_steps = newton_steps(Ops::estimate_bits,
+			  Precision == math_precision::precise ? std::numeric_limits<T>::digits
+												   : std::numeric_limits<T>::digits - std::numeric_limits<T>::digits / 4);
+
+			static reg _exp(reg x) noexcept {
+				const reg k		 = Ops::round(Ops::mul(x, _set(_c::log2e)));
+				const reg minusK = Ops::sub(_set(static_cast<T>(0)), k);
+				reg r			 = Ops::fma(minusK, _set(_c::ln2[0]), x);
+				r				 = Ops::fma(minusK, _set(_c::ln2[1]), r);
+				const reg p		 = Ops::add(Ops::fma(Ops::mul(r, r), _poly(r, _c::exp), r), _set(static_cast<T>(1)));
+				return Ops::mul(p, Ops::pow2(k));
+			}
+
+			static reg _log(reg x) noexcept {
+				reg e		   = x;
+				reg m		   = Ops::split_exponent(x, e);
+				const mask big = Ops::lt(_set(_c::sqrt2), m);
+				m			   = Ops::select(big, Ops::mul(m, _set(static_cast<T>(0.5))), m);
+				e			   = Ops::select(big, Ops::add(e, _set(static_cast<T>(1))), e);
+
+				const reg f	   = Ops::sub(m, _set(static_cast<T>(1)));
+				const reg s	   = Ops::div(f, Ops::add(m, _set(static_cast<T>(1))));
+				const reg z	   = Ops::mul(s, s);
+				const reg logM = Ops::sub(f, Ops::mul(s, Ops::sub(f, Ops::mul(Ops::add(z, z), _poly(z, _c::log)))));
+				return Ops::fma(e, _set(_c::ln2[0]), Ops::fma(e, _set(_c::ln2[1]), logM));
+			}
+
+		public:
+			static bool sin(reg x, reg& res) noexcept {
+				const reg ax = Ops::abs(x);
+					if (!Ops::all(_trig_domain(ax))) { return false; }
+				mask odd;
+				mask second;
+				const reg r = _reduce_half_pi(ax, odd, second);
+				const reg z = Ops::mul(r, r);
+				res			= Ops::xor_sign(_negate_if(second, Ops::select(odd, _cos_kernel(z), _sin_kernel(r, z))), x);
+				return true;
+			}
+
+			static bool cos(reg x, reg& res) noexcept {
+				const reg ax = Ops::abs(x);
+					if (!Ops::all(_trig_domain(ax))) { return false; }
+				mask odd;
+				mask second;
+				const reg r = _reduce_half_pi(ax, odd, second);
+				const reg z = Ops::mul(r, r);
+				res = _negate_if(Ops::mask_xor(odd, second), Ops::select(odd, _sin_kernel(r, z), _cos_kernel(z)));
+				return true;
+			}
+
+			static bool sincos(reg x, reg& sinRes, reg& cosRes) noexcept {
+				const reg ax = Ops::abs(x);
+					if (!Ops::all(_trig_domain(ax))) { return false; }
+				mask odd;
+				mask second;
+				const reg r	   = _reduce_half_pi(ax, odd, second);
+				const reg z	   = Ops::mul(r, r);
+				const reg sinR = _sin_kernel(r, z);
+				const reg cosR = _cos_kernel(z);
+				sinRes		   = Ops::xor_sign(_negate_if(second, Ops::select(odd, cosR, sinR)), x);
+				cosRes		   = _negate_if(Ops::mask_xor(odd, second), Ops::select(odd, sinR, cosR));
+				return true;
+			}
+
+			static bool tan(reg x, reg& res) noexcept {
+				const reg ax = Ops::abs(x);
+					if (!Ops::all(_trig_domain(ax))) { return false; }
+				mask odd;
+				mask second;
+				const reg r	   = _reduce_half_pi(ax, odd, second);
+				const reg z	   = Ops::mul(r, r);
+				const reg sinR = _sin_kernel(r, z);
+				const reg cosR = _cos_kernel(z);
+				// tan(r + pi / 2) = -cos(r) / sin(r)
+				const reg quotient = Ops::div(Ops::select(odd, cosR, sinR), Ops::select(odd, sinR, cosR));
+				res				   = Ops::xor_sign(_negate_if(odd, quotient), x);
+				return true;
+			}
+
+			static bool atan2(reg y, reg x, reg& res) noexcept {
+				const reg ax  = Ops::abs(x);
+				const reg ay  = Ops::abs(y);
+				const reg big = Ops::max(ax, ay);
+				const mask domain
+				  = Ops::mask_and(Ops::mask_and(Ops::le(ax, _set(_c::max)), Ops::le(ay, _set(_c::max))),
+					Ops::lt(_set(static_cast<T>(0)), big));
+					if (!Ops::all(domain)) { return false; }
+
+				// atan(a) for a = min / max in [0, 1], moved next to the closest reduction point
+				const reg a = Ops::div(Ops::min(ax, ay), big);
+				reg c		= _set(static_cast<T>(0));
+				reg atanHi	= c;
+				reg atanLo	= c;
+					for (const atan_point<T>& point : _c::atan_points) {
+						const mask above = Ops::lt(_set(point.from), a);
+						c				 = Ops::select(above, _set(point.c), c);
+						atanHi			 = Ops::select(above, _set(point.atanHi), atanHi);
+						atanLo			 = Ops::select(above, _set(point.atanLo), atanLo);
+					}
+				const reg t = Ops::div(Ops::sub(a, c), Ops::fma(a, c, _set(static_cast<T>(1))));
+				const reg z = Ops::mul(t, t);
+				reg angle	= Ops::add(atanHi, Ops::add(t, Ops::fma(Ops::mul(t, z), _poly(z, _c::atan), atanLo)));
+
+				// atan(1 / a) = pi / 2 - atan(a), atan2(y, -x) = pi - atan2(y, x)
+				angle = Ops::select(Ops::lt(ax, ay), Ops::sub(_set(_c::half_pi_hi), Ops::sub(angle, _set(_c::half_pi_lo))),
+				  angle);
+				angle = Ops::select(Ops::lt(x, _set(static_cast<T>(0))),
+				  Ops::sub(_set(_c::pi_hi), Ops::sub(angle, _set(_c::pi_lo))), angle);
+				res	  = Ops::xor_sign(angle, y);
+				return true;
+			}
+
+			static bool exp(reg x, reg& res) noexcept {
+					if (!Ops::all(_exp_domain(x))) { return false; }
+				res = _exp(x);
+				return true;
+			}
+
+			static bool log(reg x, reg& res) noexcept {
+					if (!Ops::all(_log_domain(x))) { return false; }
+				res = _log(x);
+				return true;
+			}
+
+			static bool pow(reg x, reg y, reg& res) noexcept {
+					if (!Ops::all(Ops::mask_and(_log_domain(x), Ops::le(Ops::abs(y), _set(_c::max))))) { return false; }
+				const reg exponent = Ops::mul(y, _log(x));
+					if (!Ops::all(_exp_domain(exponent))) { return false; }
+				res = _exp(exponent);
+				return true;
+			}
+
+			static bool rsqrt(reg x, reg& res) noexcept {
+					if (!Ops::all(_estimate_domain(x))) { return false; }
+				const reg minusX = Ops::sub(_set(static_cast<T>(0)), x);
+				reg y			 = Ops::rsqrt_estimate(x);
+					for (size_t i = 0; i != _estimate_steps; ++i) {
+						// y += y / 2 * (1 - x * y^2)
+						const reg e = Ops::fma(Ops::mul(minusX, y), y, _set(static_cast<T>(1)));
+						y			= Ops::fma(Ops::mul(y, _set(static_cast<T>(0.5))), e, y);
+					}
+				res = y;
+				return true;
+			}
+
+			static bool rcp(reg x, reg& res) noexcept {
+					if (!Ops::all(_estimate_domain(Ops::abs(x)))) { return false; }
+				const reg minusX = Ops::sub(_set(static_cast<T>(0)), x);
+				reg y			 = Ops::rcp_estimate(x);
+					for (size_t i = 0; i != _estimate_steps; ++i) {
+						// y += y * (1 - x * y)
+						y = Ops::fma(y, Ops::fma(minusX, y, _set(static_cast<T>(1))), y);
+					}
+				res = y;
+				return true;
+			}
+		};
+
+		#pragma endregion // MATH_ALGORITHMS
+
+		#pragma region MATH_KERNELS
+
+		// below this many elements per thread starting a thread costs more than it saves
+		static _MSTD_CONSTEXPR17 const size_t math_min_chunk = 16384;
+
+		template<class Ops>
+		struct batch_math_kernels {
+		private:
+			using T	  = typename Ops::value_type;
+			using reg = typename Ops::reg;
+
+			template<math_precision Precision>
+			using _algorithms = math_algorithms<Ops, Precision>;
+
+			// block(x, res) computes one register and returns false when a lane is outside the domain, fallback(x, res)
+			// computes one element with <cmath>
+			template<size_t In, size_t Out, class Block, class Fallback>
+			static void _run_block(const T* const (&src)[In], T* const (&dst)[Out], size_t offset, const Block& block,
+			  const Fallback& fallback) noexcept {
+				reg x[In];
+				reg res[Out];
+					for (size_t i = 0; i != In; ++i) { x[i] = Ops::load(src[i] + offset); }
+					if (block(x, res)) {
+							for (size_t i = 0; i != Out; ++i) { Ops::store(dst[i] + offset, res[i]); }
+						return;
+					}
+
+					for (size_t lane = offset; lane != offset + Ops::width; ++lane) {
+						T laneX[In];
+						T laneRes[Out];
+							for (size_t i = 0; i != In; ++i) { laneX[i] = src[i][lane]; }
+						fallback(laneX, laneRes);
+							for (size_t i = 0; i != Out; ++i) { dst[i][lane] = laneRes[i]; }
+					}
+			}
+
+			// the tail is padded into a full register, so every element goes through the same code whatever its position
+			template<size_t In, size_t Out, class Block, class Fallback>
+			static void _run(const T* const (&src)[In], T* const (&dst)[Out], size_t count, const Block& block,
+			  const Fallback& fallback) noexcept {
+				size_t i = 0;
+					for (; i + Ops::width <= count; i += Ops::width) { _run_block(src, dst, i, block, fallback); }
+					if (i == count) { return; }
+
+				T tailX[In][Ops::width];
+				T tailRes[Out][Ops::width];
+				const T* tailSrc[In];
+				T* tailDst[Out];
+					for (size_t j = 0; j != In; ++j) {
+						std::fill_n(tailX[j], Ops::width, static_cast<T>(1));
+						std::copy(src[j] + i, src[j] + count, tailX[j]);
+						tailSrc[j] = tailX[j];
+					}
+					for (size_t j = 0; j != Out; ++j) { tailDst[j] = tailRes[j]; }
+				_run_block(tailSrc, tailDst, 0, block, fallback);
+					for (size_t j = 0; j != Out; ++j) { std::copy_n(tailRes[j], count - i, dst[j] + i); }
+			}
+
+		public:
+			template<math_precision Precision>
+			static void sin(const T* src, T* dst, size_t count) noexcept {
+				_run<1, 1>({ src }, { dst }, count, [](const reg (&x)[1], reg (&res)[1]) {
+					return _algorithms<Precision>::sin(x[0], res[0]);
+				}, [](const T (&x)[1], T (&res)[1]) { res[0] = std::sin(x[0]); });
+			}
+
+			template<math_precision Precision>
+			static void cos(const T* src, T* dst, size_t count) noexcept {
+				_run<1, 1>({ src }, { dst }, count, [](const reg (&x)[1], reg (&res)[1]) {
+					return _algorithms<Precision>::cos(x[0], res[0]);
+				}, [](const T (&x)[1], T (&res)[1]) { res[0] = std::cos(x[0]); });
+			}
+
+			template<math_precision Precision>
+			static void sincos(const T* src, T* sinDst, T* cosDst, size_t count) noexcept {
+				_run<1, 2>({ src }, { sinDst, cosDst }, count, [](const reg (&x)[1], reg (&res)[2]) {
+					return _algorithms<Precision>::sincos(x[0], res[0], res[1]);
+				}, [](const T (&x)[1], T (&res)[2]) {
+					res[0] = std::sin(x[0]);
+					res[1] = std::cos(x[0]);
+				});
+			}
+
+			template<math_precision Precision>
+			static void tan(const T* src, T* dst, size_t count) noexcept {
+				_run<1, 1>({ src }, { dst }, count, [](const reg (&x)[1], reg (&res)[1]) {
+					return _algorithms<Precision>::tan(x[0], res[0]);
+				}, [](const T (&x)[1], T (&res)[1]) { res[0] = std::tan(x[0]); });
+			}
+
+			template<math_precision Precision>
+			static void atan2(const T* y, const T* x, T* dst, size_t count) noexcept {
+				_run<2, 1>({ y, x }, { dst }, count, [](const reg (&args)[2], reg (&res)[1]) {
+					return _algorithms<Precision>::atan2(args[0], args[1], res[0]);
+				}, [](const T (&args)[2], T (&res)[1]) { res[0] = std::atan2(args[0], args[1]); });
+			}
+
+			template<math_precision Precision>
+			static void exp(const T* src, T* dst, size_t count) noexcept {
+				_run<1, 1>({ src }, { dst }, count, [](const reg (&x)[1], reg (&res)[1]) {
+					return _algorithms<Precision>::exp(x[0], res[0]);
+				}, [](const T (&x)[1], T (&res)[1]) { res[0] = std::exp(x[0]); });
+			}
+
+			template<math_precision Precision>
+			static void log(const T* src, T* dst, size_t count) noexcept {
+				_run<1, 1>({ src }, { dst }, count, [](const reg (&x)[1], reg (&res)[1]) {
+					return _algorithms<Precision>::log(x[0], res[0]);
+				}, [](const T (&x)[1], T (&res)[1]) { res[0] = std::log(x[0]); });
+			}
+
+			template<math_precision Precision>
+			static void pow(const T* x, const T* y, T* dst, size_t count) noexcept {
+					if _MSTD_CONSTEXPR17 (std::is_same_v<T, float> && Precision == math_precision::precise) {
+						_pow_in_double(x, y, dst, count);
+					}
+					else {
+						_run<2, 1>({ x, y }, { dst }, count, [](const reg (&args)[2], reg (&res)[1]) {
+							return _algorithms<Precision>::pow(args[0], args[1], res[0]);
+						}, [](const T (&args)[2], T (&res)[1]) { res[0] = std::pow(args[0], args[1]); });
+					}
+			}
+
+			template<math_precision Precision>
+			static void pow(const T* x, T y, T* dst, size_t count) noexcept {
+					if _MSTD_CONSTEXPR17 (std::is_same_v<T, float> && Precision == math_precision::precise) {
+						_pow_in_double(x, y, dst, count);
+					}
+					else {
+						const reg exponent = Ops::set1(y);
+						_run<1, 1>({ x }, { dst }, count, [exponent](const reg (&args)[1], reg (&res)[1]) {
+							return _algorithms<Precision>::pow(args[0], exponent, res[0]);
+						}, [y](const T (&args)[1], T (&res)[1]) { res[0] = std::pow(args[0], y); });
+					}
+			}
+
+			template<math_precision Precision>
+			static void rsqrt(const T* src, T* dst, size_t count) noexcept {
+				_run<1, 1>({ src }, { dst }, count, [](const reg (&x)[1], reg (&res)[1]) {
+					return _algorithms<Precision>::rsqrt(x[0], res[0]);
+				}, [](const T (&x)[1], T (&res)[1]) { res[0] = static_cast<T>(1) / std::sqrt(x[0]); });
+			}
+
+			template<math_precision Precision>
+			static void rcp(const T* src, T* dst, size_t count) noexcept {
+				_run<1, 1>({ src }, { dst }, count, [](const reg (&x)[1], reg (&res)[1]) {
+					return _algorithms<Precision>::rcp(x[0], res[0]);
+				}, [](const T (&x)[1], T (&res)[1]) { res[0] = static_cast<T>(1) / x[0]; });
+			}
+
+		private:
+			// float pow through the double kernels, y * log(x) keeps enough bits there for a single final rounding, Y is
+			// either an array of exponents or a single one
+			template<class Y>
+			static void _pow_in_double(const T* x, const Y& y, T* dst, size_t count) noexcept;
+		};
+
+		template<class T>
+		struct math_kernels : batch_math_kernels<scalar_math_ops<T> > {};
+
+		#if _MSTD_HAS_AVX
+		template<>
+		struct math_kernels<float> : batch_math_kernels<avx_float_math_ops> {};
+
+		template<>
+		struct math_kernels<double> : batch_math_kernels<avx_double_math_ops> {};
+		#elif _MSTD_HAS_SSE2
+		template<>
+		struct math_kernels<float> : batch_math_kernels<sse_float_math_ops> {};
+
+		template<>
+		struct math_kernels<double> : batch_math_kernels<sse_double_math_ops> {};
+		#elif _MSTD_HAS_NEON
+		template<>
+		struct math_kernels<float> : batch_math_kernels<neon_float_math_ops> {};
+		#endif
+
+		template<class Ops>
+		template<class Y>
+		void batch_math_kernels<Ops>::_pow_in_double(const T* x, const Y& y, T* dst, size_t count) noexcept {
+			_MSTD_CONSTEXPR17 const size_t chunk = 64;
+			double xs[chunk];
+			double ys[chunk];
+			double res[chunk];
+				for (size_t first = 0; first < count; first += chunk) {
+					const size_t size = std::min(chunk, count - first);
+					std::copy_n(x + first, size, xs);
+						if _MSTD_CONSTEXPR17 (std::is_pointer_v<Y>) {
+							std::copy_n(y + first, size, ys);
+							math_kernels<double>::template pow<math_precision::precise>(xs, ys, res, size);
+						}
+						else {
+							math_kernels<double>::template pow<math_precision::precise>(xs, static_cast<double>(y), res,
+							  size);
+						}
+					std::copy_n(res, size, dst + first);
+				}
+		}
+
+		#pragma endregion // MATH_KERNELS
+	} // namespace utils
+
+	// Batched elementary functions. dst may be the same buffer as the source, threads > 1 splits large batches across
+	// that many threads (0 uses every hardware thread).
+
+		#pragma region BATCH_MATH
+
+	// dst[i] = sin(src[i])
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void sin(const T* src, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [src, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template sin<Precision>(src + first, dst + first, last - first);
+		});
+	}
+
+	// dst[i] = cos(src[i])
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void cos(const T* src, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [src, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template cos<Precision>(src + first, dst + first, last - first);
+		});
+	}
+
+	// sinDst[i] = sin(src[i]), cosDst[i] = cos(src[i]) with one shared argument reduction
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void sincos(const T* src, T* sinDst, T* cosDst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [src, sinDst, cosDst](size_t first, size_t last) {
+			utils::math_kernels<T>::template sincos<Precision>(src + first, sinDst + first, cosDst + first, last - first);
+		});
+	}
+
+	// dst[i] = tan(src[i])
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void tan(const T* src, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [src, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template tan<Precision>(src + first, dst + first, last - first);
+		});
+	}
+
+	// dst[i] = atan2(y[i], x[i])
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void atan2(const T* y, const T* x, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [y, x, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template atan2<Precision>(y + first, x + first, dst + first, last - first);
+		});
+	}
+
+	// dst[i] = exp(src[i])
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void exp(const T* src, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [src, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template exp<Precision>(src + first, dst + first, last - first);
+		});
+	}
+
+	// dst[i] = log(src[i])
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void log(const T* src, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [src, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template log<Precision>(src + first, dst + first, last - first);
+		});
+	}
+
+	// dst[i] = pow(x[i], y[i])
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void pow(const T* x, const T* y, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [x, y, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template pow<Precision>(x + first, y + first, dst + first, last - first);
+		});
+	}
+
+	// dst[i] = pow(x[i], y)
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void pow(const T* x, const T& y, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [x, y, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template pow<Precision>(x + first, y, dst + first, last - first);
+		});
+	}
+
+	// dst[i] = 1 / sqrt(src[i])
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void rsqrt(const T* src, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [src, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template rsqrt<Precision>(src + first, dst + first, last - first);
+		});
+	}
+
+	// dst[i] = 1 / src[i]
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	void rcp(const T* src, T* dst, size_t count, size_t threads = 1) {
+		utils::parallel_for(count, threads, utils::math_min_chunk, [src, dst](size_t first, size_t last) {
+			utils::math_kernels<T>::template rcp<Precision>(src + first, dst + first, last - first);
+		});
+	}
+
+		#pragma endregion // BATCH_MATH
+
+		#pragma region SCALAR_MATH
+
+	// 1 / sqrt(x) for a single value with the estimate instruction of the scalar unit, same error bounds as the batches
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T rsqrt(const T& x) noexcept {
+			if (_MSTD_IS_CONSTANT_EVALUATED()) { return static_cast<T>(1) / static_cast<T>(sqrt(x)); }
+
+		T res = x;
+			if (utils::math_algorithms<utils::scalar_math_ops<T>, Precision>::rsqrt(x, res)) { return res; }
+		return static_cast<T>(1) / std::sqrt(x);
+	}
+
+	// 1 / x for a single value
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T>
+		#else
+	template<math_precision Precision = math_precision::precise, class T,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 T rcp(const T& x) noexcept {
+			if (_MSTD_IS_CONSTANT_EVALUATED()) { return static_cast<T>(1) / x; }
+
+		T res = x;
+			if (utils::math_algorithms<utils::scalar_math_ops<T>, Precision>::rcp(x, res)) { return res; }
+		return static_cast<T>(1) / x;
+	}
+
+		#pragma endregion // SCALAR_MATH
+} // namespace mstd
+	#endif
+#endif
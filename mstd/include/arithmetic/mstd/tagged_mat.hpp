@@ -0,0 +1,182 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_TAGGED_MAT_HPP_
+	#define _MSTD_TAGGED_MAT_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/mat.hpp>
+		#include <mstd/quat.hpp>
+
+namespace mstd {
+	// square transform matrix together with its transform_type. Factories tag their results, composition keeps the weaker
+	// tag of both sides and inverted() uses the closed form inverse the tag allows
+		#if _MSTD_HAS_CXX20
+	template<size_t N, arithmetic T>
+	requires (N > 2)
+		#else
+	template<size_t N, class T, std::enable_if_t<(N > 2 && std::is_arithmetic_v<T>), bool> >
+		#endif
+	class tagged_mat {
+	public:
+		static _MSTD_CONSTEXPR17 const size_t size = N;
+		using mat_type							   = mat<N, N, T>;
+		using vec_type							   = vec<N, T>;
+		using value_type						   = T;
+
+	private:
+		mat_type _matrix	 = mat_type::identity();
+		transform_type _type = transform_type::rigid;
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 tagged_mat() = default;
+
+		// the caller vouches for the tag, nothing is checked
+		_MSTD_CONSTEXPR20 explicit tagged_mat(const mat_type& matrix, transform_type type = transform_type::general)
+			: _matrix(matrix), _type(type) {}
+
+		_MSTD_CONSTEXPR20 tagged_mat(const tagged_mat& other) = default;
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region DESTRUCTOR
+		_MSTD_CONSTEXPR20 ~tagged_mat() noexcept = default;
+		#pragma endregion // DESTRUCTOR
+
+		#pragma region ASSIGN
+		_MSTD_CONSTEXPR20 tagged_mat& operator=(const tagged_mat& other) = default;
+		#pragma endregion // ASSIGN
+
+		#pragma region PREDEFINED
+
+		static _MSTD_CONSTEXPR20 tagged_mat identity() { return tagged_mat(); }
+
+		static _MSTD_CONSTEXPR20 tagged_mat translation(const vec<N - 1, T>& transVec) {
+			return tagged_mat(mat_type::translation(transVec), transform_type::rigid);
+		}
+
+		static _MSTD_CONSTEXPR20 tagged_mat scale(const vec<N - 1, T>& scaleVec) {
+			return tagged_mat(mat_type::scale(scaleVec), transform_type::affine);
+		}
+
+		// uniform scale of the linear block, unlike mat::scale(T) w keeps 1
+		static _MSTD_CONSTEXPR20 tagged_mat scale(const T& scaleFactor) {
+			return tagged_mat(mat_type::scale(vec<N - 1, T>::fill(scaleFactor)), transform_type::affine);
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 4 && std::is_same_v<Type, value_type>))
+
+		static _MSTD_CONSTEXPR20 tagged_mat rot_x(const T& radians) _MSTD_REQUIRES(N == 4) {
+			return tagged_mat(mat_type::rot_x(radians), transform_type::rigid);
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 4 && std::is_same_v<Type, value_type>))
+
+		static _MSTD_CONSTEXPR20 tagged_mat rot_y(const T& radians) _MSTD_REQUIRES(N == 4) {
+			return tagged_mat(mat_type::rot_y(radians), transform_type::rigid);
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 4 && std::is_same_v<Type, value_type>))
+
+		static _MSTD_CONSTEXPR20 tagged_mat rot_z(const T& radians) _MSTD_REQUIRES(N == 4) {
+			return tagged_mat(mat_type::rot_z(radians), transform_type::rigid);
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 4 && std::is_same_v<Type, value_type>))
+
+		static _MSTD_CONSTEXPR20 tagged_mat rot(const vec<N - 1, T>& axis, const T& radians) _MSTD_REQUIRES(N == 4) {
+			return tagged_mat(mat_type::rot(axis, radians), transform_type::rigid);
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 4 && std::is_same_v<Type, value_type>))
+
+		// expects a unit quaternion
+		static _MSTD_CONSTEXPR20 tagged_mat rot(const quat<T>& quaternion) _MSTD_REQUIRES(N == 4) {
+			return tagged_mat(mat_type::rot(quaternion), transform_type::rigid);
+		}
+
+		// view and look_at do not normalize every basis vector, so they are only known to be affine
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 4 && std::is_same_v<Type, value_type>))
+
+		static _MSTD_CONSTEXPR20 tagged_mat view(const vec<3ull, T>& pos, const vec<3ull, T>& right,
+		  const vec<3ull, T>& forward, const vec<3ull, T>& up) _MSTD_REQUIRES(N == 4) {
+			return tagged_mat(mat_type::view(pos, right, forward, up), transform_type::affine);
+		}
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 4 && std::is_same_v<Type, value_type>))
+
+		static _MSTD_CONSTEXPR20 tagged_mat look_at(const vec<3ull, T>& eyePos, const vec<3ull, T>& lookAtPos,
+		  const vec<3ull, T>& worldUp) _MSTD_REQUIRES(N == 4) {
+			return tagged_mat(mat_type::look_at(eyePos, lookAtPos, worldUp), transform_type::affine);
+		}
+
+		#pragma endregion // PREDEFINED
+
+		#pragma region GETTERS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const mat_type& matrix() const noexcept { return _matrix; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 transform_type type() const noexcept { return _type; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool is_affine() const noexcept { return _type != transform_type::general; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool is_rigid() const noexcept { return _type == transform_type::rigid; }
+
+		_MSTD_CONSTEXPR20 operator const mat_type&() const noexcept { return _matrix; }
+
+		#pragma endregion // GETTERS
+
+		#pragma region OPERATIONS
+
+		// the inverse of an affine (rigid) transform is affine (rigid) as well
+		_MSTD_CONSTEXPR20 tagged_mat inverted() const { return tagged_mat(_matrix.inverted(_type), _type); }
+
+		_MSTD_CONSTEXPR20 tagged_mat& invert() {
+			*this = inverted();
+			return *this;
+		}
+
+		#pragma endregion // OPERATIONS
+
+		#pragma region OPERATORS
+
+		_MSTD_CONSTEXPR20 tagged_mat& operator*=(const tagged_mat& other) {
+			_matrix *= other._matrix;
+			_type	 = std::min(_type, other._type);
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 tagged_mat operator*(const tagged_mat& other) const {
+			tagged_mat res = *this;
+			res			  *= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_type operator*(const vec_type& other) const { return _matrix * other; }
+
+		_MSTD_CONSTEXPR20 bool operator==(const tagged_mat& other) const {
+			return _type == other._type && _matrix == other._matrix;
+		}
+
+		_MSTD_CONSTEXPR20 bool operator!=(const tagged_mat& other) const { return !this->operator==(other); }
+
+		#pragma endregion // OPERATORS
+	};
+} // namespace mstd
+	#endif
+#endif
@@ -21,13 +21,15 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 
 		#include <mstd/arithmetic_types.hpp>
 		#include <mstd/math_functions.hpp>
+		#include <mstd/simd.hpp>
+		#include <mstd/simd_math.hpp>
 
 namespace mstd {
 		#if _MSTD_HAS_CXX20
-	template<size_t N, arithmetic T>
+	template<size_t N, arithmetic_like T>
 	requires (N > 0)
 		#else
-	template<size_t N, class T, std::enable_if_t<(N > 0 && std::is_arithmetic_v<T>), bool> >
+	template<size_t N, class T, std::enable_if_t<(N > 0 && is_arithmetic_like_v<T>), bool> >
 		#endif
 	class vec {
 	public:
@@ -35,11 +37,13 @@ namespace mstd {
 		using value_type						   = T;
 
 	private:
-		T _values[N] = {};
+		using _kernels												   = utils::vec_kernels<N, T>;
+
+		alignas(_kernels::alignment) T _values[_kernels::storage_size] = {};
 
 		#pragma region PRIVATE_METHODS
 		#if _MSTD_HAS_CXX20
-		template<arithmetic... Ts, size_t... Idxs>
+		template<arithmetic_like... Ts, size_t... Idxs>
 		#else
 		template<class... Ts, size_t... Idxs>
 		#endif
@@ -55,7 +59,7 @@ namespace mstd {
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<arithmetic OT>
+		template<arithmetic_like OT>
 		#else
 		template<class OT>
 		#endif
@@ -67,7 +71,7 @@ namespace mstd {
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t TN, arithmetic OT>
+		template<size_t TN, arithmetic_like OT>
 		#else
 		template<size_t TN, class OT>
 		#endif
@@ -81,7 +85,7 @@ namespace mstd {
 		}
 
 		#if _MSTD_HAS_CXX20
-		template<size_t ON, arithmetic OT>
+		template<size_t ON, arithmetic_like OT>
 		requires (ON > 0)
 		#else
 		template<size_t ON, class OT>
@@ -105,68 +109,68 @@ namespace mstd {
 
 			// vecN(x, y, ...)
 		#if _MSTD_HAS_CXX20
-		template<arithmetic... Ts>
+		template<arithmetic_like... Ts>
 		requires (sizeof...(Ts) > 0 && sizeof...(Ts) <= N)
 		#else
 		template<class... Ts,
-		  std::enable_if_t<(sizeof...(Ts) > 0 && sizeof...(Ts) <= N && are_all_v<std::is_arithmetic, Ts...>), bool> = true>
+		  std::enable_if_t<(sizeof...(Ts) > 0 && sizeof...(Ts) <= N && are_all_v<is_arithmetic_like, Ts...>), bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 vec(const Ts&... values) {
 			_set_values<Ts...>(std::index_sequence_for<Ts...>(), values...);
-			_fill_values_from(sizeof...(Ts), 0);
+			_fill_values_from(sizeof...(Ts), T(0));
 		}
 
 			// vecN(vec, z, ...)
 		#if _MSTD_HAS_CXX20
-		template<size_t ON, arithmetic OT, arithmetic... Ts>
+		template<size_t ON, arithmetic_like OT, arithmetic_like... Ts>
 		requires (sizeof...(Ts) > 0 && sizeof...(Ts) <= N - ON && ON < N)
 		#else
 		template<size_t ON, class OT, class... Ts,
-		  std::enable_if_t<(sizeof...(Ts) > 0 && sizeof...(Ts) <= N - ON && ON < N && are_all_v<std::is_arithmetic, OT, Ts...>),
+		  std::enable_if_t<(sizeof...(Ts) > 0 && sizeof...(Ts) <= N - ON && ON < N && are_all_v<is_arithmetic_like, OT, Ts...>),
 			bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 vec(const vec<ON, OT>& other, const Ts&... values) {
 			_copy_values_from(other);
 			_set_values<Ts...>(make_index_sequence_for_from<ON, Ts...>(), values...);
-			_fill_values_from(sizeof...(Ts) + ON, 0);
+			_fill_values_from(sizeof...(Ts) + ON, T(0));
 		}
 
 			// vecN({ 1, 2 })
 		#if _MSTD_HAS_CXX20
-		template<size_t TN, arithmetic OT>
+		template<size_t TN, arithmetic_like OT>
 		#else
-		template<size_t TN, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t TN, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 vec(const OT (&values)[TN]) {
 			_copy_values_from(values);
-			_fill_values_from(TN, 0);
+			_fill_values_from(TN, T(0));
 		}
 
 			// vecN(&table)
 		#if _MSTD_HAS_CXX20
-		template<arithmetic OT>
+		template<arithmetic_like OT>
 		#else
-		template<class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 vec(const OT* values, const size_t& size) {
 			_copy_values_from(values, size);
-			_fill_values_from(size, 0);
+			_fill_values_from(size, T(0));
 		}
 
 			// vecN(vecON)
 		#if _MSTD_HAS_CXX20
-		template<size_t ON, arithmetic OT>
+		template<size_t ON, arithmetic_like OT>
 		#else
 		template<size_t ON, class OT>
 		#endif
 		_MSTD_CONSTEXPR20 vec(const vec<ON, OT>& other) {
 			_copy_values_from(other);
-			_fill_values_from(ON, 0);
+			_fill_values_from(ON, T(0));
 		}
 
 		#pragma region VECTOR_3_CONSTRUCTORS
 		#if _MSTD_HAS_CXX20
-		template<arithmetic AT, arithmetic BT, size_t ON>
+		template<arithmetic_like AT, arithmetic_like BT, size_t ON>
 		requires (ON == 3)
 		#else
 		template<class AT, class BT, size_t ON, std::enable_if_t<(ON == 3), bool> = true>
@@ -183,23 +187,35 @@ namespace mstd {
 
 		#pragma region ASSIGN
 		#if _MSTD_HAS_CXX20
-		template<size_t TN, arithmetic OT>
+		template<size_t TN, arithmetic_like OT>
 		#else
-		template<size_t TN, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t TN, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 vec<N, T>& operator=(const OT (&values)[TN]) {
 			_copy_values_from(values);
-			_fill_values_from(TN, 0);
+			_fill_values_from(TN, T(0));
 			return *this;
 		}
 		#if _MSTD_HAS_CXX20
-		template<size_t ON, arithmetic OT>
+		template<size_t ON, arithmetic_like OT>
 		#else
-		template<size_t ON, class OT, std::enable_if_t<std::is_arithmetic_v<OT>, bool> = true>
+		template<size_t ON, class OT, std::enable_if_t<is_arithmetic_like_v<OT>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 vec<N, T>& operator=(const vec<ON, OT>& other) {
 			_copy_values_from(other);
-			_fill_values_from(ON, 0);
+			_fill_values_from(ON, T(0));
+			return *this;
+		}
+
+		// evaluates a lazy expression (see expr.hpp) straight into this vector, every element is computed in one pass
+		#if _MSTD_HAS_CXX20
+		template<class Expr>
+		requires (utils::is_expr_of_v<Expr, vec<N, T>>)
+		#else
+		template<class Expr, std::enable_if_t<utils::is_expr_of_v<Expr, vec<N, T>>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 vec<N, T>& operator=(const Expr& expr) {
+				for (size_t i = 0; i != N; ++i) { _values[i] = expr(i); }
 			return *this;
 		}
 
@@ -292,11 +308,7 @@ namespace mstd {
 
 		#pragma region VECTOR_OPERATIONS
 
-		_MSTD_CONSTEXPR20 T length() const {
-			T value = static_cast<T>(0);
-				for (size_t i = 0; i != N; ++i) { value += _values[i] * _values[i]; }
-			return static_cast<T>(std::sqrt(value));
-		}
+		_MSTD_CONSTEXPR20 T length() const { return static_cast<T>(sqrt(dot(*this))); }
 
 		_MSTD_CONSTEXPR20 vec<N, T>& normalize() {
 			T len = length();
@@ -310,13 +322,36 @@ namespace mstd {
 			return res.normalize();
 		}
 
-		_MSTD_CONSTEXPR20 T dot(const vec<N, T>& other) const {
-			T res = static_cast<T>(0);
-				for (size_t i = 0; i != N; ++i) { res += _values[i] * other[i]; }
-			return res;
+		// scales by the fast rsqrt of dot instead of dividing by the length, the length of the result is within 4e-7
+		// (float) and 5e-14 (double) of 1. Vectors outside the estimate range (zero, denormal, huge), constant evaluation
+		// and types other than float and double use normalize. It pays off where square roots and divisions are slow,
+		// recent x86 cores divide fast enough that a single normalize is not slower
+		_MSTD_CONSTEXPR20 vec<N, T>& normalize_fast() {
+				if _MSTD_CONSTEXPR17 (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+					T scale = static_cast<T>(0);
+						if (_MSTD_IS_CONSTANT_EVALUATED() ||
+							!utils::math_algorithms<utils::scalar_math_ops<T>, math_precision::fast>::rsqrt(dot(*this),
+							  scale)) {
+							return normalize();
+						}
+					*this *= scale;
+					return *this;
+				}
+				else { return normalize(); }
 		}
 
-		_MSTD_CONSTEXPR20 T angle_between(const vec<N, T>& other) const {
+		_MSTD_CONSTEXPR20 vec<N, T> normalized_fast() const {
+			vec<N, T> res = *this;
+			return res.normalize_fast();
+		}
+
+		_MSTD_CONSTEXPR20 T dot(const vec<N, T>& other) const { return _kernels::dot(_values, other._values); }
+
+		// acos, pow and the other floating point functions need a T converting to it implicitly. fixed does not, its results
+		// would stop being the same on every platform
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
+
+		_MSTD_CONSTEXPR20 T angle_between(const vec<N, T>& other) const _MSTD_REQUIRES((std::is_convertible_v<T, double>)) {
 			T thisLen = length();
 				if (thisLen == static_cast<T>(0)) { return static_cast<T>(0); }
 
@@ -327,8 +362,7 @@ namespace mstd {
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& reflect(const vec<N, T>& normal) noexcept {
-			_MSTD_CONSTEXPR17 const float two = 2.0f;
-			*this -= two * this->dot(normal) * normal;
+			*this -= static_cast<T>(2) * this->dot(normal) * normal;
 			return *this;
 		}
 
@@ -346,7 +380,7 @@ namespace mstd {
 			float cosTheta		   = std::min((-(*this)).dot(normal), 1.0f);
 			vec<N, T> rOutPerp	   = eta * (*this + (cosTheta * normal));
 			float length		   = rOutPerp.length();
-			vec<N, T> rOutParallel = -std::sqrt(std::abs(1.0f - (length * length))) * normal;
+			vec<N, T> rOutParallel = -sqrt(abs(1.0f - (length * length))) * normal;
 			return rOutPerp + rOutParallel;
 		}
 
@@ -390,28 +424,47 @@ namespace mstd {
 			return res.mod(other);
 		}
 
-		_MSTD_CONSTEXPR20 vec<N, T>& pow(const T& y) {
-				for (size_t i = 0; i != N; ++i) { _values[i] = std::pow(_values[i], y); }
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
+
+		_MSTD_CONSTEXPR20 vec<N, T>& pow(const T& y) _MSTD_REQUIRES((std::is_convertible_v<T, double>)) {
+				// the precise float kernel rounds once from double, double keeps std::pow for exact integer powers
+				if _MSTD_CONSTEXPR17 (std::is_same_v<T, float>) {
+					utils::math_kernels<T>::template pow<math_precision::precise>(_values, y, _values, N);
+				}
+				else {
+						for (size_t i = 0; i != N; ++i) { _values[i] = std::pow(_values[i], y); }
+				}
 			return *this;
 		}
 
-		_MSTD_CONSTEXPR20 vec<N, T> powed(const T& y) const {
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
+
+		_MSTD_CONSTEXPR20 vec<N, T> powed(const T& y) const _MSTD_REQUIRES((std::is_convertible_v<T, double>)) {
 			vec<N, T> res = *this;
 			return res.pow(y);
 		}
 
-		_MSTD_CONSTEXPR20 vec<N, T>& pow(const vec<N, T>& other) {
-				for (size_t i = 0; i != N; ++i) { _values[i] = std::pow(_values[i], other[i]); }
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
+
+		_MSTD_CONSTEXPR20 vec<N, T>& pow(const vec<N, T>& other) _MSTD_REQUIRES((std::is_convertible_v<T, double>)) {
+				if _MSTD_CONSTEXPR17 (std::is_same_v<T, float>) {
+					utils::math_kernels<T>::template pow<math_precision::precise>(_values, other._values, _values, N);
+				}
+				else {
+						for (size_t i = 0; i != N; ++i) { _values[i] = std::pow(_values[i], other[i]); }
+				}
 			return *this;
 		}
 
-		_MSTD_CONSTEXPR20 vec<N, T> powed(const vec<N, T>& other) const {
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (std::is_same_v<Type, value_type> && std::is_convertible_v<Type, double>))
+
+		_MSTD_CONSTEXPR20 vec<N, T> powed(const vec<N, T>& other) const _MSTD_REQUIRES((std::is_convertible_v<T, double>)) {
 			vec<N, T> res = *this;
 			return res.pow(other);
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& clamp(const T& minVal, const T& maxVal) {
-				for (size_t i = 0; i != N; ++i) { _values[i] = std::clamp(_values[i], minVal, maxVal); }
+			_kernels::clamp(_values, minVal, maxVal);
 			return *this;
 		}
 
@@ -421,7 +474,7 @@ namespace mstd {
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& clamp(const vec<N, T>& minVal, const vec<N, T>& maxVal) {
-				for (size_t i = 0; i != N; ++i) { _values[i] = std::clamp(_values[i], minVal[i], maxVal[i]); }
+			_kernels::clamp(_values, minVal._values, maxVal._values);
 			return *this;
 		}
 
@@ -461,16 +514,10 @@ namespace mstd {
 		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 3 && std::is_same_v<Type, value_type>))
 
 		_MSTD_CONSTEXPR20 vec<N, T>& rotate(const vec<N, T>& axis, const T& radians) _MSTD_REQUIRES(N == 3) {
-			const quat<T> p(T(0), *this);
-
 			vec<N, T> normAxis = axis;
 				if (!normAxis.is_zero()) { normAxis.normalize(); }
 
-			const quat<T>& q	   = quat<T>::rotation(normAxis, radians);
-
-			const quat<T>& inversQ = q.inverted();
-
-			*this				   = (q * p * inversQ).v;
+			*this = quat<T>::rotation(normAxis, radians).rotate(*this);
 			return *this;
 		}
 		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 3 && std::is_same_v<Type, value_type>))
@@ -486,44 +533,44 @@ namespace mstd {
 		#pragma region OPERATORS
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator+=(const vec<N, T>& other) {
-				for (size_t i = 0; i != N; ++i) { _values[i] += other[i]; }
+			_kernels::add(_values, other._values);
 			return *this;
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator-=(const vec<N, T>& other) {
-				for (size_t i = 0; i != N; ++i) { _values[i] -= other[i]; }
+			_kernels::sub(_values, other._values);
 			return *this;
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator*=(const vec<N, T>& other) {
-				for (size_t i = 0; i != N; ++i) { _values[i] *= other[i]; }
+			_kernels::mul(_values, other._values);
 			return *this;
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator/=(const vec<N, T>& other) {
 				if (other == vec<N, T>::zero()) { return *this; }
-				for (size_t i = 0; i != N; ++i) { _values[i] /= other[i]; }
+			_kernels::div(_values, other._values);
 			return *this;
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator+=(const T& other) {
-				for (size_t i = 0; i != N; ++i) { _values[i] += other; }
+			_kernels::add(_values, other);
 			return *this;
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator-=(const T& other) {
-				for (size_t i = 0; i != N; ++i) { _values[i] -= other; }
+			_kernels::sub(_values, other);
 			return *this;
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator*=(const T& other) {
-				for (size_t i = 0; i != N; ++i) { _values[i] *= other; }
+			_kernels::mul(_values, other);
 			return *this;
 		}
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator/=(const T& other) {
 				if (other == static_cast<T>(0)) { return *this; }
-				for (size_t i = 0; i != N; ++i) { _values[i] /= other; }
+			_kernels::div(_values, other);
 			return *this;
 		}
 
@@ -579,7 +626,7 @@ namespace mstd {
 
 		_MSTD_CONSTEXPR20 vec<N, T> operator+() const { return vec<N, T>(*this); }
 
-		_MSTD_CONSTEXPR20 vec<N, T> operator-() const { return *this * -1; }
+		_MSTD_CONSTEXPR20 vec<N, T> operator-() const { return *this * static_cast<T>(-1); }
 
 		_MSTD_CONSTEXPR20 vec<N, T>& operator++() { return *this += vec<N, T>::one(); }
 
@@ -617,7 +664,8 @@ namespace mstd {
 		friend std::ostream& operator<<(std::ostream& str, const vec<N, T>& vector) {
 			str << "[";
 				for (size_t i = 0; i != N; ++i) {
-					str << std::to_string(vector[i]);
+						if _MSTD_CONSTEXPR17 (std::is_arithmetic_v<T>) { str << std::to_string(vector[i]); }
+						else { str << vector[i]; }
 						if (i != N - 1) { str << ", "; }
 				}
 			return str << "]";
@@ -641,14 +689,14 @@ namespace mstd {
 	template<class T, size_t N>
 	_MSTD_INLINE17 _MSTD_CONSTEXPR20 vec<N, T> max(const vec<N, T>& a, const vec<N, T>& b) noexcept {
 		vec<N, T> res;
-			for (size_t i = 0; i != N; ++i) { res[i] = std::max(a[i], b[i]); }
+		utils::vec_kernels<N, T>::max(&res[0], static_cast<const T*>(a), static_cast<const T*>(b));
 		return res;
 	}
 
 	template<class T, size_t N>
 	_MSTD_INLINE17 _MSTD_CONSTEXPR20 vec<N, T> min(const vec<N, T>& a, const vec<N, T>& b) noexcept {
 		vec<N, T> res;
-			for (size_t i = 0; i != N; ++i) { res[i] = std::min(a[i], b[i]); }
+		utils::vec_kernels<N, T>::min(&res[0], static_cast<const T*>(a), static_cast<const T*>(b));
 		return res;
 	}
 
@@ -732,6 +780,112 @@ namespace mstd {
 		return a.stepped(edge);
 	}
 
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 vec<N, T> sin(const vec<N, T>& a) {
+		vec<N, T> res;
+		utils::math_kernels<T>::template sin<Precision>(static_cast<const T*>(a), &res[0], N);
+		return res;
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 vec<N, T> cos(const vec<N, T>& a) {
+		vec<N, T> res;
+		utils::math_kernels<T>::template cos<Precision>(static_cast<const T*>(a), &res[0], N);
+		return res;
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 vec<N, T> tan(const vec<N, T>& a) {
+		vec<N, T> res;
+		utils::math_kernels<T>::template tan<Precision>(static_cast<const T*>(a), &res[0], N);
+		return res;
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 void sincos(const vec<N, T>& a, vec<N, T>& sinRes, vec<N, T>& cosRes) {
+		utils::math_kernels<T>::template sincos<Precision>(static_cast<const T*>(a), &sinRes[0], &cosRes[0], N);
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 vec<N, T> atan2(const vec<N, T>& y, const vec<N, T>& x) {
+		vec<N, T> res;
+		utils::math_kernels<T>::template atan2<Precision>(static_cast<const T*>(y), static_cast<const T*>(x), &res[0], N);
+		return res;
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 vec<N, T> exp(const vec<N, T>& a) {
+		vec<N, T> res;
+		utils::math_kernels<T>::template exp<Precision>(static_cast<const T*>(a), &res[0], N);
+		return res;
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 vec<N, T> log(const vec<N, T>& a) {
+		vec<N, T> res;
+		utils::math_kernels<T>::template log<Precision>(static_cast<const T*>(a), &res[0], N);
+		return res;
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 vec<N, T> rsqrt(const vec<N, T>& a) {
+		vec<N, T> res;
+		utils::math_kernels<T>::template rsqrt<Precision>(static_cast<const T*>(a), &res[0], N);
+		return res;
+	}
+
+		#if _MSTD_HAS_CXX20
+	template<math_precision Precision = math_precision::precise, floating_point T, size_t N>
+		#else
+	template<math_precision Precision = math_precision::precise, class T, size_t N,
+	  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+		#endif
+	_MSTD_INLINE17 vec<N, T> rcp(const vec<N, T>& a) {
+		vec<N, T> res;
+		utils::math_kernels<T>::template rcp<Precision>(static_cast<const T*>(a), &res[0], N);
+		return res;
+	}
+
 		#pragma endregion // EXTRA_OPERATORS
 } // namespace mstd
 
@@ -0,0 +1,611 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_VEC_SOA_HPP_
+	#define _MSTD_VEC_SOA_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/simd.hpp>
+		#include <mstd/vec.hpp>
+
+namespace mstd {
+	// structure of arrays: every component of the stored vectors lives in its own contiguous lane.
+	// Batch operations between two containers work on the first min(size(), other.size()) elements.
+		#if _MSTD_HAS_CXX20
+	template<size_t N, arithmetic T>
+	requires (N > 0)
+		#else
+	template<size_t N, class T, std::enable_if_t<(N > 0 && std::is_arithmetic_v<T>), bool> >
+		#endif
+	class vec_soa {
+	public:
+		static _MSTD_CONSTEXPR17 const size_t vec_size = N;
+		using value_type							   = T;
+		using vec_type								   = vec<N, T>;
+
+	private:
+		using _lane_type = std::vector<T>;
+		using _kernels	 = utils::lane_kernels<T>;
+
+	public:
+		using size_type = _MSTD_TYPENAME17 _lane_type::size_type;
+
+		#pragma region ELEMENT_CLASS
+
+		class const_vec_soa_element;
+
+		class vec_soa_element {
+		private:
+			using soa_type = vec_soa<N, T>;
+
+			soa_type* _parent;
+			size_type _idx;
+
+			friend class const_vec_soa_element;
+
+		public:
+			_MSTD_CONSTEXPR20 vec_soa_element(soa_type* parent, size_type idx) : _parent(parent), _idx(idx) {}
+
+			_MSTD_CONSTEXPR20 vec_soa_element(const vec_soa_element& other) : _parent(other._parent), _idx(other._idx) {}
+
+			_MSTD_CONSTEXPR20 vec_soa_element& operator=(const vec_soa_element& other) {
+					for (size_t c = 0; c != N; ++c) { (*this)[c] = other[c]; }
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 vec_soa_element& operator=(const vec_type& other) {
+					for (size_t c = 0; c != N; ++c) { (*this)[c] = other[c]; }
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 bool operator==(const vec_type& other) const { return static_cast<vec_type>(*this) == other; }
+
+			_MSTD_CONSTEXPR20 bool operator!=(const vec_type& other) const { return !this->operator==(other); }
+
+			_MSTD_CONSTEXPR20 T& x() { return (*this)[0]; }
+
+			_MSTD_CONSTEXPR20 T x() const { return (*this)[0]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 1 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T& y() _MSTD_REQUIRES(N > 1) { return (*this)[1]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 1 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T y() const _MSTD_REQUIRES(N > 1) { return (*this)[1]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 2 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T& z() _MSTD_REQUIRES(N > 2) { return (*this)[2]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 2 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T z() const _MSTD_REQUIRES(N > 2) { return (*this)[2]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 3 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T& w() _MSTD_REQUIRES(N > 3) { return (*this)[3]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 3 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T w() const _MSTD_REQUIRES(N > 3) { return (*this)[3]; }
+
+			_MSTD_CONSTEXPR20 vec_soa_element& operator+=(const vec_type& other) {
+					for (size_t c = 0; c != N; ++c) { (*this)[c] += other[c]; }
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 vec_soa_element& operator-=(const vec_type& other) {
+					for (size_t c = 0; c != N; ++c) { (*this)[c] -= other[c]; }
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 vec_soa_element& operator*=(const T& other) {
+					for (size_t c = 0; c != N; ++c) { (*this)[c] *= other; }
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 vec_soa_element& operator/=(const T& other) {
+					if (other == static_cast<T>(0)) { return *this; }
+					for (size_t c = 0; c != N; ++c) { (*this)[c] /= other; }
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 T dot(const vec_type& other) const { return static_cast<vec_type>(*this).dot(other); }
+
+			_MSTD_CONSTEXPR20 T length() const { return static_cast<vec_type>(*this).length(); }
+
+			_MSTD_CONSTEXPR20 T& operator[](const size_t& component) { return _parent->_lanes[component][_idx]; }
+
+			_MSTD_CONSTEXPR20 T operator[](const size_t& component) const { return _parent->_lanes[component][_idx]; }
+
+			_MSTD_CONSTEXPR20 operator vec_type() const {
+				vec_type res;
+					for (size_t c = 0; c != N; ++c) { res[c] = (*this)[c]; }
+				return res;
+			}
+		};
+
+		class const_vec_soa_element {
+		private:
+			using soa_type = vec_soa<N, T>;
+
+			const soa_type* _parent;
+			size_type _idx;
+
+		public:
+			_MSTD_CONSTEXPR20 const_vec_soa_element(const soa_type* parent, size_type idx) : _parent(parent), _idx(idx) {}
+
+			_MSTD_CONSTEXPR20 const_vec_soa_element(const vec_soa_element& other) : _parent(other._parent), _idx(other._idx) {}
+
+			_MSTD_CONSTEXPR20 const_vec_soa_element(const const_vec_soa_element& other)
+				: _parent(other._parent), _idx(other._idx) {}
+
+			_MSTD_CONSTEXPR20 bool operator==(const vec_type& other) const { return static_cast<vec_type>(*this) == other; }
+
+			_MSTD_CONSTEXPR20 bool operator!=(const vec_type& other) const { return !this->operator==(other); }
+
+			_MSTD_CONSTEXPR20 T x() const { return (*this)[0]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 1 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T y() const _MSTD_REQUIRES(N > 1) { return (*this)[1]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 2 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T z() const _MSTD_REQUIRES(N > 2) { return (*this)[2]; }
+
+			_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N > 3 && std::is_same_v<Type, value_type>))
+
+			_MSTD_CONSTEXPR20 T w() const _MSTD_REQUIRES(N > 3) { return (*this)[3]; }
+
+			_MSTD_CONSTEXPR20 T dot(const vec_type& other) const { return static_cast<vec_type>(*this).dot(other); }
+
+			_MSTD_CONSTEXPR20 T length() const { return static_cast<vec_type>(*this).length(); }
+
+			_MSTD_CONSTEXPR20 T operator[](const size_t& component) const { return _parent->_lanes[component][_idx]; }
+
+			_MSTD_CONSTEXPR20 operator vec_type() const {
+				vec_type res;
+					for (size_t c = 0; c != N; ++c) { res[c] = (*this)[c]; }
+				return res;
+			}
+		};
+
+		#pragma endregion // ELEMENT_CLASS
+
+	private:
+		// multi pass operations work on chunks so the temporary values stay in cache
+		static _MSTD_CONSTEXPR17 const size_type _chunk_size = 256;
+
+		_lane_type _lanes[N];
+
+		_MSTD_CONSTEXPR20 size_type _common_size(const vec_soa<N, T>& other) const noexcept {
+			return std::min(size(), other.size());
+		}
+
+		_MSTD_CONSTEXPR20 void _dot(const vec_soa<N, T>& other, size_type first, size_type count, T* out) const {
+			_kernels::mul(out, lane(0) + first, other.lane(0) + first, count);
+				for (size_t c = 1; c != N; ++c) { _kernels::fma(out, lane(c) + first, other.lane(c) + first, out, count); }
+		}
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		_MSTD_CONSTEXPR20 vec_soa()					  = default;
+
+		_MSTD_CONSTEXPR20 vec_soa(const vec_soa&)	  = default;
+		_MSTD_CONSTEXPR20 vec_soa(vec_soa&&) noexcept = default;
+
+		_MSTD_CONSTEXPR20 vec_soa(size_type count) { resize(count); }
+
+		_MSTD_CONSTEXPR20 vec_soa(size_type count, const vec_type& value) { resize(count, value); }
+
+		_MSTD_CONSTEXPR20 vec_soa(const std::initializer_list<vec_type>& init) {
+			reserve(init.size());
+				for (const auto& value : init) { push_back(value); }
+		}
+
+		_MSTD_CONSTEXPR20 ~vec_soa()							 = default;
+
+		_MSTD_CONSTEXPR20 vec_soa& operator=(const vec_soa&)	 = default;
+		_MSTD_CONSTEXPR20 vec_soa& operator=(vec_soa&&) noexcept = default;
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region CAPACITY
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const noexcept { return _lanes[0].size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _lanes[0].empty(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type capacity() const noexcept { return _lanes[0].capacity(); }
+
+		_MSTD_CONSTEXPR20 void reserve(size_type count) {
+				for (auto& lane : _lanes) { lane.reserve(count); }
+		}
+
+		_MSTD_CONSTEXPR20 void resize(size_type count) {
+				for (auto& lane : _lanes) { lane.resize(count); }
+		}
+
+		_MSTD_CONSTEXPR20 void resize(size_type count, const vec_type& value) {
+				for (size_t c = 0; c != N; ++c) { _lanes[c].resize(count, value[c]); }
+		}
+
+		_MSTD_CONSTEXPR20 void shrink_to_fit() {
+				for (auto& lane : _lanes) { lane.shrink_to_fit(); }
+		}
+
+		_MSTD_CONSTEXPR20 void clear() noexcept {
+				for (auto& lane : _lanes) { lane.clear(); }
+		}
+
+		#pragma endregion // CAPACITY
+
+		#pragma region MODIFIERS
+
+		_MSTD_CONSTEXPR20 void push_back(const vec_type& value) {
+				for (size_t c = 0; c != N; ++c) { _lanes[c].push_back(value[c]); }
+		}
+
+		_MSTD_CONSTEXPR20 void pop_back() {
+				for (auto& lane : _lanes) { lane.pop_back(); }
+		}
+
+		_MSTD_CONSTEXPR20 void set(size_type idx, const vec_type& value) {
+				for (size_t c = 0; c != N; ++c) { _lanes[c][idx] = value[c]; }
+		}
+
+		#pragma endregion // MODIFIERS
+
+		#pragma region ACCESS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 vec_type get(size_type idx) const {
+			vec_type res;
+				for (size_t c = 0; c != N; ++c) { res[c] = _lanes[c][idx]; }
+			return res;
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* lane(size_t component) noexcept { return _lanes[component].data(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const T* lane(size_t component) const noexcept { return _lanes[component].data(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 vec_soa_element operator[](size_type idx) { return vec_soa_element(this, idx); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_vec_soa_element operator[](size_type idx) const {
+			return const_vec_soa_element(this, idx);
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 vec_soa_element front() { return vec_soa_element(this, 0); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_vec_soa_element front() const { return const_vec_soa_element(this, 0); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 vec_soa_element back() { return vec_soa_element(this, size() - 1); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_vec_soa_element back() const { return const_vec_soa_element(this, size() - 1); }
+
+		#pragma endregion // ACCESS
+
+		#pragma region BATCH_OPERATIONS
+
+		// this = this * mul + add
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& fma(const vec_soa<N, T>& mul, const vec_soa<N, T>& add) {
+			size_type count = std::min(_common_size(mul), add.size());
+				for (size_t c = 0; c != N; ++c) { _kernels::fma(lane(c), lane(c), mul.lane(c), add.lane(c), count); }
+			return *this;
+		}
+
+		// this = this * mul + add
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& fma(const T& mul, const vec_soa<N, T>& add) {
+			size_type count = _common_size(add);
+				for (size_t c = 0; c != N; ++c) { _kernels::fma(lane(c), lane(c), mul, add.lane(c), count); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 void dot(const vec_soa<N, T>& other, T* out) const { _dot(other, 0, _common_size(other), out); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 std::vector<T> dot(const vec_soa<N, T>& other) const {
+			std::vector<T> res(_common_size(other));
+			dot(other, res.data());
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 void length(T* out) const {
+			dot(*this, out);
+			_kernels::sqrt(out, out, size());
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 std::vector<T> length() const {
+			std::vector<T> res(size());
+			length(res.data());
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& normalize() {
+			T scale[_chunk_size] = {};
+				for (size_type first = 0; first < size(); first += _chunk_size) {
+					size_type count = std::min(_chunk_size, size() - first);
+					_dot(*this, first, count, scale);
+					_kernels::sqrt(scale, scale, count);
+						for (size_type i = 0; i != count; ++i) {
+							scale[i] = scale[i] == static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(1) / scale[i];
+						}
+						for (size_t c = 0; c != N; ++c) { _kernels::mul(lane(c) + first, lane(c) + first, scale, count); }
+				}
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> normalized() const {
+			vec_soa<N, T> res = *this;
+			return res.normalize();
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& clamp(const T& minVal, const T& maxVal) {
+				for (size_t c = 0; c != N; ++c) { _kernels::clamp(lane(c), lane(c), minVal, maxVal, size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> clampped(const T& minVal, const T& maxVal) const {
+			vec_soa<N, T> res = *this;
+			return res.clamp(minVal, maxVal);
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& clamp(const vec_type& minVal, const vec_type& maxVal) {
+				for (size_t c = 0; c != N; ++c) { _kernels::clamp(lane(c), lane(c), minVal[c], maxVal[c], size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> clampped(const vec_type& minVal, const vec_type& maxVal) const {
+			vec_soa<N, T> res = *this;
+			return res.clamp(minVal, maxVal);
+		}
+
+		// this = this + (other - this) * t
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& lerp(const vec_soa<N, T>& other, const T& t) {
+			size_type size = _common_size(other);
+			T diff[_chunk_size] = {};
+				for (size_type first = 0; first < size; first += _chunk_size) {
+					size_type count = std::min(_chunk_size, size - first);
+						for (size_t c = 0; c != N; ++c) {
+							T* dst = lane(c) + first;
+							_kernels::sub(diff, other.lane(c) + first, dst, count);
+							_kernels::fma(dst, diff, t, dst, count);
+						}
+				}
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> lerped(const vec_soa<N, T>& other, const T& t) const {
+			vec_soa<N, T> res = *this;
+			return res.lerp(other, t);
+		}
+
+		#pragma region VECTOR_3_OPERATIONS
+
+		_MSTD_ENABLE_IF_TEMPLATE(Type = value_type, (N == 3 && std::is_same_v<Type, value_type>))
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> cross(const vec_soa<N, T>& other) const _MSTD_REQUIRES(N == 3) {
+			size_type size = _common_size(other);
+			vec_soa<N, T> res(size);
+			T tmp[_chunk_size] = {};
+				for (size_type first = 0; first < size; first += _chunk_size) {
+					size_type count = std::min(_chunk_size, size - first);
+						for (size_t c = 0; c != N; ++c) {
+							const size_t a = (c + 1) % N;
+							const size_t b = (c + 2) % N;
+							T* dst		   = res.lane(c) + first;
+							_kernels::mul(tmp, lane(b) + first, other.lane(a) + first, count);
+							_kernels::mul(dst, lane(a) + first, other.lane(b) + first, count);
+							_kernels::sub(dst, dst, tmp, count);
+						}
+				}
+			return res;
+		}
+
+		#pragma endregion // VECTOR_3_OPERATIONS
+		#pragma endregion // BATCH_OPERATIONS
+
+		#pragma region OPERATORS
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator+=(const vec_soa<N, T>& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::add(lane(c), lane(c), other.lane(c), _common_size(other)); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator-=(const vec_soa<N, T>& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::sub(lane(c), lane(c), other.lane(c), _common_size(other)); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator*=(const vec_soa<N, T>& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::mul(lane(c), lane(c), other.lane(c), _common_size(other)); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator/=(const vec_soa<N, T>& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::div(lane(c), lane(c), other.lane(c), _common_size(other)); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator+=(const vec_type& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::add(lane(c), lane(c), other[c], size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator-=(const vec_type& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::sub(lane(c), lane(c), other[c], size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator*=(const vec_type& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::mul(lane(c), lane(c), other[c], size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator/=(const vec_type& other) {
+				if (other == vec_type::zero()) { return *this; }
+				for (size_t c = 0; c != N; ++c) { _kernels::div(lane(c), lane(c), other[c], size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator+=(const T& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::add(lane(c), lane(c), other, size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator-=(const T& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::sub(lane(c), lane(c), other, size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator*=(const T& other) {
+				for (size_t c = 0; c != N; ++c) { _kernels::mul(lane(c), lane(c), other, size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T>& operator/=(const T& other) {
+				if (other == static_cast<T>(0)) { return *this; }
+				for (size_t c = 0; c != N; ++c) { _kernels::div(lane(c), lane(c), other, size()); }
+			return *this;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator+(const vec_soa<N, T>& other) const {
+			vec_soa<N, T> res = *this;
+			res += other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator-(const vec_soa<N, T>& other) const {
+			vec_soa<N, T> res = *this;
+			res -= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator*(const vec_soa<N, T>& other) const {
+			vec_soa<N, T> res = *this;
+			res *= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator/(const vec_soa<N, T>& other) const {
+			vec_soa<N, T> res = *this;
+			res /= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator+(const vec_type& other) const {
+			vec_soa<N, T> res = *this;
+			res += other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator-(const vec_type& other) const {
+			vec_soa<N, T> res = *this;
+			res -= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator*(const vec_type& other) const {
+			vec_soa<N, T> res = *this;
+			res *= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator/(const vec_type& other) const {
+			vec_soa<N, T> res = *this;
+			res /= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator+(const T& other) const {
+			vec_soa<N, T> res = *this;
+			res += other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator-(const T& other) const {
+			vec_soa<N, T> res = *this;
+			res -= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator*(const T& other) const {
+			vec_soa<N, T> res = *this;
+			res *= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 vec_soa<N, T> operator/(const T& other) const {
+			vec_soa<N, T> res = *this;
+			res /= other;
+			return res;
+		}
+
+		_MSTD_CONSTEXPR20 bool operator==(const vec_soa<N, T>& other) const {
+				for (size_t c = 0; c != N; ++c) {
+						if (_lanes[c] != other._lanes[c]) { return false; }
+				}
+			return true;
+		}
+
+		_MSTD_CONSTEXPR20 bool operator!=(const vec_soa<N, T>& other) const { return !this->operator==(other); }
+
+		#pragma endregion // OPERATORS
+	};
+
+		#pragma region PREDEFINED_FUNCTIONS
+
+	template<size_t N, class T>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 std::vector<T> dot(const vec_soa<N, T>& a, const vec_soa<N, T>& b) {
+		return a.dot(b);
+	}
+
+	template<class T>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 vec_soa<3, T> cross(const vec_soa<3, T>& a, const vec_soa<3, T>& b) {
+		return a.cross(b);
+	}
+
+	template<size_t N, class T>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 std::vector<T> length(const vec_soa<N, T>& a) {
+		return a.length();
+	}
+
+	template<size_t N, class T>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 vec_soa<N, T> normalize(const vec_soa<N, T>& a) {
+		return a.normalized();
+	}
+
+	template<size_t N, class T>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 vec_soa<N, T> fma(const vec_soa<N, T>& a, const vec_soa<N, T>& b,
+	  const vec_soa<N, T>& c) {
+		vec_soa<N, T> res = a;
+		return res.fma(b, c);
+	}
+
+	template<size_t N, class T>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 vec_soa<N, T> clamp(const vec_soa<N, T>& a, const T& minVal, const T& maxVal) {
+		return a.clampped(minVal, maxVal);
+	}
+
+	template<size_t N, class T>
+	_MSTD_INLINE17 _MSTD_CONSTEXPR20 vec_soa<N, T> lerp(const vec_soa<N, T>& a, const vec_soa<N, T>& b, const T& t) {
+		return a.lerped(b, t);
+	}
+
+		#pragma endregion // PREDEFINED_FUNCTIONS
+} // namespace mstd
+	#endif
+#endif
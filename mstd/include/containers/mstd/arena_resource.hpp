@@ -0,0 +1,153 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_ARENA_RESOURCE_HPP_
+	#define _MSTD_ARENA_RESOURCE_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/containers_types.hpp>
+
+namespace mstd {
+	// Monotonic memory resource: allocations bump a pointer through blocks taken from the upstream resource and
+	// deallocate does nothing. Blocks double in size, so a container built in the arena costs a handful of upstream
+	// allocations instead of one per node or growth. reset() merges the blocks into one, so a per frame arena stops
+	// touching the upstream resource once it has seen its biggest frame
+	class arena_resource : public std::pmr::memory_resource {
+	private:
+		// placed at the start of every upstream block, blocks form a list from the newest (and largest) one
+		struct _block {
+			_block* previous;
+			size_t size;
+		};
+
+		static _MSTD_CONSTEXPR17 const size_t _header_size =
+		  (sizeof(_block) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+		std::pmr::memory_resource* _upstream;
+		void* _initialBuffer = nullptr;
+		size_t _initialSize	 = 0;
+		size_t _nextBlockSize;
+
+		_block* _blocks		   = nullptr;
+		std::byte* _current	   = nullptr;
+		size_t _remaining	   = 0;
+		size_t _bytesAllocated = 0;
+
+		void _rewind_to(void* buffer, size_t size) noexcept {
+			_current   = static_cast<std::byte*>(buffer);
+			_remaining = size;
+		}
+
+		void _rewind() noexcept {
+				if (_blocks != nullptr) {
+					_rewind_to(reinterpret_cast<std::byte*>(_blocks) + _header_size, _blocks->size - _header_size);
+				}
+				else { _rewind_to(_initialBuffer, _initialSize); }
+			_bytesAllocated = 0;
+		}
+
+		void _free_blocks(_block* until) noexcept {
+				while (_blocks != until) {
+					_block* previous = _blocks->previous;
+					_upstream->deallocate(_blocks, _blocks->size, alignof(std::max_align_t));
+					_blocks = previous;
+				}
+		}
+
+		void _add_block(size_t bytes, size_t alignment) {
+			const size_t needed	= _header_size + bytes + (alignment > alignof(std::max_align_t) ? alignment : 0);
+			const size_t size	= std::max(_nextBlockSize, needed);
+
+			auto* block		= static_cast<_block*>(_upstream->allocate(size, alignof(std::max_align_t)));
+			block->previous	= _blocks;
+			block->size		= size;
+			_blocks			= block;
+			_nextBlockSize	= size * 2;
+
+			_rewind_to(reinterpret_cast<std::byte*>(block) + _header_size, size - _header_size);
+		}
+
+	protected:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			void* ptr = _current;
+				if (std::align(alignment, bytes, ptr, _remaining) == nullptr) {
+					_add_block(bytes, alignment);
+					ptr = _current;
+					std::align(alignment, bytes, ptr, _remaining);
+				}
+
+			_current		 = static_cast<std::byte*>(ptr) + bytes;
+			_remaining		-= bytes;
+			_bytesAllocated	+= bytes;
+			return ptr;
+		}
+
+		void do_deallocate(void*, size_t, size_t) noexcept override {}
+
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+
+	public:
+		explicit arena_resource(
+		  size_t initialBlockSize = 4096, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+			: _upstream(upstream), _nextBlockSize(std::max(initialBlockSize, _header_size * 2)) {}
+
+		// buffer is used before any upstream block, a stack buffer makes small arenas free
+		arena_resource(void* buffer, size_t size, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+			: _upstream(upstream), _initialBuffer(buffer), _initialSize(size),
+			  _nextBlockSize(std::max(size * 2, _header_size * 2)) {
+			_rewind_to(buffer, size);
+		}
+
+		arena_resource(const arena_resource&)			 = delete;
+		arena_resource& operator=(const arena_resource&) = delete;
+
+		~arena_resource() override { _free_blocks(nullptr); }
+
+		// everything allocated so far is gone, the blocks are replaced by a single one as large as all of them together
+		void reset() {
+				if (_blocks != nullptr && _blocks->previous != nullptr) {
+					size_t total = 0;
+						for (const _block* block = _blocks; block != nullptr; block = block->previous) { total += block->size; }
+
+					_free_blocks(nullptr);
+					_nextBlockSize = total;
+					_add_block(0, 1);
+				}
+			_rewind();
+		}
+
+		// everything allocated so far is gone and every block goes back to the upstream resource
+		void release() noexcept {
+			_free_blocks(nullptr);
+			_rewind();
+		}
+
+		[[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept { return _upstream; }
+
+		// bytes handed out since the last reset or release
+		[[nodiscard]] size_t bytes_allocated() const noexcept { return _bytesAllocated; }
+
+		// blocks currently held from the upstream resource
+		[[nodiscard]] size_t block_count() const noexcept {
+			size_t count = 0;
+				for (const _block* block = _blocks; block != nullptr; block = block->previous) { ++count; }
+			return count;
+		}
+	};
+} // namespace mstd
+	#endif
+#endif
@@ -19,19 +19,156 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 
 		#include <mstd/assert.hpp>
 		#include <mstd/containers_types.hpp>
+		#include <mstd/flat_hash_table.hpp>
 
 namespace mstd {
-	template<class Key, class T, template<class, class, class...> class Map>
+	namespace utils {
+		// Map<Key, T> allocating through Allocator, maps which do not take an allocator keep their own
+		template<template<class, class, class...> class Map, class Key, class T, class Allocator>
+		struct bimap_map_impl {
+			using type = Map<Key, T>;
+		};
+
+		template<class Key, class T, class Allocator>
+		struct bimap_map_impl<std::map, Key, T, Allocator> {
+			using type = std::map<Key, T, std::less<Key>, rebind_alloc_t<Allocator, std::pair<const Key, T> > >;
+		};
+
+		template<class Key, class T, class Allocator>
+		struct bimap_map_impl<std::unordered_map, Key, T, Allocator> {
+			using type = std::unordered_map<Key, T, std::hash<Key>, std::equal_to<Key>,
+			  rebind_alloc_t<Allocator, std::pair<const Key, T> > >;
+		};
+
+		template<class Key, class T, class Allocator>
+		struct bimap_map_impl<ordered_map, Key, T, Allocator> {
+			using type = ordered_map<Key, T, rebind_alloc_t<Allocator, std::pair<Key, T> > >;
+		};
+
+		template<class Key, class T, class Allocator>
+		struct bimap_map_impl<linked_ordered_map, Key, T, Allocator> {
+			using type = linked_ordered_map<Key, T, rebind_alloc_t<Allocator, std::pair<Key, T> > >;
+		};
+
+		// index of one side of a bimap, Map<Key, size_t> from that side of the pair to its index. The pairs are passed
+		// to every call, so the flat_hash_map specialization can keep the indexes only and hash through the pairs
+		template<template<class, class, class...> class Map, class Key, size_t Side, class Allocator>
+		class bimap_index {
+		private:
+			using _map_type = _MSTD_TYPENAME17 bimap_map_impl<Map, Key, size_t, Allocator>::type;
+
+			_map_type _map;
+
+			static _MSTD_CONSTEXPR20 _map_type _make_map(const Allocator& alloc) {
+					if _MSTD_CONSTEXPR17 (std::is_constructible_v<_map_type, const Allocator&>) { return _map_type(alloc); }
+					else { return _map_type(); }
+			}
+
+		public:
+			static _MSTD_CONSTEXPR17 const size_t npos = std::numeric_limits<size_t>::max();
+
+			_MSTD_CONSTEXPR20 bimap_index() = default;
+
+			_MSTD_CONSTEXPR20 explicit bimap_index(const Allocator& alloc) : _map(_make_map(alloc)) {}
+
+			template<class Data>
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_t find(const Data&, const Key& key) const {
+				auto it = _map.find(key);
+				return it != _map.end() ? it->second : npos;
+			}
+
+			template<class Data>
+			_MSTD_CONSTEXPR20 void insert(const Data& data, size_t index) {
+				_map[std::get<Side>(data[index])] = index;
+			}
+
+			template<class Data>
+			_MSTD_CONSTEXPR20 void erase(const Data& data, size_t index) {
+				_map.erase(std::get<Side>(data[index]));
+			}
+
+			// the pair now at to was at from
+			template<class Data>
+			_MSTD_CONSTEXPR20 void move(const Data& data, size_t, size_t to) {
+				_map[std::get<Side>(data[to])] = to;
+			}
+
+			template<class Data>
+			_MSTD_CONSTEXPR20 void reserve(const Data&, size_t) {}
+
+			_MSTD_CONSTEXPR20 void clear() { _map.clear(); }
+		};
+
+		template<class Key, size_t Side, class Allocator>
+		class bimap_index<flat_hash_map, Key, Side, Allocator> {
+		private:
+			using _table_type = flat_hash_table<size_t, Allocator>;
+
+			_table_type _table;
+
+			template<class Data>
+			[[nodiscard]] static _MSTD_CONSTEXPR20 size_t _hash_at(const Data& data, size_t index) {
+				return std::hash<Key>()(std::get<Side>(data[index]));
+			}
+
+			// slot holding from, found through the hash of the pair at at
+			template<class Data>
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_t _slot_of(const Data& data, size_t at, size_t from) const {
+				return _table.find(_hash_at(data, at), [from](size_t stored) { return stored == from; });
+			}
+
+		public:
+			static _MSTD_CONSTEXPR17 const size_t npos = _table_type::npos;
+
+			_MSTD_CONSTEXPR20 bimap_index() = default;
+
+			_MSTD_CONSTEXPR20 explicit bimap_index(const Allocator& alloc) : _table(alloc) {}
+
+			template<class Data>
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_t find(const Data& data, const Key& key) const {
+				const size_t slot = _table.find(std::hash<Key>()(key),
+				  [&data, &key](size_t index) { return std::get<Side>(data[index]) == key; });
+				return slot != npos ? _table.slot(slot) : npos;
+			}
+
+			// room has to be reserved, inserting can not rehash through pairs that already moved
+			template<class Data>
+			_MSTD_CONSTEXPR20 void insert(const Data& data, size_t index) {
+				_table.emplace(_hash_at(data, index), [&data](size_t stored) { return _hash_at(data, stored); }, index);
+			}
+
+			template<class Data>
+			_MSTD_CONSTEXPR20 void erase(const Data& data, size_t index) {
+				_table.erase(_slot_of(data, index, index));
+			}
+
+			// the pair now at to was at from, the stored index is stale so it is found by the hash of the pair
+			template<class Data>
+			_MSTD_CONSTEXPR20 void move(const Data& data, size_t from, size_t to) {
+				_table.slot(_slot_of(data, to, from)) = to;
+			}
+
+			template<class Data>
+			_MSTD_CONSTEXPR20 void reserve(const Data& data, size_t count) {
+				_table.reserve(count, [&data](size_t stored) { return _hash_at(data, stored); });
+			}
+
+			_MSTD_CONSTEXPR20 void clear() { _table.clear(); }
+		};
+	} // namespace utils
+
+	template<class Key, class T, template<class, class, class...> class Map, class Allocator>
 	class bimap {
 	public:
 		using key_type		  = Key;
 		using mapped_type	  = T;
 		using value_type	  = std::pair<Key, T>;
+		using allocator_type  = Allocator;
 		using reference		  = value_type&;
 		using const_reference = const value_type&;
 
 	private:
-		using _data_type = std::vector<value_type>;
+		using _data_type = std::vector<value_type, Allocator>;
 
 	public:
 		using size_type				 = _MSTD_TYPENAME17 _data_type::size_type;
@@ -42,34 +179,48 @@ namespace mstd {
 		using const_reverse_iterator = _MSTD_TYPENAME17 _data_type::const_reverse_iterator;
 
 	private:
-		using _map_type			 = Map<Key, size_type>;
-		using _inverted_map_type = Map<T, size_type>;
+		using _map_type			 = utils::bimap_index<Map, Key, 0, Allocator>;
+		using _inverted_map_type = utils::bimap_index<Map, T, 1, Allocator>;
+
+		static _MSTD_CONSTEXPR17 const size_type _npos = _map_type::npos;
 
 		_data_type _data;
 		_map_type _map;
 		_inverted_map_type _invertedMap;
 
-		_MSTD_CONSTEXPR20 void _update_indexes(const size_type& from) {
-				for (size_type i = from; i != _data.size(); ++i) {
-					_map[_data[i].first]		  = i;
-					_invertedMap[_data[i].second] = i;
+		// drops the pair at index, walking the pairs after it forward so no old index is looked up after another pair
+		// took it
+		_MSTD_CONSTEXPR20 void _remove(size_type index) {
+			_map.erase(_data, index);
+			_invertedMap.erase(_data, index);
+			_data.erase(std::next(_data.begin(), index));
+
+				for (size_type i = index; i != _data.size(); ++i) {
+					_map.move(_data, i + 1, i);
+					_invertedMap.move(_data, i + 1, i);
 				}
 		}
 
 	public:
 		_MSTD_CONSTEXPR20 bimap() = default;
 
-		_MSTD_CONSTEXPR20 bimap(const std::initializer_list<value_type>& init) { insert(init.begin(), init.end()); }
+		_MSTD_CONSTEXPR20 explicit bimap(const Allocator& alloc)
+			: _data(alloc), _map(alloc), _invertedMap(alloc) {}
+
+		_MSTD_CONSTEXPR20 bimap(const std::initializer_list<value_type>& init, const Allocator& alloc = Allocator())
+			: bimap(alloc) {
+			insert(init.begin(), init.end());
+		}
 
-		_MSTD_CONSTEXPR20 bimap(const bimap<Key, T, Map>& other)	 = default;
-		_MSTD_CONSTEXPR20 bimap(bimap<Key, T, Map>&& other) noexcept = default;
+		_MSTD_CONSTEXPR20 bimap(const bimap& other)		= default;
+		_MSTD_CONSTEXPR20 bimap(bimap&& other) noexcept = default;
 
 		#if _MSTD_HAS_CXX20
 		template<mstd::iterator Iter>
 		#else
 		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
 		#endif
-		_MSTD_CONSTEXPR20 bimap(const Iter& begin, const Iter& end) {
+		_MSTD_CONSTEXPR20 bimap(const Iter& begin, const Iter& end, const Allocator& alloc = Allocator()) : bimap(alloc) {
 			insert(begin, end);
 		}
 
@@ -81,50 +232,23 @@ namespace mstd {
 		_MSTD_CONSTEXPR20 T& emplace(const Key& key, const T& value) { return insert(std::make_pair(key, value)); }
 
 		_MSTD_CONSTEXPR20 T& insert(const value_type& value) {
-				if (contains(value.first) && _data[_map.at(value.first)].second == value.second) {
-					return _data[_map.at(value.first)].second;
-				}
-
-			// add new pair
-			_data.push_back(value);
-
-			// get maps iterators
-			size_t minIdx = _data.size() - 1;
-				if (contains(value.first)) {
-					size_t valueIdx = _map.at(value.first);
-
-					// set min idx
-					minIdx			= std::min(minIdx, valueIdx);
-
-					// erase inverted map
-					_invertedMap.erase(_data[valueIdx].second);
-
-					// erase data
-					_data.erase(std::next(_data.begin(), valueIdx));
-
-					// erase map
-					_map.erase(value.first);
-				}
-
-				if (contains_value(value.second)) {
-					size_t keyIdx = _invertedMap.at(value.second);
+			const size_type keyIdx = _map.find(_data, value.first);
+				if (keyIdx != _npos && _data[keyIdx].second == value.second) { return _data[keyIdx].second; }
 
-					// set min idx
-					minIdx		  = std::min(keyIdx, minIdx);
+			_map.reserve(_data, _data.size() + 1);
+			_invertedMap.reserve(_data, _data.size() + 1);
 
-					// erase map
-					_map.erase(_data[keyIdx].first);
+				// the pairs holding the key or the value are replaced by the new pair at the back
+				if (keyIdx != _npos) { _remove(keyIdx); }
 
-					// erase data
-					_data.erase(std::next(_data.begin(), keyIdx));
+			const size_type valueIdx = _invertedMap.find(_data, value.second);
+				if (valueIdx != _npos) { _remove(valueIdx); }
 
-					// erase inverted map
-					_invertedMap.erase(value.second);
-				}
-
-			_update_indexes(minIdx);
+			_data.push_back(value);
+			_map.insert(_data, _data.size() - 1);
+			_invertedMap.insert(_data, _data.size() - 1);
 
-			return _data[_map.at(value.first)].second;
+			return _data.back().second;
 		}
 
 		#if _MSTD_HAS_CXX20
@@ -137,99 +261,81 @@ namespace mstd {
 		}
 
 		_MSTD_CONSTEXPR20 void erase(const Key& key) {
-				if (!contains(key)) { return; }
-
-			size_t elementOffset = _map.at(key);
+			const size_type elementOffset = _map.find(_data, key);
+				if (elementOffset == _npos) { return; }
 
-			const iterator& itr	 = std::next(_data.begin(), elementOffset);
-			T value				 = itr->second;
-			_data.erase(itr);
-			_map.erase(key);
-			_invertedMap.erase(value);
-
-			_update_indexes(elementOffset);
+			_remove(elementOffset);
 		}
 
 		_MSTD_CONSTEXPR20 void erase_value(const T& value) {
-				if (!contains_value(value)) { return; }
-
-			size_t elementOffset = _invertedMap.at(value);
+			const size_type elementOffset = _invertedMap.find(_data, value);
+				if (elementOffset == _npos) { return; }
 
-			const iterator& itr	 = std::next(_data.begin(), elementOffset);
-			Key key				 = itr->first;
-			_data.erase(itr);
-			_invertedMap.erase(value);
-			_map.erase(key);
-
-			_update_indexes(elementOffset);
+			_remove(elementOffset);
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 T& at(const Key& key) {
-				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) { mstd_assert(contains(key), "Key '{}' not found", key); }
-				else { mstd_assert(contains(key), "Key not found"); }
-			return _data.at(_map.at(key)).second;
+			const size_type index = _map.find(_data, key);
+				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) { mstd_assert(index != _npos, "Key '{}' not found", key); }
+				else { mstd_assert(index != _npos, "Key not found"); }
+			return _data.at(index).second;
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const T& at(const Key& key) const {
-				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) { mstd_assert(contains(key), "Key '{}' not found", key); }
-				else { mstd_assert(contains(key), "Key not found"); }
-			return _data.at(_map.at(key)).second;
+			const size_type index = _map.find(_data, key);
+				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) { mstd_assert(index != _npos, "Key '{}' not found", key); }
+				else { mstd_assert(index != _npos, "Key not found"); }
+			return _data.at(index).second;
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 Key& at_value(const T& value) {
+			const size_type index = _invertedMap.find(_data, value);
 				if _MSTD_CONSTEXPR17 (fmt::is_formattable<T>::value) {
-					mstd_assert(contains_value(value), "Value '{}' not found", value);
+					mstd_assert(index != _npos, "Value '{}' not found", value);
 				}
-				else { mstd_assert(contains_value(value), "Value not found"); }
-			return _data.at(_invertedMap.at(value)).first;
+				else { mstd_assert(index != _npos, "Value not found"); }
+			return _data.at(index).first;
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const Key& at_value(const T& value) const {
+			const size_type index = _invertedMap.find(_data, value);
 				if _MSTD_CONSTEXPR17 (fmt::is_formattable<T>::value) {
-					mstd_assert(contains_value(value), "Value '{}' not found", value);
+					mstd_assert(index != _npos, "Value '{}' not found", value);
 				}
-				else { mstd_assert(contains_value(value), "Value not found"); }
-			return _data.at(_invertedMap.at(value)).first;
+				else { mstd_assert(index != _npos, "Value not found"); }
+			return _data.at(index).first;
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 size_t size() const { return _data.size(); }
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const { return _data.empty(); }
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const Key& key) const {
-		#if _MSTD_HAS_CXX20
-			return _map.contains(key);
-		#else
-			return _map.find(key) != _map.end();
-		#endif
-		}
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return _data.get_allocator(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const Key& key) const { return _map.find(_data, key) != _npos; }
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains_value(const T& value) const {
-		#if _MSTD_HAS_CXX20
-			return _invertedMap.contains(value);
-		#else
-			return _invertedMap.find(value) != _invertedMap.end();
-		#endif
+			return _invertedMap.find(_data, value) != _npos;
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 iterator find(const Key& key) {
-			auto it = _map.find(key);
-			return it != _map.end() ? std::next(_data.begin(), it->second) : _data.end();
+			const size_type index = _map.find(_data, key);
+			return index != _npos ? std::next(_data.begin(), index) : _data.end();
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator find(const Key& key) const {
-			auto it = _map.find(key);
-			return it != _map.end() ? std::next(_data.cbegin(), it->second) : _data.cend();
+			const size_type index = _map.find(_data, key);
+			return index != _npos ? std::next(_data.cbegin(), index) : _data.cend();
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 iterator find_value(const T& value) {
-			auto it = _invertedMap.find(value);
-			return it != _invertedMap.end() ? std::next(_data.begin(), it->second) : _data.end();
+			const size_type index = _invertedMap.find(_data, value);
+			return index != _npos ? std::next(_data.begin(), index) : _data.end();
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator find_value(const T& value) const {
-			auto it = _invertedMap.find(value);
-			return it != _invertedMap.end() ? std::next(_data.cbegin(), it->second) : _data.cend();
+			const size_type index = _invertedMap.find(_data, value);
+			return index != _npos ? std::next(_data.cbegin(), index) : _data.cend();
 		}
 
 		_MSTD_CONSTEXPR20 void clear() {
@@ -263,14 +369,15 @@ namespace mstd {
 		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator crend() const { return _data.crend(); }
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 T& operator[](const Key& key) {
-				if (!contains(key)) { return emplace(key, T()); }
-			return at(key);
+			const size_type index = _map.find(_data, key);
+				if (index == _npos) { return emplace(key, T()); }
+			return _data[index].second;
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const T& operator[](const Key& key) const { return at(key); }
 
 		_MSTD_CONSTEXPR20 bool operator==(const bimap& other) const {
-			return _map == other._map && _invertedMap == other._invertedMap && _data == other._data;
+			return _data == other._data;
 		}
 
 		_MSTD_CONSTEXPR20 bool operator!=(const bimap& other) const { return !(*this == other); }
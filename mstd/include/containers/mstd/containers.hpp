@@ -17,10 +17,16 @@
 _MSTD_WARNING("this is only available for c++17 and greater!");
 	#else
 
+		#include <mstd/arena_resource.hpp>
 		#include <mstd/bimap.hpp>
 		#include <mstd/containers_types.hpp>
+		#include <mstd/flat_hash_map.hpp>
+		#include <mstd/flat_hash_set.hpp>
+		#include <mstd/linked_ordered_map.hpp>
+		#include <mstd/linked_ordered_set.hpp>
 		#include <mstd/ordered_map.hpp>
 		#include <mstd/ordered_set.hpp>
+		#include <mstd/slot_map.hpp>
 		#include <mstd/stable_vector.hpp>
 
 	#endif
@@ -18,11 +18,25 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 	#else
 
 		#include <algorithm>
+		#include <cstddef>
+		#include <cstdint>
 		#include <initializer_list>
+		#include <limits>
 		#include <map>
+		#include <memory>
+		#include <memory_resource>
+		#include <numeric>
+		#include <tuple>
 		#include <unordered_map>
 		#include <unordered_set>
+		#include <utility>
 		#include <vector>
+		#if _MSTD_HAS_CXX20
+			#include <bit>
+		#endif
+		#if _MSTD_HAS_SSE2
+			#include <immintrin.h>
+		#endif
 
 	#endif
 #endif
\ No newline at end of file
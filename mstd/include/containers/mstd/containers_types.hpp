@@ -20,23 +20,79 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/containers_utils.hpp>
 
 namespace mstd {
-	template<class T>
+	template<class T, class Allocator = std::allocator<T> >
 	class ordered_set;
 
-	template<class Key, class T>
+	template<class Key, class T, class Allocator = std::allocator<std::pair<Key, T> > >
 	class ordered_map;
 
-	template<class Key, class T, template<class, class, class...> class Map = std::map>
+	template<class T, class Allocator = std::allocator<T> >
+	class linked_ordered_set;
+
+	template<class Key, class T, class Allocator = std::allocator<std::pair<Key, T> > >
+	class linked_ordered_map;
+
+	template<class T, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>, class Allocator = std::allocator<T> >
+	class flat_hash_set;
+
+	template<class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>,
+	  class Allocator = std::allocator<std::pair<Key, T> > >
+	class flat_hash_map;
+
+	template<class Key, class T, template<class, class, class...> class Map = std::map,
+	  class Allocator = std::allocator<std::pair<Key, T> > >
 	class bimap;
 
-	template<class Key, class T>
-	using unordered_bimap = bimap<Key, T, std::unordered_map>;
+	template<class Key, class T, class Allocator = std::allocator<std::pair<Key, T> > >
+	using unordered_bimap = bimap<Key, T, flat_hash_map, Allocator>;
 
-	template<class Key, class T>
-	using ordered_bimap = bimap<Key, T, ordered_map>;
+	template<class Key, class T, class Allocator = std::allocator<std::pair<Key, T> > >
+	using ordered_bimap = bimap<Key, T, ordered_map, Allocator>;
 
-	template<class T>
+	template<class T, class Allocator = std::allocator<T> >
 	class stable_vector;
+
+	template<class T, class Allocator = std::allocator<T> >
+	class slot_map;
+
+	class arena_resource;
+
+	// the containers over std::pmr::polymorphic_allocator, every internal storage allocates from the same resource
+	namespace pmr {
+		template<class T>
+		using ordered_set = mstd::ordered_set<T, std::pmr::polymorphic_allocator<T> >;
+
+		template<class Key, class T>
+		using ordered_map = mstd::ordered_map<Key, T, std::pmr::polymorphic_allocator<std::pair<Key, T> > >;
+
+		template<class T>
+		using linked_ordered_set = mstd::linked_ordered_set<T, std::pmr::polymorphic_allocator<T> >;
+
+		template<class Key, class T>
+		using linked_ordered_map = mstd::linked_ordered_map<Key, T, std::pmr::polymorphic_allocator<std::pair<Key, T> > >;
+
+		template<class T, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T> >
+		using flat_hash_set = mstd::flat_hash_set<T, Hash, KeyEqual, std::pmr::polymorphic_allocator<T> >;
+
+		template<class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key> >
+		using flat_hash_map =
+		  mstd::flat_hash_map<Key, T, Hash, KeyEqual, std::pmr::polymorphic_allocator<std::pair<Key, T> > >;
+
+		template<class Key, class T, template<class, class, class...> class Map = std::map>
+		using bimap = mstd::bimap<Key, T, Map, std::pmr::polymorphic_allocator<std::pair<Key, T> > >;
+
+		template<class Key, class T>
+		using unordered_bimap = mstd::unordered_bimap<Key, T, std::pmr::polymorphic_allocator<std::pair<Key, T> > >;
+
+		template<class Key, class T>
+		using ordered_bimap = mstd::ordered_bimap<Key, T, std::pmr::polymorphic_allocator<std::pair<Key, T> > >;
+
+		template<class T>
+		using stable_vector = mstd::stable_vector<T, std::pmr::polymorphic_allocator<T> >;
+
+		template<class T>
+		using slot_map = mstd::slot_map<T, std::pmr::polymorphic_allocator<T> >;
+	} // namespace pmr
 } // namespace mstd
 	#endif
 #endif
\ No newline at end of file
@@ -32,6 +32,81 @@ namespace mstd {
 		#if _MSTD_HAS_CXX20
 	template<class T> concept iterator = is_iterator_v<T>;
 		#endif
+
+	// Allocator rebound to allocate U, how a container reaches its internal storage with the user's allocator
+	template<class Allocator, class U>
+	using rebind_alloc_t = _MSTD_TYPENAME17 std::allocator_traits<Allocator>::template rebind_alloc<U>;
+
+	namespace utils {
+		// bidirectional iterator of the linked ordered containers, follows the links between the nodes of the dense
+		// array. Container grants access to _nodes, _tail and _npos
+		template<class Container, bool Const>
+		class linked_iterator {
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type		= _MSTD_TYPENAME17 Container::value_type;
+			using difference_type	= _MSTD_TYPENAME17 Container::difference_type;
+			using pointer			= std::conditional_t<Const, const value_type*, value_type*>;
+			using reference			= std::conditional_t<Const, const value_type&, value_type&>;
+
+		private:
+			using _container_type = std::conditional_t<Const, const Container, Container>;
+			using _size_type	  = _MSTD_TYPENAME17 Container::size_type;
+
+			_container_type* _container = nullptr;
+			_size_type _index			= Container::_npos;
+
+			template<class, bool>
+			friend class linked_iterator;
+			friend Container;
+
+		public:
+			_MSTD_CONSTEXPR20 linked_iterator() = default;
+
+			_MSTD_CONSTEXPR20 linked_iterator(_container_type* container, _size_type index) noexcept
+				: _container(container), _index(index) {}
+
+			// iterator to const_iterator
+			template<bool OtherConst, std::enable_if_t<Const && !OtherConst, bool> = true>
+			_MSTD_CONSTEXPR20 linked_iterator(const linked_iterator<Container, OtherConst>& other) noexcept
+				: _container(other._container), _index(other._index) {}
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 reference operator*() const { return _container->_nodes[_index].value; }
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 pointer operator->() const { return &_container->_nodes[_index].value; }
+
+			_MSTD_CONSTEXPR20 linked_iterator& operator++() {
+				_index = _container->_nodes[_index].next;
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 linked_iterator operator++(int) {
+				linked_iterator old = *this;
+				++*this;
+				return old;
+			}
+
+			// from end() goes to the last element
+			_MSTD_CONSTEXPR20 linked_iterator& operator--() {
+				_index = _index == Container::_npos ? _container->_tail : _container->_nodes[_index].previous;
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 linked_iterator operator--(int) {
+				linked_iterator old = *this;
+				--*this;
+				return old;
+			}
+
+			[[nodiscard]] friend _MSTD_CONSTEXPR20 bool operator==(const linked_iterator& a, const linked_iterator& b) noexcept {
+				return a._index == b._index;
+			}
+
+			[[nodiscard]] friend _MSTD_CONSTEXPR20 bool operator!=(const linked_iterator& a, const linked_iterator& b) noexcept {
+				return a._index != b._index;
+			}
+		};
+	} // namespace utils
 } // namespace mstd
 
 	#endif
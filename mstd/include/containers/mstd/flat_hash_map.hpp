@@ -0,0 +1,274 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_FLAT_HASH_MAP_HPP_
+	#define _MSTD_FLAT_HASH_MAP_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/assert.hpp>
+		#include <mstd/containers_types.hpp>
+		#include <mstd/flat_hash_table.hpp>
+
+namespace mstd {
+	// unordered_map over one flat array of pairs, no allocation per element. Like in ordered_map the key of a pair must
+	// not be changed through an iterator, and like every open addressing table inserting and erasing invalidate the
+	// iterators
+	template<class Key, class T, class Hash, class KeyEqual, class Allocator>
+	class flat_hash_map {
+	public:
+		using key_type		  = Key;
+		using mapped_type	  = T;
+		using value_type	  = std::pair<Key, T>;
+		using hasher		  = Hash;
+		using key_equal		  = KeyEqual;
+		using allocator_type  = Allocator;
+		using reference		  = value_type&;
+		using const_reference = const value_type&;
+		using size_type		  = size_t;
+		using difference_type = ptrdiff_t;
+
+	private:
+		using _table_type = utils::flat_hash_table<value_type, Allocator>;
+
+	public:
+		using iterator		 = utils::flat_iterator<_table_type, false>;
+		using const_iterator = utils::flat_iterator<_table_type, true>;
+
+	private:
+		_table_type _table;
+		Hash _hash;
+		KeyEqual _equal;
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type _find(const Key& key) const {
+			return _table.find(_hash(key), [this, &key](const value_type& value) { return _equal(value.first, key); });
+		}
+
+		// slot of key, the value is built from args only when the key is new
+		template<class K, class... Args>
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> _try_emplace(K&& key, Args&&... args) {
+			const size_type hash = _hash(key);
+			size_type index =
+			  _table.find(hash, [this, &key](const value_type& value) { return _equal(value.first, key); });
+				if (index != _table_type::npos) { return { iterator(&_table, index), false }; }
+
+			index = _table.emplace(
+			  hash, [this](const value_type& value) { return _hash(value.first); }, std::piecewise_construct,
+			  std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+			return { iterator(&_table, index), true };
+		}
+
+	public:
+		_MSTD_CONSTEXPR20 flat_hash_map()								= default;
+
+		_MSTD_CONSTEXPR20 flat_hash_map(const flat_hash_map& other)		= default;
+		_MSTD_CONSTEXPR20 flat_hash_map(flat_hash_map&& other) noexcept = default;
+
+		_MSTD_CONSTEXPR20 explicit flat_hash_map(const Allocator& alloc) : _table(alloc) {}
+
+		_MSTD_CONSTEXPR20 flat_hash_map(const std::initializer_list<value_type>& init, const Allocator& alloc = Allocator())
+			: flat_hash_map(alloc) {
+			insert(init.begin(), init.end());
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<mstd::iterator Iter>
+		#else
+		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 flat_hash_map(const Iter& begin, const Iter& end, const Allocator& alloc = Allocator())
+			: flat_hash_map(alloc) {
+			insert(begin, end);
+		}
+
+		_MSTD_CONSTEXPR20 ~flat_hash_map()										   = default;
+
+		_MSTD_CONSTEXPR20 flat_hash_map& operator=(const flat_hash_map& other)	   = default;
+		_MSTD_CONSTEXPR20 flat_hash_map& operator=(flat_hash_map&& other) noexcept = default;
+
+		#pragma region INSERT
+
+		// the element is not built when the key is already there
+		template<class... Args>
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+			return _try_emplace(key, std::forward<Args>(args)...);
+		}
+
+		template<class... Args>
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+			return _try_emplace(std::move(key), std::forward<Args>(args)...);
+		}
+
+		template<class... Args>
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> emplace(Args&&... args) {
+			value_type value(std::forward<Args>(args)...);
+			return _try_emplace(std::move(value.first), std::move(value.second));
+		}
+
+		// an existing key keeps its value
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> insert(const value_type& value) {
+			return _try_emplace(value.first, value.second);
+		}
+
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> insert(value_type&& value) {
+			return _try_emplace(std::move(value.first), std::move(value.second));
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<mstd::iterator Iter>
+		#else
+		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 void insert(const Iter& begin, const Iter& end) {
+				for (Iter iter = begin; iter != end; ++iter) { insert(*iter); }
+		}
+
+		template<class U>
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> insert_or_assign(const Key& key, U&& value) {
+			auto result = _try_emplace(key, std::forward<U>(value));
+				if (!result.second) { result.first->second = std::forward<U>(value); }
+			return result;
+		}
+
+		template<class U>
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> insert_or_assign(Key&& key, U&& value) {
+			auto result = _try_emplace(std::move(key), std::forward<U>(value));
+				if (!result.second) { result.first->second = std::forward<U>(value); }
+			return result;
+		}
+
+		#pragma endregion INSERT
+
+		#pragma region ERASE
+
+		// number of erased elements, 0 or 1
+		_MSTD_CONSTEXPR20 size_type erase(const Key& key) {
+			const size_type index = _find(key);
+				if (index == _table_type::npos) { return 0; }
+
+			_table.erase(index);
+			return 1;
+		}
+
+		// returns the element after pos
+		_MSTD_CONSTEXPR20 iterator erase(const const_iterator& pos) {
+			mstd_assert(pos.index() < _table.capacity(), "Pos out of bounds");
+
+			_table.erase(pos.index());
+			return iterator(&_table, _table.next_full(pos.index() + 1));
+		}
+
+		_MSTD_CONSTEXPR20 void clear() noexcept { _table.clear(); }
+
+		_MSTD_CONSTEXPR20 void swap(flat_hash_map& other) noexcept {
+			using std::swap;
+			_table.swap(other._table);
+			swap(_hash, other._hash);
+			swap(_equal, other._equal);
+		}
+
+		#pragma endregion ERASE
+
+		#pragma region ACCESS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T& at(const Key& key) {
+			const size_type index = _find(key);
+				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) {
+					mstd_assert(index != _table_type::npos, "Key '{}' not found", key);
+				}
+				else { mstd_assert(index != _table_type::npos, "Key not found"); }
+			return _table.slot(index).second;
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const T& at(const Key& key) const {
+			const size_type index = _find(key);
+				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) {
+					mstd_assert(index != _table_type::npos, "Key '{}' not found", key);
+				}
+				else { mstd_assert(index != _table_type::npos, "Key not found"); }
+			return _table.slot(index).second;
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T& operator[](const Key& key) { return _try_emplace(key).first->second; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const Key& key) const { return _find(key) != _table_type::npos; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 iterator find(const Key& key) {
+			const size_type index = _find(key);
+			return index != _table_type::npos ? iterator(&_table, index) : end();
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator find(const Key& key) const {
+			const size_type index = _find(key);
+			return index != _table_type::npos ? const_iterator(&_table, index) : end();
+		}
+
+		#pragma endregion ACCESS
+
+		#pragma region CAPACITY
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const noexcept { return _table.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _table.empty(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type capacity() const noexcept { return _table.capacity(); }
+
+		// bytes owned by the table
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type memory_usage() const noexcept { return _table.memory_usage(); }
+
+		_MSTD_CONSTEXPR20 void reserve(size_type count) {
+			_table.reserve(count, [this](const value_type& value) { return _hash(value.first); });
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return allocator_type(_table.get_allocator()); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 hasher hash_function() const { return _hash; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 key_equal key_eq() const { return _equal; }
+
+		#pragma endregion CAPACITY
+
+		#pragma region ITERATORS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 iterator begin() noexcept { return iterator(&_table, _table.next_full(0)); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 iterator end() noexcept { return iterator(&_table, _table.capacity()); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator begin() const noexcept {
+			return const_iterator(&_table, _table.next_full(0));
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator end() const noexcept { return const_iterator(&_table, _table.capacity()); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator cbegin() const noexcept { return begin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator cend() const noexcept { return end(); }
+
+		#pragma endregion ITERATORS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator==(const flat_hash_map& other) const {
+				if (size() != other.size()) { return false; }
+			return std::all_of(begin(), end(), [&other](const value_type& value) {
+				const size_type index = other._find(value.first);
+				return index != _table_type::npos && other._table.slot(index).second == value.second;
+			});
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator!=(const flat_hash_map& other) const { return !(*this == other); }
+	};
+} // namespace mstd
+	#endif
+#endif
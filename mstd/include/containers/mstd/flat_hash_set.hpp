@@ -0,0 +1,205 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_FLAT_HASH_SET_HPP_
+	#define _MSTD_FLAT_HASH_SET_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/assert.hpp>
+		#include <mstd/containers_types.hpp>
+		#include <mstd/flat_hash_table.hpp>
+
+namespace mstd {
+	// unordered_set over one flat array of slots, no allocation per element. Like every open addressing table, inserting
+	// and erasing invalidate the iterators
+	template<class T, class Hash, class KeyEqual, class Allocator>
+	class flat_hash_set {
+	public:
+		using key_type		  = T;
+		using value_type	  = T;
+		using hasher		  = Hash;
+		using key_equal		  = KeyEqual;
+		using allocator_type  = Allocator;
+		using reference		  = const T&;
+		using const_reference = const T&;
+		using size_type		  = size_t;
+		using difference_type = ptrdiff_t;
+
+	private:
+		using _table_type = utils::flat_hash_table<T, Allocator>;
+
+	public:
+		using iterator		 = utils::flat_iterator<_table_type, true>;
+		using const_iterator = utils::flat_iterator<_table_type, true>;
+
+	private:
+		_table_type _table;
+		Hash _hash;
+		KeyEqual _equal;
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type _find(const T& item) const {
+			return _table.find(_hash(item), [this, &item](const T& value) { return _equal(value, item); });
+		}
+
+		template<class U>
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> _insert(U&& item) {
+			const size_type hash = _hash(item);
+			size_type index		 = _table.find(hash, [this, &item](const T& value) { return _equal(value, item); });
+				if (index != _table_type::npos) { return { iterator(&_table, index), false }; }
+
+			index = _table.emplace(hash, [this](const T& value) { return _hash(value); }, std::forward<U>(item));
+			return { iterator(&_table, index), true };
+		}
+
+	public:
+		_MSTD_CONSTEXPR20 flat_hash_set()								= default;
+
+		_MSTD_CONSTEXPR20 flat_hash_set(const flat_hash_set& other)		= default;
+		_MSTD_CONSTEXPR20 flat_hash_set(flat_hash_set&& other) noexcept = default;
+
+		_MSTD_CONSTEXPR20 explicit flat_hash_set(const Allocator& alloc) : _table(alloc) {}
+
+		_MSTD_CONSTEXPR20 flat_hash_set(const std::initializer_list<T>& init, const Allocator& alloc = Allocator())
+			: flat_hash_set(alloc) {
+			insert(init.begin(), init.end());
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<mstd::iterator Iter>
+		#else
+		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 flat_hash_set(const Iter& begin, const Iter& end, const Allocator& alloc = Allocator())
+			: flat_hash_set(alloc) {
+			insert(begin, end);
+		}
+
+		_MSTD_CONSTEXPR20 ~flat_hash_set()										   = default;
+
+		_MSTD_CONSTEXPR20 flat_hash_set& operator=(const flat_hash_set& other)	   = default;
+		_MSTD_CONSTEXPR20 flat_hash_set& operator=(flat_hash_set&& other) noexcept = default;
+
+		#pragma region INSERT
+
+		template<class... Args>
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> emplace(Args&&... args) {
+			return _insert(T(std::forward<Args>(args)...));
+		}
+
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> insert(const T& item) { return _insert(item); }
+
+		_MSTD_CONSTEXPR20 std::pair<iterator, bool> insert(T&& item) { return _insert(std::move(item)); }
+
+		#if _MSTD_HAS_CXX20
+		template<mstd::iterator Iter>
+		#else
+		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 void insert(const Iter& begin, const Iter& end) {
+				for (Iter iter = begin; iter != end; ++iter) { _insert(*iter); }
+		}
+
+		#pragma endregion INSERT
+
+		#pragma region ERASE
+
+		// number of erased elements, 0 or 1
+		_MSTD_CONSTEXPR20 size_type erase(const T& item) {
+			const size_type index = _find(item);
+				if (index == _table_type::npos) { return 0; }
+
+			_table.erase(index);
+			return 1;
+		}
+
+		// returns the element after pos
+		_MSTD_CONSTEXPR20 iterator erase(const const_iterator& pos) {
+			mstd_assert(pos.index() < _table.capacity(), "Pos out of bounds");
+
+			_table.erase(pos.index());
+			return iterator(&_table, _table.next_full(pos.index() + 1));
+		}
+
+		_MSTD_CONSTEXPR20 void clear() noexcept { _table.clear(); }
+
+		_MSTD_CONSTEXPR20 void swap(flat_hash_set& other) noexcept {
+			using std::swap;
+			_table.swap(other._table);
+			swap(_hash, other._hash);
+			swap(_equal, other._equal);
+		}
+
+		#pragma endregion ERASE
+
+		#pragma region ACCESS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const T& item) const { return _find(item) != _table_type::npos; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type count(const T& item) const { return contains(item) ? 1 : 0; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator find(const T& item) const {
+			const size_type index = _find(item);
+			return index != _table_type::npos ? const_iterator(&_table, index) : end();
+		}
+
+		#pragma endregion ACCESS
+
+		#pragma region CAPACITY
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const noexcept { return _table.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _table.empty(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type capacity() const noexcept { return _table.capacity(); }
+
+		// bytes owned by the table
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type memory_usage() const noexcept { return _table.memory_usage(); }
+
+		_MSTD_CONSTEXPR20 void reserve(size_type count) {
+			_table.reserve(count, [this](const T& value) { return _hash(value); });
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return allocator_type(_table.get_allocator()); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 hasher hash_function() const { return _hash; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 key_equal key_eq() const { return _equal; }
+
+		#pragma endregion CAPACITY
+
+		#pragma region ITERATORS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator begin() const noexcept {
+			return const_iterator(&_table, _table.next_full(0));
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator end() const noexcept { return const_iterator(&_table, _table.capacity()); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator cbegin() const noexcept { return begin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator cend() const noexcept { return end(); }
+
+		#pragma endregion ITERATORS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator==(const flat_hash_set& other) const {
+				if (size() != other.size()) { return false; }
+			return std::all_of(begin(), end(), [&other](const T& item) { return other.contains(item); });
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator!=(const flat_hash_set& other) const { return !(*this == other); }
+	};
+} // namespace mstd
+	#endif
+#endif
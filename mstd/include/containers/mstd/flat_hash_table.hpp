@@ -0,0 +1,498 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_FLAT_HASH_TABLE_HPP_
+	#define _MSTD_FLAT_HASH_TABLE_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/containers_types.hpp>
+
+namespace mstd {
+	namespace utils {
+		// 16 control bytes of a flat_hash_table compared at once, a bit per byte in the returned masks
+		class flat_group {
+		public:
+			static _MSTD_CONSTEXPR17 const size_t width = 16;
+
+			static _MSTD_CONSTEXPR17 const int8_t empty	  = -128;
+			static _MSTD_CONSTEXPR17 const int8_t deleted = -2;
+
+		private:
+		#if _MSTD_HAS_SSE2
+			__m128i _ctrl;
+		#else
+			const int8_t* _ctrl;
+		#endif
+
+		public:
+		#if _MSTD_HAS_SSE2
+			explicit flat_group(const int8_t* ctrl) noexcept
+				: _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+		#else
+			explicit flat_group(const int8_t* ctrl) noexcept : _ctrl(ctrl) {}
+		#endif
+
+			[[nodiscard]] uint32_t match(int8_t h2) const noexcept {
+		#if _MSTD_HAS_SSE2
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl)));
+		#else
+				uint32_t mask = 0;
+					for (size_t i = 0; i != width; ++i) { mask |= static_cast<uint32_t>(_ctrl[i] == h2) << i; }
+				return mask;
+		#endif
+			}
+
+			[[nodiscard]] uint32_t match_empty() const noexcept { return match(empty); }
+
+			// empty or deleted, full bytes are never negative
+			[[nodiscard]] uint32_t match_free() const noexcept {
+		#if _MSTD_HAS_SSE2
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), _ctrl)));
+		#else
+				uint32_t mask = 0;
+					for (size_t i = 0; i != width; ++i) { mask |= static_cast<uint32_t>(_ctrl[i] < -1) << i; }
+				return mask;
+		#endif
+			}
+
+			[[nodiscard]] uint32_t match_full() const noexcept { return ~match_free() & ((1u << width) - 1); }
+
+			// index of the lowest set bit, mask can not be 0
+			[[nodiscard]] static _MSTD_CONSTEXPR20 size_t lowest(uint32_t mask) noexcept {
+		#if _MSTD_HAS_CXX20
+				return static_cast<size_t>(std::countr_zero(mask));
+		#elif defined(__GNUC__) || defined(__clang__)
+				return static_cast<size_t>(__builtin_ctz(mask));
+		#else
+				size_t index = 0;
+					for (; (mask & 1u) == 0; mask >>= 1) { ++index; }
+				return index;
+		#endif
+			}
+
+			// index of the highest set bit, mask can not be 0
+			[[nodiscard]] static _MSTD_CONSTEXPR20 size_t highest(uint32_t mask) noexcept {
+		#if _MSTD_HAS_CXX20
+				return static_cast<size_t>(31 - std::countl_zero(mask));
+		#elif defined(__GNUC__) || defined(__clang__)
+				return static_cast<size_t>(31 - __builtin_clz(mask));
+		#else
+				size_t index = 0;
+					for (; mask > 1u; mask >>= 1) { ++index; }
+				return index;
+		#endif
+			}
+		};
+
+		// Open addressing table laid out like SwissTable: a control byte per slot keeping 7 bits of the hash, probed a
+		// group of 16 at a time, then the slots themselves. The table keeps no hasher nor equality, every call takes
+		// them, so a table of indexes can hash through the array the indexes point into instead of storing keys
+		template<class Value, class Allocator>
+		class flat_hash_table {
+		public:
+			using value_type	 = Value;
+			using allocator_type = rebind_alloc_t<Allocator, Value>;
+			using size_type		 = size_t;
+
+			static _MSTD_CONSTEXPR17 const size_type npos = std::numeric_limits<size_type>::max();
+
+		private:
+			using _value_traits = std::allocator_traits<allocator_type>;
+			using _ctrl_alloc	= rebind_alloc_t<Allocator, int8_t>;
+			using _ctrl_traits	= std::allocator_traits<_ctrl_alloc>;
+
+			static _MSTD_CONSTEXPR17 const size_type _width = flat_group::width;
+
+			allocator_type _alloc;
+			int8_t* _ctrl		  = nullptr;
+			Value* _slots		  = nullptr;
+			size_type _capacity	  = 0;
+			size_type _size		  = 0;
+			size_type _growthLeft = 0;
+
+			// std::hash of an integer is the integer, the bits are mixed before being split into h1 and h2
+			[[nodiscard]] static _MSTD_CONSTEXPR20 size_type _mix(size_type hash) noexcept {
+					if _MSTD_CONSTEXPR17 (sizeof(size_type) == 8) {
+						hash *= static_cast<size_type>(0x9E37'79B9'7F4A'7C15);
+						return hash ^ (hash >> (sizeof(size_type) * 4));
+					}
+					else {
+						hash *= static_cast<size_type>(0x9E37'79B9);
+						return hash ^ (hash >> (sizeof(size_type) * 4));
+					}
+			}
+
+			[[nodiscard]] static _MSTD_CONSTEXPR20 size_type _h1(size_type hash) noexcept { return hash >> 7; }
+
+			[[nodiscard]] static _MSTD_CONSTEXPR20 int8_t _h2(size_type hash) noexcept {
+				return static_cast<int8_t>(hash & 0x7F);
+			}
+
+			// a 7/8 load, the empty bytes left are what stops every probe
+			[[nodiscard]] static _MSTD_CONSTEXPR20 size_type _max_load(size_type capacity) noexcept {
+				return capacity - capacity / 8;
+			}
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 bool _is_full(size_type index) const noexcept { return _ctrl[index] >= 0; }
+
+			_MSTD_CONSTEXPR20 void _set_ctrl(size_type index, int8_t ctrl) noexcept {
+				_ctrl[index] = ctrl;
+					// the first group is mirrored past the end, so a group load never wraps around
+					if (index < _width) { _ctrl[_capacity + index] = ctrl; }
+			}
+
+			// first empty or deleted slot on the probe sequence of an already mixed hash
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_type _find_free(size_type hash) const noexcept {
+				const size_type mask = _capacity - 1;
+				size_type pos		 = _h1(hash) & mask;
+					for (size_type step = _width;; step += _width) {
+						const uint32_t free = flat_group(_ctrl + pos).match_free();
+							if (free != 0) { return (pos + flat_group::lowest(free)) & mask; }
+						pos = (pos + step) & mask;
+					}
+			}
+
+			_MSTD_CONSTEXPR20 void _allocate(size_type capacity) {
+				_ctrl_alloc ctrlAlloc(_alloc);
+				int8_t* ctrl = _ctrl_traits::allocate(ctrlAlloc, capacity + _width);
+					try {
+						_slots = _value_traits::allocate(_alloc, capacity);
+					}
+					catch (...) {
+						_ctrl_traits::deallocate(ctrlAlloc, ctrl, capacity + _width);
+						throw;
+					}
+				_ctrl		= ctrl;
+				_capacity	= capacity;
+				_size		= 0;
+				_growthLeft = _max_load(capacity);
+				std::fill_n(_ctrl, capacity + _width, flat_group::empty);
+			}
+
+			_MSTD_CONSTEXPR20 void _deallocate() noexcept {
+					if (_capacity == 0) { return; }
+				_ctrl_alloc ctrlAlloc(_alloc);
+				_ctrl_traits::deallocate(ctrlAlloc, _ctrl, _capacity + _width);
+				_value_traits::deallocate(_alloc, _slots, _capacity);
+				_ctrl		= nullptr;
+				_slots		= nullptr;
+				_capacity	= 0;
+				_size		= 0;
+				_growthLeft = 0;
+			}
+
+			_MSTD_CONSTEXPR20 void _destroy_values() noexcept {
+					if _MSTD_CONSTEXPR17 (std::is_trivially_destructible_v<Value>) { return; }
+					for (size_type i = 0; i != _capacity; ++i) {
+							if (_is_full(i)) { _value_traits::destroy(_alloc, _slots + i); }
+					}
+			}
+
+			// copies or moves every value into the same slot of this freshly allocated table of the same capacity
+			template<bool Move>
+			_MSTD_CONSTEXPR20 void _assign_slots(std::conditional_t<Move, flat_hash_table&, const flat_hash_table&> other) {
+				size_type i = 0;
+					try {
+							for (; i != _capacity; ++i) {
+									if (!other._is_full(i)) { continue; }
+
+									if _MSTD_CONSTEXPR17 (Move) {
+										_value_traits::construct(_alloc, _slots + i, std::move(other._slots[i]));
+									}
+									else { _value_traits::construct(_alloc, _slots + i, other._slots[i]); }
+							}
+					}
+					catch (...) {
+							for (size_type j = 0; j != i; ++j) {
+									if (other._is_full(j)) { _value_traits::destroy(_alloc, _slots + j); }
+							}
+						_deallocate();
+						throw;
+					}
+				std::copy_n(other._ctrl, _capacity + _width, _ctrl);
+				_size		= other._size;
+				_growthLeft = other._growthLeft;
+			}
+
+			_MSTD_CONSTEXPR20 void _steal(flat_hash_table& other) noexcept {
+				_ctrl		= std::exchange(other._ctrl, nullptr);
+				_slots		= std::exchange(other._slots, nullptr);
+				_capacity	= std::exchange(other._capacity, 0);
+				_size		= std::exchange(other._size, 0);
+				_growthLeft = std::exchange(other._growthLeft, 0);
+			}
+
+			// hasher(value) gives back the hash every value was inserted with
+			template<class Hasher>
+			_MSTD_CONSTEXPR20 void _resize(size_type capacity, const Hasher& hasher) {
+				int8_t* oldCtrl			  = _ctrl;
+				Value* oldSlots			  = _slots;
+				const size_type oldCap	  = _capacity;
+				const size_type valueSize = _size;
+
+				_allocate(capacity);
+					for (size_type i = 0; i != oldCap; ++i) {
+							if (oldCtrl[i] < 0) { continue; }
+
+						const size_type hash  = _mix(hasher(static_cast<const Value&>(oldSlots[i])));
+						const size_type index = _find_free(hash);
+						_value_traits::construct(_alloc, _slots + index, std::move(oldSlots[i]));
+						_value_traits::destroy(_alloc, oldSlots + i);
+						_set_ctrl(index, _h2(hash));
+					}
+				_size		= valueSize;
+				_growthLeft = _max_load(capacity) - valueSize;
+
+					if (oldCap != 0) {
+						_ctrl_alloc ctrlAlloc(_alloc);
+						_ctrl_traits::deallocate(ctrlAlloc, oldCtrl, oldCap + _width);
+						_value_traits::deallocate(_alloc, oldSlots, oldCap);
+					}
+			}
+
+			// no free slot is left without using up an empty one: grows, or only drops the tombstones when most of the
+			// load is made of them
+			template<class Hasher>
+			_MSTD_CONSTEXPR20 void _rehash_for_insert(const Hasher& hasher) {
+					if (_capacity == 0) { _resize(_width, hasher); }
+					else if (_size * 2 > _max_load(_capacity)) { _resize(_capacity * 2, hasher); }
+					else { _resize(_capacity, hasher); }
+			}
+
+		public:
+			_MSTD_CONSTEXPR20 flat_hash_table() = default;
+
+			_MSTD_CONSTEXPR20 explicit flat_hash_table(const Allocator& alloc) : _alloc(alloc) {}
+
+			_MSTD_CONSTEXPR20 flat_hash_table(const flat_hash_table& other)
+				: _alloc(_value_traits::select_on_container_copy_construction(other._alloc)) {
+					if (other._capacity == 0) { return; }
+				_allocate(other._capacity);
+				_assign_slots<false>(other);
+			}
+
+			_MSTD_CONSTEXPR20 flat_hash_table(flat_hash_table&& other) noexcept : _alloc(std::move(other._alloc)) {
+				_steal(other);
+			}
+
+			_MSTD_CONSTEXPR20 ~flat_hash_table() {
+				_destroy_values();
+				_deallocate();
+			}
+
+			_MSTD_CONSTEXPR20 flat_hash_table& operator=(const flat_hash_table& other) {
+					if (this == &other) { return *this; }
+
+				_destroy_values();
+				_deallocate();
+					if _MSTD_CONSTEXPR17 (_value_traits::propagate_on_container_copy_assignment::value) { _alloc = other._alloc; }
+					if (other._capacity != 0) {
+						_allocate(other._capacity);
+						_assign_slots<false>(other);
+					}
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 flat_hash_table& operator=(flat_hash_table&& other) noexcept(
+			  _value_traits::propagate_on_container_move_assignment::value || _value_traits::is_always_equal::value) {
+					if (this == &other) { return *this; }
+
+				_destroy_values();
+				_deallocate();
+					if _MSTD_CONSTEXPR17 (_value_traits::propagate_on_container_move_assignment::value) {
+						_alloc = std::move(other._alloc);
+						_steal(other);
+					}
+					else if (_alloc == other._alloc) { _steal(other); }
+					else if (other._capacity != 0) {
+						// memory of another resource can not be taken over, the values move one by one
+						_allocate(other._capacity);
+						_assign_slots<true>(other);
+						other.clear();
+					}
+				return *this;
+			}
+
+			// slot of the value pred accepts among the ones stored with hash, npos when there is none
+			template<class Pred>
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_type find(size_type hash, const Pred& pred) const {
+					if (_size == 0) { return npos; }
+
+				hash				 = _mix(hash);
+				const int8_t h2		 = _h2(hash);
+				const size_type mask = _capacity - 1;
+				size_type pos		 = _h1(hash) & mask;
+					for (size_type step = _width;; step += _width) {
+						const flat_group group(_ctrl + pos);
+							for (uint32_t match = group.match(h2); match != 0; match &= match - 1) {
+								const size_type index = (pos + flat_group::lowest(match)) & mask;
+									if (pred(static_cast<const Value&>(_slots[index]))) { return index; }
+							}
+							if (group.match_empty() != 0) { return npos; }
+						pos = (pos + step) & mask;
+					}
+			}
+
+			// constructs a value that is not in the table yet, returns its slot. Hasher rehashes the stored values when
+			// the table has to grow
+			template<class Hasher, class... Args>
+			_MSTD_CONSTEXPR20 size_type emplace(size_type hash, const Hasher& hasher, Args&&... args) {
+				hash			= _mix(hash);
+				size_type index = _capacity != 0 ? _find_free(hash) : npos;
+					if (index == npos || (_growthLeft == 0 && _ctrl[index] == flat_group::empty)) {
+						_rehash_for_insert(hasher);
+						index = _find_free(hash);
+					}
+
+				_value_traits::construct(_alloc, _slots + index, std::forward<Args>(args)...);
+					if (_ctrl[index] == flat_group::empty) { --_growthLeft; }
+				_set_ctrl(index, _h2(hash));
+				++_size;
+				return index;
+			}
+
+			_MSTD_CONSTEXPR20 void erase(size_type index) noexcept {
+				_value_traits::destroy(_alloc, _slots + index);
+				--_size;
+
+				// every window of a group holding the slot also holds an empty byte, so no probe ever went past it and
+				// it can go back to empty instead of leaving a tombstone
+				const uint32_t emptyAfter  = flat_group(_ctrl + index).match_empty();
+				const uint32_t emptyBefore = flat_group(_ctrl + ((index - _width) & (_capacity - 1))).match_empty();
+					if (emptyBefore != 0 && emptyAfter != 0 &&
+						(_width - 1 - flat_group::highest(emptyBefore)) + flat_group::lowest(emptyAfter) < _width) {
+						_set_ctrl(index, flat_group::empty);
+						++_growthLeft;
+					}
+					else { _set_ctrl(index, flat_group::deleted); }
+			}
+
+			_MSTD_CONSTEXPR20 void clear() noexcept {
+					if (_capacity == 0) { return; }
+				_destroy_values();
+				std::fill_n(_ctrl, _capacity + _width, flat_group::empty);
+				_size		= 0;
+				_growthLeft = _max_load(_capacity);
+			}
+
+			// room for count values without growing
+			template<class Hasher>
+			_MSTD_CONSTEXPR20 void reserve(size_type count, const Hasher& hasher) {
+					if (count <= _size + _growthLeft) { return; }
+
+				size_type capacity = std::max(_capacity, _width);
+					while (_max_load(capacity) < count) { capacity *= 2; }
+				_resize(capacity, hasher);
+			}
+
+			_MSTD_CONSTEXPR20 void swap(flat_hash_table& other) noexcept {
+					if _MSTD_CONSTEXPR17 (_value_traits::propagate_on_container_swap::value) {
+						using std::swap;
+						swap(_alloc, other._alloc);
+					}
+				std::swap(_ctrl, other._ctrl);
+				std::swap(_slots, other._slots);
+				std::swap(_capacity, other._capacity);
+				std::swap(_size, other._size);
+				std::swap(_growthLeft, other._growthLeft);
+			}
+
+			// first full slot from index on, capacity() when there is none
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_type next_full(size_type index) const noexcept {
+					for (; index < _capacity; index += _width) {
+						const uint32_t full = flat_group(_ctrl + index).match_full();
+							// a hit past the end is in the mirrored bytes, there was nothing before it
+							if (full != 0) { return std::min(index + flat_group::lowest(full), _capacity); }
+					}
+				return _capacity;
+			}
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 Value& slot(size_type index) noexcept { return _slots[index]; }
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 const Value& slot(size_type index) const noexcept { return _slots[index]; }
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const noexcept { return _size; }
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _size == 0; }
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_type capacity() const noexcept { return _capacity; }
+
+			// bytes of the control bytes and slots
+			[[nodiscard]] _MSTD_CONSTEXPR20 size_type memory_usage() const noexcept {
+				return _capacity == 0 ? 0 : _capacity + _width + _capacity * sizeof(Value);
+			}
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return _alloc; }
+		};
+
+		// forward iterator over the full slots of a flat_hash_table
+		template<class Table, bool Const>
+		class flat_iterator {
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= _MSTD_TYPENAME17 Table::value_type;
+			using difference_type	= ptrdiff_t;
+			using pointer			= std::conditional_t<Const, const value_type*, value_type*>;
+			using reference			= std::conditional_t<Const, const value_type&, value_type&>;
+
+		private:
+			using _table_type = std::conditional_t<Const, const Table, Table>;
+			using _size_type  = _MSTD_TYPENAME17 Table::size_type;
+
+			_table_type* _table = nullptr;
+			_size_type _index	= 0;
+
+			template<class, bool>
+			friend class flat_iterator;
+
+		public:
+			_MSTD_CONSTEXPR20 flat_iterator() = default;
+
+			_MSTD_CONSTEXPR20 flat_iterator(_table_type* table, _size_type index) noexcept : _table(table), _index(index) {}
+
+			// iterator to const_iterator
+			template<bool OtherConst, std::enable_if_t<Const && !OtherConst, bool> = true>
+			_MSTD_CONSTEXPR20 flat_iterator(const flat_iterator<Table, OtherConst>& other) noexcept
+				: _table(other._table), _index(other._index) {}
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 _size_type index() const noexcept { return _index; }
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 reference operator*() const { return _table->slot(_index); }
+
+			[[nodiscard]] _MSTD_CONSTEXPR20 pointer operator->() const { return &_table->slot(_index); }
+
+			_MSTD_CONSTEXPR20 flat_iterator& operator++() {
+				_index = _table->next_full(_index + 1);
+				return *this;
+			}
+
+			_MSTD_CONSTEXPR20 flat_iterator operator++(int) {
+				flat_iterator old = *this;
+				++*this;
+				return old;
+			}
+
+			[[nodiscard]] friend _MSTD_CONSTEXPR20 bool operator==(const flat_iterator& a, const flat_iterator& b) noexcept {
+				return a._index == b._index;
+			}
+
+			[[nodiscard]] friend _MSTD_CONSTEXPR20 bool operator!=(const flat_iterator& a, const flat_iterator& b) noexcept {
+				return a._index != b._index;
+			}
+		};
+	} // namespace utils
+} // namespace mstd
+	#endif
+#endif
@@ -0,0 +1,303 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_LINKED_ORDERED_SET_HPP_
+	#define _MSTD_LINKED_ORDERED_SET_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/assert.hpp>
+		#include <mstd/containers_types.hpp>
+		#include <mstd/flat_hash_table.hpp>
+
+namespace mstd {
+	// ordered_set over a dense array linked into a list by indexes, erase and insert at any position are O(1) average.
+	// Elements are hashed, so unlike ordered_set they can only be reached as const
+	template<class T, class Allocator>
+	class linked_ordered_set {
+	public:
+		using value_type	  = T;
+		using allocator_type  = Allocator;
+		using reference		  = const T&;
+		using const_reference = const T&;
+		using size_type		  = size_t;
+		using difference_type = ptrdiff_t;
+
+		using iterator				 = utils::linked_iterator<linked_ordered_set, true>;
+		using const_iterator		 = utils::linked_iterator<linked_ordered_set, true>;
+		using reverse_iterator		 = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	private:
+		static _MSTD_CONSTEXPR17 const size_type _npos = std::numeric_limits<size_type>::max();
+
+		struct _node {
+			T value;
+			size_type previous;
+			size_type next;
+		};
+
+		using _nodes_type		= std::vector<_node, rebind_alloc_t<Allocator, _node> >;
+		using _index_table_type = utils::flat_hash_table<size_type, Allocator>;
+
+		_nodes_type _nodes;
+		_index_table_type _indexes;
+		size_type _head = _npos;
+		size_type _tail = _npos;
+
+		template<class, bool>
+		friend class utils::linked_iterator;
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type _hash_at(size_type index) const {
+			return std::hash<T>()(_nodes[index].value);
+		}
+
+		// the index table keeps indexes only and hashes through the nodes
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type _find_slot(const T& item) const {
+			return _indexes.find(std::hash<T>()(item), [this, &item](size_type index) { return _nodes[index].value == item; });
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type _find_index(const T& item) const {
+			const size_type slot = _find_slot(item);
+			return slot != _index_table_type::npos ? _indexes.slot(slot) : _npos;
+		}
+
+		// links the node before next, _npos links it at the back
+		_MSTD_CONSTEXPR20 void _link(size_type index, size_type next) noexcept {
+			const size_type previous = next == _npos ? _tail : _nodes[next].previous;
+			_nodes[index].previous	 = previous;
+			_nodes[index].next		 = next;
+
+				if (previous == _npos) { _head = index; }
+				else { _nodes[previous].next = index; }
+
+				if (next == _npos) { _tail = index; }
+				else { _nodes[next].previous = index; }
+		}
+
+		_MSTD_CONSTEXPR20 void _unlink(size_type index) noexcept {
+			const _node& node = _nodes[index];
+
+				if (node.previous == _npos) { _head = node.next; }
+				else { _nodes[node.previous].next = node.next; }
+
+				if (node.next == _npos) { _tail = node.previous; }
+				else { _nodes[node.next].previous = node.previous; }
+		}
+
+		// index has to be unlinked and out of the map already, the last node moves into its place
+		_MSTD_CONSTEXPR20 void _remove(size_type index) {
+			const size_type last = _nodes.size() - 1;
+				if (index != last) {
+					_nodes[index] = std::move(_nodes[last]);
+
+					const _node& moved = _nodes[index];
+						if (moved.previous == _npos) { _head = index; }
+						else { _nodes[moved.previous].next = index; }
+
+						if (moved.next == _npos) { _tail = index; }
+						else { _nodes[moved.next].previous = index; }
+
+					_indexes.slot(_indexes.find(_hash_at(index), [last](size_type stored) { return stored == last; })) = index;
+				}
+			_nodes.pop_back();
+		}
+
+		template<class U>
+		_MSTD_CONSTEXPR20 size_type _insert(size_type where, U&& item) {
+			const size_type slot = _find_slot(item);
+				if (slot != _index_table_type::npos) {
+					// move the element to where
+					const size_type index = _indexes.slot(slot);
+						if (index != where) {
+							_unlink(index);
+							_link(index, where);
+						}
+					return index;
+				}
+
+			// reserved first, the index table can not rehash through a node that is not there yet
+			const size_type index = _nodes.size();
+			_indexes.reserve(index + 1, [this](size_type stored) { return _hash_at(stored); });
+			_nodes.push_back(_node{ T(std::forward<U>(item)), _npos, _npos });
+			_indexes.emplace(_hash_at(index), [this](size_type stored) { return _hash_at(stored); }, index);
+			_link(index, where);
+			return index;
+		}
+
+	public:
+		_MSTD_CONSTEXPR20 linked_ordered_set()									  = default;
+
+		_MSTD_CONSTEXPR20 linked_ordered_set(const linked_ordered_set& other)	  = default;
+		_MSTD_CONSTEXPR20 linked_ordered_set(linked_ordered_set&& other) noexcept = default;
+
+		_MSTD_CONSTEXPR20 explicit linked_ordered_set(const Allocator& alloc) : _nodes(alloc), _indexes(alloc) {}
+
+		_MSTD_CONSTEXPR20 linked_ordered_set(const std::initializer_list<T>& init, const Allocator& alloc = Allocator())
+			: linked_ordered_set(alloc) {
+			insert_back(init.begin(), init.end());
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<mstd::iterator Iter>
+		#else
+		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 linked_ordered_set(const Iter& begin, const Iter& end, const Allocator& alloc = Allocator())
+			: linked_ordered_set(alloc) {
+			insert_back(begin, end);
+		}
+
+		_MSTD_CONSTEXPR20 ~linked_ordered_set()												 = default;
+
+		_MSTD_CONSTEXPR20 linked_ordered_set& operator=(const linked_ordered_set& other)	 = default;
+		_MSTD_CONSTEXPR20 linked_ordered_set& operator=(linked_ordered_set&& other) noexcept = default;
+
+		#pragma region INSERT
+
+		template<class... Args>
+		_MSTD_CONSTEXPR20 const T& emplace(const const_iterator& where, Args&&... args) {
+			return _nodes[_insert(where._index, T(std::forward<Args>(args)...))].value;
+		}
+
+		template<class... Args>
+		_MSTD_CONSTEXPR20 const T& emplace_back(Args&&... args) {
+			return emplace(cend(), std::forward<Args>(args)...);
+		}
+
+		// an existing element moves before where
+		_MSTD_CONSTEXPR20 const T& insert(const const_iterator& where, const T& item) {
+			return _nodes[_insert(where._index, item)].value;
+		}
+
+		_MSTD_CONSTEXPR20 const T& insert(const const_iterator& where, T&& item) {
+			return _nodes[_insert(where._index, std::move(item))].value;
+		}
+
+		#if _MSTD_HAS_CXX20
+		template<mstd::iterator Iter>
+		#else
+		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 void insert(const const_iterator& where, const Iter& begin, const Iter& end) {
+				for (Iter iter = begin; iter != end; ++iter) { insert(where, *iter); }
+		}
+
+		_MSTD_CONSTEXPR20 const T& insert_back(const T& item) { return insert(cend(), item); }
+
+		_MSTD_CONSTEXPR20 const T& insert_back(T&& item) { return insert(cend(), std::move(item)); }
+
+		#if _MSTD_HAS_CXX20
+		template<mstd::iterator Iter>
+		#else
+		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
+		#endif
+		_MSTD_CONSTEXPR20 void insert_back(const Iter& begin, const Iter& end) {
+			insert(cend(), begin, end);
+		}
+
+		#pragma endregion INSERT
+
+		#pragma region ERASE
+
+		_MSTD_CONSTEXPR20 void erase(const T& item) {
+			const size_type slot = _find_slot(item);
+				if (slot == _index_table_type::npos) { return; }
+
+			const size_type index = _indexes.slot(slot);
+			_indexes.erase(slot);
+			_unlink(index);
+			_remove(index);
+		}
+
+		// returns the element after pos
+		_MSTD_CONSTEXPR20 iterator erase(const const_iterator& pos) {
+			mstd_assert(pos._index < _nodes.size(), "Pos out of bounds");
+
+			const size_type index = pos._index;
+			size_type next		  = _nodes[index].next;
+				// the last node is about to move into the hole
+				if (next == _nodes.size() - 1) { next = index; }
+
+			erase(_nodes[index].value);
+			return iterator(this, next);
+		}
+
+		_MSTD_CONSTEXPR20 void clear() noexcept {
+			_indexes.clear();
+			_nodes.clear();
+			_head = _npos;
+			_tail = _npos;
+		}
+
+		#pragma endregion ERASE
+
+		#pragma region ACCESS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const T& item) const { return _find_slot(item) != _index_table_type::npos; }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator find(const T& item) const {
+			return const_iterator(this, _find_index(item));
+		}
+
+		#pragma endregion ACCESS
+
+		#pragma region CAPACITY
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const noexcept { return _nodes.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _nodes.empty(); }
+
+		_MSTD_CONSTEXPR20 void reserve(size_type capacity) {
+			_nodes.reserve(capacity);
+			_indexes.reserve(capacity, [this](size_type stored) { return _hash_at(stored); });
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return _nodes.get_allocator(); }
+
+		#pragma endregion CAPACITY
+
+		#pragma region ITERATORS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator begin() const noexcept { return const_iterator(this, _head); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator end() const noexcept { return const_iterator(this, _npos); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator cbegin() const noexcept { return begin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator cend() const noexcept { return end(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator rbegin() const noexcept {
+			return const_reverse_iterator(end());
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator rend() const noexcept {
+			return const_reverse_iterator(begin());
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator crend() const noexcept { return rend(); }
+
+		#pragma endregion ITERATORS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator==(const linked_ordered_set& other) const {
+			return size() == other.size() && std::equal(begin(), end(), other.begin());
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator!=(const linked_ordered_set& other) const { return !(*this == other); }
+	};
+} // namespace mstd
+	#endif
+#endif
@@ -19,19 +19,21 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 
 		#include <mstd/assert.hpp>
 		#include <mstd/containers_types.hpp>
+		#include <mstd/flat_hash_table.hpp>
 
 namespace mstd {
-	template<class Key, class T>
+	template<class Key, class T, class Allocator>
 	class ordered_map {
 	public:
 		using key_type		  = Key;
 		using mapped_type	  = T;
 		using value_type	  = std::pair<Key, T>;
+		using allocator_type  = Allocator;
 		using reference		  = value_type&;
 		using const_reference = const value_type&;
 
 	private:
-		using _data_type = std::vector<value_type>;
+		using _data_type = std::vector<value_type, Allocator>;
 
 	public:
 		using size_type				 = _MSTD_TYPENAME17 _data_type::size_type;
@@ -42,36 +44,80 @@ namespace mstd {
 		using const_reverse_iterator = _MSTD_TYPENAME17 _data_type::const_reverse_iterator;
 
 	private:
-		using _map_type = std::unordered_map<Key, size_type>;
+		// indexes into _orderedElements only, hashed through the elements so no key is stored twice
+		using _index_table_type = utils::flat_hash_table<size_type, Allocator>;
+
+		static _MSTD_CONSTEXPR17 const size_type _npos = _index_table_type::npos;
 
 		_data_type _orderedElements;
-		_map_type _elementsMap;
+		_index_table_type _indexes;
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type _hash_at(size_type index) const {
+			return std::hash<Key>()(_orderedElements[index].first);
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type _find_slot(const Key& key) const {
+			return _indexes.find(std::hash<Key>()(key),
+			  [this, &key](size_type index) { return _orderedElements[index].first == key; });
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type _find_index(const Key& key) const {
+			const size_type slot = _find_slot(key);
+			return slot != _npos ? _indexes.slot(slot) : _npos;
+		}
 
-		_MSTD_CONSTEXPR20 void _update_indexes(const size_type& from) {
-				for (size_type i = from; i != _orderedElements.size(); ++i) { _elementsMap[_orderedElements[i].first] = i; }
+		_MSTD_CONSTEXPR20 void _reserve_index() {
+			_indexes.reserve(_orderedElements.size() + 1, [this](size_type index) { return _hash_at(index); });
+		}
+
+		// room has to be reserved, inserting can not rehash through elements that already moved
+		_MSTD_CONSTEXPR20 void _insert_index(size_type index) {
+			_indexes.emplace(_hash_at(index), [this](size_type stored) { return _hash_at(stored); }, index);
+		}
+
+		// the element now at to was at from. The stored indexes are stale, so it is found by its hash and old index
+		_MSTD_CONSTEXPR20 void _move_index(size_type from, size_type to) {
+			_indexes.slot(_indexes.find(_hash_at(to), [from](size_type index) { return index == from; })) = to;
+		}
+
+		// elements now in [first, last) were one place further, walked forward so no old index is looked up after
+		// another element took it
+		_MSTD_CONSTEXPR20 void _shift_indexes_down(size_type first, size_type last) {
+				for (size_type i = first; i != last; ++i) { _move_index(i + 1, i); }
+		}
+
+		// elements now in [first, last) were one place closer, walked backward
+		_MSTD_CONSTEXPR20 void _shift_indexes_up(size_type first, size_type last) {
+				for (size_type i = last; i != first; --i) { _move_index(i - 2, i - 1); }
 		}
 
 	public:
-		_MSTD_CONSTEXPR20 ordered_map()										= default;
+		_MSTD_CONSTEXPR20 ordered_map()								= default;
+
+		_MSTD_CONSTEXPR20 ordered_map(const ordered_map& other)		= default;
+		_MSTD_CONSTEXPR20 ordered_map(ordered_map&& other) noexcept = default;
 
-		_MSTD_CONSTEXPR20 ordered_map(const ordered_map<Key, T>& other)		= default;
-		_MSTD_CONSTEXPR20 ordered_map(ordered_map<Key, T>&& other) noexcept = default;
+		_MSTD_CONSTEXPR20 explicit ordered_map(const Allocator& alloc) : _orderedElements(alloc), _indexes(alloc) {}
 
-		_MSTD_CONSTEXPR20 ordered_map(const std::initializer_list<value_type>& init) { insert_back(init.begin(), init.end()); }
+		_MSTD_CONSTEXPR20 ordered_map(const std::initializer_list<value_type>& init, const Allocator& alloc = Allocator())
+			: ordered_map(alloc) {
+			insert_back(init.begin(), init.end());
+		}
 
 		#if _MSTD_HAS_CXX20
 		template<mstd::iterator Iter>
 		#else
 		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
 		#endif
-		_MSTD_CONSTEXPR20 ordered_map(const Iter& begin, const Iter& end) {
+		_MSTD_CONSTEXPR20 ordered_map(const Iter& begin, const Iter& end, const Allocator& alloc = Allocator())
+			: ordered_map(alloc) {
 			insert_back(begin, end);
 		}
 
 		_MSTD_CONSTEXPR20 ~ordered_map()											   = default;
 
-		_MSTD_CONSTEXPR20 ordered_map& operator=(const ordered_map<Key, T>& other)	   = default;
-		_MSTD_CONSTEXPR20 ordered_map& operator=(ordered_map<Key, T>&& other) noexcept = default;
+		_MSTD_CONSTEXPR20 ordered_map& operator=(const ordered_map& other)	   = default;
+		_MSTD_CONSTEXPR20 ordered_map& operator=(ordered_map&& other) noexcept = default;
 
 		_MSTD_CONSTEXPR20 T& emplace(const const_iterator& where, const Key& key, const T& value) {
 			return insert(where, std::make_pair(key, value));
@@ -80,33 +126,38 @@ namespace mstd {
 		_MSTD_CONSTEXPR20 T& emplace_back(const Key& key, const T& value) { return emplace(cend(), key, value); }
 
 		_MSTD_CONSTEXPR20 T& insert(const const_iterator& where, const value_type& value) {
-				if (!contains(value.first)) {
-					// insert at where and set value (after update iterators in map)
-					size_type whereOffset = std::distance(_orderedElements.cbegin(), where);
+			const size_type slot = _find_slot(value.first);
+				if (slot == _npos) {
+					// insert at where and move the indexes after it
+					const size_type whereOffset = std::distance(_orderedElements.cbegin(), where);
 
+					_reserve_index();
 					_orderedElements.insert(where, value);
+					_shift_indexes_up(whereOffset + 1, _orderedElements.size());
+					_insert_index(whereOffset);
 
-					_update_indexes(whereOffset);
-
-					return _orderedElements.at(_elementsMap.at(value.first)).second;
+					return _orderedElements[whereOffset].second;
 				}
 
-			// move key to where and change value (after update iterators in map)
-			size_type whereOffset =
+			// move key to where and change value, only the indexes between the two places change
+			const size_type whereOffset =
 			  std::clamp<size_type>(std::distance(_orderedElements.cbegin(), where), 0, _orderedElements.size() - 1);
-			const size_type& elemOffset = _elementsMap.at(value.first);
+			const size_type elemOffset = _indexes.slot(slot);
+			const auto elements		   = _orderedElements.begin();
 
-			// remove elem
-			_orderedElements.erase(std::next(_orderedElements.begin(), elemOffset));
-
-			// insert new elem
-			_orderedElements.insert(std::next(_orderedElements.begin(), whereOffset), value);
-
-				// update iterators in map
-				if (whereOffset > elemOffset) { _update_indexes(elemOffset); }
-				else { _update_indexes(whereOffset); }
+			_indexes.slot(slot) = _npos;
+				if (whereOffset > elemOffset) {
+					std::rotate(elements + elemOffset, elements + elemOffset + 1, elements + whereOffset + 1);
+					_shift_indexes_down(elemOffset, whereOffset);
+				}
+				else {
+					std::rotate(elements + whereOffset, elements + elemOffset, elements + elemOffset + 1);
+					_shift_indexes_up(whereOffset + 1, elemOffset + 1);
+				}
+			_indexes.slot(slot)			  = whereOffset;
+			_orderedElements[whereOffset] = value;
 
-			return _orderedElements.at(_elementsMap.at(value.first)).second;
+			return _orderedElements[whereOffset].second;
 		}
 
 		#if _MSTD_HAS_CXX20
@@ -134,52 +185,51 @@ namespace mstd {
 		}
 
 		_MSTD_CONSTEXPR20 void erase(const Key& key) {
-				if (!contains(key)) { return; }
+			const size_type slot = _find_slot(key);
+				if (slot == _npos) { return; }
 
-			size_type elementOffset = _elementsMap.at(key);
+			const size_type elementOffset = _indexes.slot(slot);
 
+			_indexes.erase(slot);
 			_orderedElements.erase(std::next(_orderedElements.begin(), elementOffset));
-			_elementsMap.erase(key);
 
-			_update_indexes(elementOffset);
+			_shift_indexes_down(elementOffset, _orderedElements.size());
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 T& at(const Key& key) {
-				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) { mstd_assert(contains(key), "Key '{}' not found", key); }
-				else { mstd_assert(contains(key), "Key not found"); }
-			return _orderedElements.at(_elementsMap.at(key)).second;
+			const size_type index = _find_index(key);
+				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) { mstd_assert(index != _npos, "Key '{}' not found", key); }
+				else { mstd_assert(index != _npos, "Key not found"); }
+			return _orderedElements.at(index).second;
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const T& at(const Key& key) const {
-				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) { mstd_assert(contains(key), "Key '{}' not found", key); }
-				else { mstd_assert(contains(key), "Key not found"); }
-			return _orderedElements.at(_elementsMap.at(key)).second;
+			const size_type index = _find_index(key);
+				if _MSTD_CONSTEXPR17 (fmt::is_formattable<Key>::value) { mstd_assert(index != _npos, "Key '{}' not found", key); }
+				else { mstd_assert(index != _npos, "Key not found"); }
+			return _orderedElements.at(index).second;
 		}
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const { return _elementsMap.size(); }
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const { return _orderedElements.size(); }
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const { return _elementsMap.empty(); }
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const { return _orderedElements.empty(); }
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const Key& key) const {
-		#if _MSTD_HAS_CXX20
-			return _elementsMap.contains(key);
-		#else
-			return _elementsMap.find(key) != _elementsMap.end();
-		#endif
-		}
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return _orderedElements.get_allocator(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const Key& key) const { return _find_slot(key) != _npos; }
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 iterator find(const Key& key) {
-			auto it = _elementsMap.find(key);
-			return it != _elementsMap.end() ? std::next(_orderedElements.begin(), it->second) : _orderedElements.end();
+			const size_type index = _find_index(key);
+			return index != _npos ? std::next(_orderedElements.begin(), index) : _orderedElements.end();
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator find(const Key& key) const {
-			auto it = _elementsMap.find(key);
-			return it != _elementsMap.end() ? std::next(_orderedElements.begin(), it->second) : _orderedElements.end();
+			const size_type index = _find_index(key);
+			return index != _npos ? std::next(_orderedElements.begin(), index) : _orderedElements.end();
 		}
 
 		_MSTD_CONSTEXPR20 void clear() {
-			_elementsMap.clear();
+			_indexes.clear();
 			_orderedElements.clear();
 		}
 
@@ -208,17 +258,18 @@ namespace mstd {
 		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator crend() const { return _orderedElements.crend(); }
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 T& operator[](const Key& key) {
-				if (!contains(key)) { return emplace_back(key, T()); }
-			return at(key);
+			const size_type index = _find_index(key);
+				if (index == _npos) { return emplace_back(key, T()); }
+			return _orderedElements[index].second;
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const T& operator[](const Key& key) const { return at(key); }
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator==(const ordered_map<Key, T>& other) const {
-			return _orderedElements == other._orderedElements && _elementsMap == other._elementsMap;
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator==(const ordered_map& other) const {
+			return _orderedElements == other._orderedElements;
 		}
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator!=(const ordered_map<Key, T>& other) const { return !(*this == other); }
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator!=(const ordered_map& other) const { return !(*this == other); }
 	};
 } // namespace mstd
 	#endif
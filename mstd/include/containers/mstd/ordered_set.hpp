@@ -18,23 +18,62 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 	#else
 
 		#include <mstd/containers_types.hpp>
+		#include <mstd/flat_hash_table.hpp>
 
 namespace mstd {
-	template<class T>
+	template<class T, class Allocator>
 	class ordered_set {
 	public:
 		using value_type			 = T;
-		using iterator				 = _MSTD_TYPENAME17 std::vector<T>::iterator;
-		using const_iterator		 = _MSTD_TYPENAME17 std::vector<T>::const_iterator;
-		using reverse_iterator		 = _MSTD_TYPENAME17 std::vector<T>::reverse_iterator;
-		using const_reverse_iterator = _MSTD_TYPENAME17 std::vector<T>::const_reverse_iterator;
+		using allocator_type		 = Allocator;
+		using iterator				 = _MSTD_TYPENAME17 std::vector<T, Allocator>::iterator;
+		using const_iterator		 = _MSTD_TYPENAME17 std::vector<T, Allocator>::const_iterator;
+		using reverse_iterator		 = _MSTD_TYPENAME17 std::vector<T, Allocator>::reverse_iterator;
+		using const_reverse_iterator = _MSTD_TYPENAME17 std::vector<T, Allocator>::const_reverse_iterator;
 
 	private:
-		std::vector<T> _orderedElements;
-		std::unordered_map<T, size_t> _elementsMap;
+		// indexes into _orderedElements only, hashed through the elements so no element is stored twice
+		using _index_table_type = utils::flat_hash_table<size_t, Allocator>;
 
-		_MSTD_CONSTEXPR20 void _update_indexes(const size_t& from) {
-				for (size_t i = from; i != _orderedElements.size(); ++i) { _elementsMap[_orderedElements[i]] = i; }
+		static _MSTD_CONSTEXPR17 const size_t _npos = _index_table_type::npos;
+
+		std::vector<T, Allocator> _orderedElements;
+		_index_table_type _indexes;
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t _hash_at(size_t index) const { return std::hash<T>()(_orderedElements[index]); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t _find_slot(const T& item) const {
+			return _indexes.find(std::hash<T>()(item), [this, &item](size_t index) { return _orderedElements[index] == item; });
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_t _find_index(const T& item) const {
+			const size_t slot = _find_slot(item);
+			return slot != _npos ? _indexes.slot(slot) : _npos;
+		}
+
+		_MSTD_CONSTEXPR20 void _reserve_index() {
+			_indexes.reserve(_orderedElements.size() + 1, [this](size_t index) { return _hash_at(index); });
+		}
+
+		// room has to be reserved, inserting can not rehash through elements that already moved
+		_MSTD_CONSTEXPR20 void _insert_index(size_t index) {
+			_indexes.emplace(_hash_at(index), [this](size_t stored) { return _hash_at(stored); }, index);
+		}
+
+		// the element now at to was at from. The stored indexes are stale, so it is found by its hash and old index
+		_MSTD_CONSTEXPR20 void _move_index(size_t from, size_t to) {
+			_indexes.slot(_indexes.find(_hash_at(to), [from](size_t index) { return index == from; })) = to;
+		}
+
+		// elements now in [first, last) were one place further, walked forward so no old index is looked up after
+		// another element took it
+		_MSTD_CONSTEXPR20 void _shift_indexes_down(size_t first, size_t last) {
+				for (size_t i = first; i != last; ++i) { _move_index(i + 1, i); }
+		}
+
+		// elements now in [first, last) were one place closer, walked backward
+		_MSTD_CONSTEXPR20 void _shift_indexes_up(size_t first, size_t last) {
+				for (size_t i = last; i != first; --i) { _move_index(i - 2, i - 1); }
 		}
 
 	public:
@@ -43,14 +82,20 @@ namespace mstd {
 		_MSTD_CONSTEXPR20 ordered_set(const ordered_set& other)		= default;
 		_MSTD_CONSTEXPR20 ordered_set(ordered_set&& other) noexcept = default;
 
-		_MSTD_CONSTEXPR20 ordered_set(const std::initializer_list<T>& init) { insert_back(init.begin(), init.end()); }
+		_MSTD_CONSTEXPR20 explicit ordered_set(const Allocator& alloc) : _orderedElements(alloc), _indexes(alloc) {}
+
+		_MSTD_CONSTEXPR20 ordered_set(const std::initializer_list<T>& init, const Allocator& alloc = Allocator())
+			: ordered_set(alloc) {
+			insert_back(init.begin(), init.end());
+		}
 
 		#if _MSTD_HAS_CXX20
 		template<mstd::iterator Iter>
 		#else
 		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
 		#endif
-		_MSTD_CONSTEXPR20 ordered_set(const Iter& begin, const Iter& end) {
+		_MSTD_CONSTEXPR20 ordered_set(const Iter& begin, const Iter& end, const Allocator& alloc = Allocator())
+			: ordered_set(alloc) {
 			insert_back(begin, end);
 		}
 
@@ -59,15 +104,10 @@ namespace mstd {
 		_MSTD_CONSTEXPR20 ordered_set& operator=(const ordered_set& other)	   = default;
 		_MSTD_CONSTEXPR20 ordered_set& operator=(ordered_set&& other) noexcept = default;
 
+		// an element already in the set moves to where, like insert
 		template<class... Args>
 		_MSTD_CONSTEXPR20 T& emplace(const const_iterator& where, const Args&... args) {
-			size_t whereOffset = std::clamp<size_t>(std::distance(_orderedElements.begin(), where), 0, _orderedElements.size());
-
-			_orderedElements.emplace(where, args...);
-
-			_update_indexes(whereOffset);
-
-			return *std::next(_orderedElements.begin(), where);
+			return insert(where, T(args...));
 		}
 
 		template<class... Args>
@@ -76,31 +116,37 @@ namespace mstd {
 		}
 
 		_MSTD_CONSTEXPR20 T& insert(const const_iterator& where, const T& item) {
-				if (!contains(item)) {
-					size_t whereOffset =
+			const size_t slot = _find_slot(item);
+				if (slot == _npos) {
+					const size_t whereOffset =
 					  std::clamp<size_t>(std::distance(_orderedElements.cbegin(), where), 0, _orderedElements.size());
 
+					_reserve_index();
 					_orderedElements.insert(where, item);
+					_shift_indexes_up(whereOffset + 1, _orderedElements.size());
+					_insert_index(whereOffset);
 
-					_update_indexes(whereOffset);
-					return *std::next(_orderedElements.begin(), whereOffset);
+					return _orderedElements[whereOffset];
 				}
 
-			size_t whereOffset =
+			// only the indexes between the two places change
+			const size_t whereOffset =
 			  std::clamp<size_t>(std::distance(_orderedElements.cbegin(), where), 0, _orderedElements.size() - 1);
-			const size_t& elementOffset = _elementsMap.at(item);
-
-			// remove element
-			_orderedElements.erase(std::next(_orderedElements.cbegin(), elementOffset));
-
-			// insert element where
-			_orderedElements.insert(std::next(_orderedElements.cbegin(), whereOffset), item);
+			const size_t elementOffset = _indexes.slot(slot);
+			const auto elements		   = _orderedElements.begin();
 
-				// update iterators
-				if (whereOffset > elementOffset) { _update_indexes(elementOffset); }
-				else { _update_indexes(whereOffset); }
+			_indexes.slot(slot) = _npos;
+				if (whereOffset > elementOffset) {
+					std::rotate(elements + elementOffset, elements + elementOffset + 1, elements + whereOffset + 1);
+					_shift_indexes_down(elementOffset, whereOffset);
+				}
+				else {
+					std::rotate(elements + whereOffset, elements + elementOffset, elements + elementOffset + 1);
+					_shift_indexes_up(whereOffset + 1, elementOffset + 1);
+				}
+			_indexes.slot(slot) = whereOffset;
 
-			return *std::next(_orderedElements.begin(), whereOffset);
+			return _orderedElements[whereOffset];
 		}
 
 		#if _MSTD_HAS_CXX20
@@ -128,41 +174,38 @@ namespace mstd {
 		}
 
 		_MSTD_CONSTEXPR20 void erase(const T& item) {
-				if (!contains(item)) { return; }
+			const size_t slot = _find_slot(item);
+				if (slot == _npos) { return; }
 
-			size_t elementOffset = _elementsMap[item];
+			const size_t elementOffset = _indexes.slot(slot);
 
+			_indexes.erase(slot);
 			_orderedElements.erase(std::next(_orderedElements.begin(), elementOffset));
-			_elementsMap.erase(item);
 
-			_update_indexes(elementOffset);
+			_shift_indexes_down(elementOffset, _orderedElements.size());
 		}
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const T& item) const {
-		#if _MSTD_HAS_CXX20
-			return _elementsMap.contains(item);
-		#else
-			return _elementsMap.find(item) != _elementsMap.end();
-		#endif
-		}
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(const T& item) const { return _find_slot(item) != _npos; }
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 iterator find(const T& item) {
-			auto it = _elementsMap.find(item);
-			return it != _elementsMap.end() ? std::next(_orderedElements.begin(), it->second) : _orderedElements.end();
+			const size_t index = _find_index(item);
+			return index != _npos ? std::next(_orderedElements.begin(), index) : _orderedElements.end();
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator find(const T& item) const {
-			auto it = _elementsMap.find(item);
-			return it != _elementsMap.end() ? std::next(_orderedElements.begin(), it->second) : _orderedElements.end();
+			const size_t index = _find_index(item);
+			return index != _npos ? std::next(_orderedElements.begin(), index) : _orderedElements.end();
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 size_t size() const { return _orderedElements.size(); }
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const { return _orderedElements.empty(); }
 
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return _orderedElements.get_allocator(); }
+
 		_MSTD_CONSTEXPR20 void clear() {
 			_orderedElements.clear();
-			_elementsMap.clear();
+			_indexes.clear();
 		}
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 iterator begin() { return _orderedElements.begin(); }
@@ -189,11 +232,11 @@ namespace mstd {
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator crend() const { return _orderedElements.crend(); }
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator==(const ordered_set<T>& other) const {
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator==(const ordered_set& other) const {
 			return _orderedElements == other._orderedElements;
 		}
 
-		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator!=(const ordered_set<T>& other) const { return !(*this == other); }
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool operator!=(const ordered_set& other) const { return !(*this == other); }
 	};
 } // namespace mstd
 	#endif
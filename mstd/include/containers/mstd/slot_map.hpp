@@ -0,0 +1,279 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_SLOT_MAP_HPP_
+	#define _MSTD_SLOT_MAP_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/assert.hpp>
+		#include <mstd/containers_types.hpp>
+
+namespace mstd {
+	// stable_vector with generational handles: elements live densely in one vector (erase moves the last one into the
+	// hole) and are reached through slots. A handle is a slot index and the generation of the slot when the element was
+	// inserted, erasing bumps the generation so old handles stop resolving instead of reaching the next element in the
+	// slot. Free slots form a list threaded through the slots themselves
+	template<class T, class Allocator>
+	class slot_map {
+	public:
+		using value_type	  = T;
+		using allocator_type  = Allocator;
+		using reference		  = T&;
+		using const_reference = const T&;
+
+		// 32 bit slot index and 32 bit generation, a default handle never resolves
+		struct handle {
+			uint32_t index		= std::numeric_limits<uint32_t>::max();
+			uint32_t generation = 0;
+
+			[[nodiscard]] static _MSTD_CONSTEXPR17 handle from_value(uint64_t value) noexcept {
+				return handle{ static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32) };
+			}
+
+			// both halves packed in one integer, index in the low bits
+			[[nodiscard]] _MSTD_CONSTEXPR17 uint64_t value() const noexcept {
+				return (static_cast<uint64_t>(generation) << 32) | index;
+			}
+
+			[[nodiscard]] _MSTD_CONSTEXPR17 bool operator==(const handle& other) const noexcept {
+				return index == other.index && generation == other.generation;
+			}
+
+			[[nodiscard]] _MSTD_CONSTEXPR17 bool operator!=(const handle& other) const noexcept { return !(*this == other); }
+		};
+
+	private:
+		using _data_type = std::vector<T, Allocator>;
+
+	public:
+		using size_type				 = _MSTD_TYPENAME17 _data_type::size_type;
+		using difference_type		 = _MSTD_TYPENAME17 _data_type::difference_type;
+		using iterator				 = _MSTD_TYPENAME17 _data_type::iterator;
+		using const_iterator		 = _MSTD_TYPENAME17 _data_type::const_iterator;
+		using reverse_iterator		 = _MSTD_TYPENAME17 _data_type::reverse_iterator;
+		using const_reverse_iterator = _MSTD_TYPENAME17 _data_type::const_reverse_iterator;
+
+	private:
+		static _MSTD_CONSTEXPR17 const uint32_t _npos = std::numeric_limits<uint32_t>::max();
+
+		// odd generations are taken slots and index is the position in _data, even ones are free and index is the next
+		// free slot. A slot whose generation wraps around to 0 is never reused, so a handle can not come back to life
+		struct _slot {
+			uint32_t index;
+			uint32_t generation;
+		};
+
+		_data_type _data;
+		// slot of every element in _data
+		std::vector<uint32_t, rebind_alloc_t<Allocator, uint32_t> > _slotOf;
+		std::vector<_slot, rebind_alloc_t<Allocator, _slot> > _slots;
+		uint32_t _freeHead = _npos;
+
+		_MSTD_CONSTEXPR20 uint32_t _take_slot() {
+				if (_freeHead != _npos) {
+					const uint32_t slot = _freeHead;
+					_freeHead			= _slots[slot].index;
+					return slot;
+				}
+
+			mstd_assert(_slots.size() < _npos, "Too many slots");
+			_slots.push_back(_slot{ _npos, 0 });
+			return static_cast<uint32_t>(_slots.size() - 1);
+		}
+
+		_MSTD_CONSTEXPR20 void _free_slot(uint32_t slot) noexcept {
+				if (++_slots[slot].generation == 0) { return; }
+			_slots[slot].index = _freeHead;
+			_freeHead		   = slot;
+		}
+
+	public:
+		_MSTD_CONSTEXPR20 slot_map()							   = default;
+
+		_MSTD_CONSTEXPR20 slot_map(const slot_map&)				   = default;
+		_MSTD_CONSTEXPR20 slot_map(slot_map&&) noexcept			   = default;
+
+		_MSTD_CONSTEXPR20 ~slot_map()							   = default;
+
+		_MSTD_CONSTEXPR20 slot_map& operator=(const slot_map&)	   = default;
+		_MSTD_CONSTEXPR20 slot_map& operator=(slot_map&&) noexcept = default;
+
+		_MSTD_CONSTEXPR20 explicit slot_map(const Allocator& alloc) : _data(alloc), _slotOf(alloc), _slots(alloc) {}
+
+		#pragma region INSERT
+
+		_MSTD_CONSTEXPR20 handle insert(const T& value) { return emplace(value); }
+
+		_MSTD_CONSTEXPR20 handle insert(T&& value) { return emplace(std::move(value)); }
+
+		// constructs the element in place at the end of the dense storage
+		template<class... Args>
+		_MSTD_CONSTEXPR20 handle emplace(Args&&... args) {
+			const uint32_t slot = _take_slot();
+				try {
+					_slotOf.push_back(slot);
+					_data.emplace_back(std::forward<Args>(args)...);
+				} catch (...) {
+						if (_slotOf.size() != _data.size()) { _slotOf.pop_back(); }
+					_slots[slot].index = _freeHead;
+					_freeHead		   = slot;
+					throw;
+				}
+
+			_slots[slot].index = static_cast<uint32_t>(_data.size() - 1);
+			return handle{ slot, ++_slots[slot].generation };
+		}
+
+		#pragma endregion INSERT
+
+		#pragma region ERASE
+
+		// false when h is stale. The last element moves into the hole, so iterators and pointers to it are invalidated
+		_MSTD_CONSTEXPR20 bool erase(handle h) {
+				if (!contains(h)) { return false; }
+			erase(_data.cbegin() + _slots[h.index].index);
+			return true;
+		}
+
+		// returns pos, which now holds the element that was last (or end() when pos was the last one)
+		_MSTD_CONSTEXPR20 iterator erase(const_iterator pos) {
+			mstd_assert(pos != _data.cend(), "Pos out of bounds");
+
+			const size_type index = static_cast<size_type>(std::distance(_data.cbegin(), pos));
+			const uint32_t slot	  = _slotOf[index];
+				if (index != _data.size() - 1) {
+					_data[index]				 = std::move(_data.back());
+					_slotOf[index]				 = _slotOf.back();
+					_slots[_slotOf[index]].index = static_cast<uint32_t>(index);
+				}
+			_data.pop_back();
+			_slotOf.pop_back();
+			_free_slot(slot);
+			return _data.begin() + static_cast<difference_type>(index);
+		}
+
+		_MSTD_CONSTEXPR20 void clear() noexcept {
+				for (const uint32_t slot : _slotOf) { _free_slot(slot); }
+			_data.clear();
+			_slotOf.clear();
+		}
+
+		#pragma endregion ERASE
+
+		#pragma region ACCESS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool contains(handle h) const noexcept {
+			return h.index < _slots.size() && _slots[h.index].generation == h.generation && (h.generation & 1) != 0;
+		}
+
+		// nullptr when h is stale
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* try_get(handle h) noexcept {
+			return contains(h) ? &_data[_slots[h.index].index] : nullptr;
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const T* try_get(handle h) const noexcept {
+			return contains(h) ? &_data[_slots[h.index].index] : nullptr;
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T& at(handle h) {
+			mstd_assert(contains(h), "Handle is stale");
+			return _data[_slots[h.index].index];
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const T& at(handle h) const {
+			mstd_assert(contains(h), "Handle is stale");
+			return _data[_slots[h.index].index];
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T& operator[](handle h) { return at(h); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const T& operator[](handle h) const { return at(h); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 handle get_handle(const_iterator pos) const {
+			mstd_assert(pos != _data.cend(), "Pos out of bounds");
+			const uint32_t slot = _slotOf[static_cast<size_type>(std::distance(_data.cbegin(), pos))];
+			return handle{ slot, _slots[slot].generation };
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 T* data() noexcept { return _data.data(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const T* data() const noexcept { return _data.data(); }
+
+		#pragma endregion ACCESS
+
+		#pragma region CAPACITY
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type size() const noexcept { return _data.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const noexcept { return _data.empty(); }
+
+		// slots ever taken, free and retired ones included
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type slot_count() const noexcept { return _slots.size(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type capacity() const noexcept { return _data.capacity(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 size_type max_size() const noexcept {
+			return std::min<size_type>(_data.max_size(), _npos);
+		}
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return _data.get_allocator(); }
+
+		_MSTD_CONSTEXPR20 void reserve(size_type capacity) {
+			_data.reserve(capacity);
+			_slotOf.reserve(capacity);
+			_slots.reserve(capacity);
+		}
+
+		#pragma endregion CAPACITY
+
+		#pragma region ITERATORS
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 iterator begin() noexcept { return _data.begin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator begin() const noexcept { return _data.begin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator cbegin() const noexcept { return _data.cbegin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 iterator end() noexcept { return _data.end(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator end() const noexcept { return _data.end(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_iterator cend() const noexcept { return _data.cend(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 reverse_iterator rbegin() noexcept { return _data.rbegin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator rbegin() const noexcept { return _data.rbegin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 reverse_iterator rend() noexcept { return _data.rend(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator rend() const noexcept { return _data.rend(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator crbegin() const noexcept { return _data.crbegin(); }
+
+		[[nodiscard]] _MSTD_CONSTEXPR20 const_reverse_iterator crend() const noexcept { return _data.crend(); }
+
+		#pragma endregion ITERATORS
+
+		_MSTD_CONSTEXPR20 void swap(slot_map& other) noexcept {
+			_data.swap(other._data);
+			_slotOf.swap(other._slotOf);
+			_slots.swap(other._slots);
+			std::swap(_freeHead, other._freeHead);
+		}
+	};
+} // namespace mstd
+
+	#endif
+#endif
@@ -21,15 +21,16 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/containers_types.hpp>
 
 namespace mstd {
-	template<class T>
+	template<class T, class Allocator>
 	class stable_vector {
 	public:
 		using value_type	  = T;
+		using allocator_type  = Allocator;
 		using reference		  = T&;
 		using const_reference = const T&;
 
 	private:
-		using _data_type = std::vector<T>;
+		using _data_type = std::vector<T, Allocator>;
 
 	public:
 		using size_type				 = _MSTD_TYPENAME17 _data_type::size_type;
@@ -40,23 +41,67 @@ namespace mstd {
 		using const_reverse_iterator = _MSTD_TYPENAME17 _data_type::const_reverse_iterator;
 
 	private:
-		using _data_index_type = std::vector<size_type>;
-		using _id_type		   = std::vector<size_type>;
+		using _data_index_type = std::vector<size_type, rebind_alloc_t<Allocator, size_type> >;
+		using _id_type		   = std::vector<size_type, rebind_alloc_t<Allocator, size_type> >;
 
 		_data_index_type _dataIndex;
 		_id_type _id;
 		_data_type _data;
 
 		_MSTD_CONSTEXPR20 void _append_indexes(size_type count) {
-			size_type newSize = _dataIndex.size() + count;
+			const size_type oldSize = _dataIndex.size();
+			const size_type newSize = oldSize + count;
+
+				// reserving exactly newSize would reallocate on every insert past the end
+				if (newSize > _dataIndex.capacity()) {
+					const size_type newCapacity = std::max(newSize, _dataIndex.capacity() * 2);
+					_id.reserve(newCapacity);
+					_dataIndex.reserve(newCapacity);
+				}
 
-			_id.reserve(newSize);
-			_dataIndex.reserve(newSize);
+			_dataIndex.resize(newSize);
+			_id.resize(newSize);
+			std::iota(_dataIndex.begin() + oldSize, _dataIndex.end(), oldSize);
+			std::iota(_id.begin() + oldSize, _id.end(), oldSize);
+		}
 
-				for (size_type i = _dataIndex.size(); i < newSize; ++i) {
-					_dataIndex.push_back(i);
-					_id.push_back(i);
+		// replaces the element with value itself when that is what args is, without a temporary
+		template<class... Args>
+		static _MSTD_CONSTEXPR20 void _assign(T& target, Args&&... args) {
+				if _MSTD_CONSTEXPR17 (sizeof...(Args) == 1 && std::conjunction_v<std::is_same<std::decay_t<Args>, T>...>) {
+					((target = std::forward<Args>(args)), ...);
 				}
+				else { target = T(std::forward<Args>(args)...); }
+		}
+
+		// constructs the element in place for the first free id, adding an id when there is none
+		template<class... Args>
+		_MSTD_CONSTEXPR20 iterator _emplace_free(Args&&... args) {
+				if (_data.size() == size()) { _append_indexes(1); }
+			_data.emplace_back(std::forward<Args>(args)...);
+			return std::prev(_data.end());
+		}
+
+		// constructs the element of id in place, or assigns it when id already has one
+		template<class... Args>
+		_MSTD_CONSTEXPR20 iterator _emplace_id(size_type id, Args&&... args) {
+				if (has_value(id)) {
+					_assign(_data[_dataIndex[id]], std::forward<Args>(args)...);
+					return _data.begin() + static_cast<difference_type>(_dataIndex[id]);
+				}
+
+				if (id >= size()) { _append_indexes(id + 1 - size()); }
+			_data.emplace_back(std::forward<Args>(args)...);
+
+			// the new element took the data position of the first free id, which trades places with id
+			const size_type position = _data.size() - 1;
+			const size_type freeId	 = _id[position];
+				if (freeId != id) {
+					std::swap(_id[position], _id[_dataIndex[id]]);
+					std::swap(_dataIndex[freeId], _dataIndex[id]);
+				}
+
+			return std::prev(_data.end());
 		}
 
 	public:
@@ -65,18 +110,29 @@ namespace mstd {
 		_MSTD_CONSTEXPR20 stable_vector(const stable_vector&)	  = default;
 		_MSTD_CONSTEXPR20 stable_vector(stable_vector&&) noexcept = default;
 
-		_MSTD_CONSTEXPR20 stable_vector(size_type count) { resize(count); }
+		_MSTD_CONSTEXPR20 explicit stable_vector(const Allocator& alloc) : _dataIndex(alloc), _id(alloc), _data(alloc) {}
 
-		_MSTD_CONSTEXPR20 stable_vector(size_type count, const T& value) { resize(count, value); }
+		_MSTD_CONSTEXPR20 stable_vector(size_type count, const Allocator& alloc = Allocator()) : stable_vector(alloc) {
+			resize(count);
+		}
+
+		_MSTD_CONSTEXPR20 stable_vector(size_type count, const T& value, const Allocator& alloc = Allocator())
+			: stable_vector(alloc) {
+			resize(count, value);
+		}
 
-		_MSTD_CONSTEXPR20 stable_vector(const std::initializer_list<T>& init) : _data(init) { _append_indexes(_data.size()); }
+		_MSTD_CONSTEXPR20 stable_vector(const std::initializer_list<T>& init, const Allocator& alloc = Allocator())
+			: _dataIndex(alloc), _id(alloc), _data(init, alloc) {
+			_append_indexes(_data.size());
+		}
 
 		#if _MSTD_HAS_CXX20
 		template<mstd::iterator Iter>
 		#else
 		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
 		#endif
-		_MSTD_CONSTEXPR20 stable_vector(const Iter& begin, const Iter& end) : _data(begin, end) {
+		_MSTD_CONSTEXPR20 stable_vector(const Iter& begin, const Iter& end, const Allocator& alloc = Allocator())
+			: _dataIndex(alloc), _id(alloc), _data(begin, end, alloc) {
 			_append_indexes(_data.size());
 		}
 
@@ -87,15 +143,9 @@ namespace mstd {
 
 		#pragma region INSERT_ON_FREE_SPOT
 
-		_MSTD_CONSTEXPR20 iterator insert(const T& value) {
-				if (_data.size() == size()) { _append_indexes(1); }
-			return _data.insert(_data.cend(), value);
-		}
+		_MSTD_CONSTEXPR20 iterator insert(const T& value) { return _emplace_free(value); }
 
-		_MSTD_CONSTEXPR20 iterator insert(T&& value) {
-				if (_data.size() == size()) { _append_indexes(1); }
-			return _data.insert(_data.cend(), value);
-		}
+		_MSTD_CONSTEXPR20 iterator insert(T&& value) { return _emplace_free(std::move(value)); }
 
 		_MSTD_CONSTEXPR20 iterator insert(const T& value, size_type count) {
 			_append_indexes(count - (size() - _data.size()));
@@ -119,57 +169,13 @@ namespace mstd {
 
 		#pragma region INSERT_AT_IDX
 
-		_MSTD_CONSTEXPR20 iterator insert_at(size_type id, const T& value) {
-				if (has_value(id)) {
-					_data[_dataIndex[id]] = value;
-					return std::next(_data.begin() + _dataIndex[id]);
-				}
-
-			_append_indexes(id + 1 - size());
-
-			// insert data
-			auto iter = _data.insert(_data.cend(), value);
-
-				if (_data.size() != size()) {
-					size_type toSwapId = _id[_data.size() - 1];
-
-					// swap ids
-					std::swap(_id[_data.size() - 1], _id[id]);
-
-					// swap indexes
-					std::swap(_dataIndex[toSwapId], _dataIndex[id]);
-				}
-
-			return iter;
-		}
-
-		_MSTD_CONSTEXPR20 iterator insert_at(size_type id, T&& value) {
-				if (has_value(id)) {
-					_data[_dataIndex[id]] = value;
-					return std::next(_data.begin() + _dataIndex[id]);
-				}
-
-			_append_indexes(id + 1 - size());
-
-			// insert data
-			auto iter = _data.insert(_data.cend(), value);
-
-				if (_data.size() != size()) {
-					size_type toSwapId = _id[_data.size() - 1];
-
-					// swap ids
-					std::swap(_id[_data.size() - 1], _id[id]);
+		_MSTD_CONSTEXPR20 iterator insert_at(size_type id, const T& value) { return _emplace_id(id, value); }
 
-					// swap indexes
-					std::swap(_dataIndex[toSwapId], _dataIndex[id]);
-				}
-
-			return iter;
-		}
+		_MSTD_CONSTEXPR20 iterator insert_at(size_type id, T&& value) { return _emplace_id(id, std::move(value)); }
 
 		_MSTD_CONSTEXPR20 iterator insert_at(size_type id, const T& value, size_type count) {
-			iterator iter = insert(id, value);
-				for (size_t i = 1; i < count; ++i) { insert(id + i, value); }
+			iterator iter = insert_at(id, value);
+				for (size_t i = 1; i < count; ++i) { insert_at(id + i, value); }
 			return iter;
 		}
 
@@ -179,30 +185,28 @@ namespace mstd {
 		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 iterator insert_at(size_type id, Iter first, Iter last) {
-			iterator iter = insert(id, *first);
+			iterator iter = insert_at(id, *first);
 			++id;
-				for (Iter it = std::next(first); it != last; ++it, ++id) { insert(id, *it); }
+				for (Iter it = std::next(first); it != last; ++it, ++id) { insert_at(id, *it); }
 			return iter;
 		}
 
 		_MSTD_CONSTEXPR20 iterator insert_at(size_type id, std::initializer_list<T> init) {
-			return insert(id, init.begin(), init.end());
+			return insert_at(id, init.begin(), init.end());
 		}
 
 		#pragma endregion INSERT_AT_IDX
 
 		#pragma region INSERT_AT_ITER
 
-		_MSTD_CONSTEXPR20 iterator insert_at(const_iterator pos, const T& value) {
-			return insert(_id[std::distance(_data.begin(), pos)], value);
-		}
+		_MSTD_CONSTEXPR20 iterator insert_at(const_iterator pos, const T& value) { return insert_at(get_id(pos), value); }
 
 		_MSTD_CONSTEXPR20 iterator insert_at(const_iterator pos, T&& value) {
-			return insert(_id[std::distance(_data.begin(), pos)], value);
+			return insert_at(get_id(pos), std::move(value));
 		}
 
 		_MSTD_CONSTEXPR20 iterator insert_at(const_iterator pos, const T& value, size_type count) {
-			return insert(_id[std::distance(_data.begin(), pos)], count, value);
+			return insert_at(get_id(pos), value, count);
 		}
 
 		#if _MSTD_HAS_CXX20
@@ -211,11 +215,11 @@ namespace mstd {
 		template<class Iter, std::enable_if_t<is_iterator_v<Iter>, bool> = true>
 		#endif
 		_MSTD_CONSTEXPR20 iterator insert_at(const_iterator pos, Iter first, Iter last) {
-			return insert(_id[std::distance(_data.begin(), pos)], first, last);
+			return insert_at(get_id(pos), first, last);
 		}
 
 		_MSTD_CONSTEXPR20 iterator insert_at(const_iterator pos, std::initializer_list<T> init) {
-			return insert(pos, init.begin(), init.end());
+			return insert_at(pos, init.begin(), init.end());
 		}
 
 		#pragma endregion INSERT_AT_ITER
@@ -224,7 +228,7 @@ namespace mstd {
 
 		template<class... Args>
 		_MSTD_CONSTEXPR20 iterator emplace(Args&&... args) {
-			return insert(T(std::forward<Args>(args)...));
+			return _emplace_free(std::forward<Args>(args)...);
 		}
 
 		#pragma endregion
@@ -233,7 +237,7 @@ namespace mstd {
 
 		template<class... Args>
 		_MSTD_CONSTEXPR20 iterator emplace_at(size_type id, Args&&... args) {
-			return insert_at(id, T(std::forward<Args>(args)...));
+			return _emplace_id(id, std::forward<Args>(args)...);
 		}
 
 		#pragma endregion
@@ -242,7 +246,7 @@ namespace mstd {
 
 		template<class... Args>
 		_MSTD_CONSTEXPR20 iterator emplace_at(const_iterator pos, Args&&... args) {
-			return insert_at(pos, T(std::forward<Args>(args)...));
+			return _emplace_id(get_id(pos), std::forward<Args>(args)...);
 		}
 
 		#pragma endregion
@@ -254,7 +258,7 @@ namespace mstd {
 
 		_MSTD_CONSTEXPR20 void push_back(const T& value) { insert_at(size(), value); }
 
-		_MSTD_CONSTEXPR20 void push_back(T&& value) { insert_at(size(), value); }
+		_MSTD_CONSTEXPR20 void push_back(T&& value) { insert_at(size(), std::move(value)); }
 
 		_MSTD_CONSTEXPR20 iterator erase(size_type id) {
 			mstd_assert(id < size(), "Index out of bounds");
@@ -264,8 +268,8 @@ namespace mstd {
 			size_t index	 = _dataIndex[id];
 			size_t lastIndex = _data.size() - 1;
 
-			// swap data
-			std::swap(_data[index], _data[lastIndex]);
+			// move the last element into the hole, one move instead of the three of a swap
+				if (index != lastIndex) { _data[index] = std::move(_data[lastIndex]); }
 
 			// swap ids
 			std::swap(_id[index], _id[lastIndex]);
@@ -429,6 +433,8 @@ namespace mstd {
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 size_type max_size() const { return _data.max_size(); }
 
+		[[nodiscard]] _MSTD_CONSTEXPR20 allocator_type get_allocator() const { return _data.get_allocator(); }
+
 		[[nodiscard]] _MSTD_CONSTEXPR20 bool empty() const { return _data.empty(); }
 
 		[[nodiscard]] _MSTD_CONSTEXPR20 bool has_value(size_type id) const {
@@ -85,6 +85,7 @@
 		#define _MSTD_RETURN_VALUE_IF(condition, ...) __VA_ARGS__
 		#define _MSTD_REQUIRES(condition)			  requires (condition)
 		#define _MSTD_ENABLE_IF_TEMPLATE(class_name, condition)
+		#define _MSTD_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
 	#else
 		#define _MSTD_TYPENAME17 typename
 		#define _MSTD_INLINE17	 inline
@@ -93,7 +94,76 @@
 		#define _MSTD_REQUIRES(condition)
 		#define _MSTD_ENABLE_IF_TEMPLATE(class_name, condition)                    \
 			template<class class_name, std::enable_if_t<(condition), bool> = true>
+		#define _MSTD_IS_CONSTANT_EVALUATED() false
 	#endif
 	#pragma endregion
 
+	#pragma region SIMD_CHECKS
+	#if defined(MSTD_ENABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+		#define _MSTD_HAS_SSE2 1
+	#else
+		#define _MSTD_HAS_SSE2 0
+	#endif
+
+	#if _MSTD_HAS_SSE2 && (defined(__SSSE3__) || defined(__AVX__))
+		#define _MSTD_HAS_SSSE3 1
+	#else
+		#define _MSTD_HAS_SSSE3 0
+	#endif
+
+	#if _MSTD_HAS_SSE2 && (defined(__SSE4_1__) || defined(__AVX__))
+		#define _MSTD_HAS_SSE41 1
+	#else
+		#define _MSTD_HAS_SSE41 0
+	#endif
+
+	#if _MSTD_HAS_SSE2 && defined(__AVX__)
+		#define _MSTD_HAS_AVX 1
+	#else
+		#define _MSTD_HAS_AVX 0
+	#endif
+
+	#if _MSTD_HAS_AVX && defined(__AVX2__)
+		#define _MSTD_HAS_AVX2 1
+	#else
+		#define _MSTD_HAS_AVX2 0
+	#endif
+
+	#if _MSTD_HAS_AVX && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+		#define _MSTD_HAS_FMA 1
+	#else
+		#define _MSTD_HAS_FMA 0
+	#endif
+
+	// half precision conversions, every AVX2 capable CPU has them, MSVC does not define a macro for F16C
+	#if _MSTD_HAS_AVX && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+		#define _MSTD_HAS_F16C 1
+	#else
+		#define _MSTD_HAS_F16C 0
+	#endif
+
+	// AVX-512 is only used for instructions that have no AVX2 equivalent (14 bit rsqrt/rcp estimates) and for 16 wide
+	// float16 conversions
+	#if _MSTD_HAS_AVX2 && defined(__AVX512F__) && defined(__AVX512VL__)
+		#define _MSTD_HAS_AVX512VL 1
+	#else
+		#define _MSTD_HAS_AVX512VL 0
+	#endif
+
+	// pdep/pext, scalar instructions but x86 only and just as opt-in as the vector extensions
+	#if _MSTD_HAS_SSE2 && defined(__BMI2__)
+		#define _MSTD_HAS_BMI2 1
+	#else
+		#define _MSTD_HAS_BMI2 0
+	#endif
+
+	#if defined(MSTD_ENABLE_SIMD) && (defined(__aarch64__) || defined(_M_ARM64)) && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+		#define _MSTD_HAS_NEON 1
+	#else
+		#define _MSTD_HAS_NEON 0
+	#endif
+
+	#define _MSTD_HAS_SIMD (_MSTD_HAS_SSE2 || _MSTD_HAS_NEON)
+	#pragma endregion
+
 #endif
\ No newline at end of file
@@ -21,6 +21,7 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/containers_libs.hpp>
 		#include <mstd/functions_libs.hpp>
 		#include <mstd/management_libs.hpp>
+		#include <mstd/spatial_libs.hpp>
 		#include <mstd/string_libs.hpp>
 		#include <mstd/terminal_libs.hpp>
 
@@ -22,6 +22,7 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 	// #define MSTD_USE_ENUMS_MACROS			-> enables ENUM macros
 	// #define MSTD_USE_CLONE_FUNC_MACROS		-> enables CLONE_FUNC macros
 	// #define MSTD_USE_EXTRA_MACROS			-> enables external macros
+	// #define MSTD_ENABLE_SIMD				-> enables SIMD kernels for arithmetic types
 
 		#include <mstd/arithmetic.hpp>
 		#include <mstd/containers.hpp>
@@ -29,6 +30,7 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/functions.hpp>
 		#include <mstd/macros.hpp>
 		#include <mstd/management.hpp>
+		#include <mstd/spatial.hpp>
 		#include <mstd/string.hpp>
 		#include <mstd/terminal.hpp>
 		#include <mstd/utils.hpp>
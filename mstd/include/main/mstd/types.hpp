@@ -21,6 +21,7 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/events_types.hpp>
 		#include <mstd/functions_types.hpp>
 		#include <mstd/management_types.hpp>
+		#include <mstd/spatial_types.hpp>
 		#include <mstd/string_types.hpp>
 		#include <mstd/terminal_types.hpp>
 		#include <mstd/utils.hpp>
@@ -22,6 +22,7 @@ _MSTD_WARNING("this is only available for c++17 and greater!");
 		#include <mstd/functions_utils.hpp>
 		#include <mstd/libs.hpp>
 		#include <mstd/management_utils.hpp>
+		#include <mstd/spatial_utils.hpp>
 		#include <mstd/string_utils.hpp>
 		#include <mstd/terminal_utils.hpp>
 
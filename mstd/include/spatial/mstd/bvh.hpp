@@ -0,0 +1,627 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_BVH_HPP_
+	#define _MSTD_BVH_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/assert.hpp>
+		#include <mstd/geometry.hpp>
+		#include <mstd/spatial_types.hpp>
+
+namespace mstd {
+	// bounding volume hierarchy over primitives given by their boxes, built with binned surface area heuristics. Nodes are
+	// stored depth first in one array: the first child of an interior node follows it and the node keeps the index of
+	// the second one, so a query only touches the array and a small fixed stack. The hierarchy never sees the primitives
+	// themselves, queries call back with primitive indices (positions in the array the bvh was built from)
+		#if _MSTD_HAS_CXX20
+	template<floating_point T>
+		#else
+	template<class T, std::enable_if_t<std::is_floating_point_v<T>, bool> >
+		#endif
+	class bvh {
+	public:
+		using value_type = T;
+		using vec_type	 = vec<3, T>;
+		using aabb_type	 = aabb<3, T>;
+		using ray_type	 = ray<T>;
+		using size_type	 = size_t;
+
+		static _MSTD_CONSTEXPR17 const size_type npos = static_cast<size_type>(-1);
+
+		// 32 bytes for float, two nodes per cache line
+		struct node {
+			T min[3];
+			// first primitive in indices() for leaves, index of the second child for interior nodes
+			uint32_t offset;
+			T max[3];
+			// 0 for interior nodes
+			uint32_t count;
+
+			_MSTD_CONSTEXPR20 bool is_leaf() const noexcept { return count != 0; }
+
+			_MSTD_CONSTEXPR20 aabb_type bounds() const {
+				return aabb_type(vec_type(min[0], min[1], min[2]), vec_type(max[0], max[1], max[2]));
+			}
+		};
+
+		// leaves hold at most this many primitives, bigger ranges are always split
+		static _MSTD_CONSTEXPR17 const size_type max_leaf_size = 8;
+		// ranges this small always become leaves, splitting them costs more build time than it saves in queries
+		static _MSTD_CONSTEXPR17 const size_type min_leaf_size = 4;
+		// the depth the traversal stack is sized for, see _split
+		static _MSTD_CONSTEXPR17 const size_type max_depth	   = 64;
+
+	private:
+		static _MSTD_CONSTEXPR17 const size_type _bins			   = 16;
+		// SAH depth limit, below it ranges are split at the median so 2^32 primitives still fit in max_depth levels
+		static _MSTD_CONSTEXPR17 const size_type _sah_depth		   = max_depth - 32;
+		// ranges at least this big are split on the calling thread and built in parallel
+		static _MSTD_CONSTEXPR17 const size_type _parallel_min	   = 1 << 12;
+		// cost of visiting a node relative to testing one primitive
+		static _MSTD_CONSTEXPR17 const T _traversal_cost		   = static_cast<T>(1);
+
+		std::vector<node> _nodes;
+		std::vector<uint32_t> _indices;
+
+		#pragma region BUILD
+
+		// bounds kept as plain arrays, the build touches them too often for vec. min is in the first 4 values and -max in
+		// the last 4 (the 4th and 8th are padding), so expanding is one min over all of them
+		struct _box {
+			T values[8] = { std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), std::numeric_limits<T>::max(),
+				std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), std::numeric_limits<T>::max(),
+				std::numeric_limits<T>::max(), std::numeric_limits<T>::max() };
+
+			_MSTD_CONSTEXPR20 void expand(const _box& other) noexcept {
+					for (size_t i = 0; i != 8; ++i) { values[i] = values[i] < other.values[i] ? values[i] : other.values[i]; }
+			}
+
+			_MSTD_CONSTEXPR20 void expand(const T (&point)[3]) noexcept {
+					for (size_t i = 0; i != 3; ++i) {
+						values[i]	  = std::min(values[i], point[i]);
+						values[i + 4] = std::min(values[i + 4], -point[i]);
+					}
+			}
+
+			_MSTD_CONSTEXPR20 T min(size_t i) const noexcept { return values[i]; }
+			_MSTD_CONSTEXPR20 T max(size_t i) const noexcept { return -values[i + 4]; }
+
+			_MSTD_CONSTEXPR20 T surface_area() const noexcept {
+				const T x = max(0) - min(0);
+				const T y = max(1) - min(1);
+				const T z = max(2) - min(2);
+					if (x < static_cast<T>(0)) { return static_cast<T>(0); }
+				return static_cast<T>(2) * (x * y + y * z + z * x);
+			}
+		};
+
+		// the build partitions these records instead of indices, so every pass reads memory in order
+		struct _primitive {
+			_box bounds;
+			T centroid[3];
+			uint32_t index;
+		};
+
+		// a range of primitives with their bounds and the bounds of their centroids
+		struct _range {
+			size_type first;
+			size_type last;
+			size_type depth;
+			_box bounds;
+			_box centroids;
+		};
+
+		// top of the tree built before the parallel part, either an interior node or one of the jobs
+		struct _top_node {
+			_box bounds;
+			size_type left;
+			size_type right;
+			size_type job;
+		};
+
+		static _MSTD_CONSTEXPR20 _box _node_box(const node& target) noexcept {
+			_box res;
+				for (size_t i = 0; i != 3; ++i) {
+					res.values[i]	  = target.min[i];
+					res.values[i + 4] = -target.max[i];
+				}
+			return res;
+		}
+
+		static _MSTD_CONSTEXPR20 node _make_node(const _box& box, uint32_t offset, uint32_t count) noexcept {
+			node res{};
+				for (size_t i = 0; i != 3; ++i) {
+					res.min[i] = box.min(i);
+					res.max[i] = box.max(i);
+				}
+			res.offset = offset;
+			res.count  = count;
+			return res;
+		}
+
+		static _MSTD_CONSTEXPR20 _range _make_range(const std::vector<_primitive>& primitives, size_type first, size_type last,
+		  size_type depth) {
+			_range res{ first, last, depth, _box(), _box() };
+				for (size_type i = first; i != last; ++i) {
+					res.bounds.expand(primitives[i].bounds);
+					res.centroids.expand(primitives[i].centroid);
+				}
+			return res;
+		}
+
+		static _MSTD_CONSTEXPR20 size_type _bin_index(const T& centroid, const T& minCentroid, const T& scale) noexcept {
+			const T bin = (centroid - minCentroid) * scale;
+			return bin < static_cast<T>(_bins) ? static_cast<size_type>(bin) : _bins - 1;
+		}
+
+		static void _median_split(std::vector<_primitive>& primitives, const _range& range, size_type axis, _range& left,
+		  _range& right) {
+			const size_type middle = range.first + (range.last - range.first) / 2;
+			std::nth_element(primitives.begin() + range.first, primitives.begin() + middle, primitives.begin() + range.last,
+			  [axis](const _primitive& a, const _primitive& b) { return a.centroid[axis] < b.centroid[axis]; });
+			left  = _make_range(primitives, range.first, middle, range.depth + 1);
+			right = _make_range(primitives, middle, range.last, range.depth + 1);
+		}
+
+		// splits range in two, false when a leaf is cheaper. Below _sah_depth ranges are split at the median, which
+		// bounds the depth for max_depth
+		static bool _split(std::vector<_primitive>& primitives, const _range& range, _range& left, _range& right) {
+			const size_type count = range.last - range.first;
+				if (count <= min_leaf_size) { return false; }
+
+			T extent[3];
+			T scale[3];
+				for (size_t a = 0; a != 3; ++a) {
+					extent[a] = range.centroids.max(a) - range.centroids.min(a);
+					scale[a]  = extent[a] > static_cast<T>(0) ? static_cast<T>(_bins) / extent[a] : static_cast<T>(0);
+				}
+			size_type axis = extent[1] > extent[0] ? 1 : 0;
+				if (extent[2] > extent[axis]) { axis = 2; }
+
+			// with every centroid in one point no plane separates them
+				if (!(extent[axis] > static_cast<T>(0)) || range.depth >= _sah_depth) {
+						if (count <= max_leaf_size) { return false; }
+					_median_split(primitives, range, axis, left, right);
+					return true;
+				}
+
+			// all three axes binned in one pass
+			_box binBounds[3][_bins];
+			size_type binCounts[3][_bins] = {};
+				for (size_type i = range.first; i != range.last; ++i) {
+					const _primitive& primitive = primitives[i];
+						for (size_t a = 0; a != 3; ++a) {
+							const size_type bin = _bin_index(primitive.centroid[a], range.centroids.min(a), scale[a]);
+							++binCounts[a][bin];
+							binBounds[a][bin].expand(primitive.bounds);
+						}
+				}
+
+			T bestCost		   = std::numeric_limits<T>::infinity();
+			size_type bestAxis = 0;
+			size_type bestBin  = 0;
+			_box bestLeft;
+			_box bestRight;
+				for (size_type a = 0; a != 3; ++a) {
+						if (!(extent[a] > static_cast<T>(0))) { continue; }
+
+					// right side bounds accumulated from the last bin, left side ones on the way back
+					_box rightBounds[_bins];
+					size_type rightCounts[_bins];
+					size_type accumulatedCount = 0;
+						for (size_type b = _bins - 1; b != 0; --b) {
+							rightBounds[b] = binBounds[a][b];
+								if (b != _bins - 1) { rightBounds[b].expand(rightBounds[b + 1]); }
+							accumulatedCount += binCounts[a][b];
+							rightCounts[b]	  = accumulatedCount;
+						}
+
+					_box accumulated;
+					accumulatedCount = 0;
+						for (size_type b = 0; b != _bins - 1; ++b) {
+							accumulated.expand(binBounds[a][b]);
+							accumulatedCount += binCounts[a][b];
+								if (accumulatedCount == 0 || accumulatedCount == count) { continue; }
+
+							const T cost = accumulated.surface_area() * static_cast<T>(accumulatedCount)
+										   + rightBounds[b + 1].surface_area() * static_cast<T>(rightCounts[b + 1]);
+								if (cost < bestCost) {
+									bestCost  = cost;
+									bestAxis  = a;
+									bestBin	  = b;
+									bestLeft  = accumulated;
+									bestRight = rightBounds[b + 1];
+								}
+						}
+				}
+
+				if (bestCost == std::numeric_limits<T>::infinity()) {
+						if (count <= max_leaf_size) { return false; }
+					_median_split(primitives, range, axis, left, right);
+					return true;
+				}
+
+			const T area = range.bounds.surface_area();
+				if (count <= max_leaf_size && area * static_cast<T>(count) <= area * _traversal_cost + bestCost) { return false; }
+
+			// partition that also collects the centroid bounds of both sides, the boxes are known from the bins
+			const T minCentroid = range.centroids.min(bestAxis);
+			const T bestScale	= scale[bestAxis];
+			_box leftCentroids;
+			_box rightCentroids;
+			size_type first = range.first;
+			size_type last	= range.last;
+				while (true) {
+						while (first != last
+							   && _bin_index(primitives[first].centroid[bestAxis], minCentroid, bestScale) <= bestBin) {
+							leftCentroids.expand(primitives[first++].centroid);
+						}
+						while (first != last
+							   && _bin_index(primitives[last - 1].centroid[bestAxis], minCentroid, bestScale) > bestBin) {
+							rightCentroids.expand(primitives[--last].centroid);
+						}
+						if (first == last) { break; }
+					std::swap(primitives[first], primitives[last - 1]);
+				}
+
+			left  = { range.first, first, range.depth + 1, bestLeft, leftCentroids };
+			right = { first, range.last, range.depth + 1, bestRight, rightCentroids };
+			return true;
+		}
+
+		// builds range depth first into nodes, interior offsets are relative to the front of nodes
+		static void _build_subtree(std::vector<_primitive>& primitives, const _range& range, std::vector<node>& nodes) {
+			_range left;
+			_range right;
+				if (!_split(primitives, range, left, right)) {
+					const uint32_t count = static_cast<uint32_t>(range.last - range.first);
+					nodes.push_back(_make_node(range.bounds, static_cast<uint32_t>(range.first), count));
+					return;
+				}
+
+			const size_type idx = nodes.size();
+			nodes.push_back(_make_node(range.bounds, 0, 0));
+			_build_subtree(primitives, left, nodes);
+			nodes[idx].offset = static_cast<uint32_t>(nodes.size());
+			_build_subtree(primitives, right, nodes);
+		}
+
+		// splits the top of the tree until every range is about one of maxJobs parts, those become the jobs
+		static size_type _build_top(std::vector<_primitive>& primitives, const _range& range, size_type maxJobs,
+		  std::vector<_top_node>& top, std::vector<_range>& jobs) {
+			const size_type idx = top.size();
+			top.push_back({ range.bounds, npos, npos, npos });
+
+			// the share of maxJobs this range is worth
+			const size_type size	  = range.last - range.first;
+			const size_type rangeJobs = (maxJobs * size + primitives.size() - 1) / primitives.size();
+			_range left;
+			_range right;
+				if (rangeJobs > 1 && size >= _parallel_min && _split(primitives, range, left, right)) {
+					const size_type leftIdx	 = _build_top(primitives, left, maxJobs, top, jobs);
+					const size_type rightIdx = _build_top(primitives, right, maxJobs, top, jobs);
+					top[idx].left			 = leftIdx;
+					top[idx].right			 = rightIdx;
+					return idx;
+				}
+
+			top[idx].job = jobs.size();
+			jobs.push_back(range);
+			return idx;
+		}
+
+		void _flatten(const std::vector<_top_node>& top, size_type idx, std::vector<std::vector<node> >& jobNodes) {
+				if (top[idx].job != npos) {
+					const uint32_t base = static_cast<uint32_t>(_nodes.size());
+						for (node& jobNode : jobNodes[top[idx].job]) {
+								if (!jobNode.is_leaf()) { jobNode.offset += base; }
+							_nodes.push_back(jobNode);
+						}
+					std::vector<node>().swap(jobNodes[top[idx].job]);
+					return;
+				}
+
+			const size_type nodeIdx = _nodes.size();
+			_nodes.push_back(_make_node(top[idx].bounds, 0, 0));
+			_flatten(top, top[idx].left, jobNodes);
+			_nodes[nodeIdx].offset = static_cast<uint32_t>(_nodes.size());
+			_flatten(top, top[idx].right, jobNodes);
+		}
+
+		#pragma endregion // BUILD
+
+		#pragma region QUERIES
+
+		// slab test against a node, tNear is where the ray enters it
+		static _MSTD_CONSTEXPR20 bool _hit_node(const node& target, const T (&origin)[3], const T (&invDirection)[3],
+		  const T& tMax, T& tNear) noexcept {
+			T nearRes = static_cast<T>(0);
+			T farRes  = tMax;
+				for (size_t i = 0; i != 3; ++i) {
+					const T t1 = (target.min[i] - origin[i]) * invDirection[i];
+					const T t2 = (target.max[i] - origin[i]) * invDirection[i];
+					nearRes	   = std::max(nearRes, std::min(t1, t2));
+					farRes	   = std::min(farRes, std::max(t1, t2));
+				}
+			tNear = nearRes;
+			return nearRes <= farRes;
+		}
+
+		static _MSTD_CONSTEXPR20 bool _overlaps(const node& target, const aabb_type& box) noexcept {
+				for (size_t i = 0; i != 3; ++i) {
+						if (box.max[i] < target.min[i] || box.min[i] > target.max[i]) { return false; }
+				}
+			return true;
+		}
+
+		static _MSTD_CONSTEXPR20 T _distance_squared(const node& target, const vec_type& point) noexcept {
+			T res = static_cast<T>(0);
+				for (size_t i = 0; i != 3; ++i) {
+					const T diff = std::max(std::max(target.min[i] - point[i], point[i] - target.max[i]), static_cast<T>(0));
+					res			+= diff * diff;
+				}
+			return res;
+		}
+
+		#pragma endregion // QUERIES
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		bvh() = default;
+
+		bvh(const aabb_type* bounds, size_type count, size_type threads = 1) { build(bounds, count, threads); }
+
+		bvh(const std::vector<aabb_type>& bounds, size_type threads = 1) { build(bounds.data(), bounds.size(), threads); }
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region BUILDING
+
+		// threads == 0 uses every hardware thread. The result does not depend on threads
+		void build(const aabb_type* bounds, size_type count, size_type threads = 1) {
+			mstd_assert(count <= std::numeric_limits<uint32_t>::max(), "Too many primitives");
+
+			_nodes.clear();
+			_indices.clear();
+				if (count == 0) { return; }
+
+			std::vector<_primitive> primitives(count);
+			utils::parallel_for(count, threads, _parallel_min, [bounds, &primitives](size_t first, size_t last) {
+					for (size_t i = first; i != last; ++i) {
+						_primitive& primitive = primitives[i];
+							for (size_t a = 0; a != 3; ++a) {
+								primitive.bounds.values[a]	   = bounds[i].min[a];
+								primitive.bounds.values[a + 4] = -bounds[i].max[a];
+								primitive.centroid[a]	= (bounds[i].min[a] + bounds[i].max[a]) / static_cast<T>(2);
+							}
+						primitive.index = static_cast<uint32_t>(i);
+					}
+			});
+
+			// the top of the tree does not depend on threads either, only how the jobs are spread
+			std::vector<_top_node> top;
+			std::vector<_range> jobs;
+			const _range all = _make_range(primitives, 0, count, 0);
+			_build_top(primitives, all, std::max<size_type>(count / (_parallel_min * 4), 1), top, jobs);
+
+			std::vector<std::vector<node> > jobNodes(jobs.size());
+			utils::parallel_for(jobs.size(), threads, 1, [&primitives, &jobs, &jobNodes](size_t first, size_t last) {
+					for (size_t i = first; i != last; ++i) { _build_subtree(primitives, jobs[i], jobNodes[i]); }
+			});
+
+			size_type nodeCount = top.size();
+				for (const auto& nodes : jobNodes) { nodeCount += nodes.size(); }
+			_nodes.reserve(nodeCount);
+			_flatten(top, 0, jobNodes);
+
+			_indices.resize(count);
+				for (size_type i = 0; i != count; ++i) { _indices[i] = primitives[i].index; }
+		}
+
+		void build(const std::vector<aabb_type>& bounds, size_type threads = 1) { build(bounds.data(), bounds.size(), threads); }
+
+		// recomputes the node boxes for moved primitives without changing the tree, bounds has to have as many boxes as
+		// the bvh was built with. The tree gets worse as the primitives move away from where they were at build time
+		void refit(const aabb_type* bounds) {
+				for (size_type i = _nodes.size(); i-- != 0;) {
+					node& current = _nodes[i];
+					_box box;
+						if (current.is_leaf()) {
+								for (uint32_t p = current.offset; p != current.offset + current.count; ++p) {
+									_box primitive;
+										for (size_t a = 0; a != 3; ++a) {
+											primitive.values[a]		= bounds[_indices[p]].min[a];
+											primitive.values[a + 4] = -bounds[_indices[p]].max[a];
+										}
+									box.expand(primitive);
+								}
+						}
+						else {
+							box.expand(_node_box(_nodes[i + 1]));
+							box.expand(_node_box(_nodes[current.offset]));
+						}
+					current = _make_node(box, current.offset, current.count);
+				}
+		}
+
+		void refit(const std::vector<aabb_type>& bounds) {
+			mstd_assert(bounds.size() == _indices.size(), "Refit with a different number of primitives");
+			refit(bounds.data());
+		}
+
+		#pragma endregion // BUILDING
+
+		#pragma region GETTERS
+
+		[[nodiscard]] size_type size() const noexcept { return _indices.size(); }
+
+		[[nodiscard]] bool empty() const noexcept { return _indices.empty(); }
+
+		[[nodiscard]] aabb_type bounds() const { return _nodes.empty() ? aabb_type() : _nodes[0].bounds(); }
+
+		[[nodiscard]] const std::vector<node>& nodes() const noexcept { return _nodes; }
+
+		// primitive indices in leaf order, a leaf holds indices()[offset, offset + count)
+		[[nodiscard]] const std::vector<uint32_t>& indices() const noexcept { return _indices; }
+
+		#pragma endregion // GETTERS
+
+		#pragma region QUERIES
+
+		// closest hit along r up to t. hit(primitive, t) is called for primitives whose box the ray reaches before t and
+		// returns true after lowering t to its own hit. Returns the closest primitive hit (t is then its distance) or npos
+		template<class HitFunc>
+		size_type raycast(const ray_type& r, T& t, HitFunc&& hit) const {
+				if (_nodes.empty()) { return npos; }
+
+			const T origin[3]		= { r.origin()[0], r.origin()[1], r.origin()[2] };
+			const T invDirection[3] = { r.inv_direction()[0], r.inv_direction()[1], r.inv_direction()[2] };
+
+			size_type res = npos;
+			T tNear		  = static_cast<T>(0);
+				if (!_hit_node(_nodes[0], origin, invDirection, t, tNear)) { return npos; }
+
+			uint32_t stack[max_depth];
+			size_type stackSize = 0;
+			uint32_t current	= 0;
+				while (true) {
+					const node& currentNode = _nodes[current];
+						if (currentNode.is_leaf()) {
+								for (uint32_t p = currentNode.offset; p != currentNode.offset + currentNode.count; ++p) {
+										if (hit(static_cast<size_type>(_indices[p]), t)) { res = _indices[p]; }
+								}
+						}
+						else {
+							// the nearer child first, the other one waits on the stack
+							const uint32_t first  = current + 1;
+							const uint32_t second = currentNode.offset;
+							T firstNear			  = static_cast<T>(0);
+							T secondNear		  = static_cast<T>(0);
+							const bool firstHit	  = _hit_node(_nodes[first], origin, invDirection, t, firstNear);
+							const bool secondHit  = _hit_node(_nodes[second], origin, invDirection, t, secondNear);
+								if (firstHit && secondHit) {
+									const bool swap	  = secondNear < firstNear;
+									stack[stackSize++] = swap ? first : second;
+									current			  = swap ? second : first;
+									continue;
+								}
+								if (firstHit || secondHit) {
+									current = firstHit ? first : second;
+									continue;
+								}
+						}
+
+					// nodes pushed before t got lower may be behind the closest hit by now
+					bool found = false;
+						while (stackSize != 0) {
+							current = stack[--stackSize];
+								if (_hit_node(_nodes[current], origin, invDirection, t, tNear)) {
+									found = true;
+									break;
+								}
+						}
+						if (!found) { break; }
+				}
+			return res;
+		}
+
+		// calls func(primitive) for every primitive in the leaves whose box overlaps box, the primitive itself may still
+		// be outside of it
+		template<class Func>
+		void query(const aabb_type& box, Func&& func) const {
+				if (_nodes.empty() || !_overlaps(_nodes[0], box)) { return; }
+
+			uint32_t stack[max_depth];
+			size_type stackSize	 = 0;
+			stack[stackSize++] = 0;
+				while (stackSize != 0) {
+					const node& current = _nodes[stack[--stackSize]];
+						if (current.is_leaf()) {
+								for (uint32_t p = current.offset; p != current.offset + current.count; ++p) {
+									func(static_cast<size_type>(_indices[p]));
+								}
+							continue;
+						}
+
+					const uint32_t first = static_cast<uint32_t>(&current - _nodes.data()) + 1;
+						if (_overlaps(_nodes[current.offset], box)) { stack[stackSize++] = current.offset; }
+						if (_overlaps(_nodes[first], box)) { stack[stackSize++] = first; }
+				}
+		}
+
+		// nearest primitive within sqrt(distanceSquared) of point. distance(primitive) returns the squared distance from
+		// point to the primitive and is only called for primitives whose box is closer than the best one so far. Returns
+		// the nearest primitive (distanceSquared is then its squared distance) or npos
+		template<class DistanceFunc>
+		size_type nearest(const vec_type& point, T& distanceSquared, DistanceFunc&& distance) const {
+				if (_nodes.empty() || _distance_squared(_nodes[0], point) > distanceSquared) { return npos; }
+
+			size_type res = npos;
+			uint32_t stack[max_depth];
+			T stackDistances[max_depth];
+			size_type stackSize = 0;
+			uint32_t current	= 0;
+				while (true) {
+					const node& currentNode = _nodes[current];
+						if (currentNode.is_leaf()) {
+								for (uint32_t p = currentNode.offset; p != currentNode.offset + currentNode.count; ++p) {
+									const T primitiveDistance = distance(static_cast<size_type>(_indices[p]));
+										if (primitiveDistance < distanceSquared) {
+											distanceSquared = primitiveDistance;
+											res				= _indices[p];
+										}
+								}
+						}
+						else {
+							const uint32_t first  = current + 1;
+							const uint32_t second = currentNode.offset;
+							const T firstDistance = _distance_squared(_nodes[first], point);
+							const T secondDistance = _distance_squared(_nodes[second], point);
+							const bool firstIn	  = firstDistance <= distanceSquared;
+							const bool secondIn	  = secondDistance <= distanceSquared;
+								if (firstIn && secondIn) {
+									const bool swap				= secondDistance < firstDistance;
+									stackDistances[stackSize]	= swap ? firstDistance : secondDistance;
+									stack[stackSize++]			= swap ? first : second;
+									current						= swap ? second : first;
+									continue;
+								}
+								if (firstIn || secondIn) {
+									current = firstIn ? first : second;
+									continue;
+								}
+						}
+
+					bool found = false;
+						while (stackSize != 0) {
+							--stackSize;
+								if (stackDistances[stackSize] <= distanceSquared) {
+									current = stack[stackSize];
+									found	= true;
+									break;
+								}
+						}
+						if (!found) { break; }
+				}
+			return res;
+		}
+
+		#pragma endregion // QUERIES
+	};
+} // namespace mstd
+	#endif
+#endif
@@ -0,0 +1,308 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_SPATIAL_HASH_GRID_HPP_
+	#define _MSTD_SPATIAL_HASH_GRID_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/assert.hpp>
+		#include <mstd/hash.hpp>
+		#include <mstd/spatial_types.hpp>
+		#include <mstd/vec.hpp>
+
+namespace mstd {
+	// uniform grid of cell_size wide cells over points, with the cells hashed into a fixed number of buckets. rebuild()
+	// counting sorts the points by bucket into flat arrays (no allocation per cell or per point), so the points of a
+	// bucket are contiguous in points() and indices(). Cells that share a bucket share its points, the queries filter them
+	// out where it matters. Queries call back with point indices (positions in the array the grid was built from)
+		#if _MSTD_HAS_CXX20
+	template<size_t N, floating_point T>
+	requires (N == 2 || N == 3)
+		#else
+	template<size_t N, class T, std::enable_if_t<((N == 2 || N == 3) && std::is_floating_point_v<T>), bool> >
+		#endif
+	class spatial_hash_grid {
+	public:
+		using value_type = T;
+		using vec_type	 = vec<N, T>;
+		using cell_type	 = vec<N, int32_t>;
+		using size_type	 = size_t;
+
+	private:
+		// ranges of at least this many points are worth a thread
+		static _MSTD_CONSTEXPR17 const size_type _parallel_min		= 1 << 14;
+		// cell boxes up to this size remember the buckets they visited, bigger ones check the cell of every point instead
+		static _MSTD_CONSTEXPR17 const size_type _max_listed_cells = 64;
+
+		T _cell_size	 = static_cast<T>(1);
+		T _inv_cell_size = static_cast<T>(1);
+		// 0 picks the bucket count from the number of points on every rebuild
+		size_type _fixed_buckets = 0;
+		// set by rebuild, before it there are no buckets and bucket_of answers 0
+		size_type _shift		 = 63;
+
+		// _starts[b] is the first point of bucket b, _starts[bucket_count()] the number of points
+		std::vector<uint32_t> _starts;
+		std::vector<uint32_t> _keys;
+		std::vector<vec_type> _points;
+		std::vector<uint32_t> _indices;
+
+		static size_type _bucket_bits(size_type buckets) noexcept {
+			size_type bits = 1;
+				while ((size_type(1) << bits) < buckets) { ++bits; }
+			return bits;
+		}
+
+		// coordinates past the int32_t range (and NaN) clamp to its ends instead of overflowing the cast
+		int32_t _coord(const T& value) const noexcept {
+			const T cell = std::floor(value * _inv_cell_size);
+				if (!(cell > static_cast<T>(std::numeric_limits<int32_t>::min()))) { return std::numeric_limits<int32_t>::min(); }
+				if (cell >= static_cast<T>(std::numeric_limits<int32_t>::max())) { return std::numeric_limits<int32_t>::max(); }
+			return static_cast<int32_t>(cell);
+		}
+
+		void _cell(const vec_type& point, int32_t (&cell)[N]) const noexcept {
+				for (size_t i = 0; i != N; ++i) { cell[i] = _coord(point[i]); }
+		}
+
+		// hash_combine of the cell coordinates, its upper bits spread by a multiplicative hash
+		size_type _bucket(const int32_t (&cell)[N]) const noexcept {
+			size_t hash = 0;
+				if _MSTD_CONSTEXPR17 (N == 2) { hash = hash_combine(cell[0], cell[1]); }
+				else { hash = hash_combine(cell[0], cell[1], cell[2]); }
+			return static_cast<size_type>((static_cast<uint64_t>(hash) * 0x9E37'79B9'7F4A'7C15ull) >> _shift);
+		}
+
+		static size_type _ranges(size_type count, size_type threads) noexcept {
+				if (threads == 0) {
+					static const size_type hardwareThreads = std::max<size_type>(std::thread::hardware_concurrency(), 1);
+					threads								   = hardwareThreads;
+				}
+			return std::max<size_type>(std::min(threads, count / _parallel_min), 1);
+		}
+
+	public:
+		#pragma region CONSTRUCTORS
+
+		spatial_hash_grid() = default;
+
+		// bucketCount is rounded up to a power of two, 0 uses about one bucket per point
+		explicit spatial_hash_grid(T cellSize, size_type bucketCount = 0)
+			: _cell_size(cellSize), _inv_cell_size(static_cast<T>(1) / cellSize) {
+			mstd_assert(cellSize > static_cast<T>(0), "Cell size has to be positive");
+				if (bucketCount != 0) { _fixed_buckets = size_type(1) << _bucket_bits(bucketCount); }
+		}
+
+		#pragma endregion // CONSTRUCTORS
+
+		#pragma region BUILDING
+
+		// threads == 0 uses every hardware thread. The result does not depend on threads: within a bucket points keep
+		// their order. The arrays keep their capacity, so rebuilding every frame only allocates when the points outgrow it
+		void rebuild(const vec_type* points, size_type count, size_type threads = 1) {
+			mstd_assert(count < std::numeric_limits<uint32_t>::max(), "Too many points");
+
+			const size_type bits	= _bucket_bits(_fixed_buckets != 0 ? _fixed_buckets : count);
+			const size_type buckets = size_type(1) << bits;
+			_shift					= 64 - bits;
+
+			_starts.assign(buckets + 1, 0);
+			_keys.resize(count);
+			_points.resize(count);
+			_indices.resize(count);
+
+			utils::parallel_for(count, threads, _parallel_min, [this, points](size_t first, size_t last) {
+					for (size_t i = first; i != last; ++i) {
+						int32_t cell[N];
+						_cell(points[i], cell);
+						_keys[i] = static_cast<uint32_t>(_bucket(cell));
+					}
+			});
+
+			// every range of buckets is counted and filled by one thread, which reads all keys but writes only its own
+			// buckets. _starts[b + 1] holds the count of b, then the start of b and after the scatter the end of b
+			const size_type ranges = _ranges(count, threads);
+			std::vector<size_type> firstPoints(ranges + 1, 0);
+			const auto firstBucket = [buckets, ranges](size_type r) {
+				return buckets / ranges * r + std::min(r, buckets % ranges);
+			};
+
+			utils::parallel_for(ranges, threads, 1, [this, count, &firstPoints, &firstBucket](size_t first, size_t last) {
+					for (size_t r = first; r != last; ++r) {
+						const uint32_t lo = static_cast<uint32_t>(firstBucket(r));
+						const uint32_t hi = static_cast<uint32_t>(firstBucket(r + 1));
+						size_type total	  = 0;
+							for (size_type i = 0; i != count; ++i) {
+								const uint32_t key = _keys[i];
+									if (key >= lo && key < hi) {
+										++_starts[key + 1];
+										++total;
+									}
+							}
+						firstPoints[r + 1] = total;
+					}
+			});
+				for (size_type r = 0; r != ranges; ++r) { firstPoints[r + 1] += firstPoints[r]; }
+
+			utils::parallel_for(ranges, threads, 1, [this, points, count, &firstPoints, &firstBucket](size_t first, size_t last) {
+					for (size_t r = first; r != last; ++r) {
+						const uint32_t lo = static_cast<uint32_t>(firstBucket(r));
+						const uint32_t hi = static_cast<uint32_t>(firstBucket(r + 1));
+						uint32_t start	  = static_cast<uint32_t>(firstPoints[r]);
+							for (uint32_t b = lo; b != hi; ++b) {
+								const uint32_t bucketCount = _starts[b + 1];
+								_starts[b + 1]			   = start;
+								start					  += bucketCount;
+							}
+
+							for (size_type i = 0; i != count; ++i) {
+								const uint32_t key = _keys[i];
+									if (key >= lo && key < hi) {
+										const uint32_t position = _starts[key + 1]++;
+										_points[position]		= points[i];
+										_indices[position]		= static_cast<uint32_t>(i);
+									}
+							}
+					}
+			});
+		}
+
+		void rebuild(const std::vector<vec_type>& points, size_type threads = 1) {
+			rebuild(points.data(), points.size(), threads);
+		}
+
+		#pragma endregion // BUILDING
+
+		#pragma region GETTERS
+
+		[[nodiscard]] size_type size() const noexcept { return _indices.size(); }
+
+		[[nodiscard]] bool empty() const noexcept { return _indices.empty(); }
+
+		[[nodiscard]] T cell_size() const noexcept { return _cell_size; }
+
+		[[nodiscard]] size_type bucket_count() const noexcept { return _starts.empty() ? 0 : _starts.size() - 1; }
+
+		// the points sorted by bucket, bucket b holds points()[bucket_first(b), bucket_last(b))
+		[[nodiscard]] const std::vector<vec_type>& points() const noexcept { return _points; }
+
+		// index of every point in points() in the array the grid was built from
+		[[nodiscard]] const std::vector<uint32_t>& indices() const noexcept { return _indices; }
+
+		[[nodiscard]] cell_type cell_of(const vec_type& point) const noexcept {
+			cell_type res;
+				for (size_t i = 0; i != N; ++i) { res[i] = _coord(point[i]); }
+			return res;
+		}
+
+		[[nodiscard]] size_type bucket_of(const cell_type& cell) const noexcept {
+				if (_starts.empty()) { return 0; }
+
+			int32_t coords[N];
+				for (size_t i = 0; i != N; ++i) { coords[i] = cell[i]; }
+			return _bucket(coords);
+		}
+
+		[[nodiscard]] size_type bucket_first(size_type bucket) const noexcept { return _starts[bucket]; }
+
+		[[nodiscard]] size_type bucket_last(size_type bucket) const noexcept { return _starts[bucket + 1]; }
+
+		#pragma endregion // GETTERS
+
+		#pragma region QUERIES
+
+		// calls func(index, point) for every point in the cells from minCell to maxCell (both inclusive), each once. Points
+		// of cells outside the range that share a bucket with a cell in it may be reported too
+		template<class Func>
+		void for_each_in_cells(const cell_type& minCell, const cell_type& maxCell, Func&& func) const {
+				if (_indices.empty()) { return; }
+
+			size_type cells = 1;
+				for (size_t i = 0; i != N; ++i) {
+						if (maxCell[i] < minCell[i]) { return; }
+					const size_type extent = static_cast<size_type>(static_cast<int64_t>(maxCell[i]) - minCell[i]) + 1;
+					cells = std::min(cells * std::min(extent, _max_listed_cells + 1), _max_listed_cells + 1);
+				}
+			const bool listed = cells <= _max_listed_cells;
+
+			// small boxes skip buckets already visited, big ones keep only the points of the visited cell
+			uint32_t visited[_max_listed_cells];
+			size_type visitedCount = 0;
+			int32_t cell[N];
+				for (size_t i = 0; i != N; ++i) { cell[i] = minCell[i]; }
+				while (true) {
+					const size_type bucket = _bucket(cell);
+					bool skip			   = false;
+						if (listed) {
+							const uint32_t key = static_cast<uint32_t>(bucket);
+							skip			   = std::find(visited, visited + visitedCount, key) != visited + visitedCount;
+								if (!skip) { visited[visitedCount++] = key; }
+						}
+
+						if (!skip) {
+								for (uint32_t p = _starts[bucket]; p != _starts[bucket + 1]; ++p) {
+										if (!listed) {
+											int32_t pointCell[N];
+											_cell(_points[p], pointCell);
+												if (!std::equal(pointCell, pointCell + N, cell)) { continue; }
+										}
+									func(static_cast<size_type>(_indices[p]), _points[p]);
+								}
+						}
+
+					size_t axis = 0;
+						for (; axis != N; ++axis) {
+								if (cell[axis] != maxCell[axis]) {
+									++cell[axis];
+									break;
+								}
+							cell[axis] = minCell[axis];
+						}
+						if (axis == N) { break; }
+				}
+		}
+
+		// calls func(index, point) for every point in cell (and the ones sharing its bucket)
+		template<class Func>
+		void for_each_in_cell(const cell_type& cell, Func&& func) const {
+			for_each_in_cells(cell, cell, std::forward<Func>(func));
+		}
+
+		// calls func(index, distanceSquared) for every point within radius of center (inclusive), each once
+		template<class Func>
+		void query_radius(const vec_type& center, T radius, Func&& func) const {
+			vec_type lo;
+			vec_type hi;
+				for (size_t i = 0; i != N; ++i) {
+					lo[i] = center[i] - radius;
+					hi[i] = center[i] + radius;
+				}
+
+			const T radiusSquared = radius * radius;
+			for_each_in_cells(cell_of(lo), cell_of(hi), [&center, &radiusSquared, &func](size_type index, const vec_type& point) {
+				T distanceSquared = static_cast<T>(0);
+					for (size_t i = 0; i != N; ++i) {
+						const T diff	 = point[i] - center[i];
+						distanceSquared += diff * diff;
+					}
+					if (distanceSquared <= radiusSquared) { func(index, distanceSquared); }
+			});
+		}
+
+		#pragma endregion // QUERIES
+	};
+} // namespace mstd
+	#endif
+#endif
@@ -0,0 +1,49 @@
+/*
+ * mstd - Maipa's Standard Library
+ *
+ * Licensed under the BSD 3-Clause License with Attribution Requirement.
+ * See the LICENSE file for details: https://github.com/MAIPA01/mstd/blob/main/LICENSE
+ *
+ * Copyright (c) 2025, Patryk Antosik (MAIPA01)
+ */
+
+#pragma once
+#ifndef _MSTD_SPATIAL_TYPES_HPP_
+	#define _MSTD_SPATIAL_TYPES_HPP_
+
+	#include <mstd/config.hpp>
+
+	#if !_MSTD_HAS_CXX17
+_MSTD_WARNING("this is only available for c++17 and greater!");
+	#else
+
+		#include <mstd/arithmetic_types.hpp>
+		#include <mstd/spatial_utils.hpp>
+
+namespace mstd {
+		#if _MSTD_HAS_CXX20
+	template<floating_point T = float>
+	class bvh;
+
+	template<size_t N, floating_point T = float>
+	requires (N == 2 || N == 3)
+	class spatial_hash_grid;
+		#else
+	template<class T = float, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	class bvh;
+
+	template<size_t N, class T = float, std::enable_if_t<((N == 2 || N == 3) && std::is_floating_point_v<T>), bool> = true>
+	class spatial_hash_grid;
+		#endif
+
+	using fbvh = bvh<float>;
+	using dbvh = bvh<double>;
+
+	using spatial_hash_grid2  = spatial_hash_grid<2, float>;
+	using spatial_hash_grid3  = spatial_hash_grid<3, float>;
+	using dspatial_hash_grid2 = spatial_hash_grid<2, double>;
+	using dspatial_hash_grid3 = spatial_hash_grid<3, double>;
+} // namespace mstd
+
+	#endif
+#endif
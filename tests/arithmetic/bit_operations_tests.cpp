@@ -12,4 +12,261 @@ namespace mstd::test {
 
 		ASSERT_EQ(i, j);
 	}
-} // namespace mstd::test
\ No newline at end of file
+
+	TEST(ARITHMETIC_TESTS_BIT_OPERATIONS, BYTESWAP) {
+		ASSERT_EQ(byteswap(uint8_t(0xAB)), uint8_t(0xAB));
+		ASSERT_EQ(byteswap(uint16_t(0x0102)), uint16_t(0x0201));
+		ASSERT_EQ(byteswap(int16_t(0x00FF)), int16_t(-256));
+		ASSERT_EQ(byteswap(0x0102'0304u), 0x0403'0201u);
+		ASSERT_EQ(byteswap(uint64_t(0x0102'0304'0506'0708ull)), uint64_t(0x0807'0605'0403'0201ull));
+		ASSERT_EQ(byteswap(int64_t(-2)), int64_t(0xFEFF'FFFF'FFFF'FFFFull));
+		ASSERT_EQ(swap_endians(0x1234'5678u), 0x7856'3412u);
+
+		// floats swap their bit pattern and come back unchanged
+		const float f = 1.5f;
+		ASSERT_EQ(utils::bit_cast<uint32_t>(byteswap(f)), byteswap(utils::bit_cast<uint32_t>(f)));
+		ASSERT_EQ(byteswap(byteswap(f)), f);
+		ASSERT_EQ(byteswap(byteswap(-0.1)), -0.1);
+
+		#ifdef __SIZEOF_INT128__
+		const unsigned __int128 wide
+		  = (static_cast<unsigned __int128>(0x0102'0304'0506'0708ull) << 64) | 0x090A'0B0C'0D0E'0F10ull;
+		const unsigned __int128 swapped
+		  = (static_cast<unsigned __int128>(0x100F'0E0D'0C0B'0A09ull) << 64) | 0x0807'0605'0403'0201ull;
+		ASSERT_TRUE(byteswap(wide) == swapped);
+		#endif
+
+			if _MSTD_CONSTEXPR17 (endian::native == endian::little) {
+				ASSERT_EQ(to_little(0x0102'0304u), 0x0102'0304u);
+				ASSERT_EQ(to_big(0x0102'0304u), 0x0403'0201u);
+			}
+			else {
+				ASSERT_EQ(to_little(0x0102'0304u), 0x0403'0201u);
+				ASSERT_EQ(to_big(0x0102'0304u), 0x0102'0304u);
+			}
+		ASSERT_EQ(from_big(to_big(uint16_t(0xBEEF))), uint16_t(0xBEEF));
+		ASSERT_EQ(from_little(to_little(-7ll)), -7ll);
+
+		#if _MSTD_HAS_CXX20
+		static_assert(byteswap(0x0102'0304u) == 0x0403'0201u);
+		static_assert(byteswap(byteswap(2.5)) == 2.5);
+		#endif
+	}
+
+	template<class T>
+	static void check_bulk_byteswap() {
+		std::vector<T> src(71);
+			for (size_t i = 0; i != src.size(); ++i) { src[i] = static_cast<T>(i * 0x0123'4567'89AB'CDEFull + 3 * i); }
+
+		// every offset and length around the 16 and 32 byte blocks
+			for (size_t first = 0; first != 5; ++first) {
+					for (size_t count = 0; count + first <= src.size(); count += 3) {
+						std::vector<T> dst(count);
+						byteswap(src.data() + first, dst.data(), count);
+							for (size_t i = 0; i != count; ++i) { ASSERT_TRUE(dst[i] == byteswap(src[first + i])); }
+					}
+			}
+
+		std::vector<T> values = src;
+		byteswap(values.data(), values.size());
+			for (size_t i = 0; i != src.size(); ++i) { ASSERT_TRUE(values[i] == byteswap(src[i])); }
+		byteswap(values.data(), values.size());
+		ASSERT_TRUE(values == src);
+
+		std::vector<T> big(src.size());
+		to_big(src.data(), big.data(), src.size());
+			for (size_t i = 0; i != src.size(); ++i) { ASSERT_TRUE(big[i] == to_big(src[i])); }
+		from_big(big.data(), big.data(), big.size());
+		ASSERT_TRUE(big == src);
+		to_little(src.data(), big.data(), src.size());
+			for (size_t i = 0; i != src.size(); ++i) { ASSERT_TRUE(big[i] == to_little(src[i])); }
+		from_little(big.data(), big.data(), big.size());
+		ASSERT_TRUE(big == src);
+	}
+
+	TEST(ARITHMETIC_TESTS_BIT_OPERATIONS, BULK_BYTESWAP) {
+		check_bulk_byteswap<uint8_t>();
+		check_bulk_byteswap<uint16_t>();
+		check_bulk_byteswap<int32_t>();
+		check_bulk_byteswap<uint64_t>();
+		#ifdef __SIZEOF_INT128__
+		check_bulk_byteswap<unsigned __int128>();
+		#endif
+
+		std::vector<double> values = { 1.0, -2.5, 1e300, 0.1, -0.0 };
+		std::vector<double> swapped(values.size());
+		byteswap(values.data(), swapped.data(), values.size());
+			for (size_t i = 0; i != values.size(); ++i) {
+				ASSERT_EQ(utils::bit_cast<uint64_t>(swapped[i]), byteswap(utils::bit_cast<uint64_t>(values[i])));
+			}
+	}
+
+	// xorshift values touching every bit position
+	static std::vector<uint64_t> make_bit_values(size_t count) {
+		std::vector<uint64_t> res = { 0, 1, 2, 3, ~0ull, 1ull << 63, 0x8000'0001ull, 0xFFFF'0000ull };
+		uint64_t x				  = 0x9E37'79B9'7F4A'7C15ull;
+			while (res.size() < count) {
+				x ^= x << 13;
+				x ^= x >> 7;
+				x ^= x << 17;
+				res.push_back(x >> (res.size() % 64));
+			}
+		return res;
+	}
+
+	template<class T>
+	static void check_bit_counting(const std::vector<uint64_t>& values) {
+		constexpr int digits = std::numeric_limits<T>::digits;
+			for (const uint64_t wide : values) {
+				const T value = static_cast<T>(wide);
+				ASSERT_EQ(popcount(value), utils::popcount_fallback(value));
+				ASSERT_EQ(countl_zero(value), utils::countl_zero_fallback(value));
+				ASSERT_EQ(countr_zero(value), utils::countr_zero_fallback(value));
+				ASSERT_EQ(countl_one(value), countl_zero(static_cast<T>(~value)));
+				ASSERT_EQ(bit_width(value), digits - countl_zero(value));
+				ASSERT_EQ(has_single_bit(value), popcount(value) == 1);
+				ASSERT_EQ(bit_floor(value), value == 0 ? T(0) : static_cast<T>(T(1) << (bit_width(value) - 1)));
+					if (bit_width(value) < digits) {
+						ASSERT_GE(bit_ceil(value), value);
+						ASSERT_TRUE(has_single_bit(bit_ceil(value)));
+						ASSERT_LT(bit_ceil(value) / 2, value == 0 ? T(1) : value);
+					}
+
+				int ones = 0;
+				T reversed = 0;
+					for (int i = 0; i != digits; ++i) {
+						const bool bit = ((value >> i) & 1) != 0;
+						ones += bit ? 1 : 0;
+						reversed = static_cast<T>(reversed | (static_cast<T>(bit) << (digits - 1 - i)));
+					}
+				ASSERT_EQ(popcount(value), ones);
+				ASSERT_EQ(bit_reverse(value), reversed);
+
+					for (int shift = -digits - 1; shift <= digits + 1; shift += 3) {
+						const T rotated = rotl(value, shift);
+						ASSERT_EQ(rotr(rotated, shift), value);
+						ASSERT_EQ(popcount(rotated), popcount(value));
+					}
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_BIT_OPERATIONS, BIT_COUNTING) {
+		const std::vector<uint64_t> values = make_bit_values(500);
+		check_bit_counting<uint8_t>(values);
+		check_bit_counting<uint16_t>(values);
+		check_bit_counting<uint32_t>(values);
+		check_bit_counting<uint64_t>(values);
+
+		ASSERT_EQ(countl_zero(uint32_t(0)), 32);
+		ASSERT_EQ(countr_zero(uint16_t(0)), 16);
+		ASSERT_EQ(countl_zero(uint8_t(1)), 7);
+		ASSERT_EQ(rotl(uint8_t(0x81), 1), uint8_t(0x03));
+		ASSERT_EQ(rotr(uint8_t(0x81), 1), uint8_t(0xC0));
+		ASSERT_EQ(rotl(0x1234'5678u, -8), 0x7812'3456u);
+		ASSERT_EQ(bit_ceil(5u), 8u);
+		ASSERT_EQ(bit_ceil(0u), 1u);
+		ASSERT_EQ(bit_floor(5u), 4u);
+		ASSERT_EQ(bit_reverse(uint8_t(0x01)), uint8_t(0x80));
+		ASSERT_EQ(bit_reverse(0x0000'0001u), 0x8000'0000u);
+
+		#if _MSTD_HAS_CXX20
+		static_assert(popcount(0xF0F0u) == 8);
+		static_assert(countl_zero(uint64_t(1)) == 63);
+		static_assert(countr_zero(0x100u) == 8);
+		static_assert(bit_ceil(uint16_t(1000)) == 1024);
+		static_assert(bit_reverse(uint16_t(0x8001)) == 0x8001);
+		static_assert(rotr(uint8_t(1), 1) == 0x80);
+		#endif
+	}
+
+	TEST(ARITHMETIC_TESTS_BIT_OPERATIONS, PDEP_PEXT) {
+		ASSERT_EQ(pdep(0b1011, 0b1111'0000), 0b1011'0000u);
+		ASSERT_EQ(pdep(0b101, 0b1010'1000), 0b1000'1000u);
+		ASSERT_EQ(pext(0b1011'0110, 0b1111'0000), 0b1011u);
+		ASSERT_EQ(pext(~0ull, 0x8000'0000'0000'0001ull), 0b11u);
+
+		const std::vector<uint64_t> values = make_bit_values(300);
+			for (size_t i = 0; i + 1 < values.size(); ++i) {
+				const uint64_t mask		= values[i + 1];
+				const uint64_t lowMask	= popcount(mask) == 64 ? ~0ull : (1ull << popcount(mask)) - 1;
+				ASSERT_EQ(pdep(values[i], mask), utils::pdep_fallback(values[i], mask));
+				ASSERT_EQ(pext(values[i], mask), utils::pext_fallback(values[i], mask));
+				ASSERT_EQ(pext(pdep(values[i], mask), mask), values[i] & lowMask);
+			}
+
+		#if _MSTD_HAS_CXX20
+		static_assert(pdep(0b11, 0b1010) == 0b1010);
+		static_assert(pext(0b1010, 0b1010) == 0b11);
+		#endif
+	}
+
+	TEST(ARITHMETIC_TESTS_BIT_OPERATIONS, MORTON) {
+		ASSERT_EQ(morton_encode(vec<2, uint32_t>(0b11, 0b00)), 0b0101u);
+		ASSERT_EQ(morton_encode(vec<2, uint32_t>(0b00, 0b11)), 0b1010u);
+		ASSERT_EQ(morton_encode(vec<3, uint32_t>(1, 1, 1)), 0b111u);
+		ASSERT_EQ(morton_encode(vec<3, uint32_t>(0, 0, 2)), 0b100'000u);
+		ASSERT_EQ(morton_encode(vec<2, uint32_t>(~0u, ~0u)), ~0ull);
+		ASSERT_EQ(morton_encode(vec<3, uint32_t>(~0u, ~0u, ~0u)), ~0ull >> 1);
+
+		const std::vector<uint64_t> values = make_bit_values(300);
+			for (size_t i = 0; i + 2 < values.size(); ++i) {
+				const vec<2, uint32_t> pos2(static_cast<uint32_t>(values[i]), static_cast<uint32_t>(values[i + 1]));
+				const uint64_t code2 = morton_encode(pos2);
+				ASSERT_EQ(code2, utils::pdep_fallback(pos2[0], utils::morton2_mask) |
+								   utils::pdep_fallback(pos2[1], utils::morton2_mask << 1));
+				ASSERT_EQ(morton_decode<2>(code2), pos2);
+
+				const vec<3, uint32_t> pos3(static_cast<uint32_t>(values[i]) & 0x1F'FFFFu,
+				  static_cast<uint32_t>(values[i + 1]) & 0x1F'FFFFu, static_cast<uint32_t>(values[i + 2]) & 0x1F'FFFFu);
+				const uint64_t code3 = morton_encode(pos3);
+				ASSERT_EQ(code3, utils::morton_spread3(pos3[0]) | (utils::morton_spread3(pos3[1]) << 1) |
+								   (utils::morton_spread3(pos3[2]) << 2));
+				ASSERT_EQ(morton_decode<3>(code3), pos3);
+			}
+
+		#if _MSTD_HAS_CXX20
+		static_assert(morton_encode(vec<2, uint32_t>(3, 5)) == 0b100111);
+		static_assert(morton_decode<3>(0b111'000)[2] == 2);
+		#endif
+	}
+
+	TEST(ARITHMETIC_TESTS_BIT_OPERATIONS, BULK_BITS) {
+		const std::vector<uint64_t> values = make_bit_values(151);
+		const auto* bytes				   = reinterpret_cast<const uint8_t*>(values.data());
+
+		// every length and offset around the 32 byte blocks
+			for (size_t first = 0; first != 9; ++first) {
+					for (size_t count = 0; first + count <= 200; count += 7) {
+						size_t expected = 0;
+							for (size_t i = 0; i != count; ++i) { expected += static_cast<size_t>(popcount(bytes[first + i])); }
+						ASSERT_EQ(popcount(bytes + first, count), expected);
+					}
+			}
+
+		size_t expected = 0;
+			for (const uint64_t value : values) { expected += static_cast<size_t>(popcount(value)); }
+		ASSERT_EQ(popcount(values.data(), values.size()), expected);
+
+		std::vector<int> counts(values.size());
+		popcount(values.data(), counts.data(), values.size());
+			for (size_t i = 0; i != values.size(); ++i) { ASSERT_EQ(counts[i], popcount(values[i])); }
+
+		std::vector<uint64_t> res(values.size());
+		bit_reverse(values.data(), res.data(), values.size());
+			for (size_t i = 0; i != values.size(); ++i) { ASSERT_EQ(res[i], bit_reverse(values[i])); }
+		pdep(values.data(), 0x00FF'00FF'00FF'00FFull, res.data(), values.size());
+			for (size_t i = 0; i != values.size(); ++i) { ASSERT_EQ(res[i], pdep(values[i], 0x00FF'00FF'00FF'00FFull)); }
+		pext(values.data(), 0x00FF'00FF'00FF'00FFull, res.data(), values.size());
+			for (size_t i = 0; i != values.size(); ++i) { ASSERT_EQ(res[i], pext(values[i], 0x00FF'00FF'00FF'00FFull)); }
+
+		std::vector<vec<3, uint32_t>> positions(values.size());
+			for (size_t i = 0; i != values.size(); ++i) {
+				positions[i] = vec<3, uint32_t>(static_cast<uint32_t>(i), static_cast<uint32_t>(values[i] & 0xFFFFu), 7u);
+			}
+		morton_encode(positions.data(), res.data(), positions.size());
+			for (size_t i = 0; i != values.size(); ++i) { ASSERT_EQ(res[i], morton_encode(positions[i])); }
+		std::vector<vec<3, uint32_t>> decoded(values.size());
+		morton_decode(res.data(), decoded.data(), res.size());
+		ASSERT_EQ(decoded, positions);
+	}
+} // namespace mstd::test
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	class DmatTest : public ::testing::Test {
+	protected:
+		// small integers in [-5, 5], seed 0 gives the values of the fixed size 6x6 LU tests
+		template<class T>
+		static dmat<T> pattern(size_t columns, size_t rows, size_t seed) {
+			dmat<T> res(columns, rows);
+				for (size_t x = 0; x != columns; ++x) {
+						for (size_t y = 0; y != rows; ++y) {
+							res[x][y] = static_cast<T>((x * 7 + y * y * 3 + x * y + seed) % 11) - static_cast<T>(5);
+						}
+				}
+			return res;
+		}
+	};
+
+	template<class T>
+	static dmat<T> naive_mul(const dmat<T>& a, const dmat<T>& b) {
+		dmat<T> res(b.columns(), a.rows());
+			for (size_t x = 0; x != b.columns(); ++x) {
+					for (size_t y = 0; y != a.rows(); ++y) {
+						T sum = static_cast<T>(0);
+							for (size_t k = 0; k != a.columns(); ++k) { sum += a[k][y] * b[x][k]; }
+						res[x][y] = sum;
+					}
+			}
+		return res;
+	}
+
+	template<class T>
+	static void expect_dmat_near(const dmat<T>& value, const dmat<T>& expected, T eps) {
+		ASSERT_EQ(value.columns(), expected.columns());
+		ASSERT_EQ(value.rows(), expected.rows());
+			for (size_t x = 0; x != value.columns(); ++x) {
+					for (size_t y = 0; y != value.rows(); ++y) {
+						ASSERT_NEAR(value[x][y], expected[x][y], eps) << x << ", " << y;
+					}
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_DMAT, MAT_CONVERSIONS) {
+		mat<3, 2, float> m;
+			for (size_t x = 0; x != 3; ++x) {
+					for (size_t y = 0; y != 2; ++y) { m[x][y] = static_cast<float>(x * 2 + y); }
+			}
+
+		const dmat<float> d = m;
+		ASSERT_EQ(d.columns(), 3u);
+		ASSERT_EQ(d.rows(), 2u);
+		EXPECT_EQ(d[2u][1u], 5.f);
+		EXPECT_EQ((d.to_mat<3, 2>()), m);
+
+		// views do not copy, a block of a view keeps the column stride
+		dmat_view<float> view(m);
+		view[1u][0u] = 10.f;
+		EXPECT_EQ(m[1u][0u], 10.f);
+		EXPECT_EQ(view.block(1, 1, 5, 5).columns(), 2u);
+		EXPECT_EQ(view.block(1, 1, 5, 5)[1u][0u], m[2u][1u]);
+		EXPECT_EQ(dmat<float>(dmat_view<const float>(m)), dmat<float>(m));
+	}
+
+	template<class T>
+	static void check_dmat_mul(const dmat<T>& a, const dmat<T>& b, T eps) {
+		const dmat<T> expected = naive_mul(a, b);
+
+		expect_dmat_near(a * b, expected, eps);
+		expect_dmat_near(a.mul(b, 4), expected, eps);
+		expect_dmat_near(a.mul(b, 0), expected, eps);
+
+		const dvec<T> v	 = b.column(b.columns() - 1);
+		const dvec<T> av = a * v;
+			for (size_t y = 0; y != a.rows(); ++y) { ASSERT_NEAR(av[y], expected[b.columns() - 1][y], eps); }
+	}
+
+	TEST_F(DmatTest, MUL) {
+		check_dmat_mul(pattern<float>(5, 7, 1), pattern<float>(3, 5, 2), 1e-4f);
+		// crosses the row, inner and column blocks with tails everywhere
+		check_dmat_mul(pattern<float>(301, 263, 1), pattern<float>(131, 301, 2), 1e-2f);
+		check_dmat_mul(pattern<double>(129, 300, 1), pattern<double>(70, 129, 2), 1e-9);
+		check_dmat_mul(pattern<int>(17, 13, 1), pattern<int>(9, 17, 2), 0);
+	}
+
+	TEST(ARITHMETIC_TESTS_DMAT, GEMM_FIXED) {
+		// the same kernel multiplies fixed size matrices through views
+		const mat<4, 4, float> a = mat4::rot_y(0.4f) * mat4::translation({ 1.f, 2.f, 3.f });
+		const mat<4, 4, float> b = mat4::scale({ 2.f, 3.f, 4.f });
+		mat<4, 4, float> res;
+		gemm<float>(a, b, res);
+
+		const mat<4, 4, float> expected = a * b;
+			for (size_t x = 0; x != 4; ++x) {
+					for (size_t y = 0; y != 4; ++y) { EXPECT_NEAR(res[x][y], expected[x][y], 1e-6f); }
+			}
+	}
+
+	TEST_F(DmatTest, ELEMENT_WISE) {
+		const dmat<float> a = pattern<float>(5, 6, 1);
+		const dmat<float> b = pattern<float>(5, 6, 2);
+
+		const dmat<float> sum = a + b * 2.f - 1.f;
+			for (size_t x = 0; x != 5; ++x) {
+					for (size_t y = 0; y != 6; ++y) { ASSERT_EQ(sum[x][y], a[x][y] + b[x][y] * 2.f - 1.f); }
+			}
+		EXPECT_EQ(a / 0.f, a);
+
+		const dmat<float> clamped = a.clampped(-1.f, 2.f);
+		EXPECT_EQ(a.clampped(dmat<float>::fill(5, 6, -1.f), dmat<float>::fill(5, 6, 2.f)), clamped);
+
+		// different shapes only touch the overlap
+		dmat<float> c  = dmat<float>::one(3, 3);
+		c			  += dmat<float>::one(2, 4);
+		EXPECT_EQ(c[1u][2u], 2.f);
+		EXPECT_EQ(c[2u][0u], 1.f);
+	}
+
+	TEST(ARITHMETIC_TESTS_DMAT, FLOATING_POINT_EQUALITY) {
+		// element wise ==, not a byte compare
+		dmat<double> negativeZero(2, 2);
+		negativeZero[1u][1u] = -0.0;
+		EXPECT_EQ(negativeZero, dmat<double>(2, 2));
+
+		const dmat<double> nan(2, 2, std::numeric_limits<double>::quiet_NaN());
+		EXPECT_NE(nan, nan);
+		EXPECT_NE(dmat<double>(2, 3), dmat<double>(3, 2));
+	}
+
+	TEST_F(DmatTest, TRANSPOSE) {
+		const dmat<double> a = pattern<double>(37, 70, 3);
+		const dmat<double> t = a.transposed();
+		ASSERT_EQ(t.columns(), 70u);
+		ASSERT_EQ(t.rows(), 37u);
+			for (size_t x = 0; x != 37; ++x) {
+					for (size_t y = 0; y != 70; ++y) { ASSERT_EQ(t[y][x], a[x][y]); }
+			}
+
+		dmat<double> square = pattern<double>(9, 9, 4);
+		EXPECT_EQ(square.transposed().transpose(), square);
+		dmat<double> copy = a;
+		EXPECT_EQ(copy.transpose(), t);
+	}
+
+	TEST_F(DmatTest, LU_AND_INVERSE) {
+		// the same values as the fixed size 6x6 tests
+		const dmat<double> m = pattern<double>(6, 6, 0);
+		const mat<6, 6, double> fixed = m.to_mat<6, 6>();
+
+		const auto lu = m.lu();
+		ASSERT_FALSE(lu.is_singular());
+		expect_dmat_near(lu.permutation() * m, lu.lower() * lu.upper(), 1e-12);
+		EXPECT_NEAR(m.determinant(), fixed.determinant(), 1e-9);
+		// integer matrices take the fraction free path and stay exact
+		EXPECT_EQ(pattern<int>(6, 6, 0).determinant(), static_cast<int>(std::lround(fixed.determinant())));
+
+		expect_dmat_near(m * m.inverted(), dmat<double>::identity(6), 1e-10);
+		expect_dmat_near(m.inverted(), dmat<double>(fixed.inverted()), 1e-12);
+
+		const dvec<double> b = { 1.0, -2.0, 3.0, 0.5, 4.0, -1.0 };
+		const dvec<double> r = m * m.solve(b);
+			for (size_t i = 0; i != 6; ++i) { EXPECT_NEAR(r[i], b[i], 1e-10); }
+
+		// larger than any closed form, solved through the same LU as mat_lu
+		const dmat<double> big = pattern<double>(40, 40, 5) + dmat<double>::fill_identity(40, 20.0);
+		expect_dmat_near(big * big.inverted(), dmat<double>::identity(40), 1e-10);
+	}
+
+	TEST_F(DmatTest, SINGULAR) {
+		dmat<double> m = pattern<double>(6, 6, 0);
+		std::fill_n(m[4u], 6, 0.0);
+
+		EXPECT_TRUE(m.lu().is_singular());
+		EXPECT_EQ(m.determinant(), 0.0);
+		EXPECT_TRUE(m.inverted().is_zero());
+
+		const dmat<double> rect(3, 4, 1.0);
+		EXPECT_TRUE(rect.lu().is_singular());
+		EXPECT_EQ(rect.determinant(), 0.0);
+		EXPECT_TRUE(rect.inverted().is_zero());
+	}
+} // namespace mstd::test
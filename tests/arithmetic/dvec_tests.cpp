@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	TEST(ARITHMETIC_TESTS_DVEC, CONSTRUCTORS) {
+		const dvec<float> empty;
+		EXPECT_TRUE(empty.empty());
+
+		const dvec<float> zeros(5);
+		EXPECT_EQ(zeros.size(), 5u);
+		EXPECT_TRUE(zeros.is_zero());
+		EXPECT_TRUE(dvec<float>::one(3).is_one());
+
+		const dvec<int> values = { 1, 2, 3 };
+		EXPECT_EQ(values[2u], 3);
+
+		// the storage is aligned for the SIMD kernels
+		const dvec<double> large(37, 1.0);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(large.data()) % utils::aligned_allocator<double>::alignment, 0u);
+	}
+
+	TEST(ARITHMETIC_TESTS_DVEC, VEC_CONVERSIONS) {
+		const vec3 v(1.f, 2.f, 3.f);
+
+		// vec -> dvec copies, dvec -> vec copies the overlap
+		const dvec<float> d = v;
+		ASSERT_EQ(d.size(), 3u);
+		EXPECT_EQ(d.to_vec<3>(), v);
+		EXPECT_EQ(d.to_vec<4>(), vec4(1.f, 2.f, 3.f, 0.f));
+		EXPECT_EQ(d.to_vec<2>(), vec2(1.f, 2.f));
+
+		// views do not copy
+		vec3 target = v;
+		dvec_view<float> view(target);
+		view[1u] = 5.f;
+		EXPECT_EQ(target.y(), 5.f);
+
+		const dvec_view<const float> constView = v;
+		EXPECT_EQ(constView.data(), static_cast<const float*>(v));
+		EXPECT_EQ(dvec<float>(constView), d);
+		EXPECT_EQ(dvec_view<const float>(d).subview(1, 5).size(), 2u);
+	}
+
+	template<class T>
+	static void check_dvec_operators(size_t size) {
+		dvec<T> a(size);
+		dvec<T> b(size);
+			for (size_t i = 0; i != size; ++i) {
+				a[i] = static_cast<T>((i * 7 + 3) % 11) - static_cast<T>(5);
+				b[i] = static_cast<T>((i * 7 + 6) % 11) - static_cast<T>(5);
+			}
+
+		const dvec<T> sum  = a + b;
+		const dvec<T> diff = a - b;
+		const dvec<T> prod = a * b;
+		const dvec<T> scal = a * static_cast<T>(3) - static_cast<T>(1);
+		T dot			   = static_cast<T>(0);
+			for (size_t i = 0; i != size; ++i) {
+				ASSERT_EQ(sum[i], a[i] + b[i]);
+				ASSERT_EQ(diff[i], a[i] - b[i]);
+				ASSERT_EQ(prod[i], a[i] * b[i]);
+				ASSERT_EQ(scal[i], a[i] * static_cast<T>(3) - static_cast<T>(1));
+				dot += a[i] * b[i];
+			}
+		EXPECT_EQ(a.dot(b), dot);
+		EXPECT_EQ(-(-a), a);
+
+		// division by zero keeps the dividend like vec
+		EXPECT_EQ(a / static_cast<T>(0), a);
+		EXPECT_EQ(a / dvec<T>(size), a);
+
+		const dvec<T> clamped = a.clampped(static_cast<T>(-2), static_cast<T>(2));
+			for (size_t i = 0; i != size; ++i) { ASSERT_EQ(clamped[i], std::clamp(a[i], static_cast<T>(-2), static_cast<T>(2))); }
+		EXPECT_EQ(a.clampped(dvec<T>(size, static_cast<T>(-2)), dvec<T>(size, static_cast<T>(2))), clamped);
+	}
+
+	TEST(ARITHMETIC_TESTS_DVEC, OPERATORS) {
+		check_dvec_operators<float>(3);
+		check_dvec_operators<float>(37);
+		check_dvec_operators<double>(64);
+		check_dvec_operators<int>(19);
+	}
+
+	TEST(ARITHMETIC_TESTS_DVEC, FLOATING_POINT_EQUALITY) {
+		// element wise ==, not a byte compare
+		EXPECT_EQ((dvec<double>{ 0.0, 1.0 }), (dvec<double>{ -0.0, 1.0 }));
+		const double nan = std::numeric_limits<double>::quiet_NaN();
+		EXPECT_NE((dvec<double>{ nan, 1.0 }), (dvec<double>{ nan, 1.0 }));
+		EXPECT_EQ(dvec<float>(), dvec<float>());
+	}
+
+	TEST(ARITHMETIC_TESTS_DVEC, MISMATCHED_SIZES) {
+		// operations between two dvecs only touch the common values
+		dvec<float> a = { 1.f, 2.f, 3.f, 4.f };
+		a			 += dvec<float>{ 10.f, 20.f };
+		EXPECT_EQ(a, (dvec<float>{ 11.f, 22.f, 3.f, 4.f }));
+		EXPECT_EQ(a.dot(dvec<float>{ 1.f, 1.f }), 33.f);
+		EXPECT_NE(a, (dvec<float>{ 11.f, 22.f, 3.f }));
+	}
+
+	TEST(ARITHMETIC_TESTS_DVEC, LENGTH) {
+		const dvec<double> v = { 3.0, 4.0, 12.0 };
+		EXPECT_DOUBLE_EQ(v.length(), 13.0);
+		EXPECT_DOUBLE_EQ(v.normalized().length(), 1.0);
+		EXPECT_TRUE(dvec<double>(4).normalized().is_zero());
+	}
+} // namespace mstd::test
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	template<size_t N, class T>
+	static vec<N, T> make_expr_vec(size_t seed) {
+		vec<N, T> res;
+			for (size_t i = 0; i != N; ++i) { res[i] = static_cast<T>((i * 7 + seed * 3) % 11) - static_cast<T>(5); }
+		return res;
+	}
+
+	template<size_t C, size_t R, class T>
+	static mat<C, R, T> make_expr_mat(size_t seed) {
+		mat<C, R, T> res;
+			for (size_t x = 0; x != C; ++x) {
+					for (size_t y = 0; y != R; ++y) { res[x][y] = static_cast<T>((x * 5 + y * 3 + seed) % 13) - 6; }
+			}
+		return res;
+	}
+
+	template<size_t N, class T>
+	static void check_vec_exprs() {
+		const vec<N, T> a = make_expr_vec<N, T>(1);
+		const vec<N, T> b = make_expr_vec<N, T>(2);
+		const vec<N, T> c = make_expr_vec<N, T>(3);
+		const T s		  = static_cast<T>(3);
+		const T t		  = static_cast<T>(-2);
+
+		vec<N, T> res = lazy(a) * s + b - lazy(c) * t;
+		ASSERT_EQ(res, a * s + b - c * t);
+
+		res = s * lazy(a) - (lazy(b) + c) / t;
+		ASSERT_EQ(res, s * a - (b + c) / t);
+
+		res = -lazy(a) * b + lazy(c) * lazy(c) - s;
+		ASSERT_EQ(res, -a * b + c * c - s);
+
+		// division by zero keeps the dividend like the eager operator
+		res = lazy(a) / static_cast<T>(0);
+		ASSERT_EQ(res, a);
+
+		// the result may alias an operand
+		res = lazy(res) * s + res;
+		ASSERT_EQ(res, a * s + a);
+
+		res += lazy(b) * s;
+		ASSERT_EQ(res, a * s + a + b * s);
+
+		res -= lazy(c) + c;
+		ASSERT_EQ(res, a * s + a + b * s - c - c);
+
+		res *= lazy(a) + static_cast<T>(1);
+		ASSERT_EQ(res, (a * s + a + b * s - c - c) * (a + static_cast<T>(1)));
+	}
+
+	TEST(ARITHMETIC_TESTS_EXPR, VEC) {
+		check_vec_exprs<2, int>();
+		check_vec_exprs<3, float>();
+		check_vec_exprs<4, float>();
+		check_vec_exprs<4, double>();
+		check_vec_exprs<37, double>();
+	}
+
+	TEST(ARITHMETIC_TESTS_EXPR, MAT) {
+		const mat<3, 4, float> a = make_expr_mat<3, 4, float>(1);
+		const mat<3, 4, float> b = make_expr_mat<3, 4, float>(2);
+		const mat<3, 4, float> c = make_expr_mat<3, 4, float>(3);
+
+		mat<3, 4, float> res = lazy(a) * 2.f + b - lazy(c) / 4.f;
+		ASSERT_EQ(res, a * 2.f + b - c / 4.f);
+
+		res = 0.5f * -lazy(a) + 1.f;
+		ASSERT_EQ(res, 0.5f * -a + 1.f);
+
+		res += lazy(b) - c;
+		ASSERT_EQ(res, 0.5f * -a + 1.f + (b - c));
+
+		const mat<3, 4, float> prev = res;
+		res						   -= lazy(res) * 2.f;
+		ASSERT_EQ(res, prev - prev * 2.f);
+
+		// the matrix product stays eager
+		const mat<4, 4, double> m = make_expr_mat<4, 4, double>(4);
+		const mat<4, 4, double> n = make_expr_mat<4, 4, double>(5);
+		ASSERT_EQ((lazy(m) + n).eval() * m, (m + n) * m);
+	}
+
+	TEST(ARITHMETIC_TESTS_EXPR, EVAL) {
+		const vec3 a(1.f, 2.f, 3.f);
+		const vec3 b(4.f, 5.f, 6.f);
+
+		// auto keeps the node, eval() gives the value
+		const auto node = lazy(a) + b;
+		static_assert(!std::is_same_v<std::decay_t<decltype(node)>, vec3>);
+		static_assert(std::is_same_v<decltype(node.eval()), vec3>);
+		ASSERT_EQ(node.eval(), vec3(5.f, 7.f, 9.f));
+
+		// nodes convert where a value is expected
+		ASSERT_EQ((lazy(a) * 2.f).eval().length(), (a * 2.f).length());
+		ASSERT_EQ(vec3(lazy(a) - b).dot(a), (a - b).dot(a));
+	}
+
+		#if _MSTD_HAS_CXX20
+	TEST(ARITHMETIC_TESTS_EXPR, CONSTEXPR) {
+		constexpr vec<4, float> v = []() {
+			const vec<4, float> a(1.f, 2.f, 3.f, 4.f);
+			const vec<4, float> b(4.f, 3.f, 2.f, 1.f);
+			return (lazy(a) * 2.f + b - lazy(a)).eval();
+		}();
+		static_assert(v[0u] == 5.f && v[1u] == 5.f && v[2u] == 5.f && v[3u] == 5.f);
+
+		constexpr mat<2, 2, int> m = []() {
+			const mat<2, 2, int> a = mat<2, 2, int>::identity();
+			mat<2, 2, int> res	   = lazy(a) * 3 - 1;
+			res					  += lazy(a);
+			return res;
+		}();
+		static_assert(m[0u][0u] == 3 && m[0u][1u] == -1 && m[1u][0u] == -1 && m[1u][1u] == 3);
+	}
+		#endif
+} // namespace mstd::test
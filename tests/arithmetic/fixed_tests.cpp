@@ -0,0 +1,282 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	using sfixed4_4 = fixed<4, 4, int8_t, fixed_overflow::saturate>;
+
+	TEST(ARITHMETIC_TESTS_FIXED, CONVERSIONS) {
+		EXPECT_EQ(fixed16_16(3).raw(), 3 << 16);
+		EXPECT_EQ(fixed16_16(-3).raw(), -3 * 65536);
+		EXPECT_EQ(fixed16_16(1.5).raw(), 0x18000);
+		EXPECT_EQ(fixed16_16(-0.25f).raw(), -0x4000);
+
+		// nearest raw value, ties away from zero
+		EXPECT_EQ(fixed16_16(1.4 / 65536.0).raw(), 1);
+		EXPECT_EQ(fixed16_16(0.5 / 65536.0).raw(), 1);
+		EXPECT_EQ(fixed16_16(-0.5 / 65536.0).raw(), -1);
+		EXPECT_EQ(fixed16_16(0.49 / 65536.0).raw(), 0);
+
+		// floating point values out of range are clamped and nan gives 0 whatever the overflow mode is
+		EXPECT_EQ(fixed16_16(1e10), std::numeric_limits<fixed16_16>::max());
+		EXPECT_EQ(fixed16_16(-1e10), std::numeric_limits<fixed16_16>::lowest());
+		EXPECT_EQ(fixed16_16(std::nan("")).raw(), 0);
+
+		// integers wrap or saturate like the results do
+		EXPECT_EQ(fixed8_8(130).raw(), static_cast<int16_t>(130 << 8));
+		EXPECT_EQ((fixed<8, 8, int16_t, fixed_overflow::saturate>(130)),
+		  (std::numeric_limits<fixed<8, 8, int16_t, fixed_overflow::saturate> >::max()));
+		EXPECT_EQ((fixed<8, 8, int16_t, fixed_overflow::saturate>(uint64_t(-1))),
+		  (std::numeric_limits<fixed<8, 8, int16_t, fixed_overflow::saturate> >::max()));
+		EXPECT_EQ((fixed<8, 8, int16_t, fixed_overflow::saturate>(-200)),
+		  (std::numeric_limits<fixed<8, 8, int16_t, fixed_overflow::saturate> >::lowest()));
+
+		EXPECT_EQ(static_cast<double>(fixed16_16(2.75)), 2.75);
+		EXPECT_EQ(static_cast<float>(fixed16_16::from_raw(1)), 1.0f / 65536.0f);
+		EXPECT_EQ(static_cast<int>(fixed16_16(-1.75)), -1);
+		EXPECT_EQ(static_cast<int>(fixed16_16(1.75)), 1);
+		EXPECT_TRUE(static_cast<bool>(fixed16_16::from_raw(1)));
+		EXPECT_FALSE(static_cast<bool>(fixed16_16()));
+	}
+
+	TEST(ARITHMETIC_TESTS_FIXED, ARITHMETIC) {
+		const fixed16_16 a(2.5);
+		const fixed16_16 b(-1.25);
+
+		EXPECT_EQ(a + b, fixed16_16(1.25));
+		EXPECT_EQ(a - b, fixed16_16(3.75));
+		EXPECT_EQ(a * b, fixed16_16(-3.125));
+		EXPECT_EQ(a / b, fixed16_16(-2));
+		EXPECT_EQ(-a, fixed16_16(-2.5));
+		EXPECT_EQ(a * 2, fixed16_16(5));
+		EXPECT_EQ(3 - a, fixed16_16(0.5));
+		EXPECT_TRUE(b < a);
+		EXPECT_TRUE(a >= 2);
+		EXPECT_TRUE(a != b);
+
+		// the product is rounded to nearest, the quotient truncated toward zero
+		const fixed16_16 eps = std::numeric_limits<fixed16_16>::epsilon();
+		EXPECT_EQ(eps * fixed16_16(0.5), eps);
+		EXPECT_EQ(eps * fixed16_16(0.25), fixed16_16());
+		EXPECT_EQ(-eps * fixed16_16(0.25), fixed16_16());
+		EXPECT_EQ(fixed16_16(1) / 3, fixed16_16::from_raw(21845));
+		EXPECT_EQ(fixed16_16(-1) / 3, fixed16_16::from_raw(-21845));
+
+		// division by zero gives max or lowest by the sign of the dividend
+		EXPECT_EQ(a / 0, std::numeric_limits<fixed16_16>::max());
+		EXPECT_EQ(b / 0, std::numeric_limits<fixed16_16>::lowest());
+
+		#ifdef __SIZEOF_INT128__
+		// 64 bit storage goes through 128 bit products
+		using fixed_type = fixed<32, 32>;
+		const fixed_type big(1234567.25);
+		EXPECT_EQ(big * fixed_type(4), fixed_type(4938269));
+		EXPECT_EQ(big / fixed_type(0.5), fixed_type(2469134.5));
+		EXPECT_EQ(fixed_type(1) / 3, fixed_type::from_raw(0x5555'5555));
+		#endif
+	}
+
+	TEST(ARITHMETIC_TESTS_FIXED, OVERFLOW_MODES) {
+		using wrapping	 = fixed<4, 4, int16_t, fixed_overflow::wrap>;
+		using saturating = fixed<4, 4, int16_t, fixed_overflow::saturate>;
+
+		// the range is IntBits + FracBits bits even when the storage is wider
+		EXPECT_EQ(wrapping(7) + wrapping(1), wrapping(-8));
+		EXPECT_EQ(wrapping(-8) - wrapping::from_raw(1), std::numeric_limits<wrapping>::max());
+		EXPECT_EQ(-wrapping(-8), wrapping(-8));
+		EXPECT_EQ(wrapping(4) * wrapping(2), wrapping(-8));
+
+		EXPECT_EQ(saturating(7) + saturating(1), std::numeric_limits<saturating>::max());
+		EXPECT_EQ(saturating(-8) - saturating(1), std::numeric_limits<saturating>::lowest());
+		EXPECT_EQ(-saturating(-8), std::numeric_limits<saturating>::max());
+		EXPECT_EQ(saturating(4) * saturating(-3), std::numeric_limits<saturating>::lowest());
+		EXPECT_EQ(saturating(4) / saturating(0.25), std::numeric_limits<saturating>::max());
+
+		EXPECT_EQ(std::numeric_limits<saturating>::max().raw(), 127);
+		EXPECT_EQ(std::numeric_limits<saturating>::lowest().raw(), -128);
+	}
+
+	// every pair of fixed<4, 4> values against the exact int result
+	TEST(ARITHMETIC_TESTS_FIXED, OVERFLOW_OPERATIONS) {
+		const auto fits		= [](int value) { return value >= -128 && value <= 127; };
+		const auto clamped	= [](int value) { return sfixed4_4::from_raw(static_cast<int8_t>(std::clamp(value, -128, 127))); };
+		const auto wrapped	= [](int value) { return fixed<4, 4>::from_raw(static_cast<int8_t>(value)); };
+		const auto roundMul = [](int a, int b) { return (a * b + 8) >> 4; };
+
+			for (int a = -128; a <= 127; ++a) {
+					for (int b = -128; b <= 127; ++b) {
+						const sfixed4_4 fa = sfixed4_4::from_raw(static_cast<int8_t>(a));
+						const sfixed4_4 fb = sfixed4_4::from_raw(static_cast<int8_t>(b));
+						const int sum	   = a + b;
+						const int diff	   = a - b;
+						const int prod	   = roundMul(a, b);
+
+						sfixed4_4 res;
+						ASSERT_EQ(add_overflow(fa, fb, res), !fits(sum));
+							if (fits(sum)) { ASSERT_EQ(res.raw(), sum); }
+						ASSERT_EQ(sub_overflow(fa, fb, res), !fits(diff));
+							if (fits(diff)) { ASSERT_EQ(res.raw(), diff); }
+						ASSERT_EQ(mul_overflow(fa, fb, res), !fits(prod));
+							if (fits(prod)) { ASSERT_EQ(res.raw(), prod); }
+
+						ASSERT_EQ(fa + fb, clamped(sum));
+						ASSERT_EQ(fa - fb, clamped(diff));
+						ASSERT_EQ(fa * fb, clamped(prod));
+						ASSERT_EQ(saturating_add(fa, fb), clamped(sum));
+						ASSERT_EQ(saturating_sub(fa, fb), clamped(diff));
+						ASSERT_EQ(saturating_mul(fa, fb), clamped(prod));
+
+						const fixed<4, 4> wa = fixed<4, 4>::from_raw(static_cast<int8_t>(a));
+						const fixed<4, 4> wb = fixed<4, 4>::from_raw(static_cast<int8_t>(b));
+						ASSERT_EQ(wa + wb, wrapped(sum));
+						ASSERT_EQ(wa - wb, wrapped(diff));
+						ASSERT_EQ(wa * wb, wrapped(prod));
+
+							if (b != 0) {
+								const int quot = (a * 16) / b;
+								ASSERT_EQ(div_overflow(fa, fb, res), !fits(quot));
+									if (fits(quot)) { ASSERT_EQ(res.raw(), quot); }
+								ASSERT_EQ(fa / fb, clamped(quot));
+								ASSERT_EQ(wa / wb, wrapped(quot));
+							}
+							else {
+								ASSERT_FALSE(div_overflow(fa, fb, res));
+								ASSERT_EQ(res, a < 0 ? std::numeric_limits<sfixed4_4>::lowest()
+													 : std::numeric_limits<sfixed4_4>::max());
+							}
+					}
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_FIXED, MATH) {
+		EXPECT_EQ(abs(fixed16_16(-2.5)), fixed16_16(2.5));
+		EXPECT_EQ(floor(fixed16_16(-2.5)), fixed16_16(-3));
+		EXPECT_EQ(floor(fixed16_16(2.5)), fixed16_16(2));
+		EXPECT_EQ(ceil(fixed16_16(-2.5)), fixed16_16(-2));
+		EXPECT_EQ(ceil(fixed16_16(2.25)), fixed16_16(3));
+		EXPECT_EQ(ceil(fixed16_16(2)), fixed16_16(2));
+		EXPECT_EQ(ceil(fixed16_16(-3.75)), fixed16_16(-3));
+		EXPECT_EQ(ceil(fixed16_16(-0.25)), fixed16_16(0));
+		EXPECT_EQ(ceil(fixed16_16::from_raw(-1)), fixed16_16(0));
+		EXPECT_EQ(ceil(std::numeric_limits<fixed16_16>::max()), std::numeric_limits<fixed16_16>::lowest());
+
+		// ceil is computed on the raw value, -floor(-x) would saturate -lowest()
+		using sfixed8_0 = fixed<8, 0, int8_t, fixed_overflow::saturate>;
+		EXPECT_EQ(ceil(std::numeric_limits<sfixed8_0>::lowest()).raw(), -128);
+		EXPECT_EQ(ceil(std::numeric_limits<sfixed4_4>::lowest()).raw(), -128);
+		EXPECT_EQ(ceil(std::numeric_limits<sfixed4_4>::max()), std::numeric_limits<sfixed4_4>::max());
+		const double ceilMax = static_cast<double>(std::numeric_limits<sfixed4_4>::max());
+			for (int raw = -128; raw <= 127; ++raw) {
+				const sfixed4_4 x	  = sfixed4_4::from_raw(static_cast<int8_t>(raw));
+				const double expected = std::min(std::ceil(raw / 16.0), ceilMax);
+				ASSERT_EQ(static_cast<double>(ceil(x)), expected) << raw;
+			}
+
+		EXPECT_EQ(sqrt(fixed16_16(16)), fixed16_16(4));
+		EXPECT_EQ(sqrt(fixed16_16(-4)), fixed16_16());
+		#ifdef __SIZEOF_INT128__
+		EXPECT_EQ(sqrt(fixed32_32(2.25)), fixed32_32(1.5));
+		EXPECT_EQ(sqrt(fixed32_32(1e9)).raw(), static_cast<int64_t>(std::llround(std::sqrt(1e9) * 0x1p32)));
+		#endif
+
+		// rounded to the nearest raw value
+			for (int64_t raw = 1; raw <= std::numeric_limits<int32_t>::max(); raw += raw / 7 + 1) {
+				const int64_t expected = std::llround(std::sqrt(static_cast<double>(raw << 16)));
+				ASSERT_EQ(sqrt(fixed16_16::from_raw(static_cast<int32_t>(raw))).raw(), expected);
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_FIXED, VEC_AND_MAT) {
+		static_assert(is_arithmetic_like_v<fixed16_16>);
+		static_assert(is_arithmetic_like_v<float>);
+		static_assert(!is_arithmetic_like_v<std::string>);
+
+		using fvec3 = vec<3, fixed16_16>;
+		using fvec4 = vec<4, fixed16_16>;
+		using fmat4 = mat<4, 4, fixed16_16>;
+
+		const fvec3 a(1, 2, 2);
+		const fvec3 b(fixed16_16(0.5), fixed16_16(-1), 3);
+
+		EXPECT_EQ(a.length(), fixed16_16(3));
+		EXPECT_EQ(a.dot(b), fixed16_16(4.5));
+		EXPECT_EQ(a.cross(b), fvec3(8, fixed16_16(-2), fixed16_16(-2)));
+		EXPECT_EQ(a + b, fvec3(fixed16_16(1.5), 1, 5));
+		EXPECT_EQ(a * fixed16_16(0.5), fvec3(fixed16_16(0.5), 1, 1));
+		EXPECT_EQ(-a, fvec3(-1, -2, -2));
+
+		const fvec3 n = a.normalized();
+		EXPECT_EQ(n, fvec3(fixed16_16::from_raw(21845), fixed16_16::from_raw(43690), fixed16_16::from_raw(43690)));
+
+		// conversions from and to float vectors go through the explicit conversions
+		const fvec3 fromFloat = vec3(0.25f, -4.0f, 1.0f);
+		EXPECT_EQ(fromFloat, fvec3(fixed16_16(0.25), -4, 1));
+		EXPECT_EQ(vec3(fromFloat), vec3(0.25f, -4.0f, 1.0f));
+
+		const fmat4 transform = fmat4::translation(fvec3(1, 2, 3)) * fmat4::scale(fvec3(2, 2, 2));
+		EXPECT_EQ(transform * fvec4(1, 1, 1, 1), fvec4(3, 4, 5, 1));
+		EXPECT_EQ(transform * fmat4::identity(), transform);
+
+		// a float transform converted to fixed gives the float result within the fixed precision
+		const mat4 floatTransform = mat4::translation(vec3(0.1f, 0.2f, 0.3f)) * mat4::scale(vec3(1.7f, 1.7f, 1.7f));
+		const fmat4 fixedTransform(floatTransform);
+		const fvec4 fixedRes	  = fixedTransform * fvec4(fixed16_16(0.3), fixed16_16(-2.2), fixed16_16(5.1), 1);
+		const vec4 floatRes		  = floatTransform * vec4(0.3f, -2.2f, 5.1f, 1.0f);
+			for (size_t i = 0; i != 4; ++i) { EXPECT_NEAR(static_cast<float>(fixedRes[i]), floatRes[i], 1e-4f); }
+	}
+
+	TEST(ARITHMETIC_TESTS_FIXED, MAT_INVERSE_AND_PROJECTIONS) {
+		using fvec3 = vec<3, fixed16_16>;
+		using fmat4 = mat<4, 4, fixed16_16>;
+
+		const auto expectNear = [](const fmat4& fixedRes, const mat4& floatRes, float eps) {
+				for (size_t x = 0; x != 4; ++x) {
+						for (size_t y = 0; y != 4; ++y) {
+							EXPECT_NEAR(static_cast<float>(fixedRes[x][y]), floatRes[x][y], eps) << x << " " << y;
+						}
+				}
+		};
+
+		// translations and power of two scales invert exactly
+		const fmat4 transform = fmat4::translation(fvec3(1, 2, 3)) * fmat4::scale(fvec3(2, 4, fixed16_16(0.5)));
+		const fmat4 inverse	  = fmat4::scale(fvec3(fixed16_16(0.5), fixed16_16(0.25), 2)) * fmat4::translation(fvec3(-1, -2, -3));
+		EXPECT_EQ(transform.inverted(), inverse);
+		EXPECT_EQ(transform.inverted_affine(), inverse);
+		EXPECT_EQ(transform.inverted() * transform, fmat4::identity());
+		EXPECT_TRUE(fmat4::scale(fvec3(1, 0, 1)).inverted().is_zero());
+		EXPECT_TRUE(fmat4::scale(fvec3(1, 0, 1)).inverted_affine().is_zero());
+
+		const mat4 floatTransform =
+		  mat4::translation(vec3(0.5f, -1.f, 2.f)) * mat4::rot_y(0.4f) * mat4::scale(vec3(1.5f, 2.f, 0.75f));
+		expectNear(fmat4(floatTransform).inverted(), floatTransform.inverted(), 1e-3f);
+		expectNear(fmat4(floatTransform).inverted_affine(), floatTransform.inverted_affine(), 1e-3f);
+
+		// the projections give the float matrices within the fixed precision. The depth terms multiply the reciprocal of
+		// far - near, truncated to 2^-16, by far and near, so their error grows with far
+		const fmat4 perspective = fmat4::perspective(fixed16_16(M_PI * 0.5), 1, 1, 100);
+		expectNear(perspective, mat4::perspective(static_cast<float>(M_PI) * 0.5f, 1.f, 1.f, 100.f), 100.f * 0x1p-15f);
+		const fmat4 narrow = fmat4::perspective(fixed16_16(0.6), fixed16_16(1.5), fixed16_16(0.5), 50, false, true, false);
+		expectNear(narrow, mat4::perspective(0.6f, 1.5f, 0.5f, 50.f, false, true, false), 50.f * 0x1p-15f);
+
+		const fmat4 ortographic = fmat4::ortographic(-4, 4, fixed16_16(-2.5), fixed16_16(2.5), 1, 10);
+		expectNear(ortographic, mat4::ortographic(-4.f, 4.f, -2.5f, 2.5f, 1.f, 10.f), 10.f * 0x1p-15f);
+
+		// reflecting against an axis only flips a sign
+		EXPECT_EQ(fvec3(1, -1, 0).reflected(fvec3(0, 1, 0)), fvec3(1, 1, 0));
+		fvec3 reflected(2, -3, fixed16_16(0.5));
+		reflected.reflect(fvec3(0, 0, 1));
+		EXPECT_EQ(reflected, fvec3(2, -3, fixed16_16(-0.5)));
+	}
+
+	TEST(ARITHMETIC_TESTS_FIXED, CONSTEXPR) {
+		static_assert(fixed16_16(1.5) * fixed16_16(2) == fixed16_16(3));
+		static_assert((fixed16_16(7) / 2).raw() == 0x38000);
+		static_assert(std::numeric_limits<fixed8_8>::max().raw() == 0x7FFF);
+		static_assert(std::numeric_limits<fixed16_16>::digits == 31);
+		static_assert(!std::numeric_limits<sfixed4_4>::is_modulo);
+		static_assert(sizeof(fixed24_8) == sizeof(int32_t));
+		#if _MSTD_HAS_CXX20
+		static_assert(sqrt(fixed16_16(2.25)) == fixed16_16(1.5));
+		static_assert(vec<3, fixed16_16>(1, 2, 2).length() == fixed16_16(3));
+		#endif
+	}
+} // namespace mstd::test
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <random>
+
+namespace mstd::test {
+	TEST(ARITHMETIC_TESTS_GEOMETRY, AABB) {
+		aabb3 box;
+		EXPECT_TRUE(box.empty());
+		EXPECT_FLOAT_EQ(box.volume(), 0.f);
+
+		box.expand(vec3(1.f, 2.f, 3.f)).expand(vec3(-1.f, 0.f, 5.f));
+		EXPECT_FALSE(box.empty());
+		EXPECT_EQ(box, aabb3(vec3(-1.f, 0.f, 3.f), vec3(1.f, 2.f, 5.f)));
+		EXPECT_EQ(box.center(), vec3(0.f, 1.f, 4.f));
+		EXPECT_EQ(box.size(), vec3(2.f, 2.f, 2.f));
+		EXPECT_EQ(box.extents(), vec3(1.f, 1.f, 1.f));
+		EXPECT_FLOAT_EQ(box.volume(), 8.f);
+		EXPECT_FLOAT_EQ(box.surface_area(), 24.f);
+
+		const vec3 points[] = { vec3(1.f, 2.f, 3.f), vec3(-1.f, 0.f, 5.f) };
+		EXPECT_EQ(aabb3::from_points(points, 2), box);
+		EXPECT_EQ(aabb3::from_center(vec3(0.f, 1.f, 4.f), vec3(1.f, 1.f, 1.f)), box);
+
+		EXPECT_TRUE(box.contains(vec3(0.f, 1.f, 4.f)));
+		EXPECT_TRUE(box.contains(vec3(1.f, 2.f, 5.f)));
+		EXPECT_FALSE(box.contains(vec3(1.5f, 1.f, 4.f)));
+		EXPECT_TRUE(box.contains(aabb3(vec3(0.f, 0.f, 3.f), vec3(1.f, 1.f, 4.f))));
+		EXPECT_FALSE(box.contains(aabb3(vec3(0.f, 0.f, 3.f), vec3(2.f, 1.f, 4.f))));
+		EXPECT_TRUE(box.contains(aabb3()));
+
+		const aabb3 other(vec3(1.f, 1.f, 1.f), vec3(3.f, 3.f, 3.f));
+		EXPECT_TRUE(box.intersects(other));
+		EXPECT_EQ(box.intersection(other), aabb3(vec3(1.f, 1.f, 3.f), vec3(1.f, 2.f, 3.f)));
+		EXPECT_FALSE(box.intersects(aabb3(vec3(2.f, 0.f, 0.f), vec3(3.f, 1.f, 1.f))));
+		EXPECT_TRUE(box.intersection(aabb3(vec3(2.f, 0.f, 0.f), vec3(3.f, 1.f, 1.f))).empty());
+		EXPECT_EQ(box.expanded(other), aabb3(vec3(-1.f, 0.f, 1.f), vec3(3.f, 3.f, 5.f)));
+
+		EXPECT_EQ(box.closest_point(vec3(5.f, 1.f, 0.f)), vec3(1.f, 1.f, 3.f));
+		EXPECT_FLOAT_EQ(box.distance_squared(vec3(5.f, 1.f, 0.f)), 25.f);
+		EXPECT_FLOAT_EQ(box.distance_squared(vec3(0.f, 1.f, 4.f)), 0.f);
+
+		// the transformed box bounds every transformed corner and touches the extremes
+		const mat4 m = mat4::translation({ 1.f, 2.f, 3.f }) * mat4::rot_z(0.5f) * mat4::scale({ 2.f, 1.f, 3.f });
+		const aabb3 transformed = box.transformed(m);
+		aabb3 corners;
+			for (size_t i = 0; i != 8; ++i) {
+				const vec3 corner((i & 1) ? box.max[0] : box.min[0], (i & 2) ? box.max[1] : box.min[1],
+				  (i & 4) ? box.max[2] : box.min[2]);
+				corners.expand(vec3(m * vec4(corner, 1.f)));
+			}
+			for (size_t i = 0; i != 3; ++i) {
+				EXPECT_NEAR(transformed.min[i], corners.min[i], 1e-5f);
+				EXPECT_NEAR(transformed.max[i], corners.max[i], 1e-5f);
+			}
+		EXPECT_TRUE(aabb3().transformed(m).empty());
+
+		const iaabb2 grid(ivec2(0, 0), ivec2(4, 2));
+		EXPECT_EQ(grid.volume(), 8);
+		EXPECT_TRUE(grid.contains(ivec2(4, 2)));
+	}
+
+	TEST(ARITHMETIC_TESTS_GEOMETRY, SPHERE) {
+		const sphere<> s(vec3(1.f, 0.f, 0.f), 2.f);
+		EXPECT_TRUE(s.contains(vec3(3.f, 0.f, 0.f)));
+		EXPECT_FALSE(s.contains(vec3(3.f, 0.1f, 0.f)));
+		EXPECT_TRUE(s.intersects(sphere<>(vec3(5.f, 0.f, 0.f), 2.f)));
+		EXPECT_FALSE(s.intersects(sphere<>(vec3(5.f, 0.f, 0.f), 1.9f)));
+		EXPECT_TRUE(s.intersects(aabb3(vec3(3.f, -1.f, -1.f), vec3(4.f, 1.f, 1.f))));
+		// the box corner is sqrt(3) * 1.5 > 2 away from the center
+		EXPECT_FALSE(s.intersects(aabb3(vec3(2.5f, 1.5f, 1.5f), vec3(4.f, 4.f, 4.f))));
+		EXPECT_EQ(s.bounds(), aabb3(vec3(-1.f, -2.f, -2.f), vec3(3.f, 2.f, 2.f)));
+	}
+
+	TEST(ARITHMETIC_TESTS_GEOMETRY, PLANE) {
+		const plane<> p(vec3(0.f, 2.f, 0.f), vec3(0.f, 1.f, 0.f));
+		EXPECT_FLOAT_EQ(p.signed_distance(vec3(5.f, 3.f, 1.f)), 4.f);
+
+		const plane<> n = p.normalized();
+		EXPECT_EQ(n.normal, vec3(0.f, 1.f, 0.f));
+		EXPECT_FLOAT_EQ(n.distance, -1.f);
+		EXPECT_FLOAT_EQ(n.signed_distance(vec3(5.f, 3.f, 1.f)), 2.f);
+		EXPECT_FLOAT_EQ(n.signed_distance(vec3(5.f, -3.f, 1.f)), -4.f);
+		EXPECT_EQ(n.project(vec3(5.f, 3.f, 1.f)), vec3(5.f, 1.f, 1.f));
+
+		const plane<> fromPoints = plane<>::from_points(vec3(0.f, 1.f, 0.f), vec3(0.f, 1.f, 1.f), vec3(1.f, 1.f, 0.f));
+		EXPECT_EQ(fromPoints, n);
+	}
+
+	TEST(ARITHMETIC_TESTS_GEOMETRY, RAY) {
+		const aabb3 box(vec3(-1.f, -1.f, -1.f), vec3(1.f, 1.f, 1.f));
+		float tNear = 0.f;
+		float tFar	= 0.f;
+
+		const ray<> hit(vec3(-5.f, 0.f, 0.f), vec3(1.f, 0.f, 0.f));
+		ASSERT_TRUE(hit.intersects(box, tNear, tFar));
+		EXPECT_FLOAT_EQ(tNear, 4.f);
+		EXPECT_FLOAT_EQ(tFar, 6.f);
+		EXPECT_EQ(hit.at(tNear), vec3(-1.f, 0.f, 0.f));
+
+		// starting inside, pointing away and parallel to a slab outside of it
+		const ray<> inside(vec3(0.f, 0.f, 0.f), vec3(0.f, 2.f, 0.f));
+		ASSERT_TRUE(inside.intersects(box, tNear, tFar));
+		EXPECT_FLOAT_EQ(tNear, 0.f);
+		EXPECT_FLOAT_EQ(tFar, 0.5f);
+		EXPECT_FALSE(ray<>(vec3(-5.f, 0.f, 0.f), vec3(-1.f, 0.f, 0.f)).intersects(box));
+		EXPECT_FALSE(ray<>(vec3(-5.f, 2.f, 0.f), vec3(1.f, 0.f, 0.f)).intersects(box));
+		EXPECT_TRUE(ray<>(vec3(-5.f, -5.f, 0.f), vec3(1.f, 1.f, 0.f)).intersects(box));
+
+		float t = 0.f;
+		ASSERT_TRUE(hit.intersects(sphere<>(vec3(2.f, 0.f, 0.f), 1.f), t));
+		EXPECT_FLOAT_EQ(t, 6.f);
+		ASSERT_TRUE(inside.intersects(sphere<>(vec3(0.f, 0.f, 0.f), 1.f), t));
+		EXPECT_FLOAT_EQ(t, 0.5f);
+		EXPECT_FALSE(hit.intersects(sphere<>(vec3(-8.f, 0.f, 0.f), 1.f), t));
+		EXPECT_FALSE(hit.intersects(sphere<>(vec3(2.f, 3.f, 0.f), 1.f), t));
+
+		ASSERT_TRUE(hit.intersects(plane<>(vec3(1.f, 0.f, 0.f), -3.f), t));
+		EXPECT_FLOAT_EQ(t, 8.f);
+		EXPECT_FALSE(hit.intersects(plane<>(vec3(1.f, 0.f, 0.f), 6.f), t));
+		EXPECT_FALSE(hit.intersects(plane<>(vec3(0.f, 1.f, 0.f), 0.f), t));
+	}
+
+	TEST(ARITHMETIC_TESTS_GEOMETRY, FRUSTUM) {
+		const float clips[][2] = {
+			{ -1.f, 1.f },
+			{ 0.f, 1.f },
+			{ 1.f, 0.f }
+		};
+			for (const auto& clip : clips) {
+				// camera at the origin looking down -z, 90 degree horizontal fov and square aspect, near 1 and far 100
+				const mat4 proj = mat4::perspective(static_cast<float>(M_PI) * 0.5f, 1.f, 1.f, 100.f, true, true, true, 1.f, 1.f,
+				  clip[0], clip[1]);
+				const frustum<> f(proj, clip[0], clip[1]);
+
+				EXPECT_NEAR(f[frustum_plane::near].signed_distance(vec3(0.f, 0.f, -1.f)), 0.f, 1e-4f);
+				EXPECT_NEAR(f[frustum_plane::far].signed_distance(vec3(0.f, 0.f, -100.f)), 0.f, 1e-3f);
+				EXPECT_NEAR(f[frustum_plane::left].normal.length(), 1.f, 1e-6f);
+				EXPECT_NEAR(f[frustum_plane::left].signed_distance(vec3(-5.f, 0.f, -5.f)), 0.f, 1e-4f);
+				EXPECT_NEAR(f[frustum_plane::top].signed_distance(vec3(0.f, 5.f, -5.f)), 0.f, 1e-4f);
+
+				EXPECT_TRUE(f.contains(vec3(0.f, 0.f, -5.f)));
+				EXPECT_TRUE(f.contains(vec3(4.f, -4.f, -5.f)));
+				EXPECT_FALSE(f.contains(vec3(6.f, 0.f, -5.f)));
+				EXPECT_FALSE(f.contains(vec3(0.f, 0.f, 5.f)));
+				EXPECT_FALSE(f.contains(vec3(0.f, 0.f, -0.5f)));
+				EXPECT_FALSE(f.contains(vec3(0.f, 0.f, -101.f)));
+
+				EXPECT_TRUE(f.intersects(sphere<>(vec3(6.f, 0.f, -5.f), 1.f)));
+				EXPECT_FALSE(f.intersects(sphere<>(vec3(8.f, 0.f, -5.f), 1.f)));
+				EXPECT_FALSE(f.intersects(sphere<>(vec3(0.f, 0.f, 3.f), 1.f)));
+
+				EXPECT_TRUE(f.intersects(aabb3(vec3(-1.f, -1.f, -6.f), vec3(1.f, 1.f, -4.f))));
+				EXPECT_TRUE(f.intersects(aabb3(vec3(4.f, -1.f, -6.f), vec3(7.f, 1.f, -4.f))));
+				EXPECT_TRUE(f.intersects(aabb3(vec3(-1.f, -1.f, -200.f), vec3(1.f, 1.f, 200.f))));
+				EXPECT_FALSE(f.intersects(aabb3(vec3(7.f, -1.f, -6.f), vec3(8.f, 1.f, -4.f))));
+				EXPECT_FALSE(f.intersects(aabb3(vec3(-1.f, -1.f, 1.f), vec3(1.f, 1.f, 2.f))));
+				EXPECT_FALSE(f.intersects(aabb3(vec3(-1.f, -1.f, -300.f), vec3(1.f, 1.f, -200.f))));
+			}
+
+		// moving the camera moves the frustum
+		const mat4 proj = mat4::perspective(static_cast<float>(M_PI) * 0.5f, 1.f, 1.f, 100.f, true, true, true, 1.f, 1.f);
+		const frustum<> moved(proj * mat4::translation({ -100.f, 0.f, 0.f }));
+		EXPECT_TRUE(moved.contains(vec3(100.f, 0.f, -5.f)));
+		EXPECT_FALSE(moved.contains(vec3(0.f, 0.f, -5.f)));
+	}
+
+	TEST(ARITHMETIC_TESTS_GEOMETRY, AABB_SOA) {
+		aabb_soa<3, float> boxes = { aabb3(vec3(0.f, 0.f, 0.f), vec3(1.f, 1.f, 1.f)),
+			aabb3(vec3(-1.f, -2.f, -3.f), vec3(1.f, 2.f, 3.f)) };
+		ASSERT_EQ(boxes.size(), 2u);
+		ASSERT_FALSE(boxes.empty());
+		EXPECT_EQ(boxes.get(1), aabb3(vec3(-1.f, -2.f, -3.f), vec3(1.f, 2.f, 3.f)));
+		EXPECT_FLOAT_EQ(boxes.mins().lane(2)[1], -3.f);
+		EXPECT_FLOAT_EQ(boxes.maxs().lane(1)[1], 2.f);
+
+		boxes.set(0, aabb3(vec3(5.f, 5.f, 5.f), vec3(6.f, 6.f, 6.f)));
+		EXPECT_EQ(boxes.get(0), aabb3(vec3(5.f, 5.f, 5.f), vec3(6.f, 6.f, 6.f)));
+		boxes.pop_back();
+		ASSERT_EQ(boxes.size(), 1u);
+		boxes.clear();
+		ASSERT_TRUE(boxes.empty());
+	}
+
+	TEST(ARITHMETIC_TESTS_GEOMETRY, CULL) {
+		const mat4 proj = mat4::perspective(static_cast<float>(M_PI) * 0.5f, 1.f, 1.f, 100.f, true, true, true, 1.f, 1.f);
+		const frustum<> f(proj * mat4::rot_y(0.3f));
+		const frustum<double> fd(dmat4(proj * mat4::rot_y(0.3f)));
+
+		std::mt19937 gen(11);
+		std::uniform_real_distribution<float> pos(-150.f, 150.f);
+		std::uniform_real_distribution<float> size(0.f, 10.f);
+
+		// counts around the SIMD widths and the mask words
+		const size_t counts[] = { 0, 1, 3, 4, 7, 8, 15, 16, 17, 63, 64, 65, 130, 1000 };
+			for (const size_t count : counts) {
+				gen.seed(11);
+				aabb_soa<3, float> boxes;
+				aabb_soa<3, double> dboxes;
+					for (size_t i = 0; i != count; ++i) {
+						const vec3 center(pos(gen), pos(gen), pos(gen));
+						const aabb3 box = aabb3::from_center(center, vec3(size(gen), size(gen), size(gen)));
+						boxes.push_back(box);
+						dboxes.push_back(daabb3(dvec3(box.min), dvec3(box.max)));
+					}
+
+				// set bits past the end must be cleared
+				std::vector<uint64_t> mask((count + 63) / 64, ~uint64_t(0));
+				f.cull(boxes, mask.data());
+				const std::vector<uint64_t> dmask = fd.cull(dboxes);
+				ASSERT_EQ(dmask.size(), mask.size());
+
+				size_t visible = 0;
+					for (size_t i = 0; i != count; ++i) {
+						const bool bit = (mask[i / 64] >> (i % 64)) & 1;
+						EXPECT_EQ(bit, f.intersects(boxes.get(i))) << count << " " << i;
+						EXPECT_EQ((dmask[i / 64] >> (i % 64)) & 1, fd.intersects(dboxes.get(i)) ? 1u : 0u);
+						visible += bit;
+					}
+					if (count % 64 != 0) { EXPECT_EQ(mask.back() >> (count % 64), 0u); }
+					if (count == 1000) {
+						EXPECT_GT(visible, 0u);
+						EXPECT_LT(visible, count);
+					}
+			}
+	}
+} // namespace mstd::test
@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <random>
+
+namespace mstd::test {
+	// correctly rounded reference computed in double, F is the number of stored mantissa bits and MinExp the exponent of
+	// the smallest normal value
+	template<class T, int F, int MinExp>
+	static float reference_round(float value) {
+		const double max = static_cast<double>(static_cast<float>(std::numeric_limits<T>::max()));
+			if (std::isnan(value) || std::isinf(value) || value == 0.f) { return value; }
+
+		int exponent = 0;
+		std::frexp(static_cast<double>(value), &exponent);
+		const double quantum = std::ldexp(1.0, std::max(exponent - 1, MinExp) - F);
+		const double res	 = std::nearbyint(static_cast<double>(value) / quantum) * quantum;
+			if (std::abs(res) > max) { return std::copysign(std::numeric_limits<float>::infinity(), value); }
+		return static_cast<float>(res);
+	}
+
+	// random bit patterns plus every exponent with the mantissas around the rounding points of both formats
+	static std::vector<float> make_float16_test_values() {
+		std::vector<float> res;
+		std::mt19937 gen(7);
+			for (size_t i = 0; i != 20000; ++i) { res.push_back(utils::bit_cast<float>(static_cast<uint32_t>(gen()))); }
+
+		const uint32_t mantissas[] = { 0u, 1u, 0xFFFu, 0x1000u, 0x1001u, 0x2000u, 0x3000u, 0x7FFFu, 0x8000u, 0x8001u,
+			0x10000u, 0x18000u, 0x7FF000u, 0x7FFFFFu };
+			for (uint32_t sign = 0; sign != 2; ++sign) {
+					for (uint32_t exponent = 0; exponent != 256; ++exponent) {
+							for (const uint32_t mantissa : mantissas) {
+								res.push_back(utils::bit_cast<float>((sign << 31) | (exponent << 23) | mantissa));
+							}
+					}
+			}
+		return res;
+	}
+
+	TEST(ARITHMETIC_TESTS_HALF, CONVERSIONS) {
+		EXPECT_EQ(half(1.f).bits(), 0x3C00);
+		EXPECT_EQ(half(-2).bits(), 0xC000);
+		EXPECT_EQ(half(0.5).bits(), 0x3800);
+		EXPECT_EQ(half(65504.f).bits(), 0x7BFF);
+		EXPECT_EQ(half(-0.f).bits(), 0x8000);
+		EXPECT_EQ(static_cast<float>(half(0.1f)), 0.0999755859375f);
+
+		// nearest, ties to even, past max to infinity
+		EXPECT_EQ(half(2049.f).bits(), half(2048.f).bits());
+		EXPECT_EQ(half(2051.f).bits(), half(2052.f).bits());
+		EXPECT_EQ(half(65519.f).bits(), 0x7BFF);
+		EXPECT_EQ(half(65520.f).bits(), 0x7C00);
+		EXPECT_EQ(half(-1e10f).bits(), 0xFC00);
+		EXPECT_EQ(half(std::numeric_limits<float>::infinity()).bits(), 0x7C00);
+		EXPECT_TRUE(std::isnan(static_cast<float>(half(std::nanf("")))));
+
+		// subnormals
+		EXPECT_EQ(half(std::ldexp(1.f, -24)).bits(), 0x0001);
+		EXPECT_EQ(half(std::ldexp(1.f, -25)).bits(), 0x0000);
+		EXPECT_EQ(half(std::ldexp(1.5f, -25)).bits(), 0x0001);
+		EXPECT_EQ(half(std::ldexp(3.f, -25)).bits(), 0x0002);
+		EXPECT_EQ(static_cast<float>(half::from_bits(0x03FF)), std::ldexp(1023.f, -24));
+
+		EXPECT_EQ(bfloat16(1.f).bits(), 0x3F80);
+		EXPECT_EQ(bfloat16(-3.f).bits(), 0xC040);
+		EXPECT_EQ(static_cast<float>(bfloat16(3.14159f)), 3.140625f);
+		EXPECT_EQ(bfloat16(1e38f), bfloat16(1e38));
+		EXPECT_EQ(bfloat16(std::numeric_limits<float>::max()).bits(), 0x7F80);
+		EXPECT_EQ(bfloat16(utils::bit_cast<float>(0x3F808000u)).bits(), 0x3F80);
+		EXPECT_EQ(bfloat16(utils::bit_cast<float>(0x3F818000u)).bits(), 0x3F82);
+		EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(std::nanf("")))));
+		EXPECT_EQ(bfloat16(utils::bit_cast<float>(0x7F800001u)).bits(), 0x7FC0);
+
+		EXPECT_EQ(static_cast<float>(half(bfloat16(0.5f))), 0.5f);
+		EXPECT_EQ(static_cast<int>(half(-7.75f)), -7);
+		EXPECT_EQ(static_cast<double>(bfloat16(0.25)), 0.25);
+	}
+
+	TEST(ARITHMETIC_TESTS_HALF, ROUND_TRIP) {
+			for (uint32_t bits = 0; bits != 0x10000; ++bits) {
+				const float h = static_cast<float>(half::from_bits(static_cast<uint16_t>(bits)));
+				const float b = static_cast<float>(bfloat16::from_bits(static_cast<uint16_t>(bits)));
+					if (std::isnan(h)) { EXPECT_TRUE(std::isnan(static_cast<float>(half(h)))); }
+					else { EXPECT_EQ(half(h).bits(), bits); }
+					if (std::isnan(b)) { EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(b)))); }
+					else { EXPECT_EQ(bfloat16(b).bits(), bits); }
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_HALF, ROUNDING) {
+			for (const float value : make_float16_test_values()) {
+					if (std::isnan(value)) { continue; }
+				EXPECT_EQ(static_cast<float>(half(value)), (reference_round<half, 10, -14>(value))) << value;
+				EXPECT_EQ(static_cast<float>(bfloat16(value)), (reference_round<bfloat16, 7, -126>(value))) << value;
+
+				// the bit level conversions used in constant expressions agree with the instructions
+				const uint32_t bits = utils::bit_cast<uint32_t>(value);
+				EXPECT_EQ(utils::float16_traits<float16_format::binary16>::from_float_bits(bits), half(value).bits());
+				EXPECT_EQ(utils::float16_traits<float16_format::binary16>::to_float_bits(half(value).bits()),
+				  utils::bit_cast<uint32_t>(static_cast<float>(half(value))));
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_HALF, BULK_CONVERT) {
+		const std::vector<float> values = make_float16_test_values();
+		std::vector<half> halves(values.size());
+		std::vector<bfloat16> bfloats(values.size());
+		std::vector<float> back(values.size());
+
+		// every length up to a few SIMD widths, so all the tails are covered
+			for (size_t count = 0; count != 70; ++count) {
+				const size_t offset = count * 3;
+				convert(values.data() + offset, halves.data(), count);
+				convert(values.data() + offset, bfloats.data(), count);
+					for (size_t i = 0; i != count; ++i) {
+						EXPECT_EQ(halves[i].bits(), half(values[offset + i]).bits());
+						EXPECT_EQ(bfloats[i].bits(), bfloat16(values[offset + i]).bits());
+					}
+			}
+
+		convert(values.data(), halves.data(), values.size());
+		convert(halves.data(), back.data(), values.size());
+			for (size_t i = 0; i != values.size(); ++i) {
+				ASSERT_EQ(halves[i].bits(), half(values[i]).bits()) << i;
+				ASSERT_EQ(utils::bit_cast<uint32_t>(back[i]), utils::bit_cast<uint32_t>(static_cast<float>(halves[i]))) << i;
+			}
+
+		convert(values.data(), bfloats.data(), values.size());
+		convert(bfloats.data(), back.data(), values.size());
+			for (size_t i = 0; i != values.size(); ++i) {
+				ASSERT_EQ(bfloats[i].bits(), bfloat16(values[i]).bits()) << i;
+				ASSERT_EQ(utils::bit_cast<uint32_t>(back[i]), utils::bit_cast<uint32_t>(static_cast<float>(bfloats[i]))) << i;
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_HALF, ARITHMETIC) {
+		const half a(2.5f);
+		const half b(-1.25f);
+
+		EXPECT_EQ(a + b, half(1.25f));
+		EXPECT_EQ(a - b, half(3.75f));
+		EXPECT_EQ(a * b, half(-3.125f));
+		EXPECT_EQ(a / b, half(-2.f));
+		EXPECT_EQ(-a, half(-2.5f));
+		EXPECT_TRUE(b < a);
+		EXPECT_TRUE(a >= half(2.5f));
+		EXPECT_TRUE(a != b);
+		EXPECT_EQ(half(0.f), -half(0.f));
+
+		// every result is rounded once, 2048 + 1 is not representable
+		EXPECT_EQ(half(2048.f) + half(1.f), half(2048.f));
+		EXPECT_EQ(half(1.f) / half(3.f), half(1.f / 3.f));
+		EXPECT_EQ(half(60000.f) * half(2.f), std::numeric_limits<half>::infinity());
+
+		// mixed with float the result is float
+		EXPECT_EQ(a * 2.f, 5.f);
+		EXPECT_EQ(bfloat16(1.5f) + bfloat16(0.25f), bfloat16(1.75f));
+
+		EXPECT_EQ(abs(b), half(1.25f));
+		EXPECT_EQ(sqrt(half(2.25f)), half(1.5f));
+		EXPECT_EQ(sqrt(bfloat16(16.f)), bfloat16(4.f));
+
+		EXPECT_EQ(std::numeric_limits<half>::max().bits(), 0x7BFF);
+		EXPECT_EQ(std::numeric_limits<half>::lowest().bits(), 0xFBFF);
+		EXPECT_EQ(static_cast<float>(std::numeric_limits<half>::min()), std::ldexp(1.f, -14));
+		EXPECT_EQ(static_cast<float>(std::numeric_limits<half>::epsilon()), std::ldexp(1.f, -10));
+		EXPECT_EQ(static_cast<float>(std::numeric_limits<half>::denorm_min()), std::ldexp(1.f, -24));
+		EXPECT_EQ(static_cast<float>(std::numeric_limits<half>::round_error()), 0.5f);
+		EXPECT_TRUE(std::isnan(static_cast<float>(std::numeric_limits<half>::quiet_NaN())));
+		EXPECT_TRUE(std::isnan(static_cast<float>(std::numeric_limits<half>::signaling_NaN())));
+		EXPECT_EQ(std::numeric_limits<bfloat16>::max().bits(), 0x7F7F);
+		EXPECT_EQ(static_cast<float>(std::numeric_limits<bfloat16>::min()), std::numeric_limits<float>::min());
+		EXPECT_EQ(static_cast<float>(std::numeric_limits<bfloat16>::epsilon()), std::ldexp(1.f, -7));
+		EXPECT_EQ(std::numeric_limits<bfloat16>::infinity().bits(), 0x7F80);
+		EXPECT_EQ(std::numeric_limits<half>::digits, 11);
+		EXPECT_EQ(std::numeric_limits<half>::max_exponent, 16);
+		EXPECT_EQ(std::numeric_limits<bfloat16>::min_exponent, std::numeric_limits<float>::min_exponent);
+	}
+
+	TEST(ARITHMETIC_TESTS_HALF, VEC) {
+		const vec<3, half> a(1.f, 2.f, 2.f);
+		const vec<3, half> b(0.5f, -1.f, 4.f);
+
+		EXPECT_EQ(sizeof(vec<3, half>), 3 * sizeof(half));
+		EXPECT_EQ(a + b, (vec<3, half>(1.5f, 1.f, 6.f)));
+		EXPECT_EQ(a * half(2.f), (vec<3, half>(2.f, 4.f, 4.f)));
+		EXPECT_EQ(-a, (vec<3, half>(-1.f, -2.f, -2.f)));
+		EXPECT_EQ(a.dot(b), half(6.5f));
+		EXPECT_EQ(a.length(), half(3.f));
+		const vec3 normalized = vec3(a.normalized());
+		EXPECT_NEAR(normalized.x(), 1.f / 3.f, 1e-3f);
+		EXPECT_NEAR(normalized.y(), 2.f / 3.f, 1e-3f);
+		EXPECT_NEAR(normalized.z(), 2.f / 3.f, 1e-3f);
+
+		// the dot product is summed in float, 2048 + 1 + 1 would stay at 2048 in half
+		EXPECT_EQ((vec<3, half>(2048.f, 1.f, 1.f).dot(vec<3, half>(1.f, 1.f, 1.f))), half(2050.f));
+
+		EXPECT_EQ(vec3(a), vec3(1.f, 2.f, 2.f));
+		EXPECT_EQ((vec<3, bfloat16>(vec3(1.f, 2.f, 2.f))), (vec<3, bfloat16>(a)));
+
+		const mat<4, 4, half> m = mat<4, 4, half>::translation(vec<3, half>(1.f, 2.f, 3.f));
+		EXPECT_EQ((m * vec<4, half>(1.f, 1.f, 1.f, 1.f)), (vec<4, half>(2.f, 3.f, 4.f, 1.f)));
+	}
+
+	TEST(ARITHMETIC_TESTS_HALF, TRANSFORM) {
+		const mat4 m = mat4::translation({ 1.f, -2.f, 3.f }) * mat4::rot_y(0.7f) * mat4::scale({ 2.f, 3.f, 0.5f });
+
+		// more than one conversion block and a tail
+		std::mt19937 gen(3);
+		std::uniform_real_distribution<float> dist(-10.f, 10.f);
+		std::vector<vec<3, half> > points(1000);
+		std::vector<vec<4, bfloat16> > vectors(1000);
+			for (size_t i = 0; i != points.size(); ++i) {
+				points[i]  = vec<3, half>(dist(gen), dist(gen), dist(gen));
+				vectors[i] = vec<4, bfloat16>(dist(gen), dist(gen), dist(gen), dist(gen));
+			}
+
+		std::vector<vec<3, half> > transformedPoints(points.size());
+		std::vector<vec<3, half> > transformedNormals(points.size());
+		std::vector<vec<4, bfloat16> > transformedVectors(vectors.size());
+		transform_points(m, points.data(), transformedPoints.data(), points.size());
+		transform_normals(m, points.data(), transformedNormals.data(), points.size());
+		transform_vectors(m, vectors.data(), transformedVectors.data(), vectors.size());
+
+		std::vector<vec3> floatPoints(points.size());
+		std::vector<vec3> floatNormals(points.size());
+		std::vector<vec4> floatVectors(vectors.size());
+		// the float transform of the widened values, rounded once
+			for (size_t i = 0; i != points.size(); ++i) {
+				floatPoints[i]	= vec3(points[i]);
+				floatVectors[i] = vec4(vectors[i]);
+			}
+		transform_normals(m, floatPoints.data(), floatNormals.data(), floatPoints.size());
+		transform_points(m, floatPoints.data(), floatPoints.data(), floatPoints.size());
+		transform_vectors(m, floatVectors.data(), floatVectors.data(), floatVectors.size());
+
+			for (size_t i = 0; i != points.size(); ++i) {
+				EXPECT_EQ(transformedPoints[i], (vec<3, half>(floatPoints[i]))) << i;
+				EXPECT_EQ(transformedNormals[i], (vec<3, half>(floatNormals[i]))) << i;
+				EXPECT_EQ(transformedVectors[i], (vec<4, bfloat16>(floatVectors[i]))) << i;
+			}
+
+		// in place, split across threads
+		std::vector<vec<3, half> > inPlace(points);
+		transform_points(m, inPlace.data(), inPlace.data(), inPlace.size(), 4);
+		EXPECT_EQ(inPlace, transformedPoints);
+	}
+
+	TEST(ARITHMETIC_TESTS_HALF, CONSTEXPR) {
+		static_assert(sizeof(half) == 2 && sizeof(bfloat16) == 2);
+		static_assert((-half::from_bits(0x3C00)).bits() == 0xBC00);
+		static_assert(std::numeric_limits<half>::max().bits() == 0x7BFF);
+		static_assert(std::numeric_limits<bfloat16>::epsilon().bits() == 0x3C00);
+		static_assert(utils::float16_traits<float16_format::binary16>::from_float_bits(0x3F800000u) == 0x3C00);
+		static_assert(utils::float16_traits<float16_format::bfloat16>::from_float_bits(0x40490FDBu) == 0x4049);
+		#if _MSTD_HAS_CXX20
+		static_assert(half(1.5f) * half(2.f) == half(3.f));
+		static_assert(static_cast<float>(half(0.1f)) == 0.0999755859375f);
+		static_assert(bfloat16(-3.f).bits() == 0xC040);
+		static_assert(vec<3, half>(1.f, 2.f, 2.f).length() == half(3.f));
+		#endif
+	}
+} // namespace mstd::test
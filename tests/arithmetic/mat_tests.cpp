@@ -178,4 +178,249 @@ namespace mstd::test {
 		EXPECT_FALSE(m1 == m3);
 		EXPECT_TRUE(m1 != m3);
 	}
+
+	template<size_t C, size_t R, size_t OC, class T>
+	static void check_mat_kernels() {
+		mat<C, R, T> a;
+		mat<OC, C, T> b;
+		vec<C, T> v;
+			for (size_t x = 0; x != C; ++x) {
+					for (size_t y = 0; y != R; ++y) { a[x][y] = static_cast<T>((x * 5 + y * 3) % 7) - 3; }
+				v[x] = static_cast<T>(x % 3) + 1;
+			}
+			for (size_t x = 0; x != OC; ++x) {
+					for (size_t y = 0; y != C; ++y) { b[x][y] = static_cast<T>((x * 2 + y * 7) % 5) - 2; }
+			}
+
+		const auto res	  = a * b;
+		const auto resVec = a * v;
+			for (size_t y = 0; y != R; ++y) {
+					for (size_t x = 0; x != OC; ++x) {
+						T expected = static_cast<T>(0);
+							for (size_t i = 0; i != C; ++i) { expected += a[i][y] * b[x][i]; }
+						ASSERT_EQ(res[x][y], expected);
+					}
+
+				T expected = static_cast<T>(0);
+					for (size_t i = 0; i != C; ++i) { expected += a[i][y] * v[i]; }
+				ASSERT_EQ(resVec[y], expected);
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT, KERNELS) {
+		check_mat_kernels<4, 4, 4, float>();
+		check_mat_kernels<4, 4, 3, float>();
+		check_mat_kernels<4, 4, 4, double>();
+		check_mat_kernels<4, 4, 2, double>();
+		check_mat_kernels<3, 3, 3, float>();
+		check_mat_kernels<6, 5, 9, double>();
+		check_mat_kernels<8, 8, 8, int>();
+	}
+
+		#if _MSTD_HAS_CXX20
+	TEST(ARITHMETIC_TESTS_MAT, CONSTEXPR_KERNELS) {
+		constexpr mat<4, 4, float> m =
+		  mat<4, 4, float>::scale({ 2.0f, 2.0f, 2.0f }) * mat<4, 4, float>::translation({ 1.0f, 2.0f, 3.0f });
+		static_assert(m[3u][0u] == 2.0f && m[3u][2u] == 6.0f && m[3u][3u] == 1.0f);
+
+		constexpr vec<4, double> v = mat<4, 4, double>::scale(3.0) * vec<4, double>(1.0, 2.0, 3.0, 4.0);
+		static_assert(v[0u] == 3.0 && v[3u] == 12.0);
+	}
+		#endif
+
+	// 6x6 of small integers, past the closed form determinant and inverse sizes so they go through the LU
+	class MatLuTest : public ::testing::Test {
+	protected:
+		mat<6, 6, int> values;
+
+		void SetUp() override {
+				for (size_t x = 0; x != 6; ++x) {
+						for (size_t y = 0; y != 6; ++y) { values[x][y] = static_cast<int>((x * 7 + y * y * 3 + x * y) % 11) - 5; }
+				}
+		}
+	};
+
+	TEST_F(MatLuTest, LU_DECOMPOSITION) {
+		const mat<6, 6, double> m = values;
+		const auto lu			  = m.lu();
+		ASSERT_FALSE(lu.is_singular());
+
+		const auto pm = lu.permutation() * m;
+		const auto lm = lu.lower() * lu.upper();
+			for (size_t x = 0; x != 6; ++x) {
+					for (size_t y = 0; y != 6; ++y) {
+						EXPECT_NEAR(pm[x][y], lm[x][y], 1e-12);
+							if (y < x) { EXPECT_EQ(lu.lower()[x][y], 0.0); }
+							if (y > x) { EXPECT_EQ(lu.upper()[x][y], 0.0); }
+					}
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT, DETERMINANT_5x5) {
+		// lower triangular with diagonal 1..5, first two columns swapped
+		mat<5, 5, int> m;
+			for (size_t x = 0; x != 5; ++x) {
+					for (size_t y = x; y != 5; ++y) { m[x][y] = x == y ? static_cast<int>(x + 1) : static_cast<int>(x + y); }
+			}
+		mat<5, 5, int> swapped = m;
+		swapped[0u]			   = m[1u];
+		swapped[1u]			   = m[0u];
+
+		EXPECT_EQ(m.determinant(), 120);
+		EXPECT_EQ(swapped.determinant(), -120);
+		EXPECT_DOUBLE_EQ((mat<5, 5, double>(swapped).determinant()), -120.0);
+	}
+
+	TEST_F(MatLuTest, DETERMINANT_6x6) {
+		// fraction-free integer elimination and the floating point LU have to agree
+		const int det = values.determinant();
+		ASSERT_NE(det, 0);
+		EXPECT_NEAR((mat<6, 6, double>(values).determinant()), static_cast<double>(det), 1e-8);
+	}
+
+	TEST_F(MatLuTest, SOLVE_6x6) {
+		const mat<6, 6, double> m = values;
+		const vec<6, double> b(1.0, -2.0, 3.0, 0.5, 4.0, -1.0);
+
+		const auto x = m.solve(b);
+		const auto r = m * x;
+			for (size_t i = 0; i != 6; ++i) { EXPECT_NEAR(r[i], b[i], 1e-10); }
+
+		mat<2, 6, double> bs;
+		bs[0u]		  = b;
+		bs[1u]		  = b * 2.0;
+		const auto xs = m.solve(bs);
+			for (size_t i = 0; i != 6; ++i) {
+				EXPECT_NEAR(xs[0u][i], x[i], 1e-10);
+				EXPECT_NEAR(xs[1u][i], x[i] * 2.0, 1e-10);
+			}
+	}
+
+	TEST_F(MatLuTest, INVERT_6x6) {
+		const mat<6, 6, float> m = values;
+		const auto inv			 = m.inverted();
+		const auto res			 = m * inv;
+			for (size_t x = 0; x != 6; ++x) {
+					for (size_t y = 0; y != 6; ++y) { EXPECT_NEAR(res[x][y], x == y ? 1.0f : 0.0f, 1e-4); }
+			}
+
+		auto copy = m;
+		copy.invert();
+		EXPECT_TRUE(copy == inv);
+	}
+
+	TEST_F(MatLuTest, SINGULAR_6x6) {
+		mat<6, 6, double> m = values;
+		m[4u]				= vec<6, double>::zero();
+
+		EXPECT_TRUE(m.lu().is_singular());
+		EXPECT_EQ(m.determinant(), 0.0);
+		EXPECT_TRUE(m.inverted().is_zero());
+		EXPECT_TRUE(m.solve(vec<6, double>(1.0, 1.0, 1.0, 1.0, 1.0, 1.0)).is_zero());
+	}
+
+	template<size_t N, class T>
+	static void expect_mat_near(const mat<N, N, T>& value, const mat<N, N, T>& expected, T eps) {
+			for (size_t x = 0; x != N; ++x) {
+					for (size_t y = 0; y != N; ++y) { EXPECT_NEAR(value[x][y], expected[x][y], eps); }
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT, ROT_AXIS) {
+		expect_mat_near(mat4::rot({ 1.f, 0.f, 0.f }, 0.6f), mat4::rot_x(0.6f), 1e-6f);
+		expect_mat_near(mat4::rot({ 0.f, 2.f, 0.f }, 0.6f), mat4::rot_y(0.6f), 1e-6f);
+		expect_mat_near(mat4::rot({ 0.f, 0.f, 1.f }, 0.6f), mat4::rot_z(0.6f), 1e-6f);
+
+		const mat4 m = mat4::rot({ 1.f, -2.f, 3.f }, 1.3f);
+		expect_mat_near(m * m.transposed(), mat4::identity(), 1e-6f);
+		expect_mat_near(m, mat4::rot(fquat::rotation(vec3(1.f, -2.f, 3.f).normalized(), 1.3f)), 1e-6f);
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT, INVERT_AFFINE) {
+		const dmat4 m = dmat4::translation({ 1.0, -2.0, 3.0 }) * dmat4::rot_y(0.7) * dmat4::scale({ 2.0, 3.0, 0.5 });
+		EXPECT_TRUE(m.is_affine());
+
+		const dmat4 inv = m.inverted_affine();
+		expect_mat_near(m * inv, dmat4::identity(), 1e-12);
+		expect_mat_near(inv, m.inverted(transform_type::general), 1e-12);
+		EXPECT_TRUE(m.inverted() == inv);
+
+		dmat4 projective   = m;
+		projective[0u][3u] = 0.5;
+		EXPECT_FALSE(projective.is_affine());
+		expect_mat_near(projective * projective.inverted(), dmat4::identity(), 1e-12);
+
+		EXPECT_TRUE(dmat4::scale({ 1.0, 0.0, 1.0 }).inverted_affine().is_zero());
+		EXPECT_TRUE(dmat4::scale({ 1.0, 0.0, 1.0 }).inverted().is_zero());
+
+		const dmat3 m2d = dmat3::translation({ 4.0, -1.0 }) * dmat3::scale({ 2.0, 4.0 });
+		expect_mat_near(m2d * m2d.inverted_affine(), dmat3::identity(), 1e-12);
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT, INVERT_RIGID) {
+		const mat4 m   = mat4::translation({ 1.f, -2.f, 3.f }) * mat4::rot({ 1.f, 1.f, 0.f }, 0.9f) * mat4::rot_z(-0.3f);
+		const mat4 inv = m.inverted_rigid();
+		expect_mat_near(m * inv, mat4::identity(), 1e-5f);
+		expect_mat_near(inv, m.inverted_affine(), 1e-5f);
+		EXPECT_TRUE(m.inverted(transform_type::rigid) == inv);
+
+		const imat4 translation = imat4::translation({ 1, 2, 3 });
+		EXPECT_TRUE(translation.inverted_rigid() == imat4::translation({ -1, -2, -3 }));
+	}
+
+		#if _MSTD_HAS_CXX20
+	TEST(ARITHMETIC_TESTS_MAT, CONSTEXPR_AFFINE_INVERSE) {
+		constexpr dmat4 translation = dmat4::translation({ 1.0, 2.0, 4.0 }).inverted();
+		static_assert(translation[3u][0u] == -1.0 && translation[3u][1u] == -2.0 && translation[3u][2u] == -4.0);
+		static_assert(translation[0u][0u] == 1.0 && translation[3u][3u] == 1.0);
+
+		constexpr dmat4 scale = dmat4::scale({ 2.0, 4.0, 0.5 }).inverted_affine();
+		static_assert(scale[0u][0u] == 0.5 && scale[1u][1u] == 0.25 && scale[2u][2u] == 2.0 && scale[3u][3u] == 1.0);
+
+		constexpr imat4 rigid = imat4::translation({ 1, 2, 3 }).inverted_rigid();
+		static_assert(rigid[3u][0u] == -1 && rigid[3u][1u] == -2 && rigid[3u][2u] == -3 && rigid[2u][2u] == 1);
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT, CONSTEXPR_FACTORIES) {
+		// projection and rotation matrices baked at compile time match the runtime ones
+		constexpr mat4 perspective = mat4::perspective(1.2f, 16.f / 9.f, 0.1f, 100.f);
+		constexpr mat4 rotation	   = mat4::rot_y(0.7f) * mat4::rot(vec3(1.f, 2.f, 3.f), -2.1f);
+		constexpr mat4 lookAt	   = mat4::look_at({ 1.f, 2.f, 3.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f });
+		static_assert(perspective[2u][3u] == -1.f);
+
+		const mat4 runtimePerspective = mat4::perspective(1.2f, 16.f / 9.f, 0.1f, 100.f);
+		const mat4 runtimeRotation	  = mat4::rot_y(0.7f) * mat4::rot(vec3(1.f, 2.f, 3.f), -2.1f);
+		const mat4 runtimeLookAt	  = mat4::look_at({ 1.f, 2.f, 3.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f });
+			for (size_t x = 0; x != 4; ++x) {
+					for (size_t y = 0; y != 4; ++y) {
+						EXPECT_NEAR(perspective[x][y], runtimePerspective[x][y], 1e-6f);
+						EXPECT_NEAR(rotation[x][y], runtimeRotation[x][y], 1e-6f);
+						EXPECT_NEAR(lookAt[x][y], runtimeLookAt[x][y], 1e-6f);
+					}
+			}
+
+		constexpr quat<double> q = quat<double>::rotation({ 0.0, 0.0, 1.0 }, M_PI_2);
+		static_assert(q.v[2u] > 0.7071067811 && q.v[2u] < 0.7071067812);
+		constexpr vec<3, double> v = vec<3, double>(3.0, 4.0, 12.0).normalized();
+		static_assert(v[2u] * 13.0 == 12.0);
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT, CONSTEXPR_LU) {
+		constexpr double det = []() {
+			auto m	  = mat<5, 5, double>::identity();
+			m[0u][0u] = 0.0;
+			m[1u][0u] = 2.0;
+			m[0u][1u] = 3.0;
+			m[4u][4u] = 4.0;
+			return m.determinant();
+		}();
+		static_assert(det == -24.0);
+
+		constexpr double solved = []() {
+			auto m = mat<5, 5, double>::scale(2.0);
+			return m.solve(vec<5, double>(2.0, 4.0, 6.0, 8.0, 10.0))[4u];
+		}();
+		static_assert(solved == 5.0);
+	}
+		#endif
 } // namespace mstd::test
\ No newline at end of file
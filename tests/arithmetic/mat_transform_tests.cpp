@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	// odd count so the kernels run with a tail after any unrolled part
+	static constexpr size_t transform_count = 37;
+
+	template<size_t N, class T>
+	static std::vector<vec<N, T>> make_transform_vecs(size_t count) {
+		std::vector<vec<N, T>> res(count);
+			for (size_t i = 0; i != count; ++i) {
+					for (size_t c = 0; c != N; ++c) { res[i][c] = static_cast<T>(((i * 5 + c * 3) % 13)) - static_cast<T>(6); }
+			}
+		return res;
+	}
+
+	template<class T>
+	static mat<4, 4, T> make_transform_mat() {
+		return mat<4, 4, T>::translation({ 1, -2, 3 }) * mat<4, 4, T>::rot_y(static_cast<T>(0.7)) *
+			   mat<4, 4, T>::scale({ 2, 3, static_cast<T>(0.5) });
+	}
+
+	template<size_t N, class T>
+	static void expect_vec_near(const vec<N, T>& value, const vec<N, T>& expected) {
+			for (size_t c = 0; c != N; ++c) { EXPECT_NEAR(value[c], expected[c], static_cast<T>(1e-4)); }
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT_TRANSFORM, POINTS) {
+		const mat4 m   = make_transform_mat<float>();
+		const auto src = make_transform_vecs<3, float>(transform_count);
+
+		std::vector<vec3> dst(transform_count);
+		transform_points(m, src.data(), dst.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) { expect_vec_near(dst[i], vec3(m * vec4(src[i], 1.f))); }
+
+		// in place
+		std::vector<vec3> values = src;
+		transform_points(m, values.data(), values.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) { ASSERT_EQ(values[i], dst[i]); }
+
+		const dmat4 dm	= make_transform_mat<double>();
+		const auto dsrc = make_transform_vecs<4, double>(transform_count);
+		std::vector<dvec4> ddst(transform_count);
+		transform_points(dm, dsrc.data(), ddst.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) { expect_vec_near(ddst[i], dm * dsrc[i]); }
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT_TRANSFORM, VECTORS) {
+		const mat4 m   = make_transform_mat<float>();
+		const auto src = make_transform_vecs<3, float>(transform_count);
+
+		std::vector<vec3> dst(transform_count);
+		transform_vectors(m, src.data(), dst.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) { expect_vec_near(dst[i], vec3(m * vec4(src[i], 0.f))); }
+
+		const auto src4 = make_transform_vecs<4, float>(transform_count);
+		std::vector<vec4> dst4(transform_count);
+		transform_vectors(m, src4.data(), dst4.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) { expect_vec_near(dst4[i], m * vec4(vec3(src4[i]), 0.f)); }
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT_TRANSFORM, NORMALS) {
+		const mat4 m		 = make_transform_mat<float>();
+		const mat4 normalMat = mat4(mat3(m).inverted().transposed());
+		const auto src		 = make_transform_vecs<3, float>(transform_count);
+
+		std::vector<vec3> dst(transform_count);
+		transform_normals(m, src.data(), dst.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) {
+				const vec3 expected = vec3(normalMat * vec4(src[i], 0.f));
+					if (expected.length() == 0.f) { ASSERT_EQ(dst[i], vec3()); }
+					else { expect_vec_near(dst[i], expected.normalized()); }
+			}
+
+		// the transformed normal of a plane stays perpendicular to the transformed plane
+		const vec3 normal  = vec3(1.f, 1.f, 0.f).normalized();
+		const vec3 tangent = vec3(1.f, -1.f, 2.f);
+		vec3 transformedNormal;
+		vec3 transformedTangent;
+		transform_normals(m, &normal, &transformedNormal, 1);
+		transform_vectors(m, &tangent, &transformedTangent, 1);
+		EXPECT_NEAR(transformedNormal.dot(transformedTangent), 0.f, 1e-5f);
+		EXPECT_NEAR(transformedNormal.length(), 1.f, 1e-6f);
+
+		const auto dsrc = make_transform_vecs<4, double>(transform_count);
+		std::vector<dvec4> ddst(transform_count, dvec4(1.0, 1.0, 1.0, 1.0));
+		transform_normals(dmat4(m), dsrc.data(), ddst.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) {
+				EXPECT_DOUBLE_EQ(ddst[i].w(), 0.0);
+					if (ddst[i] != dvec4()) { EXPECT_NEAR(ddst[i].length(), 1.0, 1e-12); }
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT_TRANSFORM, STRIDED) {
+		struct vertex {
+			float position[3];
+			float uv[2];
+			float normal[3];
+		};
+
+		const mat4 m = make_transform_mat<float>();
+		std::vector<vertex> vertices(transform_count);
+			for (size_t i = 0; i != transform_count; ++i) {
+				const float value = static_cast<float>(i);
+				vertices[i]		  = { { value, 1.f - value, 2.f }, { 0.25f, 0.75f }, { 0.f, value, 1.f } };
+			}
+		const std::vector<vertex> src = vertices;
+
+		transform_points(m, vertices[0].position, sizeof(vertex), vertices[0].position, sizeof(vertex), transform_count);
+		transform_normals(m, vertices[0].normal, sizeof(vertex), vertices[0].normal, sizeof(vertex), transform_count);
+
+		const mat4 normalMat = mat4(mat3(m).inverted().transposed());
+			for (size_t i = 0; i != transform_count; ++i) {
+				expect_vec_near(vec3(vertices[i].position), vec3(m * vec4(vec3(src[i].position), 1.f)));
+				expect_vec_near(vec3(vertices[i].normal), vec3(normalMat * vec4(vec3(src[i].normal), 0.f)).normalized());
+				ASSERT_EQ(vertices[i].uv[0], 0.25f);
+				ASSERT_EQ(vertices[i].uv[1], 0.75f);
+			}
+
+		// strided source into a tightly packed destination
+		std::vector<float> packed(transform_count * 3);
+		transform_vectors(m, src[0].position, sizeof(vertex), packed.data(), 3 * sizeof(float), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) {
+				expect_vec_near(vec3(&packed[i * 3], 3), vec3(m * vec4(vec3(src[i].position), 0.f)));
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT_TRANSFORM, THREADS) {
+		const size_t count = 100003;
+		const mat4 m	   = make_transform_mat<float>();
+		const auto src	   = make_transform_vecs<3, float>(count);
+
+		std::vector<vec3> single(count);
+		std::vector<vec3> threaded(count);
+		transform_points(m, src.data(), single.data(), count);
+		transform_points(m, src.data(), threaded.data(), count, 4);
+		ASSERT_EQ(single, threaded);
+
+		transform_normals(m, src.data(), threaded.data(), count, 0);
+		transform_normals(m, src.data(), single.data(), count);
+		ASSERT_EQ(single, threaded);
+	}
+
+	TEST(ARITHMETIC_TESTS_MAT_TRANSFORM, INTEGERS) {
+		const imat4 m  = imat4::translation({ 1, 2, 3 }) * imat4::scale({ 2, -1, 3 });
+		const auto src = make_transform_vecs<3, int>(transform_count);
+
+		std::vector<ivec3> dst(transform_count);
+		transform_points(m, src.data(), dst.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) { ASSERT_EQ(dst[i], ivec3(m * ivec4(src[i], 1))); }
+
+		transform_vectors(m, src.data(), dst.data(), transform_count);
+			for (size_t i = 0; i != transform_count; ++i) { ASSERT_EQ(dst[i], ivec3(m * ivec4(src[i], 0))); }
+	}
+} // namespace mstd::test
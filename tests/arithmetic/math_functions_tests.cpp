@@ -41,4 +41,60 @@ namespace mstd::test {
 		// Q_rstqr
 		ASSERT_FLOAT_EQ(mstd::q_rsqrt(2.f), 0.70693f);
 	}
+
+	static int64_t ulp_distance(double a, double b) {
+		int64_t ai = 0;
+		int64_t bi = 0;
+		std::memcpy(&ai, &a, sizeof(double));
+		std::memcpy(&bi, &b, sizeof(double));
+			if (ai < 0) { ai = std::numeric_limits<int64_t>::min() - ai; }
+			if (bi < 0) { bi = std::numeric_limits<int64_t>::min() - bi; }
+		return ai > bi ? ai - bi : bi - ai;
+	}
+
+	TEST(ARITHMETIC_TESTS_MATH_FUNCTIONS, CONSTEXPR_MATH) {
+		// the constant evaluation versions against <cmath> on a sweep over a few periods
+			for (int i = -20000; i != 20000; ++i) {
+				const double x = i * 0.00157 + 0.00001;
+				ASSERT_LE(ulp_distance(utils::constexpr_sin(x), std::sin(x)), 2) << x;
+				ASSERT_LE(ulp_distance(utils::constexpr_cos(x), std::cos(x)), 2) << x;
+				ASSERT_LE(ulp_distance(utils::constexpr_tan(x), std::tan(x)), 3) << x;
+			}
+
+			for (int i = -300; i != 300; ++i) {
+				const double x = std::ldexp(1.2345, i);
+				ASSERT_EQ(ulp_distance(utils::constexpr_sqrt(x), std::sqrt(x)), 0) << x;
+			}
+		ASSERT_EQ(utils::constexpr_sqrt(std::numeric_limits<double>::denorm_min()),
+		  std::sqrt(std::numeric_limits<double>::denorm_min()));
+
+		// special values follow <cmath>
+		ASSERT_EQ(utils::constexpr_sin(0.0), 0.0);
+		ASSERT_TRUE(std::signbit(utils::constexpr_sin(-0.0)));
+		ASSERT_EQ(utils::constexpr_cos(0.0), 1.0);
+		ASSERT_TRUE(std::isnan(utils::constexpr_sin(std::numeric_limits<double>::infinity())));
+		ASSERT_TRUE(std::isnan(utils::constexpr_cos(std::numeric_limits<double>::quiet_NaN())));
+		ASSERT_TRUE(std::isnan(utils::constexpr_sqrt(-1.0)));
+		ASSERT_EQ(utils::constexpr_sqrt(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+
+		// at runtime the <cmath> result is returned as is
+		ASSERT_EQ(mstd::sin(0.5f), std::sin(0.5f));
+		ASSERT_EQ(mstd::sqrt(2), std::sqrt(2));
+		ASSERT_EQ(mstd::abs(-3), 3);
+	}
+
+		#if _MSTD_HAS_CXX20
+	TEST(ARITHMETIC_TESTS_MATH_FUNCTIONS, CONSTEXPR_EVALUATION) {
+		static_assert(mstd::sqrt(16.0) == 4.0 && mstd::sqrt(2.f) == 1.41421356f);
+		static_assert(mstd::sin(0.0) == 0.0 && mstd::cos(0.0) == 1.0);
+		static_assert(mstd::abs(-2.5f) == 2.5f);
+
+		constexpr double s = mstd::sin(M_PI / 6.0);
+		constexpr double c = mstd::cos(M_PI / 3.0);
+		constexpr double t = mstd::tan(M_PI / 4.0);
+		ASSERT_NEAR(s, 0.5, 1e-15);
+		ASSERT_NEAR(c, 0.5, 1e-15);
+		ASSERT_NEAR(t, 1.0, 1e-15);
+	}
+		#endif
 } // namespace mstd::test
\ No newline at end of file
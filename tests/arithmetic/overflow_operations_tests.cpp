@@ -31,4 +31,191 @@ namespace mstd::test {
 		bi = -1;
 		ASSERT_TRUE(mstd::div_overflow(ai, bi, ci));
 	}
-} // namespace mstd::test
\ No newline at end of file
+
+	// every pair of 8 bit values against the exact int result, for the builtins and the fallbacks alike
+	template<class T>
+	static void check_small_overflow() {
+		using limits = std::numeric_limits<T>;
+			for (int a = limits::min(); a <= limits::max(); ++a) {
+					for (int b = limits::min(); b <= limits::max(); ++b) {
+						const T ta		= static_cast<T>(a);
+						const T tb		= static_cast<T>(b);
+						const int sum	= a + b;
+						const int diff	= a - b;
+						const int prod	= a * b;
+						const auto fits = [](int value) { return value >= limits::min() && value <= limits::max(); };
+
+						T res			= 0;
+						T fallback		= 0;
+						ASSERT_EQ(add_overflow(ta, tb, res), !fits(sum));
+						ASSERT_EQ(utils::add_overflow_fallback(ta, tb, fallback), !fits(sum));
+							if (fits(sum)) { ASSERT_EQ(res, static_cast<T>(sum)); }
+						ASSERT_EQ(sub_overflow(ta, tb, res), !fits(diff));
+						ASSERT_EQ(utils::sub_overflow_fallback(ta, tb, fallback), !fits(diff));
+							if (fits(diff)) { ASSERT_EQ(res, static_cast<T>(diff)); }
+						ASSERT_EQ(mul_overflow(ta, tb, res), !fits(prod));
+						ASSERT_EQ(utils::mul_overflow_fallback(ta, tb, fallback), !fits(prod));
+							if (fits(prod)) { ASSERT_EQ(res, static_cast<T>(prod)); }
+
+						ASSERT_EQ(saturating_add(ta, tb), static_cast<T>(std::clamp<int>(sum, limits::min(), limits::max())));
+						ASSERT_EQ(saturating_sub(ta, tb), static_cast<T>(std::clamp<int>(diff, limits::min(), limits::max())));
+						ASSERT_EQ(saturating_mul(ta, tb), static_cast<T>(std::clamp<int>(prod, limits::min(), limits::max())));
+					}
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_OVERFLOW_OPERATIONS, BUILTINS) {
+		check_small_overflow<int8_t>();
+		check_small_overflow<uint8_t>();
+
+		using limits = std::numeric_limits<int64_t>;
+		int64_t res	 = 7;
+		ASSERT_TRUE(mul_overflow(limits::min(), int64_t(-1), res));
+		ASSERT_TRUE(add_overflow(limits::max(), int64_t(1), res));
+		ASSERT_TRUE(sub_overflow(limits::min(), int64_t(1), res));
+		ASSERT_EQ(res, 7);
+		ASSERT_FALSE(mul_overflow(int64_t(-3037000499), int64_t(3037000499), res));
+		ASSERT_EQ(res, int64_t(-3037000499) * 3037000499);
+		ASSERT_TRUE(mul_overflow(uint64_t(1) << 32, uint64_t(1) << 32, res));
+
+		// mixed operand types like in strtonum
+		uint8_t small = 0;
+		ASSERT_FALSE(add_overflow(uint8_t(250), 5, small));
+		ASSERT_EQ(small, 255);
+		ASSERT_TRUE(add_overflow(uint8_t(250), 6, small));
+		ASSERT_TRUE(sub_overflow(uint8_t(0), 1, small));
+
+		float f = 0.f;
+		ASSERT_FALSE(add_overflow(1.5f, 2.f, f));
+		ASSERT_EQ(f, 3.5f);
+
+		#if _MSTD_HAS_CXX20
+		static_assert([] {
+			int32_t value = 0;
+			return mul_overflow(1 << 16, 1 << 15, value) && !add_overflow(-5, 3, value) && value == -2;
+		}());
+		static_assert(saturating_add(int16_t(30000), int16_t(30000)) == 32767);
+		static_assert(saturating_sub(uint32_t(3), uint32_t(5)) == 0);
+		static_assert(saturating_mul(int64_t(-1) << 62, int64_t(4)) == std::numeric_limits<int64_t>::min());
+		#endif
+	}
+
+	template<class T>
+	static void check_saturating_spans() {
+		using limits = std::numeric_limits<T>;
+		std::vector<T> a(133);
+		std::vector<T> b(a.size());
+		uint64_t x	 = 0x9E37'79B9'7F4A'7C15ull;
+			for (size_t i = 0; i != a.size(); ++i) {
+				x ^= x << 13;
+				x ^= x >> 7;
+				x ^= x << 17;
+				a[i] = static_cast<T>(x);
+				b[i] = i % 5 == 0 ? limits::max() : (i % 5 == 1 ? limits::min() : static_cast<T>(x >> 32));
+			}
+
+		// the kernels and the scalar tail give the same results for every length
+			for (size_t count = 0; count <= a.size(); count += 11) {
+				std::vector<T> res(count);
+				saturating_add(a.data(), b.data(), res.data(), count);
+					for (size_t i = 0; i != count; ++i) { ASSERT_EQ(res[i], saturating_add(a[i], b[i])); }
+				saturating_sub(a.data(), b.data(), res.data(), count);
+					for (size_t i = 0; i != count; ++i) { ASSERT_EQ(res[i], saturating_sub(a[i], b[i])); }
+				saturating_mul(a.data(), b.data(), res.data(), count);
+					for (size_t i = 0; i != count; ++i) { ASSERT_EQ(res[i], saturating_mul(a[i], b[i])); }
+			}
+
+		std::vector<T> inPlace = a;
+		saturating_add(inPlace.data(), b.data(), inPlace.data(), inPlace.size());
+			for (size_t i = 0; i != a.size(); ++i) { ASSERT_EQ(inPlace[i], saturating_add(a[i], b[i])); }
+	}
+
+	TEST(ARITHMETIC_TESTS_OVERFLOW_OPERATIONS, SATURATING) {
+		ASSERT_EQ(saturating_add(std::numeric_limits<int32_t>::max(), 1), std::numeric_limits<int32_t>::max());
+		ASSERT_EQ(saturating_add(std::numeric_limits<int32_t>::min(), -1), std::numeric_limits<int32_t>::min());
+		ASSERT_EQ(saturating_sub(std::numeric_limits<int64_t>::min(), int64_t(1)), std::numeric_limits<int64_t>::min());
+		ASSERT_EQ(saturating_sub(int64_t(0), std::numeric_limits<int64_t>::min()), std::numeric_limits<int64_t>::max());
+		ASSERT_EQ(saturating_add(~uint64_t(0), uint64_t(2)), ~uint64_t(0));
+		ASSERT_EQ(saturating_mul(uint32_t(1) << 20, uint32_t(1) << 20), ~uint32_t(0));
+		ASSERT_EQ(saturating_mul(-(1 << 20), 1 << 20), std::numeric_limits<int32_t>::min());
+		ASSERT_EQ(saturating_add(-7, 3), -4);
+
+		check_saturating_spans<int8_t>();
+		check_saturating_spans<uint8_t>();
+		check_saturating_spans<int16_t>();
+		check_saturating_spans<uint16_t>();
+		check_saturating_spans<int32_t>();
+		check_saturating_spans<uint64_t>();
+		check_saturating_spans<int64_t>();
+	}
+
+	TEST(ARITHMETIC_TESTS_OVERFLOW_OPERATIONS, CHECKED_SPANS) {
+		using limits = std::numeric_limits<int64_t>;
+
+		// only the final sum has to fit
+		std::vector<int64_t> values = { limits::max(), limits::max(), 5, limits::min(), limits::min(), 7, 1, -2, 3 };
+		int64_t sum					= 0;
+		ASSERT_FALSE(sum_overflow(values.data(), values.size(), sum));
+		ASSERT_EQ(sum, 12);
+		values.push_back(limits::max());
+		ASSERT_TRUE(sum_overflow(values.data(), values.size(), sum));
+		ASSERT_EQ(sum, 12);
+		values.back() = limits::min() + 11;
+		ASSERT_FALSE(sum_overflow(values.data(), values.size(), sum));
+		ASSERT_EQ(sum, limits::min() + 23);
+
+		std::vector<uint64_t> unsignedValues(37, ~uint64_t(0) / 36);
+		uint64_t unsignedSum = 0;
+		ASSERT_TRUE(sum_overflow(unsignedValues.data(), unsignedValues.size(), unsignedSum));
+		ASSERT_FALSE(sum_overflow(unsignedValues.data(), 36, unsignedSum));
+		ASSERT_EQ(unsignedSum, ~uint64_t(0) / 36 * 36);
+
+		// narrow terms and a narrow result
+		const std::vector<int32_t> small(1001, std::numeric_limits<int32_t>::max());
+		int32_t smallSum = 0;
+		ASSERT_TRUE(sum_overflow(small.data(), small.size(), smallSum));
+		ASSERT_FALSE(sum_overflow(small.data(), small.size(), sum));
+		ASSERT_EQ(sum, int64_t(1001) * std::numeric_limits<int32_t>::max());
+		const std::vector<int8_t> bytes = { 100, 27, 50, -50 };
+		int8_t byteSum					= 0;
+		ASSERT_FALSE(sum_overflow(bytes.data(), 2, byteSum));
+		ASSERT_EQ(byteSum, 127);
+		ASSERT_TRUE(sum_overflow(bytes.data(), 3, byteSum));
+		ASSERT_FALSE(sum_overflow(bytes.data(), bytes.size(), byteSum));
+		ASSERT_EQ(byteSum, 127);
+		uint32_t unsignedSmall = 0;
+		ASSERT_TRUE(sum_overflow(values.data(), 3, unsignedSmall));
+
+		// dot products of every width against the exact long double result
+		std::vector<int32_t> a(1003);
+		std::vector<int32_t> b(a.size());
+		long double exact = 0.0L;
+			for (size_t i = 0; i != a.size(); ++i) {
+				a[i] = static_cast<int32_t>(i * 2654435761u);
+				b[i] = static_cast<int32_t>(i * 40503u % 2000u) - 1000;
+				exact += static_cast<long double>(a[i]) * b[i];
+			}
+		int64_t dot = 0;
+		ASSERT_FALSE(dot_overflow(a.data(), b.data(), a.size(), dot));
+		ASSERT_EQ(static_cast<long double>(dot), exact);
+		int32_t narrowDot = 0;
+		ASSERT_TRUE(dot_overflow(a.data(), b.data(), a.size(), narrowDot));
+
+		const std::vector<uint32_t> big(9, ~uint32_t(0));
+		uint64_t bigDot = 0;
+		ASSERT_TRUE(dot_overflow(big.data(), big.data(), big.size(), bigDot));
+		ASSERT_FALSE(dot_overflow(big.data(), big.data(), 1, bigDot));
+		ASSERT_EQ(bigDot, uint64_t(~uint32_t(0)) * ~uint32_t(0));
+
+		const std::vector<int16_t> shorts = { -32768, -32768, 3 };
+		int32_t shortDot				  = 0;
+		ASSERT_TRUE(dot_overflow(shorts.data(), shorts.data(), 2, shortDot));
+		ASSERT_FALSE(dot_overflow(shorts.data(), shorts.data(), 1, shortDot));
+		ASSERT_EQ(shortDot, 1 << 30);
+
+		const std::vector<int64_t> wide = { int64_t(1) << 40, int64_t(1) << 30 };
+		ASSERT_TRUE(dot_overflow(wide.data(), wide.data(), 1, dot));
+		ASSERT_FALSE(dot_overflow(wide.data() + 1, wide.data() + 1, 1, dot));
+		ASSERT_EQ(dot, int64_t(1) << 60);
+	}
+} // namespace mstd::test
@@ -137,4 +137,101 @@ namespace mstd::test {
 		// quat != quat
 		ASSERT_FALSE(q != q);
 	}
+
+	template<class T>
+	static void expect_quat_near(const quat<T>& value, const quat<T>& expected, const T& tolerance) {
+		EXPECT_NEAR(value.s, expected.s, tolerance);
+			for (size_t i = 0; i != 3; ++i) { EXPECT_NEAR(value.v[i], expected.v[i], tolerance); }
+	}
+
+	template<class T>
+	static void check_quat_kernels(const T& tolerance) {
+			for (size_t i = 0; i != 20; ++i) {
+				const T angle = static_cast<T>(i) * static_cast<T>(0.37) - 3;
+				const vec<3, T> axisA(static_cast<T>(i % 5) - 2, static_cast<T>(i % 3) + 1, static_cast<T>(i % 7) - 3);
+				const vec<3, T> axisB(static_cast<T>(i % 3), static_cast<T>(2), static_cast<T>(i % 4) - 1);
+				const quat<T> a = quat<T>::rotation(axisA, angle);
+				const quat<T> b = quat<T>::rotation(axisB, static_cast<T>(2) - angle);
+
+				// a * b = (as bs - av . bv, as bv + bs av + av x bv)
+				const quat<T> expected(a.s * b.s - a.v.dot(b.v), b.v * a.s + a.v * b.s + a.v.cross(b.v));
+				expect_quat_near(a * b, expected, tolerance);
+
+				quat<T> inPlace	 = a;
+				inPlace			*= inPlace;
+				expect_quat_near(inPlace, a * a, tolerance);
+
+				const vec<3, T> p(static_cast<T>(i) - 4, static_cast<T>(2), static_cast<T>(i % 3));
+				const vec<3, T> rotated = a.rotate(p);
+				const vec<3, T> slow	= (a * quat<T>(static_cast<T>(0), p) * a.inverted()).v;
+					for (size_t c = 0; c != 3; ++c) { EXPECT_NEAR(rotated[c], slow[c], tolerance * 10); }
+				EXPECT_NEAR(rotated.length(), p.length(), tolerance * 10);
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_QUAT, KERNELS) {
+		check_quat_kernels<float>(1e-5f);
+		check_quat_kernels<double>(1e-12);
+
+		// rotate(axis) of vec goes through quat::rotate
+		const vec3 rotated = vec3(0.f, 1.f, 0.f).rotated(vec3(0.f, 0.f, 1.f), static_cast<float>(M_PI_2));
+		EXPECT_NEAR(rotated.x(), -1.f, 1e-6f);
+		EXPECT_NEAR(rotated.y(), 0.f, 1e-6f);
+		EXPECT_NEAR(rotated.z(), 0.f, 1e-6f);
+	}
+
+	TEST(ARITHMETIC_TESTS_QUAT, SLERP) {
+		const dquat a = dquat::rotation(dvec3(1.0, 1.0, 0.0), -1.9);
+		const dquat b = dquat::rotation(dvec3(-1.0, 3.0, 1.0), 1.07);
+
+		expect_quat_near(slerp(a, b, 0.0), a, 1e-12);
+		expect_quat_near(slerp(a, b, 1.0), b, 1e-12);
+
+		// constant angular speed: every step covers the same angle
+		const double full = std::acos(std::abs(a.scalar(b)));
+			for (size_t i = 0; i <= 10; ++i) {
+				const double t	 = static_cast<double>(i) / 10.0;
+				const dquat step = slerp(a, b, t);
+				EXPECT_NEAR(step.magnitude(), 1.0, 1e-12);
+				EXPECT_NEAR(std::acos(std::min(std::abs(a.scalar(step)), 1.0)), full * t, 1e-9);
+			}
+
+		// q and -q are the same rotation, the shorter arc is taken
+		expect_quat_near(slerp(a, -b, 0.5), slerp(a, b, 0.5), 1e-12);
+
+		// nearly equal quaternions stay finite and normalized
+		const dquat close = (a + dquat(1e-9, 0.0, 0.0, 0.0)).normalized();
+		const dquat mid	  = slerp(a, close, 0.5);
+		EXPECT_NEAR(mid.magnitude(), 1.0, 1e-12);
+		expect_quat_near(mid, a, 1e-8);
+
+		const fquat fa = fquat(a);
+		const fquat fb = fquat(b);
+		expect_quat_near(slerp(fa, fb, 0.25f), fquat(slerp(dquat(fa), dquat(fb), 0.25)), 1e-6f);
+	}
+
+	TEST(ARITHMETIC_TESTS_QUAT, NLERP) {
+		const fquat a = fquat::rotation(vec3(2.f, 2.f, 1.f), -1.52f);
+		const fquat b = fquat::rotation(vec3(2.f, 1.f, -1.f), 0.33f);
+
+		expect_quat_near(nlerp(a, b, 0.f), a, 1e-6f);
+		expect_quat_near(nlerp(a, b, 1.f), b, 1e-6f);
+		expect_quat_near(nlerp(a, -b, 0.3f), nlerp(a, b, 0.3f), 1e-6f);
+
+		const fquat mid = nlerp(a, b, 0.5f);
+		EXPECT_NEAR(mid.magnitude(), 1.f, 1e-6f);
+		// halfway between two rotations nlerp and slerp agree
+		expect_quat_near(mid, slerp(a, b, 0.5f), 1e-5f);
+	}
+
+		#if _MSTD_HAS_CXX20
+	TEST(ARITHMETIC_TESTS_QUAT, CONSTEXPR_KERNELS) {
+		constexpr fquat q = fquat(0.f, 1.f, 0.f, 0.f) * fquat(0.f, 0.f, 1.f, 0.f);
+		static_assert(q.s == 0.f && q.v[0u] == 0.f && q.v[1u] == 0.f && q.v[2u] == 1.f);
+
+		// 180 degrees around z
+		constexpr vec3 rotated = fquat(0.f, 0.f, 0.f, 1.f).rotate(vec3(1.f, 2.f, 3.f));
+		static_assert(rotated[0u] == -1.f && rotated[1u] == -2.f && rotated[2u] == 3.f);
+	}
+		#endif
 } // namespace mstd::test
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	// odd count so nothing depends on a multiple of the vector width
+	static constexpr size_t quat_batch_count = 37;
+
+	template<class T>
+	static std::vector<quat<T>> make_batch_quats(size_t count, size_t seed) {
+		std::vector<quat<T>> res(count);
+			for (size_t i = 0; i != count; ++i) {
+				const vec<3, T> axis(static_cast<T>((i + seed) % 5) - 2, static_cast<T>(i % 3) + 1, static_cast<T>(seed % 7));
+				res[i] = quat<T>::rotation(axis, static_cast<T>(i) * static_cast<T>(0.21) - static_cast<T>(seed));
+			}
+		return res;
+	}
+
+	template<class T>
+	static std::vector<vec<3, T>> make_batch_vecs(size_t count) {
+		std::vector<vec<3, T>> res(count);
+			for (size_t i = 0; i != count; ++i) {
+				res[i] = vec<3, T>(static_cast<T>(i % 7) - 3, static_cast<T>(i % 4), static_cast<T>(i % 5) * 2 - 4);
+			}
+		return res;
+	}
+
+	TEST(ARITHMETIC_TESTS_QUAT_TRANSFORM, ROTATE) {
+		const auto quats = make_batch_quats<float>(quat_batch_count, 1);
+		const auto src	 = make_batch_vecs<float>(quat_batch_count);
+
+		std::vector<vec3> dst(quat_batch_count);
+		rotate_vectors(quats[5], src.data(), dst.data(), quat_batch_count);
+			for (size_t i = 0; i != quat_batch_count; ++i) { ASSERT_EQ(dst[i], quats[5].rotate(src[i])); }
+
+		rotate_vectors(quats.data(), src.data(), dst.data(), quat_batch_count);
+			for (size_t i = 0; i != quat_batch_count; ++i) { ASSERT_EQ(dst[i], quats[i].rotate(src[i])); }
+
+		// in place
+		std::vector<vec3> values = src;
+		rotate_vectors(quats.data(), values.data(), values.data(), quat_batch_count);
+		ASSERT_EQ(values, dst);
+	}
+
+	TEST(ARITHMETIC_TESTS_QUAT_TRANSFORM, MUL) {
+		const auto a = make_batch_quats<double>(quat_batch_count, 2);
+		const auto b = make_batch_quats<double>(quat_batch_count, 3);
+
+		std::vector<dquat> dst(quat_batch_count);
+		mul_quats(a.data(), b.data(), dst.data(), quat_batch_count);
+			for (size_t i = 0; i != quat_batch_count; ++i) { ASSERT_EQ(dst[i], a[i] * b[i]); }
+
+		std::vector<dquat> values = a;
+		mul_quats(values.data(), b.data(), values.data(), quat_batch_count);
+		ASSERT_EQ(values, dst);
+	}
+
+	TEST(ARITHMETIC_TESTS_QUAT_TRANSFORM, INTERPOLATE) {
+		const auto a = make_batch_quats<float>(quat_batch_count, 4);
+		const auto b = make_batch_quats<float>(quat_batch_count, 5);
+		std::vector<float> t(quat_batch_count);
+			for (size_t i = 0; i != quat_batch_count; ++i) { t[i] = static_cast<float>(i) / (quat_batch_count - 1); }
+
+		std::vector<fquat> dst(quat_batch_count);
+		slerp(a.data(), b.data(), 0.3f, dst.data(), quat_batch_count);
+			for (size_t i = 0; i != quat_batch_count; ++i) { ASSERT_EQ(dst[i], slerp(a[i], b[i], 0.3f)); }
+
+		slerp(a.data(), b.data(), t.data(), dst.data(), quat_batch_count);
+			for (size_t i = 0; i != quat_batch_count; ++i) { ASSERT_EQ(dst[i], slerp(a[i], b[i], t[i])); }
+
+		nlerp(a.data(), b.data(), 0.3f, dst.data(), quat_batch_count);
+			for (size_t i = 0; i != quat_batch_count; ++i) { ASSERT_EQ(dst[i], nlerp(a[i], b[i], 0.3f)); }
+
+		nlerp(a.data(), b.data(), t.data(), dst.data(), quat_batch_count);
+			for (size_t i = 0; i != quat_batch_count; ++i) { ASSERT_EQ(dst[i], nlerp(a[i], b[i], t[i])); }
+	}
+
+	TEST(ARITHMETIC_TESTS_QUAT_TRANSFORM, THREADS) {
+		const size_t count = 50003;
+		const auto a	   = make_batch_quats<float>(count, 6);
+		const auto b	   = make_batch_quats<float>(count, 7);
+		const auto src	   = make_batch_vecs<float>(count);
+
+		std::vector<fquat> single(count);
+		std::vector<fquat> threaded(count);
+		slerp(a.data(), b.data(), 0.7f, single.data(), count);
+		slerp(a.data(), b.data(), 0.7f, threaded.data(), count, 4);
+		ASSERT_EQ(single, threaded);
+
+		std::vector<vec3> singleVecs(count);
+		std::vector<vec3> threadedVecs(count);
+		rotate_vectors(a[0], src.data(), singleVecs.data(), count);
+		rotate_vectors(a[0], src.data(), threadedVecs.data(), count, 0);
+		ASSERT_EQ(singleVecs, threadedVecs);
+	}
+} // namespace mstd::test
@@ -0,0 +1,303 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	static constexpr size_t simd_math_count = 1 << 20;
+
+	// distance to the exact result in units of the last place of the rounded result
+	template<class T>
+	static double ulp_error(T value, long double exact) {
+		const T rounded = static_cast<T>(exact);
+		const T ulp		= std::nextafter(std::abs(rounded), std::numeric_limits<T>::infinity()) - std::abs(rounded);
+		return static_cast<double>(std::abs(static_cast<long double>(value) - exact) / ulp);
+	}
+
+	template<class T>
+	static double relative_error(T value, long double exact) {
+		return static_cast<double>(std::abs((static_cast<long double>(value) - exact) / exact));
+	}
+
+	// evenly spread values in [from, to)
+	template<class T>
+	static std::vector<T> make_math_values(size_t count, double from, double to, size_t seed) {
+		std::vector<T> res(count);
+		double t = static_cast<double>(seed) * 0.1234567;
+			for (T& value : res) {
+				t	  = t + 0.6180339887498949 - std::floor(t + 0.6180339887498949);
+				value = static_cast<T>(from + (to - from) * t);
+			}
+		return res;
+	}
+
+	template<class T>
+	static bool same_value(T a, T b) {
+		return (std::isnan(a) && std::isnan(b)) || (a == b && std::signbit(a) == std::signbit(b));
+	}
+
+	// the units of the error table in simd_math.hpp, relative error for the fast double tier and ulp for the others
+	template<math_precision Precision, class T>
+	static double math_error(T value, long double exact) {
+			if constexpr (Precision == math_precision::fast && std::is_same_v<T, double>) {
+				return relative_error(value, exact);
+			}
+		return ulp_error(value, exact);
+	}
+
+	// max error of every function over the domains of the error table
+	template<math_precision Precision, class T>
+	static void check_math_errors(double trigError, double tanError, double expError, double logError,
+	  double atan2Error, double powError) {
+		const auto error	   = math_error<Precision, T>;
+		const double trigLimit = std::is_same_v<T, float> ? 8192.0 : 1e6;
+		const double expMin	   = std::is_same_v<T, float> ? -87.0 : -708.0;
+		const double expMax	   = std::is_same_v<T, float> ? 88.0 : 709.0;
+		const double minExp2   = std::numeric_limits<T>::min_exponent - 1;
+		const double maxExp2   = std::numeric_limits<T>::max_exponent - 1;
+
+		const std::vector<T> angles = make_math_values<T>(simd_math_count, -trigLimit, trigLimit, 1);
+		std::vector<T> res(simd_math_count);
+		std::vector<T> res2(simd_math_count);
+		sin<Precision>(angles.data(), res.data(), simd_math_count);
+		cos<Precision>(angles.data(), res2.data(), simd_math_count);
+			for (size_t i = 0; i != simd_math_count; ++i) {
+				ASSERT_LE(error(res[i], std::sin(static_cast<long double>(angles[i]))), trigError) << angles[i];
+				ASSERT_LE(error(res2[i], std::cos(static_cast<long double>(angles[i]))), trigError) << angles[i];
+			}
+		tan<Precision>(angles.data(), res.data(), simd_math_count);
+			for (size_t i = 0; i != simd_math_count; ++i) {
+				ASSERT_LE(error(res[i], std::tan(static_cast<long double>(angles[i]))), tanError) << angles[i];
+			}
+
+		const std::vector<T> exponents = make_math_values<T>(simd_math_count, expMin, expMax, 2);
+		exp<Precision>(exponents.data(), res.data(), simd_math_count);
+			for (size_t i = 0; i != simd_math_count; ++i) {
+				ASSERT_LE(error(res[i], std::exp(static_cast<long double>(exponents[i]))), expError) << exponents[i];
+			}
+
+		std::vector<T> positive = make_math_values<T>(simd_math_count, minExp2, maxExp2, 3);
+			for (T& value : positive) { value = std::exp2(value); }
+		log<Precision>(positive.data(), res.data(), simd_math_count);
+			for (size_t i = 0; i != simd_math_count; ++i) {
+				ASSERT_LE(error(res[i], std::log(static_cast<long double>(positive[i]))), logError) << positive[i];
+			}
+
+		const std::vector<T> y = make_math_values<T>(simd_math_count, -100.0, 100.0, 4);
+		const std::vector<T> x = make_math_values<T>(simd_math_count, -100.0, 100.0, 5);
+		atan2<Precision>(y.data(), x.data(), res.data(), simd_math_count);
+			for (size_t i = 0; i != simd_math_count; ++i) {
+				ASSERT_LE(error(res[i], std::atan2(static_cast<long double>(y[i]), static_cast<long double>(x[i]))),
+				  atan2Error)
+				  << y[i] << ", " << x[i];
+			}
+
+		// x in [2^-4, 2^4] and |y| <= 2, so |y * log(x)| stays below 8
+		const std::vector<T> powExponents = make_math_values<T>(simd_math_count, -2.0, 2.0, 6);
+		std::vector<T> bases			  = make_math_values<T>(simd_math_count, -4.0, 4.0, 7);
+			for (T& value : bases) { value = std::exp2(value); }
+		pow<Precision>(bases.data(), powExponents.data(), res.data(), simd_math_count);
+			for (size_t i = 0; i != simd_math_count; ++i) {
+				ASSERT_LE(error(res[i],
+							std::pow(static_cast<long double>(bases[i]), static_cast<long double>(powExponents[i]))),
+				  powError)
+				  << bases[i] << ", " << powExponents[i];
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_SIMD_MATH, PRECISE) {
+		check_math_errors<math_precision::precise, float>(2.4, 3.6, 0.87, 0.94, 3.2, 0.5);
+		check_math_errors<math_precision::precise, double>(2.5, 4.2, 0.96, 1.3, 1.7, 8.7);
+	}
+
+	TEST(ARITHMETIC_TESTS_SIMD_MATH, FAST) {
+		check_math_errors<math_precision::fast, float>(27.0, 36.0, 2.2, 2.9, 13.0, 9.9);
+		check_math_errors<math_precision::fast, double>(3.8e-9, 4.0e-9, 1.1e-9, 2.1e-9, 2.1e-8, 2.5e-9);
+	}
+
+	// positive values spread over the whole estimate range, rcp also checks their negations
+	template<math_precision Precision, class T>
+	static void check_estimate_errors(double rsqrtError, double rcpError) {
+		const auto error = math_error<Precision, T>;
+
+		std::vector<T> values = make_math_values<T>(simd_math_count, -126.0, 126.0, 10);
+			for (T& value : values) { value = std::exp2(value); }
+		std::vector<T> res(simd_math_count);
+		rsqrt<Precision>(values.data(), res.data(), simd_math_count);
+			for (size_t i = 0; i != simd_math_count; ++i) {
+				const long double exact = 1.0L / std::sqrt(static_cast<long double>(values[i]));
+				ASSERT_LE(error(res[i], exact), rsqrtError) << values[i];
+				ASSERT_LE(error(rsqrt<Precision>(values[i]), exact), rsqrtError) << values[i];
+			}
+
+			for (size_t i = 0; i < simd_math_count; i += 2) { values[i] = -values[i]; }
+		rcp<Precision>(values.data(), res.data(), simd_math_count);
+			for (size_t i = 0; i != simd_math_count; ++i) {
+				const long double exact = 1.0L / static_cast<long double>(values[i]);
+				ASSERT_LE(error(res[i], exact), rcpError) << values[i];
+				ASSERT_LE(error(rcp<Precision>(values[i]), exact), rcpError) << values[i];
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_SIMD_MATH, RSQRT_RCP) {
+		check_estimate_errors<math_precision::precise, float>(1.5, 1.4);
+		check_estimate_errors<math_precision::precise, double>(1.5, 1.3);
+		check_estimate_errors<math_precision::fast, float>(3.4, 2.9);
+		check_estimate_errors<math_precision::fast, double>(3.9e-14, 8.2e-15);
+
+		// outside the estimate range the result is the exact one
+		const double inf			   = std::numeric_limits<double>::infinity();
+		const std::vector<double> args = { 0.0, -0.0, inf, -inf, std::numeric_limits<double>::quiet_NaN(), 1e-310, 1e300,
+			-1e300, 0x1p-127, 0x1p127, 0x1p126, -0x1p126 };
+		std::vector<double> res(args.size());
+		rsqrt(args.data(), res.data(), args.size());
+			for (size_t i = 0; i != args.size(); ++i) {
+				ASSERT_TRUE(same_value(res[i], 1.0 / std::sqrt(args[i]))) << args[i];
+				ASSERT_TRUE(same_value(rsqrt(args[i]), 1.0 / std::sqrt(args[i]))) << args[i];
+			}
+		ASSERT_TRUE(std::isnan(rsqrt(-1.0)));
+		rcp<math_precision::fast>(args.data(), res.data(), args.size());
+			for (size_t i = 0; i != args.size(); ++i) {
+				ASSERT_TRUE(same_value(res[i], 1.0 / args[i])) << args[i];
+				ASSERT_TRUE(same_value(rcp<math_precision::fast>(args[i]), 1.0 / args[i])) << args[i];
+			}
+
+	#if _MSTD_HAS_CXX20
+		static_assert(rsqrt(4.f) == 0.5f);
+		static_assert(rcp(-8.0) == -0.125);
+	#endif
+	}
+
+	TEST(ARITHMETIC_TESTS_SIMD_MATH, SPECIAL_VALUES) {
+		const double inf			   = std::numeric_limits<double>::infinity();
+		const double nan			   = std::numeric_limits<double>::quiet_NaN();
+		const std::vector<double> args = { 0.0, -0.0, inf, -inf, nan, -1e-300, 1e-310, 1e7, -1e7, 710.0, -750.0 };
+		std::vector<double> res(args.size());
+		std::vector<double> res2(args.size());
+
+		sin(args.data(), res.data(), args.size());
+			for (size_t i = 0; i != args.size(); ++i) { ASSERT_TRUE(same_value(res[i], std::sin(args[i]))) << args[i]; }
+		sincos(args.data(), res.data(), res2.data(), args.size());
+			for (size_t i = 0; i != args.size(); ++i) {
+				ASSERT_TRUE(same_value(res[i], std::sin(args[i]))) << args[i];
+				ASSERT_TRUE(same_value(res2[i], std::cos(args[i]))) << args[i];
+			}
+		tan(args.data(), res.data(), args.size());
+			for (size_t i = 0; i != args.size(); ++i) { ASSERT_TRUE(same_value(res[i], std::tan(args[i]))) << args[i]; }
+		exp(args.data(), res.data(), args.size());
+			for (size_t i = 0; i != args.size(); ++i) { ASSERT_TRUE(same_value(res[i], std::exp(args[i]))) << args[i]; }
+		log(args.data(), res.data(), args.size());
+			for (size_t i = 0; i != args.size(); ++i) { ASSERT_TRUE(same_value(res[i], std::log(args[i]))) << args[i]; }
+
+		const std::vector<float> x = { 0.f, -0.f, 1.f, -1.f, static_cast<float>(inf), static_cast<float>(-inf), 0.f,
+			-0.f, static_cast<float>(nan) };
+		const std::vector<float> y = { 0.f, 0.f, -0.f, -0.f, 1.f, -1.f, static_cast<float>(inf), -1.f, 1.f };
+		std::vector<float> angles(x.size());
+		atan2(y.data(), x.data(), angles.data(), x.size());
+			for (size_t i = 0; i != x.size(); ++i) {
+				ASSERT_TRUE(same_value(angles[i], std::atan2(y[i], x[i]))) << y[i] << ", " << x[i];
+			}
+		pow(x.data(), y.data(), angles.data(), x.size());
+			for (size_t i = 0; i != x.size(); ++i) {
+				ASSERT_TRUE(same_value(angles[i], std::pow(x[i], y[i]))) << x[i] << ", " << y[i];
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_SIMD_MATH, TAIL_AND_IN_PLACE) {
+		const std::vector<float> values = make_math_values<float>(67, -10.0, 10.0, 8);
+		std::vector<float> full(values.size());
+		exp(values.data(), full.data(), values.size());
+
+		// every element gets the same result whatever its position in the batch
+			for (size_t first = 0; first != 9; ++first) {
+					for (size_t count = 0; count != 19; ++count) {
+						std::vector<float> part(count);
+						exp(values.data() + first, part.data(), count);
+							for (size_t i = 0; i != count; ++i) { ASSERT_EQ(part[i], full[first + i]); }
+					}
+			}
+
+		std::vector<float> inPlace = values;
+		exp(inPlace.data(), inPlace.data(), inPlace.size());
+		ASSERT_EQ(inPlace, full);
+
+		std::vector<float> cosines(values.size());
+		sincos(values.data(), full.data(), cosines.data(), values.size());
+		inPlace = values;
+		std::vector<float> inPlaceCos(values.size());
+		sincos(inPlace.data(), inPlace.data(), inPlaceCos.data(), inPlace.size());
+		ASSERT_EQ(inPlace, full);
+		ASSERT_EQ(inPlaceCos, cosines);
+	}
+
+	TEST(ARITHMETIC_TESTS_SIMD_MATH, THREADS) {
+		const size_t count				 = 100003;
+		const std::vector<double> values = make_math_values<double>(count, -50.0, 50.0, 9);
+		std::vector<double> single(count);
+		std::vector<double> threaded(count);
+
+		sin(values.data(), single.data(), count);
+		sin(values.data(), threaded.data(), count, 4);
+		ASSERT_EQ(single, threaded);
+
+		pow<math_precision::fast>(values.data(), 0.5, single.data(), count);
+		pow<math_precision::fast>(values.data(), 0.5, threaded.data(), count, 0);
+			for (size_t i = 0; i != count; ++i) { ASSERT_TRUE(same_value(single[i], threaded[i])); }
+	}
+
+	TEST(ARITHMETIC_TESTS_SIMD_MATH, VEC) {
+		const vec4 a(0.5f, -1.25f, 3.f, 100.f);
+		const vec4 b(2.f, 0.25f, -1.f, 7.f);
+		vec4 expected;
+
+		mstd::sin(static_cast<const float*>(a), &expected[0], 4);
+		ASSERT_EQ(mstd::sin(a), expected);
+		mstd::cos<math_precision::fast>(static_cast<const float*>(a), &expected[0], 4);
+		ASSERT_EQ(mstd::cos<math_precision::fast>(a), expected);
+		mstd::tan(static_cast<const float*>(a), &expected[0], 4);
+		ASSERT_EQ(mstd::tan(a), expected);
+		mstd::atan2(static_cast<const float*>(a), static_cast<const float*>(b), &expected[0], 4);
+		ASSERT_EQ(mstd::atan2(a, b), expected);
+		mstd::exp(static_cast<const float*>(a), &expected[0], 4);
+		ASSERT_EQ(mstd::exp(a), expected);
+
+		vec4 sines;
+		vec4 cosines;
+		mstd::sincos(a, sines, cosines);
+		ASSERT_EQ(sines, mstd::sin(a));
+		ASSERT_EQ(cosines, mstd::cos(a));
+
+		const vec4 positive(0.5f, 1.25f, 3.f, 100.f);
+		mstd::log(static_cast<const float*>(positive), &expected[0], 4);
+		ASSERT_EQ(mstd::log(positive), expected);
+		ASSERT_EQ(positive.powed(b), vec4(std::pow(0.5f, 2.f), std::pow(1.25f, 0.25f), std::pow(3.f, -1.f),
+									   std::pow(100.f, 7.f)));
+		ASSERT_EQ(positive.powed(2.f), vec4(0.25f, 1.5625f, 9.f, 10000.f));
+		ASSERT_EQ(ivec2(3, -2).powed(2), ivec2(9, 4));
+
+		mstd::rsqrt(static_cast<const float*>(positive), &expected[0], 4);
+		ASSERT_EQ(mstd::rsqrt(positive), expected);
+		mstd::rcp<math_precision::fast>(static_cast<const float*>(b), &expected[0], 4);
+		ASSERT_EQ(mstd::rcp<math_precision::fast>(b), expected);
+	}
+
+	TEST(ARITHMETIC_TESTS_SIMD_MATH, NORMALIZE_FAST) {
+		double t = 0.3;
+			for (size_t i = 0; i != 1000; ++i) {
+				t = t + 0.6180339887498949 - std::floor(t + 0.6180339887498949);
+				const dvec3 d(t * 10.0 - 5.0, std::fmod(t * 37.0, 4.0) - 2.0, 1e-3 + t);
+				const vec3 f(static_cast<float>(d[0]), static_cast<float>(d[1]), static_cast<float>(d[2]));
+				ASSERT_NEAR(f.normalized_fast().length(), 1.f, 4e-7f) << f[0] << ", " << f[1] << ", " << f[2];
+				ASSERT_NEAR(d.normalized_fast().length(), 1.0, 5e-14) << d[0] << ", " << d[1] << ", " << d[2];
+
+				const vec3 direction = f.normalized();
+				const vec3 fast		 = f.normalized_fast();
+					for (size_t j = 0; j != 3; ++j) { ASSERT_NEAR(fast[j], direction[j], 4e-7f); }
+
+				const dquat q(d[0], d[1], d[2], t);
+				ASSERT_NEAR(q.normalized_fast().magnitude(), 1.0, 5e-14);
+			}
+
+		// zero vectors are left as they are, integral ones use normalize
+		ASSERT_EQ(vec3(0.f).normalized_fast(), vec3(0.f));
+		ASSERT_EQ(ivec2(0, 5).normalized_fast(), ivec2(0, 5).normalized());
+	}
+} // namespace mstd::test
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	template<size_t N, class T>
+	static void expect_tagged_near(const tagged_mat<N, T>& value, const mat<N, N, T>& expected) {
+			for (size_t x = 0; x != N; ++x) {
+					for (size_t y = 0; y != N; ++y) { EXPECT_NEAR(value.matrix()[x][y], expected[x][y], static_cast<T>(1e-5)); }
+			}
+	}
+
+	TEST(ARITHMETIC_TESTS_TAGGED_MAT, FACTORIES) {
+		using tmat4 = tagged_mat<4, float>;
+
+		EXPECT_EQ(tmat4().type(), transform_type::rigid);
+		EXPECT_TRUE(tmat4().matrix().is_identity());
+		EXPECT_EQ(tmat4::translation({ 1.f, 2.f, 3.f }).type(), transform_type::rigid);
+		EXPECT_EQ(tmat4::rot_x(0.5f).type(), transform_type::rigid);
+		EXPECT_EQ(tmat4::rot({ 1.f, 1.f, 0.f }, 0.5f).type(), transform_type::rigid);
+		EXPECT_EQ(tmat4::rot(fquat::rotation(vec3(0.f, 1.f, 0.f), 0.5f)).type(), transform_type::rigid);
+		EXPECT_EQ(tmat4::scale({ 1.f, 2.f, 3.f }).type(), transform_type::affine);
+		EXPECT_EQ(tmat4::look_at({ 0.f, 0.f, 5.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }).type(), transform_type::affine);
+		EXPECT_EQ(tmat4(mat4::perspective(1.f, 1.f, 0.1f, 100.f)).type(), transform_type::general);
+
+		// uniform scale keeps w at 1 so the result stays affine
+		EXPECT_TRUE(tmat4::scale(2.f).matrix().is_affine());
+		EXPECT_EQ(tmat4::scale(2.f).matrix()[3u][3u], 1.f);
+	}
+
+	TEST(ARITHMETIC_TESTS_TAGGED_MAT, COMPOSITION) {
+		using tmat4 = tagged_mat<4, float>;
+
+		const tmat4 rigid	= tmat4::translation({ 1.f, 2.f, 3.f }) * tmat4::rot_y(0.4f);
+		const tmat4 affine	= rigid * tmat4::scale({ 2.f, 1.f, 1.f });
+		const tmat4 general = tmat4(mat4::perspective(1.f, 1.f, 0.1f, 100.f)) * rigid;
+
+		EXPECT_EQ(rigid.type(), transform_type::rigid);
+		EXPECT_EQ(affine.type(), transform_type::affine);
+		EXPECT_EQ(general.type(), transform_type::general);
+		expect_tagged_near(affine, mat4::translation({ 1.f, 2.f, 3.f }) * mat4::rot_y(0.4f) * mat4::scale({ 2.f, 1.f, 1.f }));
+
+		const vec4 point(1.f, 2.f, 3.f, 1.f);
+		EXPECT_TRUE(affine * point == affine.matrix() * point);
+
+		tmat4 value = rigid;
+		value	   *= tmat4::scale(3.f);
+		EXPECT_EQ(value.type(), transform_type::affine);
+	}
+
+	TEST(ARITHMETIC_TESTS_TAGGED_MAT, INVERTED) {
+		using tmat4 = tagged_mat<4, float>;
+
+		const tmat4 rigid = tmat4::translation({ 1.f, 2.f, 3.f }) * tmat4::rot({ 0.f, 1.f, 1.f }, 0.8f);
+		const tmat4 inv	  = rigid.inverted();
+		EXPECT_EQ(inv.type(), transform_type::rigid);
+		EXPECT_TRUE(inv.matrix() == rigid.matrix().inverted_rigid());
+		expect_tagged_near(rigid * inv, mat4::identity());
+
+		const tmat4 affine = rigid * tmat4::scale({ 2.f, 4.f, 0.5f });
+		EXPECT_EQ(affine.inverted().type(), transform_type::affine);
+		expect_tagged_near(affine * affine.inverted(), mat4::identity());
+
+		tmat4 general = tmat4(mat4::perspective(1.f, 1.f, 0.1f, 100.f));
+		general.invert();
+		EXPECT_EQ(general.type(), transform_type::general);
+		expect_tagged_near(general, mat4::perspective(1.f, 1.f, 0.1f, 100.f).inverted());
+
+		const tagged_mat<3, double> m2d = tagged_mat<3, double>::translation({ 1.0, 2.0 }) * tagged_mat<3, double>::scale(2.0);
+		expect_tagged_near(m2d * m2d.inverted(), dmat3::identity());
+	}
+} // namespace mstd::test
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	// odd count above the chunk size so the SIMD body, the scalar tail and chunking are used
+	static constexpr size_t soa_count = 301;
+
+	template<size_t N, class T>
+	static std::vector<vec<N, T>> make_soa_vecs(size_t count, T offset) {
+		std::vector<vec<N, T>> res(count);
+			for (size_t i = 0; i != count; ++i) {
+					for (size_t c = 0; c != N; ++c) {
+						res[i][c] = static_cast<T>(((i * 7 + c * 3) % 11)) - static_cast<T>(5) + offset;
+					}
+			}
+		return res;
+	}
+
+	template<size_t N, class T>
+	static vec_soa<N, T> to_soa(const std::vector<vec<N, T>>& values) {
+		vec_soa<N, T> res;
+			for (const auto& value : values) { res.push_back(value); }
+		return res;
+	}
+
+	TEST(ARITHMETIC_TESTS_VEC_SOA, ELEMENTS) {
+		vec_soa<3, float> soa = { vec3(1.f, 2.f, 3.f), vec3(4.f, 5.f, 6.f) };
+		ASSERT_EQ(soa.size(), 2u);
+		ASSERT_FALSE(soa.empty());
+
+		// const view
+		const auto& constSoa = soa;
+		ASSERT_EQ(constSoa[1], vec3(4.f, 5.f, 6.f));
+		ASSERT_FLOAT_EQ(constSoa[0].y(), 2.f);
+
+		// element view writes through to the lanes
+		soa[0].x() = 7.f;
+		soa[0] += vec3(1.f, 1.f, 1.f);
+		ASSERT_FLOAT_EQ(soa.lane(0)[0], 8.f);
+		ASSERT_FLOAT_EQ(soa.lane(1)[0], 3.f);
+		ASSERT_FLOAT_EQ(soa.lane(2)[0], 4.f);
+
+		soa[1] = vec3(0.f, 3.f, 4.f);
+		ASSERT_FLOAT_EQ(soa[1].length(), 5.f);
+		ASSERT_FLOAT_EQ(soa[1].dot(vec3(1.f, 1.f, 1.f)), 7.f);
+
+		vec3 copy = soa.back();
+		ASSERT_EQ(copy, vec3(0.f, 3.f, 4.f));
+		ASSERT_EQ(soa.get(0), vec3(8.f, 3.f, 4.f));
+
+		soa.set(0, vec3(1.f, 1.f, 1.f));
+		soa.pop_back();
+		ASSERT_EQ(soa.size(), 1u);
+		ASSERT_EQ(soa.front(), vec3(1.f, 1.f, 1.f));
+
+		soa.resize(3, vec3(2.f, 2.f, 2.f));
+		ASSERT_EQ(soa[2], vec3(2.f, 2.f, 2.f));
+
+		soa.clear();
+		ASSERT_TRUE(soa.empty());
+	}
+
+	TEST(ARITHMETIC_TESTS_VEC_SOA, ARITHMETIC) {
+		auto aVecs = make_soa_vecs<4, float>(soa_count, 0.5f);
+		auto bVecs = make_soa_vecs<4, float>(soa_count, 7.f);
+		auto a	   = to_soa(aVecs);
+		auto b	   = to_soa(bVecs);
+
+		auto sum   = a + b;
+		auto diff  = a - b;
+		auto prod  = a * b;
+		auto quot  = a / b;
+		auto moved = a + vec4(1.f, 2.f, 3.f, 4.f);
+		auto scale = a * 2.f;
+		auto fused = fma(a, b, b);
+			for (size_t i = 0; i != soa_count; ++i) {
+				ASSERT_EQ(sum[i], aVecs[i] + bVecs[i]);
+				ASSERT_EQ(diff[i], aVecs[i] - bVecs[i]);
+				ASSERT_EQ(prod[i], aVecs[i] * bVecs[i]);
+				ASSERT_EQ(moved[i], aVecs[i] + vec4(1.f, 2.f, 3.f, 4.f));
+				ASSERT_EQ(scale[i], aVecs[i] * 2.f);
+					for (size_t c = 0; c != 4; ++c) {
+						ASSERT_FLOAT_EQ(quot[i][c], aVecs[i][c] / bVecs[i][c]);
+						ASSERT_FLOAT_EQ(fused[i][c], aVecs[i][c] * bVecs[i][c] + bVecs[i][c]);
+					}
+			}
+
+		// mismatched sizes only touch the common part
+		vec_soa<4, float> shortSoa(3, vec4(1.f, 1.f, 1.f, 1.f));
+		auto partial = a + shortSoa;
+		ASSERT_EQ(partial[2], aVecs[2] + vec4(1.f, 1.f, 1.f, 1.f));
+		ASSERT_EQ(partial[3], aVecs[3]);
+	}
+
+	TEST(ARITHMETIC_TESTS_VEC_SOA, VECTOR_OPERATIONS) {
+		auto aVecs		= make_soa_vecs<3, double>(soa_count, 0.25);
+		auto bVecs		= make_soa_vecs<3, double>(soa_count, 1.5);
+		auto a			= to_soa(aVecs);
+		auto b			= to_soa(bVecs);
+
+		auto dots		= a.dot(b);
+		auto lengths	= a.length();
+		auto normalized = a.normalized();
+		auto crossed	= cross(a, b);
+		auto clampped	= a.clampped(-1.0, 1.0);
+		auto lerped		= lerp(a, b, 0.25);
+		ASSERT_EQ(dots.size(), soa_count);
+			for (size_t i = 0; i != soa_count; ++i) {
+				ASSERT_NEAR(dots[i], aVecs[i].dot(bVecs[i]), 1e-12);
+				ASSERT_NEAR(lengths[i], aVecs[i].length(), 1e-12);
+				ASSERT_NEAR(normalized[i].length(), 1.0, 1e-12);
+				ASSERT_EQ(clampped[i], aVecs[i].clampped(-1.0, 1.0));
+
+				dvec3 expectedCross = aVecs[i].cross(bVecs[i]);
+					for (size_t c = 0; c != 3; ++c) {
+						ASSERT_NEAR(crossed[i][c], expectedCross[c], 1e-12);
+						ASSERT_NEAR(lerped[i][c], aVecs[i][c] + (bVecs[i][c] - aVecs[i][c]) * 0.25, 1e-12);
+					}
+			}
+
+		// zero length vectors stay unchanged
+		vec_soa<3, double> zeros(5);
+		zeros.normalize();
+		ASSERT_EQ(zeros[4], dvec3(0.0, 0.0, 0.0));
+	}
+
+	TEST(ARITHMETIC_TESTS_VEC_SOA, INTEGERS) {
+		auto aVecs = make_soa_vecs<2, int>(soa_count, 0);
+		auto a	   = to_soa(aVecs);
+
+		auto dots  = a.dot(a);
+		a		  += 3;
+		a.clamp(0, 4);
+			for (size_t i = 0; i != soa_count; ++i) {
+				ASSERT_EQ(dots[i], aVecs[i].dot(aVecs[i]));
+				ASSERT_EQ(a[i], (aVecs[i] + 3).clampped(0, 4));
+			}
+	}
+} // namespace mstd::test
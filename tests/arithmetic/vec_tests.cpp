@@ -273,4 +273,110 @@ namespace mstd::test {
 		ASSERT_FLOAT_EQ(v3[1u], -0.5f);
 		ASSERT_FLOAT_EQ(v3[2u], -0.5f);
 	}
+
+	#ifdef MSTD_TESTS_SIMD
+	// without SIMD kernels the SIMD test build would compare the scalar kernels with themselves
+	static_assert(_MSTD_HAS_SIMD, "the SIMD tests need an instruction set with SIMD kernels");
+	#endif
+
+	template<size_t N, class T>
+	static void check_vec_kernels(const vec<N, T>& a, const vec<N, T>& b) {
+		using scalar = utils::scalar_vec_kernels<N, T>;
+
+		T expected[N];
+		T lhs[N];
+		T rhs[N];
+			for (size_t i = 0; i != N; ++i) {
+				lhs[i] = a[i];
+				rhs[i] = b[i];
+			}
+
+		auto checkEq = [&](const vec<N, T>& res) {
+				for (size_t i = 0; i != N; ++i) { ASSERT_DOUBLE_EQ(res[i], expected[i]); }
+		};
+
+		std::copy_n(lhs, N, expected);
+		scalar::add(expected, rhs);
+		checkEq(a + b);
+
+		std::copy_n(lhs, N, expected);
+		scalar::sub(expected, rhs);
+		checkEq(a - b);
+
+		std::copy_n(lhs, N, expected);
+		scalar::mul(expected, rhs);
+		checkEq(a * b);
+
+		std::copy_n(lhs, N, expected);
+		scalar::div(expected, rhs);
+		checkEq(a / b);
+
+		std::copy_n(lhs, N, expected);
+		scalar::mul(expected, static_cast<T>(3));
+		checkEq(a * static_cast<T>(3));
+
+		std::copy_n(lhs, N, expected);
+		scalar::div(expected, static_cast<T>(4));
+		checkEq(a / static_cast<T>(4));
+
+		scalar::min(expected, lhs, rhs);
+		checkEq(min(a, b));
+
+		scalar::max(expected, lhs, rhs);
+		checkEq(max(a, b));
+
+		std::copy_n(lhs, N, expected);
+		scalar::clamp(expected, static_cast<T>(-1), static_cast<T>(1));
+		checkEq(a.clampped(static_cast<T>(-1), static_cast<T>(1)));
+
+		std::copy_n(lhs, N, expected);
+		scalar::clamp(expected, rhs, rhs);
+		checkEq(a.clampped(b, b));
+
+		ASSERT_DOUBLE_EQ(a.dot(b), scalar::dot(lhs, rhs));
+		ASSERT_DOUBLE_EQ(a.length(), static_cast<T>(std::sqrt(scalar::dot(lhs, lhs))));
+			if constexpr (std::is_floating_point_v<T>) { ASSERT_NEAR(a.normalized().length(), static_cast<T>(1), 1e-6); }
+
+		// padding lanes must not leak into results
+		vec<N, T> c = a / b;
+		c			= c * static_cast<T>(2) + b;
+		ASSERT_DOUBLE_EQ(c.dot(c), (a / b * static_cast<T>(2) + b).dot(a / b * static_cast<T>(2) + b));
+	}
+
+	TEST(ARITHMETIC_TESTS_VEC, KERNELS) {
+		check_vec_kernels(vec4(1.5f, -2.f, 3.25f, 0.5f), vec4(0.25f, 4.f, -1.f, 2.f));
+		check_vec_kernels(vec3(1.5f, -2.f, 3.25f), vec3(0.25f, 4.f, -1.f));
+		check_vec_kernels(dvec4(1.5, -2.0, 3.25, 0.5), dvec4(0.25, 4.0, -1.0, 2.0));
+		check_vec_kernels(ivec4(1, -2, 3, 5), ivec4(2, 4, -1, 2));
+
+		ASSERT_EQ(reinterpret_cast<uintptr_t>(static_cast<const float*>(vec4())) % alignof(vec4), 0u);
+	}
+
+	TEST(ARITHMETIC_TESTS_VEC, DOUBLE_POW_EXACT) {
+			for (int base = 1; base != 11; ++base) {
+					for (int exponent = 0; exponent != 11; ++exponent) {
+						const double expected = std::pow(static_cast<double>(base), static_cast<double>(exponent));
+
+						dvec3 scalar = dvec3::fill(static_cast<double>(base)).powed(static_cast<double>(exponent));
+						ASSERT_EQ(scalar.x(), expected);
+						ASSERT_EQ(scalar.z(), expected);
+
+						dvec4 lanes = dvec4::fill(static_cast<double>(base)).powed(dvec4::fill(static_cast<double>(exponent)));
+						ASSERT_EQ(lanes.w(), expected);
+					}
+			}
+
+		ASSERT_EQ(dvec3::fill(2.0).powed(3.0).y(), 8.0);
+	}
+
+		#if _MSTD_HAS_CXX20
+	TEST(ARITHMETIC_TESTS_VEC, CONSTEXPR_KERNELS) {
+		constexpr vec4 v = (vec4(1.f, 2.f, 3.f, 4.f) + 1.f) * 2.f;
+		static_assert(v.dot(v) == 16.f + 36.f + 64.f + 100.f);
+
+		constexpr vec3 c = min(vec3(1.f, 5.f, 2.f), vec3(3.f, 0.f, 2.f)).clampped(0.5f, 1.5f);
+		static_assert(c.x() == 1.f && c.y() == 0.5f && c.z() == 1.5f);
+		ASSERT_FLOAT_EQ(v.length(), std::sqrt(216.f));
+	}
+		#endif
 } // namespace mstd::test
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+
+namespace mstd::test {
+	// forwards to new/delete and counts what reaches it
+	class counting_resource : public std::pmr::memory_resource {
+	public:
+		size_t allocations	 = 0;
+		size_t deallocations = 0;
+
+	protected:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			++allocations;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+			++deallocations;
+			std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+		}
+
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+	};
+
+	class ArenaResourceTest : public ::testing::Test {
+	protected:
+		counting_resource upstream;
+	};
+
+	TEST_F(ArenaResourceTest, AllocationsAreAlignedAndDistinct) {
+		mstd::arena_resource arena(256, &upstream);
+
+		void* a = arena.allocate(3, 1);
+		void* b = arena.allocate(8, 8);
+		void* c = arena.allocate(16, 64);
+
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 8, 0);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(c) % 64, 0);
+		EXPECT_GE(static_cast<std::byte*>(b), static_cast<std::byte*>(a) + 3);
+		EXPECT_GE(static_cast<std::byte*>(c), static_cast<std::byte*>(b) + 8);
+		EXPECT_EQ(arena.bytes_allocated(), 27);
+		EXPECT_EQ(upstream.allocations, 1);
+	}
+
+	TEST_F(ArenaResourceTest, BlocksGrowGeometrically) {
+		mstd::arena_resource arena(256, &upstream);
+
+			for (size_t i = 0; i != 1000; ++i) { EXPECT_NE(arena.allocate(64, 8), nullptr); }
+
+		// 64000 bytes from blocks of 256, 512, 1024, ... take 8 blocks
+		EXPECT_EQ(upstream.allocations, 8);
+		EXPECT_EQ(arena.block_count(), 8);
+
+		// larger than any block, gets a block of its own size
+		void* big = arena.allocate(1 << 20, 16);
+		EXPECT_NE(big, nullptr);
+		EXPECT_EQ(arena.block_count(), 9);
+	}
+
+	TEST_F(ArenaResourceTest, ResetMergesBlocks) {
+		mstd::arena_resource arena(256, &upstream);
+
+			for (size_t i = 0; i != 100; ++i) { EXPECT_NE(arena.allocate(64, 8), nullptr); }
+		const size_t blocks = upstream.allocations;
+		EXPECT_GT(blocks, 1);
+
+		// the blocks are merged into one
+		arena.reset();
+		EXPECT_EQ(arena.block_count(), 1);
+		EXPECT_EQ(arena.bytes_allocated(), 0);
+		EXPECT_EQ(upstream.deallocations, blocks);
+		EXPECT_EQ(upstream.allocations, blocks + 1);
+
+			// the same round again fits in it
+			for (size_t i = 0; i != 100; ++i) { EXPECT_NE(arena.allocate(64, 8), nullptr); }
+		EXPECT_EQ(upstream.allocations, blocks + 1);
+
+		arena.reset();
+		EXPECT_EQ(upstream.allocations, blocks + 1);
+	}
+
+	TEST_F(ArenaResourceTest, ReleaseReturnsEveryBlock) {
+		{
+			mstd::arena_resource arena(256, &upstream);
+				for (size_t i = 0; i != 100; ++i) { EXPECT_NE(arena.allocate(64, 8), nullptr); }
+
+			arena.release();
+			EXPECT_EQ(arena.block_count(), 0);
+			EXPECT_EQ(upstream.deallocations, upstream.allocations);
+
+			EXPECT_NE(arena.allocate(64, 8), nullptr);
+		}
+		EXPECT_EQ(upstream.deallocations, upstream.allocations);
+	}
+
+	TEST_F(ArenaResourceTest, InitialBufferIsUsedFirst) {
+		alignas(std::max_align_t) std::byte buffer[1024];
+		mstd::arena_resource arena(buffer, sizeof(buffer), &upstream);
+
+		std::pmr::vector<int> values(&arena);
+		values.reserve(128);
+			for (int i = 0; i != 128; ++i) { values.push_back(i); }
+
+		EXPECT_GE(static_cast<void*>(values.data()), static_cast<void*>(buffer));
+		EXPECT_LT(static_cast<void*>(values.data()), static_cast<void*>(buffer + sizeof(buffer)));
+		EXPECT_EQ(upstream.allocations, 0);
+
+		// past the buffer the arena falls back to the upstream resource
+		values.reserve(1024);
+		EXPECT_EQ(upstream.allocations, 1);
+	}
+} // namespace mstd::test
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <pch.hpp>
+#include <random>
+#include "pmr_test_utils.hpp"
 
 namespace mstd::test {
 	class BimapTest : public ::testing::Test {
@@ -86,4 +88,43 @@ namespace mstd::test {
 		bm1.clear();
 		EXPECT_NE(bm1, bm2);
 	}
+
+	TEST_F(BimapTest, ChurnKeepsBothSidesConsistent) {
+		mstd::unordered_bimap<int, int> numbers;
+		std::mt19937 gen(17);
+
+			for (int step = 0; step != 5000; ++step) {
+				const int key	= static_cast<int>(gen() % 64);
+				const int value = static_cast<int>(gen() % 64);
+					switch (gen() % 3) {
+						case 0: numbers.erase(key); break;
+						case 1: numbers.erase_value(value); break;
+						default: numbers.insert({ key, value }); break;
+					}
+			}
+
+			for (const auto& pair : numbers) {
+				ASSERT_EQ(numbers.at(pair.first), pair.second);
+				ASSERT_EQ(numbers.at_value(pair.second), pair.first);
+			}
+	}
+
+	TEST_F(BimapTest, PmrAllocatorReachesEveryStorage) {
+		// the ordered_map indexes need the allocator too
+		check_pmr_allocator_reaches_every_storage([](std::pmr::memory_resource* resource) {
+			mstd::pmr::ordered_bimap<int, int> pmrOrdered(resource);
+			mstd::pmr::unordered_bimap<int, int> pmrUnordered(resource);
+			mstd::pmr::bimap<int, int> pmrTree(resource);
+				for (int i = 0; i != 100; ++i) {
+					pmrOrdered.insert({ i, -i });
+					pmrUnordered.insert({ i, -i });
+					pmrTree.insert({ i, -i });
+				}
+			pmrOrdered.erase(10);
+			EXPECT_EQ(pmrOrdered.size(), 99);
+			EXPECT_EQ(pmrOrdered.at_value(-20), 20);
+			EXPECT_EQ(pmrUnordered.at(30), -30);
+			EXPECT_EQ(pmrTree.at_value(-40), 40);
+		});
+	}
 } // namespace mstd::test
\ No newline at end of file
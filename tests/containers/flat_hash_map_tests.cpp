@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include "pmr_test_utils.hpp"
+
+namespace mstd::test {
+	class FlatHashMapTest : public ::testing::Test {
+	protected:
+		mstd::flat_hash_map<std::string, int> map;
+	};
+
+	// every key lands in the same group, probing and tombstones do all the work
+	struct FlatHashMapCollidingHash {
+		size_t operator()(int) const noexcept { return 42; }
+	};
+
+	TEST_F(FlatHashMapTest, DefaultConstructorIsEmpty) {
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(map.size(), 0);
+		EXPECT_EQ(map.begin(), map.end());
+		EXPECT_FALSE(map.contains("a"));
+	}
+
+	TEST_F(FlatHashMapTest, InsertFindErase) {
+		EXPECT_TRUE(map.insert({ "one", 1 }).second);
+		EXPECT_TRUE(map.insert({ "two", 2 }).second);
+		EXPECT_EQ(map.size(), 2);
+
+		ASSERT_NE(map.find("one"), map.end());
+		EXPECT_EQ(map.find("one")->second, 1);
+		EXPECT_EQ(map.at("two"), 2);
+		EXPECT_EQ(map.count("two"), 1);
+		EXPECT_EQ(map.find("three"), map.end());
+
+		EXPECT_EQ(map.erase("one"), 1);
+		EXPECT_EQ(map.erase("one"), 0);
+		EXPECT_FALSE(map.contains("one"));
+		EXPECT_EQ(map.size(), 1);
+	}
+
+	TEST_F(FlatHashMapTest, InsertKeepsExistingValue) {
+		map.insert({ "key", 1 });
+
+		auto result = map.insert({ "key", 2 });
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ(result.first->second, 1);
+
+		EXPECT_FALSE(map.insert_or_assign("key", 3).second);
+		EXPECT_EQ(map.at("key"), 3);
+
+		std::string key(64, 'k');
+		EXPECT_TRUE(map.insert_or_assign(std::move(key), 4).second);
+		EXPECT_EQ(map.at(std::string(64, 'k')), 4);
+		EXPECT_EQ(map.erase(std::string(64, 'k')), 1);
+
+		map["other"] += 5;
+		EXPECT_EQ(map.at("other"), 5);
+		EXPECT_EQ(map.size(), 2);
+	}
+
+	TEST_F(FlatHashMapTest, GrowsAndKeepsEveryElement) {
+		mstd::flat_hash_map<int, int> numbers;
+			for (int i = 0; i != 10000; ++i) { numbers.insert({ i, i * 2 }); }
+
+		EXPECT_EQ(numbers.size(), 10000);
+		EXPECT_GE(numbers.capacity(), numbers.size());
+		EXPECT_EQ(numbers.capacity() & (numbers.capacity() - 1), 0);
+			for (int i = 0; i != 10000; ++i) { ASSERT_EQ(numbers.at(i), i * 2); }
+
+		size_t visited = 0;
+			for (const auto& pair : numbers) {
+				EXPECT_EQ(pair.second, pair.first * 2);
+				++visited;
+			}
+		EXPECT_EQ(visited, numbers.size());
+	}
+
+	TEST_F(FlatHashMapTest, ReserveAvoidsRehash) {
+		mstd::flat_hash_map<int, int> numbers;
+		numbers.reserve(1000);
+		const size_t capacity = numbers.capacity();
+
+			for (int i = 0; i != 1000; ++i) { numbers.insert({ i, i }); }
+		EXPECT_EQ(numbers.capacity(), capacity);
+	}
+
+	TEST_F(FlatHashMapTest, ChurnMatchesUnorderedMap) {
+		mstd::flat_hash_map<int, int> numbers;
+		std::unordered_map<int, int> model;
+		std::mt19937 gen(1234);
+
+			for (int step = 0; step != 50000; ++step) {
+				const int key = static_cast<int>(gen() % 512);
+					if (gen() % 2 == 0) {
+						numbers[key] = step;
+						model[key]	 = step;
+					}
+					else { ASSERT_EQ(numbers.erase(key), model.erase(key)); }
+			}
+
+		ASSERT_EQ(numbers.size(), model.size());
+			for (const auto& pair : model) { ASSERT_EQ(numbers.at(pair.first), pair.second); }
+			for (const auto& pair : numbers) { ASSERT_EQ(model.at(pair.first), pair.second); }
+	}
+
+	TEST_F(FlatHashMapTest, CollidingKeysStillFound) {
+		mstd::flat_hash_map<int, int, FlatHashMapCollidingHash> numbers;
+			for (int i = 0; i != 100; ++i) { numbers.insert({ i, -i }); }
+			for (int i = 0; i != 100; i += 2) { numbers.erase(i); }
+
+		EXPECT_EQ(numbers.size(), 50);
+			for (int i = 0; i != 100; ++i) { EXPECT_EQ(numbers.contains(i), i % 2 == 1); }
+
+		numbers.insert({ 0, 7 });
+		EXPECT_EQ(numbers.at(0), 7);
+	}
+
+	TEST_F(FlatHashMapTest, EraseByIteratorReturnsNext) {
+		mstd::flat_hash_map<int, int> numbers = {
+			{ 1, 1 },
+			{ 2, 2 },
+			{ 3, 3 }
+		};
+
+		size_t visited = 0;
+			for (auto it = numbers.begin(); it != numbers.end(); ++visited) {
+					if (it->first != 2) { it = numbers.erase(it); }
+					else { ++it; }
+			}
+
+		EXPECT_EQ(visited, 3);
+		EXPECT_EQ(numbers.size(), 1);
+		EXPECT_TRUE(numbers.contains(2));
+	}
+
+	TEST_F(FlatHashMapTest, CopyMoveAndEquality) {
+		map = {
+			{ "a", 1 },
+			{ "b", 2 }
+		};
+
+		mstd::flat_hash_map<std::string, int> copy = map;
+		EXPECT_EQ(copy, map);
+
+		copy["c"] = 3;
+		EXPECT_NE(copy, map);
+
+		mstd::flat_hash_map<std::string, int> moved = std::move(copy);
+		EXPECT_EQ(moved.size(), 3);
+		EXPECT_EQ(moved.at("c"), 3);
+
+		map = moved;
+		EXPECT_EQ(map, moved);
+
+		map.clear();
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(map.begin(), map.end());
+	}
+
+	TEST_F(FlatHashMapTest, MoveOnlyValues) {
+		mstd::flat_hash_map<int, std::unique_ptr<int> > pointers;
+			for (int i = 0; i != 100; ++i) { pointers.try_emplace(i, std::make_unique<int>(i)); }
+
+		EXPECT_FALSE(pointers.try_emplace(5, std::make_unique<int>(-1)).second);
+			for (int i = 0; i != 100; ++i) { ASSERT_EQ(*pointers.at(i), i); }
+	}
+
+	TEST_F(FlatHashMapTest, PmrAllocatorReachesEveryStorage) {
+		check_pmr_allocator_reaches_every_storage([](std::pmr::memory_resource* resource) {
+			mstd::pmr::flat_hash_map<int, int> numbers(resource);
+				for (int i = 0; i != 1000; ++i) { numbers.insert({ i, -i }); }
+			numbers.erase(10);
+			EXPECT_EQ(numbers.size(), 999);
+			EXPECT_EQ(numbers.at(20), -20);
+		});
+	}
+} // namespace mstd::test
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <random>
+#include "pmr_test_utils.hpp"
+
+namespace mstd::test {
+	class FlatHashSetTest : public ::testing::Test {
+	protected:
+		mstd::flat_hash_set<int> set;
+	};
+
+	TEST_F(FlatHashSetTest, DefaultConstructorIsEmpty) {
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(set.size(), 0);
+		EXPECT_EQ(set.begin(), set.end());
+	}
+
+	TEST_F(FlatHashSetTest, InitializerListSkipsDuplicates) {
+		mstd::flat_hash_set<int> s = { 1, 2, 3, 2, 1 };
+		EXPECT_EQ(s.size(), 3);
+		EXPECT_TRUE(s.contains(1));
+		EXPECT_TRUE(s.contains(2));
+		EXPECT_TRUE(s.contains(3));
+	}
+
+	TEST_F(FlatHashSetTest, InsertFindErase) {
+		EXPECT_TRUE(set.insert(10).second);
+		EXPECT_FALSE(set.insert(10).second);
+		EXPECT_TRUE(set.emplace(20).second);
+
+		ASSERT_NE(set.find(20), set.end());
+		EXPECT_EQ(*set.find(20), 20);
+		EXPECT_EQ(set.find(30), set.end());
+		EXPECT_EQ(set.count(10), 1);
+
+		EXPECT_EQ(set.erase(10), 1);
+		EXPECT_EQ(set.erase(10), 0);
+		EXPECT_EQ(set.size(), 1);
+	}
+
+	TEST_F(FlatHashSetTest, ChurnMatchesUnorderedSet) {
+		std::unordered_set<int> model;
+		std::mt19937 gen(99);
+
+			for (int step = 0; step != 50000; ++step) {
+				const int value = static_cast<int>(gen() % 700);
+					if (gen() % 3 != 0) { ASSERT_EQ(set.insert(value).second, model.insert(value).second); }
+					else { ASSERT_EQ(set.erase(value), model.erase(value)); }
+			}
+
+		ASSERT_EQ(set.size(), model.size());
+			for (int value : set) { ASSERT_EQ(model.count(value), 1); }
+	}
+
+	TEST_F(FlatHashSetTest, StringsGrowAndCopy) {
+		mstd::flat_hash_set<std::string> strings;
+			for (int i = 0; i != 2000; ++i) { strings.insert(std::to_string(i)); }
+
+		mstd::flat_hash_set<std::string> copy = strings;
+		EXPECT_EQ(copy, strings);
+
+		copy.erase("1000");
+		EXPECT_NE(copy, strings);
+		EXPECT_FALSE(copy.contains("1000"));
+		EXPECT_TRUE(strings.contains("1000"));
+
+		mstd::flat_hash_set<std::string> moved = std::move(copy);
+		EXPECT_EQ(moved.size(), 1999);
+	}
+
+	TEST_F(FlatHashSetTest, PmrAllocatorReachesEveryStorage) {
+		check_pmr_allocator_reaches_every_storage([](std::pmr::memory_resource* resource) {
+			mstd::pmr::flat_hash_set<int> numbers(resource);
+				for (int i = 0; i != 1000; ++i) { numbers.insert(i); }
+			EXPECT_EQ(numbers.size(), 1000);
+			EXPECT_TRUE(numbers.contains(500));
+		});
+	}
+} // namespace mstd::test
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <list>
+#include <random>
+#include "pmr_test_utils.hpp"
+
+namespace mstd::test {
+	class LinkedOrderedMapTest : public ::testing::Test {
+	protected:
+		mstd::linked_ordered_map<std::string, int> map;
+
+		std::vector<std::string> keys() const {
+			std::vector<std::string> result;
+				for (const auto& pair : map) { result.push_back(pair.first); }
+			return result;
+		}
+	};
+
+	TEST_F(LinkedOrderedMapTest, DefaultConstructor) {
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(map.size(), 0);
+		EXPECT_EQ(map.begin(), map.end());
+	}
+
+	TEST_F(LinkedOrderedMapTest, InitializerListKeepsOrder) {
+		map = {
+			{ "one",	 1 },
+			{ "two",	 2 },
+			{ "three", 3 }
+		};
+		EXPECT_EQ(map.size(), 3);
+		EXPECT_EQ(map["two"], 2);
+		EXPECT_EQ(keys(), (std::vector<std::string>{ "one", "two", "three" }));
+	}
+
+	TEST_F(LinkedOrderedMapTest, InsertExistingKeyMovesBeforeWhere) {
+		map = {
+			{ "A", 1 },
+			{ "B", 2 },
+			{ "C", 3 },
+			{ "D", 4 }
+		};
+
+		map.insert(map.end(), { "A", 10 });
+		EXPECT_EQ(keys(), (std::vector<std::string>{ "B", "C", "D", "A" }));
+		EXPECT_EQ(map["A"], 10);
+
+		map.insert(map.find("C"), { "D", 40 });
+		EXPECT_EQ(keys(), (std::vector<std::string>{ "B", "D", "C", "A" }));
+
+		map.insert(map.begin(), { "E", 5 });
+		EXPECT_EQ(keys(), (std::vector<std::string>{ "E", "B", "D", "C", "A" }));
+		EXPECT_EQ(map.size(), 5);
+	}
+
+	TEST_F(LinkedOrderedMapTest, EraseKeyKeepsOrder) {
+		map = {
+			{ "X", 10 },
+			{ "Y", 20 },
+			{ "Z", 30 },
+			{ "W", 40 }
+		};
+
+		// X is moved into the hole of the dense array, the order has to stay
+		map.erase("X");
+		map.erase("missing");
+		EXPECT_EQ(keys(), (std::vector<std::string>{ "Y", "Z", "W" }));
+		EXPECT_FALSE(map.contains("X"));
+		EXPECT_EQ(map.at("W"), 40);
+
+		map.erase("W");
+		map.erase("Y");
+		EXPECT_EQ(keys(), (std::vector<std::string>{ "Z" }));
+		EXPECT_EQ(map.at("Z"), 30);
+	}
+
+	TEST_F(LinkedOrderedMapTest, EraseIteratorReturnsNext) {
+		map = {
+			{ "A", 1 },
+			{ "B", 2 },
+			{ "C", 3 },
+			{ "D", 4 }
+		};
+
+		auto it = map.erase(map.find("B"));
+		ASSERT_NE(it, map.end());
+		EXPECT_EQ(it->first, "C");
+
+		it = map.erase(map.find("D"));
+		EXPECT_EQ(it, map.end());
+
+		// the next element is the last one of the dense array and moves into the hole
+		map.insert_back({ "E", 5 });
+		it = map.erase(map.find("C"));
+		ASSERT_NE(it, map.end());
+		EXPECT_EQ(it->first, "E");
+		EXPECT_EQ(keys(), (std::vector<std::string>{ "A", "E" }));
+	}
+
+	TEST_F(LinkedOrderedMapTest, BidirectionalIteration) {
+		map = {
+			{ "A", 1 },
+			{ "B", 2 },
+			{ "C", 3 }
+		};
+
+		auto it = map.end();
+		EXPECT_EQ((--it)->first, "C");
+		EXPECT_EQ((--it)->first, "B");
+
+		std::vector<std::string> reversed;
+			for (auto rit = map.rbegin(); rit != map.rend(); ++rit) { reversed.push_back(rit->first); }
+		EXPECT_EQ(reversed, (std::vector<std::string>{ "C", "B", "A" }));
+
+		map.begin()->second = 100;
+		const auto& constMap											   = map;
+		mstd::linked_ordered_map<std::string, int>::const_iterator constIt = constMap.find("A");
+		EXPECT_EQ(constIt->second, 100);
+		EXPECT_EQ(constIt, map.begin());
+	}
+
+	TEST_F(LinkedOrderedMapTest, EqualityComparesOrder) {
+		mstd::linked_ordered_map<int, int> m1 = {
+			{ 1, 10 },
+			{ 2, 20 }
+		};
+		mstd::linked_ordered_map<int, int> m2 = {
+			{ 1, 10 },
+			{ 2, 20 }
+		};
+		mstd::linked_ordered_map<int, int> m3 = {
+			{ 2, 20 },
+			{ 1, 10 }
+		};
+
+		EXPECT_EQ(m1, m2);
+		EXPECT_NE(m1, m3);
+
+		// same order reached through different dense array layouts
+		m3.insert_back({ 2, 20 });
+		EXPECT_EQ(m1, m3);
+	}
+
+	TEST_F(LinkedOrderedMapTest, MatchesListModel) {
+		std::mt19937 gen(7);
+		std::uniform_int_distribution<int> keyDist(0, 63);
+		std::uniform_int_distribution<int> opDist(0, 3);
+
+		mstd::linked_ordered_map<int, int> container;
+		std::list<std::pair<int, int> > model;
+
+			for (int step = 0; step != 4000; ++step) {
+				const int key = keyDist(gen);
+				auto found	  = std::find_if(model.begin(), model.end(), [key](const auto& pair) { return pair.first == key; });
+					switch (opDist(gen)) {
+						case 0:
+							// touch, moves the key to the back
+							container.insert_back({ key, step });
+								if (found != model.end()) { model.erase(found); }
+							model.emplace_back(key, step);
+							break;
+						case 1:
+							// insert or move to the front
+							container.insert(container.begin(), { key, step });
+								if (found != model.end()) { model.erase(found); }
+							model.emplace_front(key, step);
+							break;
+						default:
+							container.erase(key);
+								if (found != model.end()) { model.erase(found); }
+							break;
+					}
+
+				ASSERT_EQ(container.size(), model.size());
+				ASSERT_TRUE(std::equal(container.begin(), container.end(), model.begin(), model.end()));
+			}
+	}
+
+	TEST_F(LinkedOrderedMapTest, ReinsertAndEraseAtPositions) {
+		std::mt19937 gen(9);
+		mstd::linked_ordered_map<int, int> container;
+		std::list<std::pair<int, int> > model;
+
+			for (int step = 0; step != 4000; ++step) {
+				const int key	   = static_cast<int>(gen() % 64);
+				const size_t where = model.empty() ? 0 : gen() % model.size();
+				auto target		   = std::next(model.begin(), static_cast<ptrdiff_t>(where));
+				auto found		   = std::find_if(model.begin(), model.end(), [key](const auto& pair) {
+					return pair.first == key;
+				});
+					if (gen() % 3 != 0) {
+						// an existing key moves before where and takes the new value
+						container.insert(std::next(container.cbegin(), static_cast<ptrdiff_t>(where)), { key, step });
+							if (found == model.end()) { model.emplace(target, key, step); }
+							else {
+								found->second = step;
+								model.splice(target, model, found);
+							}
+					}
+					else if (!model.empty()) {
+						// erasing from the middle moves the last node into the hole
+						auto next = container.erase(std::next(container.cbegin(), static_cast<ptrdiff_t>(where)));
+						target	  = model.erase(target);
+							if (target == model.end()) { ASSERT_EQ(next, container.end()); }
+							else { ASSERT_EQ(next->first, target->first); }
+					}
+
+				ASSERT_EQ(container.size(), model.size());
+				ASSERT_TRUE(std::equal(container.begin(), container.end(), model.begin(), model.end()));
+			}
+
+		// every key has to find its own node
+			for (const auto& pair : model) {
+				ASSERT_EQ(container.find(pair.first)->second, pair.second);
+				ASSERT_EQ(container.at(pair.first), pair.second);
+			}
+	}
+
+	TEST_F(LinkedOrderedMapTest, PmrAllocatorReachesEveryStorage) {
+		check_pmr_allocator_reaches_every_storage([](std::pmr::memory_resource* resource) {
+			mstd::pmr::linked_ordered_map<int, int> pmrMap(resource);
+				for (int i = 0; i != 100; ++i) { pmrMap[i] = i * 2; }
+			pmrMap.erase(50);
+			EXPECT_EQ(pmrMap.size(), 99);
+			EXPECT_EQ(pmrMap.at(99), 198);
+		});
+	}
+} // namespace mstd::test
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <list>
+#include <random>
+
+namespace mstd::test {
+	class LinkedOrderedSetTest : public ::testing::Test {
+	protected:
+		mstd::linked_ordered_set<int> set;
+
+		std::vector<int> values() const { return std::vector<int>(set.begin(), set.end()); }
+	};
+
+	TEST_F(LinkedOrderedSetTest, InitializerListMovesDuplicatesToBack) {
+		mstd::linked_ordered_set<int> s = { 1, 2, 3, 2, 1 };
+		EXPECT_EQ(s.size(), 3);
+		EXPECT_EQ(std::vector<int>(s.begin(), s.end()), (std::vector<int>{ 3, 2, 1 }));
+	}
+
+	TEST_F(LinkedOrderedSetTest, InsertAtPositions) {
+		set.insert(set.end(), 10);
+		set.insert(set.end(), 20);
+		set.insert(set.begin(), 5);
+		set.insert(set.find(20), 15);
+
+		EXPECT_EQ(values(), (std::vector<int>{ 5, 10, 15, 20 }));
+
+		// existing element moves before where
+		set.insert(set.begin(), 20);
+		EXPECT_EQ(values(), (std::vector<int>{ 20, 5, 10, 15 }));
+	}
+
+	TEST_F(LinkedOrderedSetTest, EraseKeepsOrder) {
+		set = { 10, 20, 30, 40 };
+		set.erase(10);
+		set.erase(99);
+
+		EXPECT_EQ(set.size(), 3);
+		EXPECT_FALSE(set.contains(10));
+		EXPECT_EQ(values(), (std::vector<int>{ 20, 30, 40 }));
+
+		auto it = set.erase(set.find(30));
+		ASSERT_NE(it, set.end());
+		EXPECT_EQ(*it, 40);
+		EXPECT_EQ(values(), (std::vector<int>{ 20, 40 }));
+	}
+
+	TEST_F(LinkedOrderedSetTest, FindAndReverseIteration) {
+		set = { 100, 200, 300 };
+
+		EXPECT_NE(set.find(200), set.end());
+		EXPECT_EQ(*set.find(200), 200);
+		EXPECT_EQ(set.find(500), set.end());
+
+		auto rit = set.rbegin();
+		EXPECT_EQ(*rit++, 300);
+		EXPECT_EQ(*rit++, 200);
+		EXPECT_EQ(*rit++, 100);
+		EXPECT_EQ(rit, set.rend());
+	}
+
+	TEST_F(LinkedOrderedSetTest, ReinsertAndEraseAtPositions) {
+		std::mt19937 gen(13);
+		std::list<int> model;
+
+			for (int step = 0; step != 4000; ++step) {
+				const int item	   = static_cast<int>(gen() % 64);
+				const size_t where = model.empty() ? 0 : gen() % model.size();
+				auto target		   = std::next(model.begin(), static_cast<ptrdiff_t>(where));
+					if (gen() % 3 != 0) {
+						// an existing element moves before where
+						set.insert(std::next(set.cbegin(), static_cast<ptrdiff_t>(where)), item);
+						auto found = std::find(model.begin(), model.end(), item);
+							if (found == model.end()) { model.insert(target, item); }
+							else { model.splice(target, model, found); }
+					}
+					else if (!model.empty()) {
+						// erasing from the middle moves the last node into the hole
+						auto next = set.erase(std::next(set.cbegin(), static_cast<ptrdiff_t>(where)));
+						target	  = model.erase(target);
+							if (target == model.end()) { ASSERT_EQ(next, set.end()); }
+							else { ASSERT_EQ(*next, *target); }
+					}
+
+				ASSERT_EQ(set.size(), model.size());
+				ASSERT_EQ(values(), std::vector<int>(model.begin(), model.end()));
+			}
+
+		// every item has to find its own node
+			for (const int item : model) { ASSERT_EQ(*set.find(item), item); }
+	}
+
+	TEST_F(LinkedOrderedSetTest, EqualityAndClear) {
+		mstd::linked_ordered_set<int> s1 = { 1, 2, 3 };
+		mstd::linked_ordered_set<int> s2 = { 1, 2, 3 };
+		mstd::linked_ordered_set<int> s3 = { 3, 2, 1 };
+
+		EXPECT_EQ(s1, s2);
+		EXPECT_NE(s1, s3);
+
+		s1.clear();
+		EXPECT_TRUE(s1.empty());
+		EXPECT_EQ(s1.begin(), s1.end());
+		EXPECT_FALSE(s1.contains(1));
+	}
+} // namespace mstd::test
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <pch.hpp>
+#include <random>
+#include "pmr_test_utils.hpp"
 
 namespace mstd::test {
 	class OrderedMapTest : public ::testing::Test {
@@ -118,4 +120,36 @@ namespace mstd::test {
 		EXPECT_EQ(map.size(), 0);
 		EXPECT_FALSE(map.contains("A"));
 	}
+
+	TEST_F(OrderedMapTest, IndexesFollowShiftedElements) {
+		mstd::ordered_map<int, int> numbers;
+		std::mt19937 gen(5);
+
+			for (int step = 0; step != 5000; ++step) {
+				const int key = static_cast<int>(gen() % 64);
+					if (gen() % 3 == 0) { numbers.erase(key); }
+					else {
+						const size_t where = numbers.empty() ? 0 : gen() % numbers.size();
+						numbers.insert(std::next(numbers.cbegin(), static_cast<ptrdiff_t>(where)), { key, step });
+					}
+			}
+
+		// every key has to find the element at its current position
+		size_t position = 0;
+			for (auto it = numbers.cbegin(); it != numbers.cend(); ++it, ++position) {
+				ASSERT_EQ(std::distance(numbers.begin(), numbers.find(it->first)), static_cast<ptrdiff_t>(position));
+				ASSERT_EQ(numbers.at(it->first), it->second);
+			}
+	}
+
+	TEST_F(OrderedMapTest, PmrAllocatorReachesEveryStorage) {
+		check_pmr_allocator_reaches_every_storage([](std::pmr::memory_resource* resource) {
+			mstd::pmr::ordered_map<int, int> pmrMap(resource);
+				for (int i = 0; i != 100; ++i) { pmrMap[i] = i * 2; }
+			pmrMap.erase(50);
+			EXPECT_EQ(pmrMap.size(), 99);
+			EXPECT_EQ(pmrMap.at(99), 198);
+			EXPECT_EQ(pmrMap.get_allocator().resource(), resource);
+		});
+	}
 } // namespace mstd::test
\ No newline at end of file
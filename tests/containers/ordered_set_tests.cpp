@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <pch.hpp>
+#include <random>
+#include "pmr_test_utils.hpp"
 
 namespace mstd::test {
 	class OrderedSetTest : public ::testing::Test {
@@ -98,4 +100,51 @@ namespace mstd::test {
 		EXPECT_EQ(set.size(), 0);
 		EXPECT_FALSE(set.contains(1));
 	}
+
+	TEST_F(OrderedSetTest, IndexesFollowShiftedElements) {
+		std::mt19937 gen(5);
+		std::unordered_set<int> present;
+
+			for (int step = 0; step != 5000; ++step) {
+				const int item = static_cast<int>(gen() % 64);
+				const size_t where = set.empty() ? 0 : gen() % set.size();
+					switch (gen() % 3) {
+						case 0:
+							// reinsert or insert at a random position
+							set.insert(std::next(set.cbegin(), static_cast<ptrdiff_t>(where)), item);
+							present.insert(item);
+							break;
+						case 1:
+								if (!set.empty()) {
+									// erase from the middle, shifting every element after it
+									const int erased = *std::next(set.cbegin(), static_cast<ptrdiff_t>(where));
+									set.erase(erased);
+									present.erase(erased);
+								}
+							break;
+						default:
+							set.insert_back(item);
+							present.insert(item);
+							break;
+					}
+			}
+
+		// every item has to find itself at its current position
+		ASSERT_EQ(set.size(), present.size());
+		size_t position = 0;
+			for (auto it = set.cbegin(); it != set.cend(); ++it, ++position) {
+				ASSERT_EQ(std::distance(set.begin(), set.find(*it)), static_cast<ptrdiff_t>(position));
+			}
+	}
+
+	TEST_F(OrderedSetTest, PmrAllocatorReachesEveryStorage) {
+		check_pmr_allocator_reaches_every_storage([](std::pmr::memory_resource* resource) {
+			mstd::pmr::ordered_set<int> pmrSet({ 3, 1, 2 }, resource);
+				for (int i = 10; i != 100; ++i) { pmrSet.insert_back(i); }
+			pmrSet.erase(1);
+			EXPECT_EQ(pmrSet.size(), 92);
+			EXPECT_EQ(*pmrSet.begin(), 3);
+			EXPECT_EQ(pmrSet.get_allocator().resource(), resource);
+		});
+	}
 } // namespace mstd::test
\ No newline at end of file
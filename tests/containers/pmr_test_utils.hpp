@@ -0,0 +1,22 @@
+#pragma once
+#ifndef _MSTD_TESTS_PMR_TEST_UTILS_HPP_
+	#define _MSTD_TESTS_PMR_TEST_UTILS_HPP_
+
+	#include <gtest/gtest.h>
+	#include <pch.hpp>
+
+namespace mstd::test {
+	// runs build(resource) with the default resource failing, so any storage missing the allocator throws
+	template<class Build>
+	inline void check_pmr_allocator_reaches_every_storage(Build&& build) {
+		mstd::arena_resource arena(1024, std::pmr::new_delete_resource());
+
+		std::pmr::memory_resource* previous = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+		EXPECT_NO_THROW(build(static_cast<std::pmr::memory_resource*>(&arena)));
+		std::pmr::set_default_resource(previous);
+
+		EXPECT_GT(arena.bytes_allocated(), 0);
+	}
+} // namespace mstd::test
+
+#endif // _MSTD_TESTS_PMR_TEST_UTILS_HPP_
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <memory>
+#include <random>
+#include "pmr_test_utils.hpp"
+
+namespace mstd::test {
+
+	class SlotMapTest : public ::testing::Test {
+	protected:
+		using handle = mstd::slot_map<int>::handle;
+
+		mstd::slot_map<int> container;
+	};
+
+	TEST_F(SlotMapTest, DefaultConstructorIsEmpty) {
+		EXPECT_TRUE(container.empty());
+		EXPECT_EQ(container.size(), 0);
+		EXPECT_FALSE(container.contains(handle()));
+		EXPECT_EQ(container.try_get(handle()), nullptr);
+	}
+
+	TEST_F(SlotMapTest, InsertReturnsResolvingHandles) {
+		const handle a = container.insert(10);
+		const handle b = container.insert(20);
+		const handle c = container.emplace(30);
+
+		EXPECT_EQ(container.size(), 3);
+		EXPECT_NE(a, b);
+		EXPECT_EQ(container.at(a), 10);
+		EXPECT_EQ(container[b], 20);
+		ASSERT_NE(container.try_get(c), nullptr);
+		EXPECT_EQ(*container.try_get(c), 30);
+	}
+
+	TEST_F(SlotMapTest, EraseMakesHandleStale) {
+		const handle a = container.insert(1);
+		const handle b = container.insert(2);
+
+		EXPECT_TRUE(container.erase(a));
+		EXPECT_FALSE(container.contains(a));
+		EXPECT_EQ(container.try_get(a), nullptr);
+		EXPECT_FALSE(container.erase(a));
+		EXPECT_EQ(container.at(b), 2);
+
+		// the slot is reused with a new generation, the old handle still does not resolve
+		const handle c = container.insert(3);
+		EXPECT_EQ(c.index, a.index);
+		EXPECT_NE(c.generation, a.generation);
+		EXPECT_EQ(container.try_get(a), nullptr);
+		EXPECT_EQ(container.at(c), 3);
+		EXPECT_EQ(container.slot_count(), 2);
+	}
+
+	TEST_F(SlotMapTest, DenseIterationAfterErase) {
+		std::vector<handle> handles;
+			for (int i = 0; i < 10; ++i) { handles.push_back(container.insert(i)); }
+			for (size_t i = 0; i < handles.size(); i += 3) { container.erase(handles[i]); }
+
+		std::vector<int> values(container.begin(), container.end());
+		std::sort(values.begin(), values.end());
+		EXPECT_EQ(values, std::vector<int>({ 1, 2, 4, 5, 7, 8 }));
+		EXPECT_EQ(container.data(), &*container.begin());
+
+			for (auto it = container.cbegin(); it != container.cend(); ++it) {
+				EXPECT_EQ(container.try_get(container.get_handle(it)), &*it);
+			}
+	}
+
+	TEST_F(SlotMapTest, EraseByIteratorKeepsPosition) {
+			for (int i = 0; i < 6; ++i) { container.insert(i); }
+
+			for (auto it = container.begin(); it != container.end();) {
+					if (*it % 2 == 0) { it = container.erase(it); }
+					else { ++it; }
+			}
+
+		std::vector<int> values(container.begin(), container.end());
+		std::sort(values.begin(), values.end());
+		EXPECT_EQ(values, std::vector<int>({ 1, 3, 5 }));
+	}
+
+	TEST_F(SlotMapTest, HandleValueRoundTrip) {
+		container.erase(container.insert(5));
+		const handle h = container.insert(6);
+
+		const handle copy = handle::from_value(h.value());
+		EXPECT_EQ(copy, h);
+		EXPECT_EQ(container.at(copy), 6);
+	}
+
+	TEST_F(SlotMapTest, ClearInvalidatesHandles) {
+		const handle a = container.insert(1);
+		const handle b = container.insert(2);
+		container.clear();
+
+		EXPECT_TRUE(container.empty());
+		EXPECT_FALSE(container.contains(a));
+		EXPECT_FALSE(container.contains(b));
+
+		const handle c = container.insert(3);
+		EXPECT_LT(c.index, 2u);
+		EXPECT_EQ(container.at(c), 3);
+	}
+
+	TEST_F(SlotMapTest, EmplaceMoveOnlyType) {
+		mstd::slot_map<std::unique_ptr<int> > pointers;
+		const auto a = pointers.emplace(new int(7));
+		const auto b = pointers.insert(std::make_unique<int>(8));
+		pointers.erase(a);
+
+		ASSERT_NE(pointers.try_get(b), nullptr);
+		EXPECT_EQ(**pointers.try_get(b), 8);
+	}
+
+	TEST_F(SlotMapTest, ChurnMatchesReference) {
+		std::mt19937 gen(11);
+		std::vector<std::pair<handle, int> > live;
+		std::vector<handle> dead;
+
+			for (int step = 0; step < 20000; ++step) {
+					if (live.empty() || gen() % 3 != 0) {
+						live.emplace_back(container.insert(step), step);
+						continue;
+					}
+
+				const size_t victim = gen() % live.size();
+				EXPECT_TRUE(container.erase(live[victim].first));
+				dead.push_back(live[victim].first);
+				live[victim] = live.back();
+				live.pop_back();
+			}
+
+		ASSERT_EQ(container.size(), live.size());
+			for (const auto& [h, value] : live) {
+				ASSERT_NE(container.try_get(h), nullptr);
+				EXPECT_EQ(*container.try_get(h), value);
+			}
+			for (const handle& h : dead) { EXPECT_EQ(container.try_get(h), nullptr); }
+	}
+
+	TEST_F(SlotMapTest, PmrAllocatorReachesEveryStorage) {
+		check_pmr_allocator_reaches_every_storage([](std::pmr::memory_resource* resource) {
+			mstd::pmr::slot_map<int> pmrSlots(resource);
+			auto first = pmrSlots.insert(1);
+				for (int i = 0; i != 100; ++i) { pmrSlots.insert(i); }
+			pmrSlots.erase(first);
+			EXPECT_EQ(pmrSlots.size(), 100);
+			EXPECT_FALSE(pmrSlots.contains(first));
+			EXPECT_EQ(pmrSlots.get_allocator().resource(), resource);
+		});
+	}
+} // namespace mstd::test
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <pch.hpp>
+#include "pmr_test_utils.hpp"
 
 namespace mstd::test {
 
@@ -268,4 +269,114 @@ namespace mstd::test {
 		container.erase(0);
 		EXPECT_EQ(container.active_slots(), 1);
 	}
-} // namespace mstd::test
\ No newline at end of file
+
+	// counts copies and moves, each copy stands for a buffer allocation of a heavy type
+	struct CountedValue {
+		static inline size_t copies = 0;
+		static inline size_t moves	= 0;
+
+		int value = 0;
+
+		CountedValue(int v) : value(v) {}
+
+		CountedValue(int a, int b) : value(a + b) {}
+
+		CountedValue(const CountedValue& other) : value(other.value) { ++copies; }
+
+		CountedValue(CountedValue&& other) noexcept : value(other.value) { ++moves; }
+
+		CountedValue& operator=(const CountedValue& other) {
+			value = other.value;
+			++copies;
+			return *this;
+		}
+
+		CountedValue& operator=(CountedValue&& other) noexcept {
+			value = other.value;
+			++moves;
+			return *this;
+		}
+
+		static void reset() {
+			copies = 0;
+			moves  = 0;
+		}
+	};
+
+	TEST_F(StableVectorTest, MoveInsertDoesNotCopy) {
+		mstd::stable_vector<CountedValue> c;
+		c.reserve(8);
+		CountedValue::reset();
+
+		c.insert(CountedValue(1));
+		c.insert_at(3, CountedValue(2));
+		c.push_back(CountedValue(3));
+		c.insert_at(3, CountedValue(4));
+
+		EXPECT_EQ(CountedValue::copies, 0);
+		EXPECT_EQ(CountedValue::moves, 4);
+		EXPECT_EQ(c.at(0).value, 1);
+		EXPECT_EQ(c.at(3).value, 4);
+		EXPECT_EQ(c.at(4).value, 3);
+	}
+
+	TEST_F(StableVectorTest, EmplaceConstructsInPlace) {
+		mstd::stable_vector<CountedValue> c;
+		c.reserve(8);
+		CountedValue::reset();
+
+		c.emplace(1, 2);
+		c.emplace_at(4, 3, 4);
+		c.emplace_back(5);
+		c.emplace_at(c.cbegin(), 6, 7);
+
+		EXPECT_EQ(CountedValue::copies, 0);
+		// replacing an existing element moves one temporary into it
+		EXPECT_EQ(CountedValue::moves, 1);
+		EXPECT_EQ(c.at(0).value, 13);
+		EXPECT_EQ(c.at(4).value, 7);
+		EXPECT_EQ(c.at(5).value, 5);
+	}
+
+	TEST_F(StableVectorTest, GrowthMovesNoexceptElements) {
+		mstd::stable_vector<CountedValue> c;
+		CountedValue::reset();
+
+			for (int i = 0; i < 100; ++i) { c.emplace_back(i); }
+			for (size_t id = 0; id < 100; id += 3) { c.erase(id); }
+
+		EXPECT_EQ(CountedValue::copies, 0);
+			for (size_t id = 1; id < 100; id += 3) { EXPECT_EQ(c.at(id).value, static_cast<int>(id)); }
+	}
+
+	TEST_F(StableVectorTest, InsertAtFreedIdsKeepsMapping) {
+		container = { 0, 10, 20, 30, 40 };
+		container.erase(1);
+		container.erase(2);
+
+		container.insert_at(1, 11);
+		container.insert_at(2, 21);
+
+			for (size_t id = 0; id < 5; ++id) { ASSERT_TRUE(container.has_value(id)); }
+		EXPECT_EQ(container.at(0), 0);
+		EXPECT_EQ(container.at(1), 11);
+		EXPECT_EQ(container.at(2), 21);
+		EXPECT_EQ(container.at(3), 30);
+		EXPECT_EQ(container.at(4), 40);
+			for (auto it = container.begin(); it != container.end(); ++it) {
+				EXPECT_EQ(&container.at(container.get_id(it)), &*it);
+			}
+	}
+
+	TEST_F(StableVectorTest, PmrAllocatorReachesEveryStorage) {
+		check_pmr_allocator_reaches_every_storage([](std::pmr::memory_resource* resource) {
+			mstd::pmr::stable_vector<int> pmrVector(resource);
+				for (int i = 0; i != 100; ++i) { pmrVector.push_back(i); }
+			pmrVector.erase(5);
+			pmrVector.insert_at(200, 7);
+			EXPECT_EQ(pmrVector.active_slots(), 100);
+			EXPECT_EQ(pmrVector.at(200), 7);
+			EXPECT_EQ(pmrVector.get_allocator().resource(), resource);
+		});
+	}
+} // namespace mstd::test
@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <random>
+
+namespace mstd::test {
+	class BvhTest : public ::testing::Test {
+	protected:
+		static std::vector<aabb3> random_boxes(size_t count, uint32_t seed, float range = 100.f) {
+			std::mt19937 gen(seed);
+			std::uniform_real_distribution<float> pos(-range, range);
+			std::uniform_real_distribution<float> size(0.1f, 3.f);
+
+			std::vector<aabb3> res(count);
+				for (aabb3& box : res) {
+					box = aabb3::from_center(vec3(pos(gen), pos(gen), pos(gen)), vec3(size(gen), size(gen), size(gen)));
+				}
+			return res;
+		}
+	};
+
+	// every node bounds its children and primitives, leaves cover every primitive once and the depth fits the stack
+	static void check_bvh(const bvh<>& tree, const std::vector<aabb3>& boxes) {
+		ASSERT_EQ(tree.size(), boxes.size());
+			if (boxes.empty()) {
+				ASSERT_TRUE(tree.nodes().empty());
+				return;
+			}
+
+		std::vector<size_t> seen(boxes.size(), 0);
+		std::vector<std::pair<uint32_t, size_t> > stack = { { 0u, 1u } };
+			while (!stack.empty()) {
+				const auto [idx, depth] = stack.back();
+				stack.pop_back();
+				ASSERT_LE(depth, bvh<>::max_depth);
+
+				const auto& node = tree.nodes()[idx];
+					if (node.is_leaf()) {
+						ASSERT_LE(node.count, bvh<>::max_leaf_size);
+							for (uint32_t p = node.offset; p != node.offset + node.count; ++p) {
+								const uint32_t primitive = tree.indices()[p];
+								++seen[primitive];
+								ASSERT_TRUE(node.bounds().contains(boxes[primitive]));
+							}
+						continue;
+					}
+
+				ASSERT_LT(node.offset, tree.nodes().size());
+				ASSERT_TRUE(node.bounds().contains(tree.nodes()[idx + 1].bounds()));
+				ASSERT_TRUE(node.bounds().contains(tree.nodes()[node.offset].bounds()));
+				stack.push_back({ idx + 1, depth + 1 });
+				stack.push_back({ node.offset, depth + 1 });
+			}
+			for (const size_t count : seen) { ASSERT_EQ(count, 1u); }
+	}
+
+	// closest box hit along r, npos when there is none
+	static size_t brute_force_raycast(const std::vector<aabb3>& boxes, const ray<>& r, float& t) {
+		size_t res = bvh<>::npos;
+			for (size_t i = 0; i != boxes.size(); ++i) {
+				float tNear = 0.f;
+				float tFar	= 0.f;
+					if (r.intersects(boxes[i], tNear, tFar) && tNear < t) {
+						t	= tNear;
+						res = i;
+					}
+			}
+		return res;
+	}
+
+	static void check_bvh_queries(const bvh<>& tree, const std::vector<aabb3>& boxes, uint32_t seed) {
+		std::mt19937 gen(seed);
+		std::uniform_real_distribution<float> pos(-120.f, 120.f);
+		std::uniform_real_distribution<float> dir(-1.f, 1.f);
+		std::uniform_real_distribution<float> size(0.f, 20.f);
+
+			for (size_t i = 0; i != 200; ++i) {
+				const ray<> r(vec3(pos(gen), pos(gen), pos(gen)), vec3(dir(gen), dir(gen), dir(gen)));
+				float expectedT			= std::numeric_limits<float>::infinity();
+				const size_t expected	= brute_force_raycast(boxes, r, expectedT);
+
+				float t			 = std::numeric_limits<float>::infinity();
+				const size_t hit = tree.raycast(r, t, [&boxes, &r](size_t primitive, float& closest) {
+					float tNear = 0.f;
+					float tFar	= 0.f;
+						if (r.intersects(boxes[primitive], tNear, tFar) && tNear < closest) {
+							closest = tNear;
+							return true;
+						}
+					return false;
+				});
+				EXPECT_EQ(hit == bvh<>::npos, expected == bvh<>::npos);
+				EXPECT_EQ(t, expectedT);
+
+				const aabb3 area = aabb3::from_center(vec3(pos(gen), pos(gen), pos(gen)), vec3(size(gen), size(gen), size(gen)));
+				std::vector<size_t> found;
+				tree.query(area, [&boxes, &area, &found](size_t primitive) {
+						if (boxes[primitive].intersects(area)) { found.push_back(primitive); }
+				});
+				std::sort(found.begin(), found.end());
+				std::vector<size_t> expectedFound;
+					for (size_t b = 0; b != boxes.size(); ++b) {
+							if (boxes[b].intersects(area)) { expectedFound.push_back(b); }
+					}
+				EXPECT_EQ(found, expectedFound);
+
+				const vec3 point(pos(gen), pos(gen), pos(gen));
+				float expectedDistance = std::numeric_limits<float>::infinity();
+					for (const aabb3& box : boxes) { expectedDistance = std::min(expectedDistance, box.distance_squared(point)); }
+				float distance			= std::numeric_limits<float>::infinity();
+				const size_t nearest	= tree.nearest(point, distance,
+					 [&boxes, &point](size_t primitive) { return boxes[primitive].distance_squared(point); });
+					if (boxes.empty()) { EXPECT_EQ(nearest, bvh<>::npos); }
+					else {
+						ASSERT_NE(nearest, bvh<>::npos);
+						EXPECT_EQ(distance, expectedDistance);
+						EXPECT_EQ(boxes[nearest].distance_squared(point), expectedDistance);
+					}
+			}
+	}
+
+	TEST(SPATIAL_TESTS_BVH, EMPTY) {
+		bvh<> tree;
+		EXPECT_TRUE(tree.empty());
+		EXPECT_TRUE(tree.bounds().empty());
+
+		float t = 10.f;
+		EXPECT_EQ(tree.raycast(ray<>(vec3(), vec3(1.f, 0.f, 0.f)), t, [](size_t, float&) { return true; }), bvh<>::npos);
+		EXPECT_EQ(t, 10.f);
+
+		size_t calls = 0;
+		tree.query(aabb3(vec3(-1.f, -1.f, -1.f), vec3(1.f, 1.f, 1.f)), [&calls](size_t) { ++calls; });
+		EXPECT_EQ(calls, 0u);
+
+		tree.build(std::vector<aabb3>());
+		check_bvh(tree, {});
+	}
+
+	TEST_F(BvhTest, BUILD) {
+		const size_t counts[] = { 1, 2, 7, 9, 100, 5000 };
+			for (const size_t count : counts) {
+				const std::vector<aabb3> boxes = random_boxes(count, static_cast<uint32_t>(count));
+				const bvh<> tree(boxes);
+				check_bvh(tree, boxes);
+
+				aabb3 all;
+					for (const aabb3& box : boxes) { all.expand(box); }
+				EXPECT_EQ(tree.bounds(), all);
+			}
+	}
+
+	TEST_F(BvhTest, QUERIES) {
+		const std::vector<aabb3> boxes = random_boxes(3000, 5);
+		const bvh<> tree(boxes);
+		check_bvh_queries(tree, boxes, 17);
+
+		// a ray starting inside a box hits it at 0, a limited t keeps the far boxes out
+		const ray<> inside(boxes[42].center(), vec3(0.f, 1.f, 0.f));
+		float t			 = std::numeric_limits<float>::infinity();
+		const size_t hit = tree.raycast(inside, t, [](size_t primitive, float& closest) {
+				if (primitive != 42) { return false; }
+			closest = 0.f;
+			return true;
+		});
+		EXPECT_EQ(hit, 42u);
+		EXPECT_EQ(t, 0.f);
+
+		const ray<> outside(vec3(500.f, 0.f, 0.f), vec3(-1.f, 0.f, 0.f));
+		float limited = 1e-3f;
+		EXPECT_EQ(tree.raycast(outside, limited, [](size_t, float&) { return true; }), bvh<>::npos);
+	}
+
+	TEST_F(BvhTest, PARALLEL_BUILD) {
+		const std::vector<aabb3> boxes = random_boxes(100000, 3, 1000.f);
+		const bvh<> single(boxes, 1);
+		const bvh<> parallel(boxes, 4);
+		check_bvh(parallel, boxes);
+
+		// the same tree whatever the number of threads
+		ASSERT_EQ(single.nodes().size(), parallel.nodes().size());
+		EXPECT_EQ(single.indices(), parallel.indices());
+			for (size_t i = 0; i != single.nodes().size(); ++i) {
+				EXPECT_EQ(single.nodes()[i].bounds(), parallel.nodes()[i].bounds());
+				EXPECT_EQ(single.nodes()[i].offset, parallel.nodes()[i].offset);
+				EXPECT_EQ(single.nodes()[i].count, parallel.nodes()[i].count);
+			}
+		check_bvh_queries(parallel, boxes, 23);
+	}
+
+	TEST_F(BvhTest, REFIT) {
+		std::vector<aabb3> boxes = random_boxes(2000, 9);
+		bvh<> tree(boxes);
+
+		std::mt19937 gen(1);
+		std::uniform_real_distribution<float> offset(-5.f, 5.f);
+			for (aabb3& box : boxes) {
+				const vec3 move(offset(gen), offset(gen), offset(gen));
+				box = aabb3(box.min + move, box.max + move);
+			}
+		tree.refit(boxes);
+		check_bvh(tree, boxes);
+		check_bvh_queries(tree, boxes, 31);
+	}
+
+	TEST(SPATIAL_TESTS_BVH, DEGENERATE) {
+		// one centroid for every primitive and primitives on a line, neither may break the depth limit
+		const std::vector<aabb3> same(10000, aabb3(vec3(0.f, 0.f, 0.f), vec3(1.f, 1.f, 1.f)));
+		const bvh<> sameTree(same);
+		check_bvh(sameTree, same);
+
+		std::vector<aabb3> line(10000);
+			for (size_t i = 0; i != line.size(); ++i) {
+				const float x = std::ldexp(1.f, static_cast<int>(i % 100)) + static_cast<float>(i);
+				line[i]		  = aabb3(vec3(x, 0.f, 0.f), vec3(x, 0.f, 0.f));
+			}
+		const bvh<> lineTree(line);
+		check_bvh(lineTree, line);
+
+		size_t calls = 0;
+		sameTree.query(aabb3(vec3(0.5f, 0.5f, 0.5f), vec3(2.f, 2.f, 2.f)), [&calls](size_t) { ++calls; });
+		EXPECT_EQ(calls, same.size());
+	}
+
+	TEST_F(BvhTest, DOUBLE) {
+		std::vector<daabb3> boxes;
+			for (const aabb3& box : random_boxes(500, 4)) { boxes.push_back(daabb3(dvec3(box.min), dvec3(box.max))); }
+		const dbvh tree(boxes);
+
+		const dvec3 point(1.0, 2.0, 3.0);
+		double distance = std::numeric_limits<double>::infinity();
+		const size_t nearest =
+		  tree.nearest(point, distance, [&boxes, &point](size_t primitive) { return boxes[primitive].distance_squared(point); });
+		ASSERT_NE(nearest, dbvh::npos);
+			for (const daabb3& box : boxes) { EXPECT_GE(box.distance_squared(point), distance); }
+	}
+} // namespace mstd::test
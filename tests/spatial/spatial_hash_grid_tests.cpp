@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <pch.hpp>
+#include <random>
+
+namespace mstd::test {
+	// every point once, in the bucket of its cell and in build order within the bucket
+	template<size_t N, class T>
+	static void check_grid(const spatial_hash_grid<N, T>& grid, const std::vector<vec<N, T> >& points) {
+		ASSERT_EQ(grid.size(), points.size());
+		ASSERT_EQ(grid.indices().size(), points.size());
+
+		std::vector<size_t> seen(points.size(), 0);
+			for (size_t b = 0; b != grid.bucket_count(); ++b) {
+					for (size_t p = grid.bucket_first(b); p != grid.bucket_last(b); ++p) {
+						const uint32_t index = grid.indices()[p];
+						++seen[index];
+						ASSERT_EQ(grid.points()[p], points[index]);
+						ASSERT_EQ(grid.bucket_of(grid.cell_of(points[index])), b);
+							if (p != grid.bucket_first(b)) { ASSERT_LT(grid.indices()[p - 1], index); }
+					}
+			}
+		ASSERT_EQ(grid.bucket_last(grid.bucket_count() - 1), points.size());
+			for (const size_t count : seen) { ASSERT_EQ(count, 1u); }
+	}
+
+	template<size_t N, class T>
+	static void check_grid_radius(const spatial_hash_grid<N, T>& grid, const std::vector<vec<N, T> >& points, uint32_t seed) {
+		std::mt19937 gen(seed);
+		std::uniform_real_distribution<T> pos(static_cast<T>(-110), static_cast<T>(110));
+		const T radii[] = { static_cast<T>(0.5), static_cast<T>(2), static_cast<T>(5), static_cast<T>(30) };
+
+			for (size_t q = 0; q != 100; ++q) {
+				vec<N, T> center;
+					for (size_t i = 0; i != N; ++i) { center[i] = pos(gen); }
+				const T radius = radii[q % 4];
+
+				std::vector<size_t> found;
+				grid.query_radius(center, radius, [&points, &center, &found](size_t index, T distanceSquared) {
+					T expected = static_cast<T>(0);
+						for (size_t i = 0; i != N; ++i) {
+							const T diff = points[index][i] - center[i];
+							expected	+= diff * diff;
+						}
+					EXPECT_EQ(distanceSquared, expected);
+					found.push_back(index);
+				});
+				std::sort(found.begin(), found.end());
+
+				std::vector<size_t> expectedFound;
+					for (size_t p = 0; p != points.size(); ++p) {
+						T distanceSquared = static_cast<T>(0);
+							for (size_t i = 0; i != N; ++i) {
+								const T diff	 = points[p][i] - center[i];
+								distanceSquared += diff * diff;
+							}
+							if (distanceSquared <= radius * radius) { expectedFound.push_back(p); }
+					}
+				EXPECT_EQ(found, expectedFound);
+			}
+	}
+
+	class SpatialHashGridTest : public ::testing::Test {
+	protected:
+		template<size_t N, class T>
+		static std::vector<vec<N, T> > random_points(size_t count, uint32_t seed, T range = static_cast<T>(100)) {
+			std::mt19937 gen(seed);
+			std::uniform_real_distribution<T> pos(-range, range);
+
+			std::vector<vec<N, T> > res(count);
+				for (vec<N, T>& point : res) {
+						for (size_t i = 0; i != N; ++i) { point[i] = pos(gen); }
+				}
+			return res;
+		}
+	};
+
+	TEST(SPATIAL_TESTS_SPATIAL_HASH_GRID, EMPTY) {
+		spatial_hash_grid3 grid(2.f);
+		EXPECT_TRUE(grid.empty());
+		EXPECT_EQ(grid.bucket_count(), 0u);
+
+		size_t calls = 0;
+		grid.query_radius(vec3(), 10.f, [&calls](size_t, float) { ++calls; });
+		EXPECT_EQ(calls, 0u);
+		EXPECT_EQ(grid.bucket_of(ivec3(1, -2, 3)), 0u);
+
+		// a default constructed grid has no buckets either
+		const spatial_hash_grid2 unbuilt;
+		EXPECT_EQ(unbuilt.bucket_count(), 0u);
+		EXPECT_EQ(unbuilt.bucket_of(unbuilt.cell_of(vec2(5.f, -7.f))), 0u);
+		unbuilt.query_radius(vec2(), 10.f, [&calls](size_t, float) { ++calls; });
+		EXPECT_EQ(calls, 0u);
+
+		grid.rebuild(std::vector<vec3>());
+		EXPECT_TRUE(grid.empty());
+		grid.for_each_in_cells(ivec3(-5, -5, -5), ivec3(5, 5, 5), [&calls](size_t, const vec3&) { ++calls; });
+		EXPECT_EQ(calls, 0u);
+	}
+
+	TEST_F(SpatialHashGridTest, REBUILD) {
+		const size_t counts[] = { 1, 2, 100, 5000 };
+		spatial_hash_grid3 grid(4.f);
+			for (const size_t count : counts) {
+				const std::vector<vec3> points = random_points<3, float>(count, static_cast<uint32_t>(count));
+				grid.rebuild(points);
+				check_grid(grid, points);
+				EXPECT_GE(grid.bucket_count(), count);
+			}
+
+		// a fixed bucket count is rounded up to a power of two and kept for every rebuild
+		spatial_hash_grid3 fixed(4.f, 100);
+		const std::vector<vec3> points = random_points<3, float>(5000, 8);
+		fixed.rebuild(points);
+		EXPECT_EQ(fixed.bucket_count(), 128u);
+		check_grid(fixed, points);
+
+		EXPECT_EQ(fixed.cell_of(vec3(-0.5f, 3.9f, 4.f)), ivec3(-1, 0, 1));
+	}
+
+	TEST_F(SpatialHashGridTest, RADIUS_QUERY) {
+		const std::vector<vec3> points = random_points<3, float>(4000, 5);
+		spatial_hash_grid3 grid(2.f);
+		grid.rebuild(points);
+		check_grid_radius(grid, points, 17);
+
+		// with few buckets most of them are shared by many cells
+		spatial_hash_grid3 crowded(2.f, 8);
+		crowded.rebuild(points);
+		check_grid_radius(crowded, points, 19);
+
+		const std::vector<dvec2> points2 = random_points<2, double>(4000, 6);
+		dspatial_hash_grid2 grid2(3.0);
+		grid2.rebuild(points2);
+		check_grid(grid2, points2);
+		check_grid_radius(grid2, points2, 23);
+	}
+
+	TEST_F(SpatialHashGridTest, CELL_RANGE) {
+		const std::vector<vec2> points = random_points<2, float>(3000, 9, 20.f);
+		spatial_hash_grid2 grid(1.f, 16);
+		grid.rebuild(points);
+
+		// small ranges may report points of cells sharing a bucket, big ones only the points in range
+		const ivec2 ranges[][2] = { { ivec2(-3, -2), ivec2(2, 4) }, { ivec2(-15, -15), ivec2(15, 15) } };
+			for (const auto& range : ranges) {
+				const ivec2& minCell = range[0];
+				const ivec2& maxCell = range[1];
+				std::vector<size_t> seen(points.size(), 0);
+				grid.for_each_in_cells(minCell, maxCell, [&points, &seen](size_t index, const vec2& point) {
+					EXPECT_EQ(point, points[index]);
+					++seen[index];
+				});
+
+				const bool big = (maxCell[0] - minCell[0] + 1) * (maxCell[1] - minCell[1] + 1) > 64;
+					for (size_t p = 0; p != points.size(); ++p) {
+						const ivec2 cell = grid.cell_of(points[p]);
+						const bool in	 = cell[0] >= minCell[0] && cell[0] <= maxCell[0] && cell[1] >= minCell[1]
+										&& cell[1] <= maxCell[1];
+						EXPECT_LE(seen[p], 1u);
+							if (in || big) { EXPECT_EQ(seen[p], in ? 1u : 0u); }
+					}
+			}
+
+		size_t calls = 0;
+		grid.for_each_in_cell(grid.cell_of(points[7]), [&calls](size_t index, const vec2&) { calls += index == 7; });
+		EXPECT_EQ(calls, 1u);
+	}
+
+	TEST(SPATIAL_TESTS_SPATIAL_HASH_GRID, HUGE_COORDINATES) {
+		// cells past the int32_t range clamp to its ends
+		const std::vector<vec2> points = { vec2(1e30f, -1e30f), vec2(3e9f, 0.f), vec2(-3e9f, 0.5f), vec2(0.5f, 0.5f) };
+		spatial_hash_grid2 grid(1.f);
+		grid.rebuild(points);
+		check_grid(grid, points);
+
+		constexpr int32_t lo = std::numeric_limits<int32_t>::min();
+		constexpr int32_t hi = std::numeric_limits<int32_t>::max();
+		EXPECT_EQ(grid.cell_of(points[0]), ivec2(hi, lo));
+		EXPECT_EQ(grid.cell_of(points[1]), ivec2(hi, 0));
+		EXPECT_EQ(grid.cell_of(points[2]), ivec2(lo, 0));
+
+		std::vector<size_t> found;
+		grid.query_radius(vec2(3e9f, 0.f), 1.f, [&found](size_t index, float) { found.push_back(index); });
+		EXPECT_EQ(found, std::vector<size_t>({ 1 }));
+	}
+
+	TEST_F(SpatialHashGridTest, PARALLEL_REBUILD) {
+		const std::vector<vec3> points = random_points<3, float>(200000, 3, 500.f);
+		spatial_hash_grid3 single(5.f);
+		spatial_hash_grid3 parallel(5.f);
+		single.rebuild(points, 1);
+		parallel.rebuild(points, 4);
+		check_grid(parallel, points);
+
+		// the same arrays whatever the number of threads
+		EXPECT_EQ(single.indices(), parallel.indices());
+		ASSERT_EQ(single.bucket_count(), parallel.bucket_count());
+			for (size_t b = 0; b != single.bucket_count(); ++b) { ASSERT_EQ(single.bucket_first(b), parallel.bucket_first(b)); }
+		check_grid_radius(parallel, points, 29);
+	}
+} // namespace mstd::test